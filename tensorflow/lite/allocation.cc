@@ -17,10 +17,12 @@ limitations under the License.
 
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <algorithm>
 #include <cassert>
 #include <cstdarg>
 #include <cstdint>
 #include <cstring>
+#include <new>
 #include <utility>
 
 #include "tensorflow/lite/c/c_api_internal.h"
@@ -89,4 +91,88 @@ size_t MemoryAllocation::bytes() const { return buffer_size_bytes_; }
 
 bool MemoryAllocation::valid() const { return buffer_ != nullptr; }
 
+namespace {
+// The alignment of the buffers in a model, so that their data can be used in
+// place.
+constexpr size_t kStreamingAlignment = 16;
+// The most bytes asked from the reader at once.
+constexpr size_t kStreamingChunkBytes = 64 * 1024;
+}  // namespace
+
+StreamingAllocation::StreamingAllocation(StreamReader* reader,
+                                         size_t expected_bytes,
+                                         const Check& check,
+                                         ErrorReporter* error_reporter)
+    : Allocation(error_reporter) {
+  // Ask for one more byte than expected, to tell if the stream is longer.
+  if (!Reserve(expected_bytes ? expected_bytes + 1 : kStreamingChunkBytes)) {
+    return;
+  }
+  while (true) {
+    if (buffer_size_bytes_ == capacity_ && !Reserve(2 * capacity_)) {
+      return;
+    }
+    const int64_t bytes_read =
+        reader->Read(buffer_ + buffer_size_bytes_,
+                     std::min(capacity_ - buffer_size_bytes_,
+                              kStreamingChunkBytes));
+    if (bytes_read < 0) {
+      error_reporter_->Report("Read of the stream failed.");
+      return;
+    }
+    if (bytes_read == 0) break;
+    buffer_size_bytes_ += bytes_read;
+    if (expected_bytes && buffer_size_bytes_ > expected_bytes) {
+      error_reporter_->Report("The stream is longer than %zu bytes.",
+                              expected_bytes);
+      return;
+    }
+    if (check && !check(buffer_, buffer_size_bytes_)) {
+      return;
+    }
+  }
+  if (expected_bytes && buffer_size_bytes_ != expected_bytes) {
+    error_reporter_->Report("Read %zu bytes from a stream of %zu bytes.",
+                            buffer_size_bytes_, expected_bytes);
+    return;
+  }
+  // The buffer of a stream of unknown size grew by doubling, so up to half of
+  // it is unused. It is kept for as long as the model, so trim it, at the
+  // cost of one last copy. Should that fail, the larger buffer is still fine.
+  if (!expected_bytes && capacity_ > buffer_size_bytes_) {
+    Reserve(buffer_size_bytes_);
+  }
+  valid_ = true;
+}
+
+StreamingAllocation::~StreamingAllocation() {}
+
+bool StreamingAllocation::Reserve(size_t capacity) {
+  std::unique_ptr<char[]> allocated_buffer(
+      new (std::nothrow) char[capacity + kStreamingAlignment - 1]);
+  if (!allocated_buffer) {
+    error_reporter_->Report("Malloc of buffer to hold the stream failed.");
+    return false;
+  }
+  const uintptr_t address =
+      reinterpret_cast<uintptr_t>(allocated_buffer.get());
+  char* buffer =
+      allocated_buffer.get() +
+      (kStreamingAlignment - address % kStreamingAlignment) %
+          kStreamingAlignment;
+  if (buffer_size_bytes_) {
+    memcpy(buffer, buffer_, buffer_size_bytes_);
+  }
+  allocated_buffer_ = std::move(allocated_buffer);
+  buffer_ = buffer;
+  capacity_ = capacity;
+  return true;
+}
+
+const void* StreamingAllocation::base() const { return buffer_; }
+
+size_t StreamingAllocation::bytes() const { return buffer_size_bytes_; }
+
+bool StreamingAllocation::valid() const { return valid_; }
+
 }  // namespace tflite
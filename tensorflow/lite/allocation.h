@@ -17,8 +17,11 @@ limitations under the License.
 #ifndef TENSORFLOW_LITE_ALLOCATION_H_
 #define TENSORFLOW_LITE_ALLOCATION_H_
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <functional>
+#include <memory>
 #include <vector>
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/core/api/error_reporter.h"
@@ -40,6 +43,31 @@ class Allocation {
   // Whether the allocation is valid
   virtual bool valid() const = 0;
 
+  // How a range of the allocation is about to be accessed.
+  enum class Advice {
+    kNormal,
+    // Read once in order, e.g. while preparing the model, so it is worth
+    // reading ahead aggressively and dropping the pages once read.
+    kSequential,
+    // Read in no particular order, so reading ahead is wasted.
+    kRandom,
+    // Read soon, so it is worth starting to page it in now.
+    kWillNeed,
+  };
+
+  // Passes `advice` on the `bytes` bytes at `ptr`, which must be within the
+  // allocation, to the system so it can tune the paging of allocations backed
+  // by a file. Returns false if the advice was not taken, which is harmless.
+  virtual bool Advise(Advice advice, const void* ptr, size_t bytes) const {
+    return false;
+  }
+
+  // Locks the pages holding the `bytes` bytes at `ptr`, which must be within
+  // the allocation, in memory until the allocation is destroyed, so that hot
+  // weights are never paged out. Returns false on failure, e.g. when over the
+  // limit of locked memory of the process.
+  virtual bool Lock(const void* ptr, size_t bytes) const { return false; }
+
  protected:
   ErrorReporter* error_reporter_;
 };
@@ -51,6 +79,8 @@ class MMAPAllocation : public Allocation {
   const void* base() const override;
   size_t bytes() const override;
   bool valid() const override;
+  bool Advise(Advice advice, const void* ptr, size_t bytes) const override;
+  bool Lock(const void* ptr, size_t bytes) const override;
 
   static bool IsSupported();
 
@@ -92,6 +122,44 @@ class MemoryAllocation : public Allocation {
   size_t buffer_size_bytes_ = 0;
 };
 
+// A source of bytes that can only be read in order, e.g. a pipe or a download.
+class StreamReader {
+ public:
+  virtual ~StreamReader() {}
+
+  // Reads up to `bytes` bytes into `dst`. Returns the number of bytes read,
+  // 0 at the end of the stream, or a negative number on error.
+  virtual int64_t Read(void* dst, size_t bytes) = 0;
+};
+
+class StreamingAllocation : public Allocation {
+ public:
+  // Called with the bytes received so far after each read. Returns false to
+  // stop reading, e.g. as soon as the stream is known not to be a model.
+  using Check = std::function<bool(const char* data, size_t bytes)>;
+
+  // Reads all of `reader` straight into a single buffer, aligned like the
+  // buffers of a model. `expected_bytes` is the size of the stream if known,
+  // so that the buffer is allocated once, or 0 to grow it as needed and copy
+  // it once more into a buffer of the final size at the end.
+  StreamingAllocation(StreamReader* reader, size_t expected_bytes,
+                      const Check& check, ErrorReporter* error_reporter);
+  virtual ~StreamingAllocation();
+  const void* base() const override;
+  size_t bytes() const override;
+  bool valid() const override;
+
+ private:
+  // Reallocates the buffer to `capacity` bytes, keeping the bytes received.
+  bool Reserve(size_t capacity);
+
+  std::unique_ptr<char[]> allocated_buffer_;
+  char* buffer_ = nullptr;
+  size_t capacity_ = 0;
+  size_t buffer_size_bytes_ = 0;
+  bool valid_ = false;
+};
+
 }  // namespace tflite
 
 #endif  // TENSORFLOW_LITE_ALLOCATION_H_
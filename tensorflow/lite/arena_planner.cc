@@ -13,9 +13,127 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 #include "tensorflow/lite/arena_planner.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
 #include <utility>
 
 namespace tflite {
+namespace {
+
+bool LessOrEqual(const SymbolicSize& a, const SymbolicSize& b) {
+  for (int i = 0; i < 3; ++i) {
+    if (a.coefficients[i] > b.coefficients[i]) return false;
+  }
+  return true;
+}
+
+SymbolicSize Add(const SymbolicSize& a, const SymbolicSize& b) {
+  SymbolicSize sum;
+  for (int i = 0; i < 3; ++i) {
+    sum.coefficients[i] = a.coefficients[i] + b.coefficients[i];
+  }
+  return sum;
+}
+
+SymbolicSize Max(const SymbolicSize& a, const SymbolicSize& b) {
+  SymbolicSize max;
+  for (int i = 0; i < 3; ++i) {
+    max.coefficients[i] = std::max(a.coefficients[i], b.coefficients[i]);
+  }
+  return max;
+}
+
+// Finds the polynomial of degree at most 2, with non-negative integer
+// coefficients, that goes through `points`, two or three (extent, size) pairs
+// of distinct extents. Returns false if there is none.
+bool FitPolynomial(const std::vector<std::pair<int64_t, int64_t>>& points,
+                   SymbolicSize* size) {
+  // Newton's divided differences, which are integers for integer
+  // polynomials.
+  const int64_t x0 = points[0].first, y0 = points[0].second;
+  const int64_t x1 = points[1].first, y1 = points[1].second;
+  if ((y1 - y0) % (x1 - x0) != 0) return false;
+  const int64_t d01 = (y1 - y0) / (x1 - x0);
+  int64_t d012 = 0;
+  if (points.size() == 3) {
+    const int64_t x2 = points[2].first, y2 = points[2].second;
+    if ((y2 - y1) % (x2 - x1) != 0) return false;
+    const int64_t d12 = (y2 - y1) / (x2 - x1);
+    if ((d12 - d01) % (x2 - x0) != 0) return false;
+    d012 = (d12 - d01) / (x2 - x0);
+  }
+  const int64_t coefficients[3] = {y0 - d01 * x0 + d012 * x0 * x1,
+                                   d01 - d012 * (x0 + x1), d012};
+  for (int i = 0; i < 3; ++i) {
+    if (coefficients[i] < 0) return false;
+    size->coefficients[i] = coefficients[i];
+  }
+  return true;
+}
+
+// Places allocations whose sizes depend on the extent so that no two live
+// allocations overlap whatever the extent: each one goes either below or
+// above each live allocation, coefficient by coefficient. Among the valid
+// offsets, the start of the arena or the end of a live allocation, it picks
+// the lowest for `reference_extent`.
+class SymbolicArena {
+ public:
+  explicit SymbolicArena(size_t reference_extent)
+      : reference_extent_(reference_extent) {}
+
+  SymbolicSize Allocate(int tensor, const SymbolicSize& size) {
+    if (LessOrEqual(size, SymbolicSize())) {
+      return SymbolicSize();
+    }
+    // Above all the live allocations is always valid.
+    SymbolicSize best_offset = size_;
+    auto try_offset = [&](const SymbolicSize& offset) {
+      if (offset.Evaluate(reference_extent_) >=
+          best_offset.Evaluate(reference_extent_)) {
+        return;
+      }
+      const SymbolicSize end = Add(offset, size);
+      for (const Alloc& alloc : live_) {
+        if (!LessOrEqual(end, alloc.offset) &&
+            !LessOrEqual(alloc.end, offset)) {
+          return;
+        }
+      }
+      best_offset = offset;
+    };
+    try_offset(SymbolicSize());
+    for (const Alloc& alloc : live_) {
+      try_offset(alloc.end);
+    }
+    live_.push_back({tensor, best_offset, Add(best_offset, size)});
+    size_ = Max(size_, live_.back().end);
+    return best_offset;
+  }
+
+  void Deallocate(int tensor) {
+    for (auto it = live_.begin(); it != live_.end(); ++it) {
+      if (it->tensor == tensor) {
+        live_.erase(it);
+        return;
+      }
+    }
+  }
+
+ private:
+  struct Alloc {
+    int tensor;
+    SymbolicSize offset;
+    SymbolicSize end;
+  };
+
+  const size_t reference_extent_;
+  std::vector<Alloc> live_;
+  // At least the end of every live or past allocation.
+  SymbolicSize size_;
+};
+
+}  // namespace
 
 struct AllocationInfo {
   // The node index requesting this allocation.
@@ -64,8 +182,12 @@ TfLiteStatus ArenaPlanner::PlanAllocations() {
   // Invalidate any existing data.
   TF_LITE_ENSURE_STATUS(ResetAllocations());
   // The alloc_queue_ is specific to the graph topology, and will be
-  // completely reconstructed from graph data here.
+  // completely reconstructed from graph data here. So are symbolic plans.
   alloc_queue_.clear();
+  recorded_types_.clear();
+  recorded_sizes_.clear();
+  symbolic_offsets_.clear();
+  symbolic_sizes_.clear();
 
   // Keeps track of references to each tensor.
   std::vector<int> refcounts(graph_info_->num_tensors(), 0);
@@ -204,6 +326,185 @@ TfLiteStatus ArenaPlanner::ExecuteAllocations(int first_node, int last_node) {
   return kTfLiteOk;
 }
 
+void ArenaPlanner::GetPlan(ArenaPlan* plan) const {
+  plan->arena_size = arena_.high_water_mark();
+  plan->persistent_arena_size = persistent_arena_.high_water_mark();
+  plan->allocs = allocs_;
+}
+
+TfLiteStatus ArenaPlanner::ExecutePlan(const ArenaPlan& plan) {
+  TF_LITE_ENSURE_EQ(context_, plan.allocs.size(), graph_info_->num_tensors());
+  // Plans may come from files, so the sizes of the arenas are derived from
+  // the allocations rather than trusted. They must leave room for the padding
+  // SimpleMemoryArena adds when committing.
+  const size_t max_arena_size =
+      std::numeric_limits<size_t>::max() - 2 * kDefaultArenaAlignment;
+  size_t arena_size = 0;
+  size_t persistent_arena_size = 0;
+  for (int i = 0; i < graph_info_->num_tensors(); ++i) {
+    const TfLiteTensor& tensor = *graph_info_->tensor(i);
+    const ArenaAlloc& alloc = plan.allocs[i];
+    if (tensor.allocation_type == kTfLiteArenaRw ||
+        tensor.allocation_type == kTfLiteArenaRwPersistent) {
+      TF_LITE_ENSURE_EQ(context_, alloc.size, tensor.bytes);
+      TF_LITE_ENSURE(context_, alloc.offset % tensor_alignment_ == 0);
+      TF_LITE_ENSURE(context_, alloc.offset <= max_arena_size &&
+                                   alloc.size <= max_arena_size - alloc.offset);
+      size_t& size = tensor.allocation_type == kTfLiteArenaRw
+                         ? arena_size
+                         : persistent_arena_size;
+      size = std::max(size, alloc.offset + alloc.size);
+    }
+  }
+  allocs_ = plan.allocs;
+  // The arenas do not track the individual allocations of the plan. That is
+  // fine as long as the whole graph is allocated at once, which is the case
+  // without dynamic tensors.
+  arena_.Reserve(arena_size);
+  persistent_arena_.Reserve(persistent_arena_size);
+  TF_LITE_ENSURE_STATUS(Commit());
+
+  for (int i = 0; i < graph_info_->num_tensors(); ++i) {
+    TF_LITE_ENSURE_STATUS(ResolveTensorAllocation(i));
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus ArenaPlanner::RecordExtent(size_t extent) {
+  const size_t num_tensors = graph_info_->num_tensors();
+  TF_LITE_ENSURE_EQ(context_, allocs_.size(), num_tensors);
+  std::vector<TfLiteAllocationType> types(num_tensors);
+  std::vector<size_t> sizes(num_tensors);
+  for (int i = 0; i < num_tensors; ++i) {
+    types[i] = graph_info_->tensor(i)->allocation_type;
+    sizes[i] = allocs_[i].size;
+  }
+  if (types != recorded_types_) {
+    recorded_types_ = std::move(types);
+    recorded_sizes_.clear();
+  }
+  for (auto it = recorded_sizes_.begin(); it != recorded_sizes_.end(); ++it) {
+    if (it->first == extent) {
+      recorded_sizes_.erase(it);
+      break;
+    }
+  }
+  recorded_sizes_.emplace_back(extent, std::move(sizes));
+  if (recorded_sizes_.size() > 3) {
+    recorded_sizes_.erase(recorded_sizes_.begin());
+  }
+
+  symbolic_offsets_.clear();
+  symbolic_sizes_.clear();
+  if (recorded_sizes_.size() < 2) {
+    return kTfLiteOk;
+  }
+  std::vector<SymbolicSize> symbolic_sizes(num_tensors);
+  for (int i = 0; i < num_tensors; ++i) {
+    // Try a quadratic through the last three extents, then a linear function
+    // through the last two, in case the earliest was sized differently.
+    bool fits = false;
+    for (int num_points = recorded_sizes_.size(); !fits && num_points >= 2;
+         --num_points) {
+      std::vector<std::pair<int64_t, int64_t>> points;
+      for (int j = recorded_sizes_.size() - num_points;
+           j < recorded_sizes_.size(); ++j) {
+        points.emplace_back(recorded_sizes_[j].first,
+                            recorded_sizes_[j].second[i]);
+      }
+      fits = FitPolynomial(points, &symbolic_sizes[i]);
+    }
+    if (!fits) {
+      return kTfLiteOk;
+    }
+    // Aligned coefficients keep all the offsets aligned.
+    for (size_t& coefficient : symbolic_sizes[i].coefficients) {
+      coefficient = (coefficient + tensor_alignment_ - 1) / tensor_alignment_ *
+                    tensor_alignment_;
+    }
+  }
+
+  // Replay the allocations of CalculateAllocations() for the whole graph.
+  std::vector<SymbolicSize> symbolic_offsets(num_tensors);
+  SymbolicArena arena(extent);
+  SymbolicArena persistent_arena(extent);
+  auto allocate = [&](int tensor_index) {
+    if (recorded_types_[tensor_index] == kTfLiteArenaRw) {
+      symbolic_offsets[tensor_index] =
+          arena.Allocate(tensor_index, symbolic_sizes[tensor_index]);
+    }
+    if (recorded_types_[tensor_index] == kTfLiteArenaRwPersistent) {
+      symbolic_offsets[tensor_index] =
+          persistent_arena.Allocate(tensor_index, symbolic_sizes[tensor_index]);
+    }
+  };
+  auto deallocate = [&](int tensor_index) {
+    if (recorded_types_[tensor_index] == kTfLiteArenaRw) {
+      arena.Deallocate(tensor_index);
+    }
+  };
+  auto for_each_temporary = [this](int node_index,
+                                   const std::function<void(int)>& f) {
+    if (node_index < graph_info_->num_nodes()) {
+      const TfLiteIntArray* temporaries =
+          graph_info_->node(node_index).temporaries;
+      for (int i = 0; i < temporaries->size; ++i) {
+        f(temporaries->data[i]);
+      }
+    }
+  };
+  int active_node = 0;
+  for (const auto& alloc_info : alloc_queue_) {
+    if (alloc_info.node == active_node) {
+      if (active_node != 0) {
+        for_each_temporary(active_node - 1, deallocate);
+      }
+      for_each_temporary(active_node, allocate);
+      ++active_node;
+    }
+    if (alloc_info.type == AllocationInfo::ALLOC) {
+      allocate(alloc_info.tensor);
+    } else {
+      deallocate(alloc_info.tensor);
+    }
+  }
+  for_each_temporary(active_node - 1, deallocate);
+
+  symbolic_offsets_ = std::move(symbolic_offsets);
+  symbolic_sizes_ = std::move(symbolic_sizes);
+  return kTfLiteOk;
+}
+
+bool ArenaPlanner::SymbolicPlanFits(size_t extent) const {
+  if (symbolic_sizes_.empty() ||
+      symbolic_sizes_.size() != graph_info_->num_tensors()) {
+    return false;
+  }
+  for (int i = 0; i < graph_info_->num_tensors(); ++i) {
+    const TfLiteTensor& tensor = *graph_info_->tensor(i);
+    if (tensor.allocation_type != recorded_types_[i] ||
+        tensor.bytes > symbolic_sizes_[i].Evaluate(extent)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TfLiteStatus ArenaPlanner::ExecuteSymbolicPlan(size_t extent) {
+  TF_LITE_ENSURE(context_, SymbolicPlanFits(extent));
+  ArenaPlan plan;
+  plan.allocs.resize(graph_info_->num_tensors());
+  for (int i = 0; i < graph_info_->num_tensors(); ++i) {
+    const TfLiteTensor& tensor = *graph_info_->tensor(i);
+    if (tensor.allocation_type == kTfLiteArenaRw ||
+        tensor.allocation_type == kTfLiteArenaRwPersistent) {
+      plan.allocs[i].offset = symbolic_offsets_[i].Evaluate(extent);
+      plan.allocs[i].size = tensor.bytes;
+    }
+  }
+  return ExecutePlan(plan);
+}
+
 TfLiteStatus ArenaPlanner::Commit() {
   TF_LITE_ENSURE_STATUS(arena_.Commit(context_));
   TF_LITE_ENSURE_STATUS(persistent_arena_.Commit(context_));
@@ -15,7 +15,9 @@ limitations under the License.
 #ifndef TENSORFLOW_LITE_ARENA_PLANNER_H_
 #define TENSORFLOW_LITE_ARENA_PLANNER_H_
 
+#include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "tensorflow/lite/c/c_api_internal.h"
@@ -31,6 +33,34 @@ constexpr const int kDefaultTensorAlignment = 64;
 
 struct AllocationInfo;
 
+// The location of all the tensors in the arenas, as computed by ArenaPlanner.
+// A plan can be saved once a graph is prepared, and replayed to allocate the
+// same graph again without recomputing it.
+struct ArenaPlan {
+  // Identifies the graph and tensor sizes the plan is valid for. The planner
+  // does not interpret it, see Subgraph::ArenaPlanFingerprint().
+  uint64_t fingerprint = 0;
+  // Informative only: ExecutePlan() derives the sizes of the arenas from
+  // `allocs`.
+  size_t arena_size = 0;
+  size_t persistent_arena_size = 0;
+  // The allocation of each tensor, in the arena of its allocation type.
+  std::vector<ArenaAlloc> allocs;
+};
+
+// A size or offset that depends on the symbolic extent of a graph, i.e. on
+// the product of the input dimensions only known at runtime, as a polynomial
+// of degree 2 with non-negative coefficients. It covers tensors linear in a
+// sequence length as well as attention scores, quadratic in it.
+struct SymbolicSize {
+  size_t coefficients[3] = {0, 0, 0};
+
+  size_t Evaluate(size_t extent) const {
+    return coefficients[0] +
+           extent * (coefficients[1] + extent * coefficients[2]);
+  }
+};
+
 // A memory planner that makes all the allocations using arenas.
 //
 // Before a model is executed by the interpreter, this class determines when
@@ -64,6 +94,37 @@ class ArenaPlanner : public MemoryPlanner {
   // Returns the base arena location for a given allocation type.
   int64_t BasePointer(TfLiteAllocationType type);
 
+  // Fills `plan` with the allocations made by ExecuteAllocations(), which must
+  // have covered all the nodes of the graph. The fingerprint is left as is.
+  void GetPlan(ArenaPlan* plan) const;
+
+  // Allocates all the tensors at the locations saved in `plan` rather than
+  // computing them, in place of ExecuteAllocations() for the whole graph. The
+  // caller is responsible for checking that the plan was made for a graph
+  // with the same tensors and nodes.
+  TfLiteStatus ExecutePlan(const ArenaPlan& plan);
+
+  // Symbolic plans let a graph whose tensor sizes are polynomials of a
+  // symbolic extent be reallocated for any extent by evaluating the offsets
+  // of its tensors rather than planning them again. Once ExecuteAllocations()
+  // covered the whole graph, call RecordExtent() with the extent the tensors
+  // were sized for. After two or three distinct extents the planner derives
+  // the sizes and offsets of the tensors as functions of the extent, placed
+  // so that no two live tensors overlap whatever the extent.
+
+  // Records that the tensors allocated by the last ExecuteAllocations(), for
+  // the whole graph, were sized for `extent`, and updates the symbolic plan.
+  TfLiteStatus RecordExtent(size_t extent);
+
+  // Whether there is a symbolic plan in which all the tensors, as currently
+  // sized, fit when evaluated at `extent`.
+  bool SymbolicPlanFits(size_t extent) const;
+
+  // Allocates all the tensors at the offsets of the symbolic plan evaluated
+  // at `extent`, in place of ExecuteAllocations() for the whole graph.
+  // SymbolicPlanFits(extent) must be true.
+  TfLiteStatus ExecuteSymbolicPlan(size_t extent);
+
  private:
   // Make sure all the arenas have reserved enough memory to store all their
   // tensors.
@@ -120,6 +181,17 @@ class ArenaPlanner : public MemoryPlanner {
 
   // Number of bytes that tensor buffers should be aligned to.
   int tensor_alignment_;
+
+  // The allocation types and sizes of the tensors for the last distinct
+  // extents given to RecordExtent(), the latest last. Cleared when the graph
+  // or the allocation types change.
+  std::vector<TfLiteAllocationType> recorded_types_;
+  std::vector<std::pair<size_t, std::vector<size_t>>> recorded_sizes_;
+
+  // The symbolic plan, valid for tensors of `recorded_types_`. Empty if the
+  // sizes of the tensors are not polynomials of the extent.
+  std::vector<SymbolicSize> symbolic_offsets_;
+  std::vector<SymbolicSize> symbolic_sizes_;
 };
 
 }  // namespace tflite
@@ -15,6 +15,7 @@ limitations under the License.
 #include "tensorflow/lite/arena_planner.h"
 
 #include <cstdarg>
+#include <limits>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -283,6 +284,114 @@ TEST_F(ArenaPlannerTest, SimpleGraphInputsPreserved) {
   EXPECT_EQ(GetOffset(3), GetOffsetAfter(1));
 }
 
+TEST_F(ArenaPlannerTest, SavedPlan) {
+  TestGraph graph({0, 1},
+                  {
+                      /* in, out, tmp */
+                      {{0, 1}, {2}, {}},     // First op
+                      {{2, 0}, {4, 5}, {}},  // Second op
+                      {{4, 5}, {3}, {}}      // Third op
+                  },
+                  {3});
+  SetGraph(&graph);
+  Execute(0, 10);
+  std::vector<int64_t> offsets;
+  for (int i = 0; i < 6; ++i) {
+    offsets.push_back(GetOffset(i));
+  }
+  ArenaPlan plan;
+  planner_->GetPlan(&plan);
+  EXPECT_EQ(plan.allocs.size(), 6);
+  EXPECT_EQ(plan.arena_size, GetOffset(5) + (*graph.tensors())[5].bytes);
+
+  // Replaying the plan in a new planner gives the same offsets.
+  SetGraph(&graph);
+  ASSERT_EQ(planner_->ExecutePlan(plan), kTfLiteOk);
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(GetOffset(i), offsets[i]);
+  }
+
+  // The sizes of the arenas come from the allocations, not from the plan.
+  plan.arena_size = 0;
+  SetGraph(&graph);
+  ASSERT_EQ(planner_->ExecutePlan(plan), kTfLiteOk);
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(GetOffset(i), offsets[i]);
+  }
+
+  // Allocations beyond the address space are rejected.
+  plan.allocs[5].offset = std::numeric_limits<size_t>::max() & ~size_t{63};
+  SetGraph(&graph);
+  EXPECT_EQ(planner_->ExecutePlan(plan), kTfLiteError);
+  plan.allocs[5].offset = offsets[5];
+
+  // Plans for other graphs are rejected.
+  plan.allocs.pop_back();
+  EXPECT_EQ(planner_->ExecutePlan(plan), kTfLiteError);
+}
+
+TEST_F(ArenaPlannerTest, SymbolicPlan) {
+  TestGraph graph({0, 1},
+                  {
+                      /* in, out, tmp */
+                      {{0, 1}, {2}, {}},   // First op
+                      {{2, 0}, {4}, {5}},  // Second op, with temporary
+                      {{4}, {3}, {}}       // Third op
+                  },
+                  {3});
+  // Tensors linear in the extent, but for a quadratic temporary.
+  auto resize = [&graph](size_t extent) {
+    for (int i = 0; i < 5; ++i) {
+      (*graph.tensors())[i].bytes = (i + 1) * extent + i;
+    }
+    (*graph.tensors())[5].bytes = extent * extent;
+  };
+  auto overlap = [this, &graph](int a, int b) {
+    const int64_t a_end = GetOffset(a) + (*graph.tensors())[a].bytes;
+    const int64_t b_end = GetOffset(b) + (*graph.tensors())[b].bytes;
+    return GetOffset(a) < b_end && GetOffset(b) < a_end;
+  };
+  SetGraph(&graph);
+
+  // Linear functions don't fit the temporary, so it takes three extents.
+  for (size_t extent : {2, 5, 3}) {
+    EXPECT_FALSE(planner_->SymbolicPlanFits(extent));
+    resize(extent);
+    ASSERT_EQ(planner_->ResetAllocations(), kTfLiteOk);
+    Execute(0, 10);
+    ASSERT_EQ(planner_->RecordExtent(extent), kTfLiteOk);
+  }
+
+  for (size_t extent : {1, 9, 100}) {
+    resize(extent);
+    ASSERT_EQ(planner_->ResetAllocations(), kTfLiteOk);
+    ASSERT_TRUE(planner_->SymbolicPlanFits(extent));
+    ASSERT_EQ(planner_->ExecuteSymbolicPlan(extent), kTfLiteOk);
+    // Alloc(+) and dealloc(-) order: +0 +1 +2 -1 +5 +4 -2 -0 -5 +3 -4
+    const std::vector<std::pair<int, int>> live_together = {
+        {0, 1}, {0, 2}, {1, 2}, {0, 5}, {2, 5},
+        {0, 4}, {2, 4}, {4, 5}, {3, 4}};
+    for (const auto& tensors : live_together) {
+      EXPECT_FALSE(overlap(tensors.first, tensors.second))
+          << tensors.first << " " << tensors.second;
+    }
+    for (int i = 0; i < 6; ++i) {
+      EXPECT_EQ(GetOffset(i) % kTensorAlignment, 0);
+    }
+  }
+
+  // Tensors larger than planned for need planning again.
+  (*graph.tensors())[3].bytes += kTensorAlignment;
+  EXPECT_FALSE(planner_->SymbolicPlanFits(100));
+
+  // Planning the graph again, e.g. once delegates changed it, forgets the
+  // symbolic plan.
+  resize(100);
+  EXPECT_TRUE(planner_->SymbolicPlanFits(100));
+  CHECK(planner_->PlanAllocations() == kTfLiteOk);
+  EXPECT_FALSE(planner_->SymbolicPlanFits(100));
+}
+
 TEST_F(ArenaPlannerTest, SimpleGraphWithTemporary) {
   TestGraph graph({0, 1},
                   {
@@ -458,6 +458,43 @@ def gen_selected_ops(name, model):
         tools = [tool],
     )
 
+def gen_selected_op_resolver(name, model, class_name = "SelectedOpResolver", deps = []):
+    """Generate a library with a resolver of only the ops used by a model.
+
+    The library provides the header "<name>.h", which defines `class_name` in
+    the tflite namespace: an OpResolver of exactly the op versions used by the
+    model, found with a switch rather than a map lookup. It depends on the
+    builtin kernels rather than on //tensorflow/lite/kernels:builtin_ops, so
+    that only the kernels of these ops are linked in.
+
+    Args:
+      name: Name of the generated library.
+      model: TFLite model to interpret.
+      class_name: Name of the generated resolver class.
+      deps: Libraries registering the custom ops used by the model.
+    """
+    out = name + ".h"
+    tool = "//tensorflow/lite/tools:generate_op_registrations"
+    tflite_path = "//tensorflow/lite"
+    native.genrule(
+        name = name + "_header",
+        srcs = [model],
+        outs = [out],
+        cmd = ("$(location %s) --input_model=$(location %s) --output_resolver=$(location %s) --resolver_class=%s --tflite_path=%s") %
+              (tool, model, out, class_name, tflite_path[2:]),
+        tools = [tool],
+    )
+    native.cc_library(
+        name = name,
+        hdrs = [out],
+        deps = [
+            "//tensorflow/lite/c:c_api_internal",
+            "//tensorflow/lite/core/api",
+            "//tensorflow/lite/kernels:builtin_op_kernels",
+            "//tensorflow/lite/schema:schema_fbs",
+        ] + deps,
+    )
+
 def flex_dep(target_op_sets):
     if "SELECT_TF_OPS" in target_op_sets:
         return ["//tensorflow/lite/delegates/flex:delegate"]
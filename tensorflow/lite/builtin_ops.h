@@ -142,6 +142,7 @@ typedef enum {
   kTfLiteBuiltinQuantize = 114,
   kTfLiteBuiltinMatrixSetDiag = 115,
   kTfLiteBuiltinRound = 116,
+  kTfLiteBuiltinBatchMatmul = 126,
 } TfLiteBuiltinOperator;
 
 #ifdef __cplusplus
@@ -391,6 +391,11 @@ typedef struct {
   EmptyStructPlaceholder placeholder;
 } TfLiteMatrixSetDiagParams;
 
+typedef struct {
+  bool adj_x;
+  bool adj_y;
+} TfLiteBatchMatMulParams;
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
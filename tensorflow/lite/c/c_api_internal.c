@@ -104,6 +104,14 @@ void TfLiteQuantizationFree(TfLiteQuantization* quantization) {
       q_params->zero_point = NULL;
     }
     free(q_params);
+  } else if (quantization->type == kTfLitePaletteQuantization) {
+    TfLitePaletteQuantization* q_params =
+        (TfLitePaletteQuantization*)(quantization->params);
+    if (q_params->values) {
+      TfLiteFloatArrayFree(q_params->values);
+      q_params->values = NULL;
+    }
+    free(q_params);
   }
   quantization->params = NULL;
   quantization->type = kTfLiteNoQuantization;
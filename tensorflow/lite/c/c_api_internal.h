@@ -44,11 +44,12 @@ typedef enum { kTfLiteOk = 0, kTfLiteError = 1 } TfLiteStatus;
 // need. Access to the external contexts is controled by one of the
 // corresponding support files.
 typedef enum {
-  kTfLiteEigenContext = 0,       // include eigen_support.h to use.
-  kTfLiteGemmLowpContext = 1,    // include gemm_support.h to use.
-  kTfLiteEdgeTpuContext = 2,     // Placeholder for Edge TPU support.
-  kTfLiteCpuBackendContext = 3,  // include cpu_backend_support.h to use.
-  kTfLiteMaxExternalContexts = 4
+  kTfLiteEigenContext = 0,        // include eigen_support.h to use.
+  kTfLiteGemmLowpContext = 1,     // include gemm_support.h to use.
+  kTfLiteEdgeTpuContext = 2,      // Placeholder for Edge TPU support.
+  kTfLiteCpuBackendContext = 3,   // include cpu_backend_support.h to use.
+  kTfLiteWeightCacheContext = 4,  // include weight_cache.h to use.
+  kTfLiteMaxExternalContexts = 5
 } TfLiteExternalContextType;
 
 struct TfLiteContext;
@@ -225,6 +226,9 @@ typedef enum {
   // Affine quantization (with support for per-channel quantization).
   // Corresponds to TfLiteAffineQuantization.
   kTfLiteAffineQuantization = 1,
+  // Palette quantization, where each element is the index of its value in a
+  // table. Corresponds to TfLitePaletteQuantization.
+  kTfLitePaletteQuantization = 2,
 } TfLiteQuantizationType;
 
 // Structure specifying the quantization used by the tensor, if-any.
@@ -260,6 +264,13 @@ typedef struct {
   int32_t quantized_dimension;
 } TfLiteAffineQuantization;
 
+// Parameters for palette quantization, where the elements of the tensor are
+// uint8 indices into a table of values:
+//     real_value = values[quantized_value]
+typedef struct {
+  TfLiteFloatArray* values;
+} TfLitePaletteQuantization;
+
 // A union of pointers that points to memory for a given tensor.
 typedef union {
   int32_t* i32;
@@ -700,6 +700,17 @@ TfLiteStatus ParseOpData(const Operator* op, BuiltinOperator op_type,
       *builtin_data = reinterpret_cast<void*>(params);
       break;
     }
+    case BuiltinOperator_BATCH_MATMUL: {
+      TfLiteBatchMatMulParams* params =
+          allocator->AllocatePOD<TfLiteBatchMatMulParams>();
+      if (const auto* batch_matmul_params =
+              op->builtin_options_as_BatchMatMulOptions()) {
+        params->adj_x = batch_matmul_params->adj_x();
+        params->adj_y = batch_matmul_params->adj_y();
+      }
+      *builtin_data = reinterpret_cast<void*>(params);
+      break;
+    }
     // Below are the ops with no builtin_data structure.
     case BuiltinOperator_ABS:
     case BuiltinOperator_BATCH_TO_SPACE_ND:
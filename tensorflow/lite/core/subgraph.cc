@@ -50,6 +50,12 @@ TfLiteStatus ReportOpError(TfLiteContext* context, const TfLiteNode& node,
   return kTfLiteError;
 }
 
+// Rounds `offset` up to the alignment used for tensors in the arena.
+size_t AlignVariableTensorOffset(size_t offset) {
+  return (offset + kDefaultTensorAlignment - 1) / kDefaultTensorAlignment *
+         kDefaultTensorAlignment;
+}
+
 // Stub method which returns kTfLiteError when the function is forbidden.
 // We're registering this function to several different function to save
 // compiled binary size. Please note the restrictions:
@@ -194,8 +200,13 @@ Subgraph::~Subgraph() {
       tensor->delegate->FreeBufferHandle(context_, tensor->delegate,
                                          &tensor->buffer_handle);
     }
+    ReleaseBorrowedQuantizationScale(i);
     TfLiteTensorFree(tensor);
   }
+
+  for (const auto& releaser : constant_data_releasers_) {
+    releaser();
+  }
 }
 
 TfLiteStatus Subgraph::ReplaceNodeSubsetsWithDelegateKernels(
@@ -478,6 +489,8 @@ TfLiteStatus Subgraph::AllocateTensors() {
   if (memory_planner_) {
     TF_LITE_ENSURE_STATUS(memory_planner_->ResetAllocations());
   }
+  variable_tensors_buffer_ = nullptr;
+  variable_tensors_arena_data_.clear();
 
   TF_LITE_ENSURE_STATUS(PrepareOpsAndTensors());
 
@@ -505,11 +518,94 @@ TfLiteStatus Subgraph::ResetVariableTensors() {
                       kTfLiteArenaRwPersistent);
     TF_LITE_ENSURE(context_, tensor.data.raw != nullptr);
 
-    memset(tensor.data.raw, 0, tensor.bytes);
+    // Quantized tensors are reset to the representation of zero.
+    const int value =
+        (tensor.type == kTfLiteInt8 || tensor.type == kTfLiteUInt8)
+            ? tensor.params.zero_point
+            : 0;
+    memset(tensor.data.raw, value, tensor.bytes);
+  }
+  return kTfLiteOk;
+}
+
+size_t Subgraph::VariableTensorsBytes() const {
+  size_t bytes = 0;
+  for (int tensor_index : variables_) {
+    bytes = AlignVariableTensorOffset(bytes) + tensors_[tensor_index].bytes;
+  }
+  return bytes;
+}
+
+TfLiteStatus Subgraph::SaveVariableTensors(void* buffer, size_t bytes) {
+  TF_LITE_ENSURE(context_, state_ != kStateUninvokable);
+  TF_LITE_ENSURE(context_, bytes >= VariableTensorsBytes());
+  size_t offset = 0;
+  for (int tensor_index : variables_) {
+    const TfLiteTensor& tensor = tensors_[tensor_index];
+    offset = AlignVariableTensorOffset(offset);
+    memcpy(static_cast<char*>(buffer) + offset, tensor.data.raw,
+           tensor.bytes);
+    offset += tensor.bytes;
   }
   return kTfLiteOk;
 }
 
+TfLiteStatus Subgraph::RestoreVariableTensors(const void* buffer,
+                                              size_t bytes) {
+  TF_LITE_ENSURE(context_, state_ != kStateUninvokable);
+  TF_LITE_ENSURE(context_, bytes >= VariableTensorsBytes());
+  size_t offset = 0;
+  for (int tensor_index : variables_) {
+    TfLiteTensor& tensor = tensors_[tensor_index];
+    offset = AlignVariableTensorOffset(offset);
+    memcpy(tensor.data.raw, static_cast<const char*>(buffer) + offset,
+           tensor.bytes);
+    offset += tensor.bytes;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus Subgraph::SetVariableTensorsBuffer(void* buffer, size_t bytes) {
+  TF_LITE_ENSURE(context_, state_ != kStateUninvokable);
+  if (buffer == nullptr) {
+    if (variable_tensors_buffer_ != nullptr) {
+      for (int i = 0; i < variables_.size(); ++i) {
+        tensors_[variables_[i]].data.raw = variable_tensors_arena_data_[i];
+      }
+    }
+    variable_tensors_buffer_ = nullptr;
+    variable_tensors_arena_data_.clear();
+    return kTfLiteOk;
+  }
+
+  TF_LITE_ENSURE(context_, bytes >= VariableTensorsBytes());
+  for (int tensor_index : variables_) {
+    // Only tensors owned by the arena can be redirected; the others would be
+    // reallocated or freed behind our back.
+    TF_LITE_ENSURE_EQ(context_, tensors_[tensor_index].allocation_type,
+                      kTfLiteArenaRwPersistent);
+  }
+  if (variable_tensors_buffer_ == nullptr) {
+    variable_tensors_arena_data_.clear();
+    for (int tensor_index : variables_) {
+      variable_tensors_arena_data_.push_back(tensors_[tensor_index].data.raw);
+    }
+  }
+  variable_tensors_buffer_ = buffer;
+  ApplyVariableTensorsBuffer();
+  return kTfLiteOk;
+}
+
+void Subgraph::ApplyVariableTensorsBuffer() {
+  size_t offset = 0;
+  for (int tensor_index : variables_) {
+    TfLiteTensor& tensor = tensors_[tensor_index];
+    offset = AlignVariableTensorOffset(offset);
+    tensor.data.raw = static_cast<char*>(variable_tensors_buffer_) + offset;
+    offset += tensor.bytes;
+  }
+}
+
 TfLiteStatus Subgraph::AddNodeWithParameters(
     const std::vector<int>& inputs, const std::vector<int>& outputs,
     const char* init_data, size_t init_data_size, void* builtin_data,
@@ -641,13 +737,80 @@ TfLiteStatus Subgraph::PrepareOpsAndTensors() {
 
   TF_LITE_ENSURE_STATUS(PrepareOpsStartingAt(
       next_execution_plan_index_to_prepare_, &last_exec_plan_index_prepared));
-  TF_LITE_ENSURE_STATUS(memory_planner_->ExecuteAllocations(
-      next_execution_plan_index_to_prepare_, last_exec_plan_index_prepared));
+  // Saved and symbolic plans cover the whole graph, so they can only be used
+  // when all the ops were prepared at once.
+  const bool whole_graph =
+      next_execution_plan_index_to_prepare_ == 0 && !has_dynamic_tensors_;
+  const size_t symbolic_extent = whole_graph ? SymbolicExtent() : 0;
+  if (arena_plan_ && whole_graph &&
+      arena_plan_->fingerprint == ArenaPlanFingerprint()) {
+    if (memory_planner_->ExecutePlan(*arena_plan_) != kTfLiteOk) {
+      // The plan is corrupted, forget about it.
+      arena_plan_.reset();
+      TF_LITE_ENSURE_STATUS(memory_planner_->ExecuteAllocations(
+          0, last_exec_plan_index_prepared));
+    }
+  } else if (symbolic_extent != 0) {
+    if (memory_planner_->SymbolicPlanFits(symbolic_extent)) {
+      TF_LITE_ENSURE_STATUS(
+          memory_planner_->ExecuteSymbolicPlan(symbolic_extent));
+    } else {
+      TF_LITE_ENSURE_STATUS(memory_planner_->ExecuteAllocations(
+          0, last_exec_plan_index_prepared));
+      TF_LITE_ENSURE_STATUS(memory_planner_->RecordExtent(symbolic_extent));
+    }
+  } else {
+    TF_LITE_ENSURE_STATUS(memory_planner_->ExecuteAllocations(
+        next_execution_plan_index_to_prepare_, last_exec_plan_index_prepared));
+  }
+
+  // The memory planner has just pointed the variable tensors back at the
+  // arena, which may also have moved.
+  if (variable_tensors_buffer_ != nullptr) {
+    for (int i = 0; i < variables_.size(); ++i) {
+      variable_tensors_arena_data_[i] = tensors_[variables_[i]].data.raw;
+    }
+    ApplyVariableTensorsBuffer();
+  }
 
   next_execution_plan_index_to_prepare_ = last_exec_plan_index_prepared + 1;
   return kTfLiteOk;
 }
 
+uint64_t Subgraph::ArenaPlanFingerprint() const {
+  size_t hash = CombineHashes({tensors_.size(), execution_plan_.size()});
+  for (const TfLiteTensor& tensor : tensors_) {
+    hash = CombineHashes(
+        {hash, static_cast<size_t>(tensor.allocation_type), tensor.bytes});
+  }
+  auto combine_array = [&hash](const TfLiteIntArray* array) {
+    hash = CombineHashes({hash, static_cast<size_t>(array->size)});
+    for (int i = 0; i < array->size; ++i) {
+      hash = CombineHashes({hash, static_cast<size_t>(array->data[i])});
+    }
+  };
+  for (int node_index : execution_plan_) {
+    const TfLiteNode& node = nodes_and_registration_[node_index].first;
+    combine_array(node.inputs);
+    combine_array(node.outputs);
+    combine_array(node.temporaries);
+  }
+  return hash;
+}
+
+TfLiteStatus Subgraph::GetArenaPlan(ArenaPlan* plan) const {
+  if (materializer_) {
+    // Never built, so there is nothing to plan.
+    *plan = ArenaPlan();
+    return kTfLiteOk;
+  }
+  TF_LITE_ENSURE(context_, state_ != kStateUninvokable);
+  TF_LITE_ENSURE(context_, !has_dynamic_tensors_);
+  memory_planner_->GetPlan(plan);
+  plan->fingerprint = ArenaPlanFingerprint();
+  return kTfLiteOk;
+}
+
 TfLiteStatus Subgraph::Invoke() {
   if (!consistent_) {
     ReportError("Invoke called on model that is not consistent.");
@@ -832,6 +995,7 @@ TfLiteStatus Subgraph::SetTensorParametersReadOnly(
       EqualArrayAndTfLiteIntArray(tensor.dims, rank, dims)) {
     // Fast path which does not invalidate the invokable property.
     TfLiteTensorDataFree(&tensor);
+    ReleaseBorrowedQuantizationScale(tensor_index);
     TfLiteQuantizationFree(&tensor.quantization);
     tensor.data.raw = const_cast<char*>(buffer);
     if (!tensor.dims) tensor.dims = ConvertArrayToTfLiteIntArray(rank, dims);
@@ -841,6 +1005,7 @@ TfLiteStatus Subgraph::SetTensorParametersReadOnly(
     tensor.allocation = allocation;
   } else {
     state_ = kStateUninvokable;
+    ReleaseBorrowedQuantizationScale(tensor_index);
     TfLiteTensorReset(type, name, ConvertArrayToTfLiteIntArray(rank, dims),
                       GetLegacyQuantization(quantization),
                       const_cast<char*>(buffer), bytes, kTfLiteMmapRo,
@@ -891,6 +1056,7 @@ TfLiteStatus Subgraph::SetTensorParametersReadWrite(
   }
 
   TfLiteTensor& tensor = context_->tensors[tensor_index];
+  ReleaseBorrowedQuantizationScale(tensor_index);
   TfLiteTensorReset(type, name, ConvertArrayToTfLiteIntArray(rank, dims),
                     GetLegacyQuantization(quantization),
                     /*buffer=*/nullptr, required_bytes, allocation_type,
@@ -901,6 +1067,98 @@ TfLiteStatus Subgraph::SetTensorParametersReadWrite(
   return kTfLiteOk;
 }
 
+char* Subgraph::AllocateConstantData(size_t bytes) {
+  constant_data_.emplace_back(new char[bytes]);
+  return constant_data_.back().get();
+}
+
+TfLiteStatus Subgraph::BorrowQuantizationScale(int tensor_index,
+                                               const TfLiteFloatArray* scale) {
+  TF_LITE_ENSURE(context_,
+                 tensor_index < context_->tensors_size && tensor_index >= 0);
+  TfLiteQuantization& quantization =
+      context_->tensors[tensor_index].quantization;
+  TF_LITE_ENSURE_EQ(context_, quantization.type, kTfLiteAffineQuantization);
+  auto* affine_quantization =
+      reinterpret_cast<TfLiteAffineQuantization*>(quantization.params);
+  ReleaseBorrowedQuantizationScale(tensor_index);
+  if (affine_quantization->scale) {
+    TfLiteFloatArrayFree(affine_quantization->scale);
+  }
+  affine_quantization->scale = const_cast<TfLiteFloatArray*>(scale);
+  if (borrowed_quantization_scales_.size() <=
+      static_cast<size_t>(tensor_index)) {
+    borrowed_quantization_scales_.resize(tensor_index + 1);
+  }
+  borrowed_quantization_scales_[tensor_index] = true;
+  return kTfLiteOk;
+}
+
+TfLiteStatus Subgraph::SetTensorDimsSignature(
+    int tensor_index, const std::vector<int>& dims_signature) {
+  TF_LITE_ENSURE(context_,
+                 tensor_index < context_->tensors_size && tensor_index >= 0);
+  for (int dim : dims_signature) {
+    TF_LITE_ENSURE(context_, dim >= -1);
+  }
+  if (dims_signatures_.size() <= static_cast<size_t>(tensor_index)) {
+    dims_signatures_.resize(tensor_index + 1);
+  }
+  dims_signatures_[tensor_index] = dims_signature;
+  return kTfLiteOk;
+}
+
+size_t Subgraph::SymbolicExtent() const {
+  size_t extent = 0;
+  for (int tensor_index : inputs_) {
+    if (tensor_index == kOptionalTensor ||
+        static_cast<size_t>(tensor_index) >= dims_signatures_.size()) {
+      continue;
+    }
+    const std::vector<int>& dims_signature = dims_signatures_[tensor_index];
+    const TfLiteIntArray* dims = tensors_[tensor_index].dims;
+    if (dims == nullptr || dims->size != dims_signature.size()) continue;
+    for (int i = 0; i < dims->size; ++i) {
+      if (dims_signature[i] == -1) {
+        extent = (extent == 0 ? 1 : extent) * dims->data[i];
+      }
+    }
+  }
+  return extent;
+}
+
+void Subgraph::ReallocDynamicTensor(TfLiteTensor* tensor, size_t bytes) {
+  const size_t tensor_index = tensor - context_->tensors;
+  if (dynamic_tensor_buffers_.size() <= tensor_index) {
+    dynamic_tensor_buffers_.resize(tensor_index + 1);
+  }
+  DynamicTensorBuffer& buffer = dynamic_tensor_buffers_[tensor_index];
+  // Anything else that reallocates or frees the buffer, e.g.
+  // TfLiteTensorRealloc, also changes the pointer or the size.
+  if (buffer.data != tensor->data.raw || buffer.bytes != tensor->bytes) {
+    buffer.capacity = tensor->data.raw ? tensor->bytes : 0;
+  }
+  if (bytes > buffer.capacity) {
+    TfLiteTensorRealloc(bytes, tensor);
+    buffer.capacity = bytes;
+  }
+  tensor->bytes = bytes;
+  buffer.data = tensor->data.raw;
+  buffer.bytes = bytes;
+}
+
+void Subgraph::ReleaseBorrowedQuantizationScale(int tensor_index) {
+  if (static_cast<size_t>(tensor_index) >=
+          borrowed_quantization_scales_.size() ||
+      !borrowed_quantization_scales_[tensor_index]) {
+    return;
+  }
+  auto* affine_quantization = reinterpret_cast<TfLiteAffineQuantization*>(
+      context_->tensors[tensor_index].quantization.params);
+  affine_quantization->scale = nullptr;
+  borrowed_quantization_scales_[tensor_index] = false;
+}
+
 TfLiteStatus Subgraph::SetExecutionPlan(const std::vector<int>& new_plan) {
   for (int node_index : new_plan) {
     TF_LITE_ENSURE(context_, node_index >= 0 &&
@@ -928,7 +1186,9 @@ TfLiteStatus Subgraph::ResizeTensorImpl(TfLiteTensor* tensor,
       }
 
       // Realloc space for kTfLiteDynamic tensors.
-      TfLiteTensorRealloc(bytesRequired, tensor);
+      if (tensor->allocation_type == kTfLiteDynamic) {
+        ReallocDynamicTensor(tensor, bytesRequired);
+      }
       tensor->bytes = bytesRequired;
     }
     if (tensor->dims) TfLiteIntArrayFree(tensor->dims);
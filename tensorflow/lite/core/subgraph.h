@@ -16,13 +16,15 @@ limitations under the License.
 #define TENSORFLOW_LITE_CORE_SUBGRAPH_H_
 
 #include <cstdlib>
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include "tensorflow/lite/allocation.h"
+#include "tensorflow/lite/arena_planner.h"
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/core/api/profiler.h"
 #include "tensorflow/lite/delegates/nnapi/nnapi_delegate.h"
-#include "tensorflow/lite/memory_planner.h"
 #include "tensorflow/lite/util.h"
 
 namespace tflite {
@@ -60,6 +62,57 @@ class Subgraph {
   // interpreter.
   TfLiteStatus SetVariables(std::vector<int> variables);
 
+  // Makes the quantization scales of tensor `tensor_index`, which must have
+  // affine quantization, point at `scale` rather than at a copy owned by the
+  // tensor. `scale` must outlive the subgraph, e.g. it may point into the
+  // model like the buffers of read-only tensors.
+  TfLiteStatus BorrowQuantizationScale(int tensor_index,
+                                       const TfLiteFloatArray* scale);
+
+  // Sets the shape signature of tensor `tensor_index`: its shape with -1 for
+  // the dimensions only known at runtime. The product of these dimensions
+  // over the inputs is the symbolic extent of the subgraph. When the sizes of
+  // the tensors are polynomials of the extent, e.g. of a batch size or a
+  // sequence length, `AllocateTensors` learns where to place each tensor for
+  // any extent after seeing two or three of them, and only evaluates these
+  // offsets on the following resizes.
+  TfLiteStatus SetTensorDimsSignature(int tensor_index,
+                                      const std::vector<int>& dims_signature);
+
+  // Returns `bytes` bytes of memory that live as long as the subgraph, for
+  // the data of read-only tensors that is not stored as is in the model, e.g.
+  // decompressed weights.
+  // WARNING: This is an experimental API and subject to change.
+  char* AllocateConstantData(size_t bytes);
+
+  // Calls `releaser` when the subgraph is destroyed, once its nodes are
+  // freed, e.g. to give back constant data borrowed from a WeightRegistry.
+  // WARNING: This is an experimental API and subject to change.
+  void AddConstantDataReleaser(std::function<void()> releaser) {
+    constant_data_releasers_.push_back(std::move(releaser));
+  }
+
+  // Defers building the tensors and nodes of the subgraph until
+  // `EnsureMaterialized` is called, which then runs `materializer` once.
+  // WARNING: This is an experimental API and subject to change.
+  void SetMaterializer(std::function<TfLiteStatus(Subgraph*)> materializer) {
+    materializer_ = std::move(materializer);
+  }
+
+  // Builds the subgraph if it was left to be built on first use. Callers of a
+  // subgraph other than the primary one, e.g. control flow ops, must call this
+  // before anything else. A failure is not retried, since the subgraph may be
+  // partially built, and is returned again by later calls.
+  // WARNING: This is an experimental API and subject to change.
+  TfLiteStatus EnsureMaterialized() {
+    if (materializer_) {
+      auto materializer = std::move(materializer_);
+      materializer_ = nullptr;
+      materialize_status_ = materializer(this);
+    }
+    return materialize_status_;
+  }
+
   // Ensure the internal node storage memory allocates at least `count`
   // spots for node. NOTE, this doesn't actually add operators. This is an
   // efficiency optimization that is subject to change.
@@ -276,6 +329,53 @@ class Subgraph {
   // WARNING: This is an experimental API and subject to change.
   TfLiteStatus ResetVariableTensors();
 
+  // Returns the number of bytes needed to hold the state of all variable
+  // tensors, i.e. the size of the buffers taken by `SaveVariableTensors`,
+  // `RestoreVariableTensors` and `SetVariableTensorsBuffer`. In these buffers
+  // the variable tensors are laid out in the order of `variables()`, each one
+  // starting on a `kDefaultTensorAlignment` boundary.
+  // Must be called after `AllocateTensors`.
+  // WARNING: This is an experimental API and subject to change.
+  size_t VariableTensorsBytes() const;
+
+  // Copies the state of all variable tensors to `buffer`, which must hold at
+  // least `VariableTensorsBytes()` bytes.
+  // WARNING: This is an experimental API and subject to change.
+  TfLiteStatus SaveVariableTensors(void* buffer, size_t bytes);
+
+  // Copies the state of all variable tensors back from `buffer`, previously
+  // filled by `SaveVariableTensors`.
+  // WARNING: This is an experimental API and subject to change.
+  TfLiteStatus RestoreVariableTensors(const void* buffer, size_t bytes);
+
+  // Makes the variable tensors read and write their state directly in
+  // `buffer` instead of the arena, so that switching between several
+  // independent streams (e.g. one per audio session) only costs a pointer
+  // update. `buffer` must hold at least `VariableTensorsBytes()` bytes and
+  // outlive its use; it should be aligned to `kDefaultTensorAlignment`. Its
+  // content is used as is, call `ResetVariableTensors` to start a new stream.
+  // Passing nullptr points the variable tensors back at the arena. Any
+  // reallocation done by `AllocateTensors` (e.g. after resizing an input)
+  // also goes back to the arena, since the buffer layout may have changed.
+  // WARNING: This is an experimental API and subject to change.
+  TfLiteStatus SetVariableTensorsBuffer(void* buffer, size_t bytes);
+
+  // Fills `plan` with the location of all the tensors in the arenas, as
+  // computed by `AllocateTensors`. Fails if tensors remain to be allocated,
+  // i.e. when the graph has dynamic tensors. The plan of a subgraph that was
+  // never materialized is empty.
+  // WARNING: This is an experimental API and subject to change.
+  TfLiteStatus GetArenaPlan(ArenaPlan* plan) const;
+
+  // Makes the following `AllocateTensors` reuse `plan`, saved by
+  // `GetArenaPlan` for the same model, instead of planning the allocations
+  // again. The plan is ignored if, once the ops are prepared, the graph or
+  // the size of its tensors differ from those it was saved for.
+  // WARNING: This is an experimental API and subject to change.
+  void SetArenaPlan(const ArenaPlan& plan) {
+    arena_plan_.reset(new ArenaPlan(plan));
+  }
+
   void SetProfiler(Profiler* profiler) {
     profiler_ = profiler;
     context_->profiler = profiler;
@@ -334,6 +434,28 @@ class Subgraph {
   // to wait until Invoke() to resolve the sizes of dynamic tensors.
   TfLiteStatus PrepareOpsAndTensors();
 
+  // Returns a hash of everything the memory plan depends on: the tensors and
+  // their sizes, the execution plan and the tensors used by each node.
+  uint64_t ArenaPlanFingerprint() const;
+
+  // Returns the product of the dimensions of the inputs that are -1 in their
+  // shape signature, or 0 if no input has such dimensions.
+  size_t SymbolicExtent() const;
+
+  // Makes the buffer of dynamic tensor `tensor` hold at least `bytes` bytes.
+  // Unlike TfLiteTensorRealloc, keeps track of the capacity of the buffer
+  // when the tensor shrinks, so that tensors whose size changes from one
+  // invocation to the next stop reallocating once their buffer fits them all.
+  void ReallocDynamicTensor(TfLiteTensor* tensor, size_t bytes);
+
+  // Forgets about the quantization scales of tensor `tensor_index` set by
+  // `BorrowQuantizationScale`, before the quantization is freed.
+  void ReleaseBorrowedQuantizationScale(int tensor_index);
+
+  // Points the variable tensors at `variable_tensors_buffer_`. Called again
+  // after the memory planner has resolved the arena pointers.
+  void ApplyVariableTensorsBuffer();
+
   // Call OpPrepare() for all ops starting at 'first_node'. Stop when a
   // dynamic tensors is found or all ops have been prepared. Fill
   // 'last_node_prepared' with the id of the op containing dynamic tensors, or
@@ -488,6 +610,40 @@ class Subgraph {
   // Array of indices representing the tensors that are variable tensors.
   std::vector<int> variables_;
 
+  // The buffer set by `SetVariableTensorsBuffer`, or nullptr when the
+  // variable tensors live in the arena. In the former case the arena
+  // pointers of the variable tensors are kept aside to be restored later.
+  void* variable_tensors_buffer_ = nullptr;
+  std::vector<char*> variable_tensors_arena_data_;
+
+  // Whether each tensor has quantization scales set by
+  // `BorrowQuantizationScale`. Only grown up to the last such tensor.
+  std::vector<bool> borrowed_quantization_scales_;
+
+  // The shape signatures set by `SetTensorDimsSignature`. Only grown up to
+  // the last tensor with one.
+  std::vector<std::vector<int>> dims_signatures_;
+
+  // The buffers `ReallocDynamicTensor` allocated, as long as the tensors
+  // still point at them with the size it set.
+  struct DynamicTensorBuffer {
+    const void* data = nullptr;
+    size_t bytes = 0;
+    size_t capacity = 0;
+  };
+  std::vector<DynamicTensorBuffer> dynamic_tensor_buffers_;
+
+  // Memory returned by `AllocateConstantData`.
+  std::vector<std::unique_ptr<char[]>> constant_data_;
+
+  // Set by `AddConstantDataReleaser`.
+  std::vector<std::function<void()>> constant_data_releasers_;
+
+  // Set by `SetMaterializer` until the subgraph is built.
+  std::function<TfLiteStatus(Subgraph*)> materializer_;
+  // The result of running `materializer_`.
+  TfLiteStatus materialize_status_ = kTfLiteOk;
+
   // The error reporter delegate that tflite will forward queries errors to.
   ErrorReporter* error_reporter_;
 
@@ -516,7 +672,10 @@ class Subgraph {
   bool should_apply_nnapi_delegate_ = false;
   bool applied_nnapi_delegate_ = false;
 
-  std::unique_ptr<MemoryPlanner> memory_planner_;
+  std::unique_ptr<ArenaPlanner> memory_planner_;
+
+  // The plan set by `SetArenaPlan`, if any.
+  std::unique_ptr<ArenaPlan> arena_plan_;
 
   // Tracking bit for whether a tensor was resized in the course of an op
   // invocation. This is a useful hint to ensure that dynamic tensor outputs
@@ -1376,8 +1376,9 @@ class NNAPIDelegateKernel {
         }
         break;
       case kTfLiteBuiltinHashtableLookup:
-        // NNAPI only support float32 output.
+        // NNAPI only support float32 output and int32 keys.
         if (version == 1 &&
+            context->tensors[node->inputs->data[0]].type == kTfLiteInt32 &&
             context->tensors[node->outputs->data[0]].type == kTfLiteFloat32) {
           return BasicMappingFn<ANEURALNETWORKS_HASHTABLE_LOOKUP>;
         }
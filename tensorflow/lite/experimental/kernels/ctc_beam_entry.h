@@ -20,6 +20,8 @@ limitations under the License.
 
 #include <algorithm>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -57,9 +59,10 @@ class BeamRoot;
 
 template <class CTCBeamState = EmptyBeamState>
 struct BeamEntry {
-  // BeamRoot<CTCBeamState>::AddEntry() serves as the factory method.
-  friend BeamEntry<CTCBeamState>* BeamRoot<CTCBeamState>::AddEntry(
-      BeamEntry<CTCBeamState>* p, int l);
+  // BeamRoot<CTCBeamState>::AddEntry() serves as the factory method. The
+  // whole class is a friend, as BeamRoot needs the size of BeamEntry to lay
+  // out its blocks.
+  friend class BeamRoot<CTCBeamState>;
   inline bool Active() const { return newp.total != kLogZero; }
   // Return the child at the given index, or construct a new one in-place if
   // none was found.
@@ -111,23 +114,52 @@ struct BeamEntry {
 
 // This class owns all instances of BeamEntry.  This is used to avoid recursive
 // destructor call during destruction.
+// The entries are constructed in blocks of kEntriesPerBlock, which Reset()
+// keeps, so that decoding another sequence reuses the memory rather than
+// allocating every entry again.
 template <class CTCBeamState = EmptyBeamState>
 class BeamRoot {
  public:
   BeamRoot(BeamEntry<CTCBeamState>* p, int l) { root_entry_ = AddEntry(p, l); }
+  ~BeamRoot() { DestroyEntries(); }
   BeamRoot(const BeamRoot&) = delete;
   BeamRoot& operator=(const BeamRoot&) = delete;
 
   BeamEntry<CTCBeamState>* AddEntry(BeamEntry<CTCBeamState>* p, int l) {
-    auto* new_entry = new BeamEntry<CTCBeamState>(p, l, this);
-    beam_entries_.emplace_back(new_entry);
-    return new_entry;
+    if (num_entries_ == blocks_.size() * kEntriesPerBlock) {
+      blocks_.emplace_back(new EntryStorage[kEntriesPerBlock]);
+    }
+    EntryStorage* storage = &blocks_[num_entries_ / kEntriesPerBlock]
+                                    [num_entries_ % kEntriesPerBlock];
+    ++num_entries_;
+    return new (storage) BeamEntry<CTCBeamState>(p, l, this);
   }
   BeamEntry<CTCBeamState>* RootEntry() const { return root_entry_; }
 
+  // Destroys all the entries and starts over from a new root entry.
+  void Reset(BeamEntry<CTCBeamState>* p, int l) {
+    DestroyEntries();
+    root_entry_ = AddEntry(p, l);
+  }
+
  private:
+  static constexpr int kEntriesPerBlock = 256;
+  typedef typename std::aligned_storage<
+      sizeof(BeamEntry<CTCBeamState>),
+      alignof(BeamEntry<CTCBeamState>)>::type EntryStorage;
+
+  void DestroyEntries() {
+    for (size_t i = 0; i < num_entries_; ++i) {
+      reinterpret_cast<BeamEntry<CTCBeamState>*>(
+          &blocks_[i / kEntriesPerBlock][i % kEntriesPerBlock])
+          ->~BeamEntry<CTCBeamState>();
+    }
+    num_entries_ = 0;
+  }
+
   BeamEntry<CTCBeamState>* root_entry_ = nullptr;
-  std::vector<std::unique_ptr<BeamEntry<CTCBeamState>>> beam_entries_;
+  std::vector<std::unique_ptr<EntryStorage[]>> blocks_;
+  size_t num_entries_ = 0;
 };
 
 // BeamComparer is the default beam comparer provided in CTCBeamSearch.
@@ -149,6 +149,11 @@ class CTCBeamSearchDecoder : public CTCDecoder {
   std::unique_ptr<BeamRoot> beam_root_;
   BaseBeamScorer<CTCBeamState>* beam_scorer_;
 
+  // Buffers of Step(), kept across steps so that it does not allocate.
+  std::vector<BeamEntry*> branches_;
+  std::vector<float> top_k_logits_;
+  std::vector<int> top_k_indices_;
+
   CTCBeamSearchDecoder(const CTCBeamSearchDecoder&) = delete;
   void operator=(const CTCBeamSearchDecoder&) = delete;
 };
@@ -243,8 +248,8 @@ template <typename CTCBeamState, typename CTCBeamComparer>
 template <typename Vector>
 void CTCBeamSearchDecoder<CTCBeamState, CTCBeamComparer>::Step(
     const Vector& raw_input) {
-  std::vector<float> top_k_logits;
-  std::vector<int> top_k_indices;
+  std::vector<float>& top_k_logits = top_k_logits_;
+  std::vector<int>& top_k_indices = top_k_indices_;
   const bool top_k =
       (label_selection_size_ > 0 && label_selection_size_ < raw_input.size());
   // Number of character classes to consider in each step.
@@ -274,15 +279,16 @@ void CTCBeamSearchDecoder<CTCBeamState, CTCBeamComparer>::Step(
   // Extract the beams sorted in decreasing new probability
   TFLITE_DCHECK_EQ(num_classes_, raw_input.size());
 
-  std::unique_ptr<std::vector<BeamEntry*>> branches(leaves_.Extract());
+  std::vector<BeamEntry*>& branches = branches_;
+  leaves_.ExtractNondestructive(&branches);
   leaves_.Reset();
 
-  for (BeamEntry* b : *branches) {
+  for (BeamEntry* b : branches) {
     // P(.. @ t) becomes the new P(.. @ t-1)
     b->oldp = b->newp;
   }
 
-  for (BeamEntry* b : *branches) {
+  for (BeamEntry* b : branches) {
     if (b->parent != nullptr) {  // if not the root
       if (b->parent->Active()) {
         // If last two sequence characters are identical:
@@ -316,7 +322,7 @@ void CTCBeamSearchDecoder<CTCBeamState, CTCBeamComparer>::Step(
   // originally in descending newp order and we copied newp to oldp.
 
   // Grow new leaves
-  for (BeamEntry* b : *branches) {
+  for (BeamEntry* b : branches) {
     // A new leaf (represented by its BeamProbability) is a candidate
     // iff its total probability is nonzero and either the beam list
     // isn't full, or the lowest probability entry in the beam has a
@@ -381,8 +387,12 @@ void CTCBeamSearchDecoder<CTCBeamState, CTCBeamComparer>::Reset() {
   leaves_.Reset();
 
   // This beam root, and all of its children, will be in memory until
-  // the next reset.
-  beam_root_.reset(new BeamRoot(nullptr, -1));
+  // the next reset, which reuses their memory for the new ones.
+  if (beam_root_ == nullptr) {
+    beam_root_.reset(new BeamRoot(nullptr, -1));
+  } else {
+    beam_root_->Reset(nullptr, -1);
+  }
   beam_root_->RootEntry()->newp.total = 0.0;  // ln(1)
   beam_root_->RootEntry()->newp.blank = 0.0;  // ln(1)
 
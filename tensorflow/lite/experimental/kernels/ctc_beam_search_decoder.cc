@@ -12,10 +12,15 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
+#include <algorithm>
+#include <memory>
 #include <vector>
 #include "flatbuffers/flexbuffers.h"  // TF:flatbuffers
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/experimental/kernels/ctc_beam_search.h"
+#include "tensorflow/lite/kernels/cpu_backend_context.h"
+#include "tensorflow/lite/kernels/cpu_backend_support.h"
+#include "tensorflow/lite/kernels/cpu_backend_threadpool.h"
 #include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
 #include "tensorflow/lite/kernels/internal/tensor.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
@@ -28,36 +33,78 @@ namespace ctc_beam_search_decoder {
 
 constexpr int kInputsTensor = 0;
 constexpr int kSequenceLengthTensor = 1;
+// Optional, streaming mode only.
+constexpr int kResetTensor = 2;
 
 typedef struct {
   int beam_width;
   int top_paths;
   bool merge_repeated;
+  // Only the label_selection_size labels with the highest inputs of a frame,
+  // and within label_selection_margin of the best one, extend the beams. Zero
+  // and a negative margin respectively mean no limit.
+  int label_selection_size;
+  float label_selection_margin;
+  // In streaming mode the beams of each batch element are kept across
+  // invocations, so that a sequence can be decoded as its frames arrive:
+  // every invocation steps through sequence_length more frames and outputs
+  // the best paths of all the frames so far. The beams of batch element b
+  // start over when the op is prepared again or, if the op has a third bool
+  // input, when element b of that input is true.
+  bool streaming;
 } CTCBeamSearchDecoderParams;
 
+typedef ::tflite::experimental::ctc::CTCBeamSearchDecoder<> BeamSearchDecoder;
+
+struct OpData {
+  CTCBeamSearchDecoderParams params;
+  BeamSearchDecoder::DefaultBeamScorer beam_scorer;
+  // One decoder per batch element, created in Prepare.
+  std::vector<std::unique_ptr<BeamSearchDecoder>> decoders;
+};
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_CHECK(buffer != nullptr);
   const uint8_t* buffer_t = reinterpret_cast<const uint8_t*>(buffer);
   const flexbuffers::Map& m = flexbuffers::GetRoot(buffer_t, length).AsMap();
 
-  CTCBeamSearchDecoderParams* option = new CTCBeamSearchDecoderParams;
+  cpu_backend_support::IncrementUsageCounter(context);
+  OpData* op_data = new OpData;
+  CTCBeamSearchDecoderParams* option = &op_data->params;
   option->beam_width = m["beam_width"].AsInt32();
   option->top_paths = m["top_paths"].AsInt32();
   option->merge_repeated = m["merge_repeated"].AsBool();
-
-  return option;
+  if (m["label_selection_size"].IsNull())
+    option->label_selection_size = 0;
+  else
+    option->label_selection_size = m["label_selection_size"].AsInt32();
+  if (m["label_selection_margin"].IsNull())
+    option->label_selection_margin = -1.0f;
+  else
+    option->label_selection_margin = m["label_selection_margin"].AsFloat();
+  if (m["streaming"].IsNull())
+    option->streaming = false;
+  else
+    option->streaming = m["streaming"].AsBool();
+
+  return op_data;
 }
 
 void Free(TfLiteContext* context, void* buffer) {
-  delete reinterpret_cast<CTCBeamSearchDecoderParams*>(buffer);
+  cpu_backend_support::DecrementUsageCounter(context);
+  delete reinterpret_cast<OpData*>(buffer);
 }
 
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
-  const CTCBeamSearchDecoderParams* option =
-      reinterpret_cast<CTCBeamSearchDecoderParams*>(node->user_data);
+  OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
+  const CTCBeamSearchDecoderParams* option = &op_data->params;
   const int top_paths = option->top_paths;
   TF_LITE_ENSURE(context, option->beam_width >= top_paths);
-  TF_LITE_ENSURE_EQ(context, NumInputs(node), 2);
+  if (option->streaming) {
+    TF_LITE_ENSURE(context, NumInputs(node) == 2 || NumInputs(node) == 3);
+  } else {
+    TF_LITE_ENSURE_EQ(context, NumInputs(node), 2);
+  }
   // The outputs should be top_paths * 3 + 1.
   TF_LITE_ENSURE_EQ(context, NumOutputs(node), 3 * top_paths + 1);
 
@@ -74,6 +121,25 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   // TensorFlow only supports int32.
   TF_LITE_ENSURE_EQ(context, sequence_length->type, kTfLiteInt32);
 
+  if (NumInputs(node) == 3) {
+    const TfLiteTensor* reset = GetInput(context, node, kResetTensor);
+    TF_LITE_ENSURE_EQ(context, NumDimensions(reset), 1);
+    TF_LITE_ENSURE_EQ(context, NumElements(reset), batch_size);
+    TF_LITE_ENSURE_EQ(context, reset->type, kTfLiteBool);
+  }
+
+  // The decoders are kept across invocations, which in streaming mode keeps
+  // their beams and otherwise reuses their memory.
+  const int num_classes = SizeOfDimension(inputs, 2);
+  op_data->decoders.clear();
+  for (int b = 0; b < batch_size; ++b) {
+    op_data->decoders.emplace_back(new BeamSearchDecoder(
+        num_classes, option->beam_width, &op_data->beam_scorer,
+        1 /* batch_size */, option->merge_repeated));
+    op_data->decoders.back()->SetLabelSelectionParameters(
+        option->label_selection_size, option->label_selection_margin);
+  }
+
   // Resize decoded outputs.
   // Do not resize indices & values cause we don't know the values yet.
   for (int i = 0; i < top_paths; ++i) {
@@ -159,20 +225,85 @@ TfLiteStatus StoreAllDecodedSequences(
   return kTfLiteOk;
 }
 
+// Decodes the batch elements in [start, end), each with its own decoder.
+struct DecodeWorkerTask : cpu_backend_threadpool::Task {
+  DecodeWorkerTask(OpData* op_data, const float* inputs,
+                   const int32_t* sequence_length, const bool* reset,
+                   int batch_size, int num_classes, int start, int end,
+                   std::vector<std::vector<std::vector<int>>>* best_paths,
+                   float* log_probabilities_output)
+      : op_data_(op_data),
+        inputs_(inputs),
+        sequence_length_(sequence_length),
+        reset_(reset),
+        batch_size_(batch_size),
+        num_classes_(num_classes),
+        start_(start),
+        end_(end),
+        best_paths_(best_paths),
+        log_probabilities_output_(log_probabilities_output) {}
+
+  void Run() override {
+    const CTCBeamSearchDecoderParams& option = op_data_->params;
+    const int top_paths = option.top_paths;
+    for (int b = start_; b < end_; ++b) {
+      BeamSearchDecoder* beam_search = op_data_->decoders[b].get();
+      if (reset_ != nullptr && reset_[b]) {
+        beam_search->Reset();
+      }
+      // The inputs of batch element b at time t are contiguous, and are
+      // stepped through in place.
+      for (int t = 0; t < sequence_length_[b]; ++t) {
+        beam_search->Step(Eigen::Map<const Eigen::ArrayXf>(
+            inputs_ + (t * batch_size_ + b) * num_classes_, num_classes_));
+      }
+      auto& best_paths_b = (*best_paths_)[b];
+      best_paths_b.resize(top_paths);
+      if (!beam_search->TopPaths(top_paths, &best_paths_b, &log_probs_,
+                                 option.merge_repeated)) {
+        ok_ = false;
+        return;
+      }
+      if (!option.streaming) {
+        beam_search->Reset();
+      }
+
+      // Fill in log_probabilities output.
+      for (int bp = 0; bp < top_paths; ++bp) {
+        log_probabilities_output_[b * top_paths + bp] = log_probs_[bp];
+      }
+    }
+  }
+
+  bool ok() const { return ok_; }
+
+ private:
+  OpData* op_data_;
+  const float* inputs_;
+  const int32_t* sequence_length_;
+  const bool* reset_;
+  int batch_size_;
+  int num_classes_;
+  int start_;
+  int end_;
+  std::vector<std::vector<std::vector<int>>>* best_paths_;
+  float* log_probabilities_output_;
+  std::vector<float> log_probs_;
+  bool ok_ = true;
+};
+
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteTensor* inputs = GetInput(context, node, kInputsTensor);
   const TfLiteTensor* sequence_length =
       GetInput(context, node, kSequenceLengthTensor);
-  const CTCBeamSearchDecoderParams* option =
-      reinterpret_cast<CTCBeamSearchDecoderParams*>(node->user_data);
+  OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
+  const CTCBeamSearchDecoderParams* option = &op_data->params;
 
   const int max_time = SizeOfDimension(inputs, 0);
   const int batch_size = SizeOfDimension(inputs, 1);
   const int num_classes = SizeOfDimension(inputs, 2);
 
-  const int beam_width = option->beam_width;
   const int top_paths = option->top_paths;
-  const bool merge_repeated = option->merge_repeated;
 
   // Validate sequence length is less or equal than max time.
   for (int i = 0; i < batch_size; ++i) {
@@ -180,56 +311,44 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
                    max_time >= GetTensorData<int32_t>(sequence_length)[i]);
   }
 
-  // The following logic is implemented like
-  // tensorflow/core/kernels/ctc_decoder_ops.cc
-  std::vector<optimized_ops::TTypes<float>::UnalignedConstMatrix> input_list_t;
-
-  for (std::size_t t = 0; t < max_time; ++t) {
-    input_list_t.emplace_back(
-        GetTensorData<float>(inputs) + t * batch_size * num_classes, batch_size,
-        num_classes);
+  const bool* reset = nullptr;
+  if (NumInputs(node) == 3) {
+    reset = GetTensorData<bool>(GetInput(context, node, kResetTensor));
   }
 
-  ::tflite::experimental::ctc::CTCBeamSearchDecoder<>::DefaultBeamScorer
-      beam_scorer;
-  ::tflite::experimental::ctc::CTCBeamSearchDecoder<> beam_search(
-      num_classes, beam_width, &beam_scorer, 1 /* batch_size */,
-      merge_repeated);
-
-  // Allocate temporary memory for holding chip operation data.
-  float* input_chip_t_data =
-      static_cast<float*>(malloc(num_classes * sizeof(float)));
-  Eigen::array<Eigen::DenseIndex, 1> dims;
-  dims[0] = num_classes;
-  optimized_ops::TTypes<float>::Flat input_chip_t(input_chip_t_data, dims);
-
   std::vector<std::vector<std::vector<int>>> best_paths(batch_size);
-  std::vector<float> log_probs;
 
   TfLiteTensor* log_probabilities = GetOutput(context, node, 3 * top_paths);
   float* log_probabilities_output = GetTensorData<float>(log_probabilities);
 
   // Assumption: the blank index is num_classes - 1
-  for (int b = 0; b < batch_size; ++b) {
-    auto& best_paths_b = best_paths[b];
-    best_paths_b.resize(top_paths);
-    for (int t = 0; t < GetTensorData<int32_t>(sequence_length)[b]; ++t) {
-      input_chip_t = input_list_t[t].chip(b, 0);
-      auto input_bi =
-          Eigen::Map<const Eigen::ArrayXf>(input_chip_t.data(), num_classes);
-      beam_search.Step(input_bi);
-    }
-    TF_LITE_ENSURE(context, beam_search.TopPaths(top_paths, &best_paths_b,
-                                                 &log_probs, merge_repeated));
-    beam_search.Reset();
-
-    // Fill in log_probabilities output.
-    for (int bp = 0; bp < top_paths; ++bp) {
-      log_probabilities_output[b * top_paths + bp] = log_probs[bp];
-    }
+  // The batch elements are decoded independently, so they are split across
+  // threads.
+  CpuBackendContext* cpu_backend_context =
+      cpu_backend_support::GetFromContext(context);
+  const int thread_count = std::max(
+      1, std::min(cpu_backend_context->max_num_threads(), batch_size));
+  std::vector<DecodeWorkerTask> tasks;
+  tasks.reserve(thread_count);
+  int start = 0;
+  for (int i = 0; i < thread_count; ++i) {
+    const int end = start + (batch_size - start) / (thread_count - i);
+    tasks.emplace_back(op_data, GetTensorData<float>(inputs),
+                       GetTensorData<int32_t>(sequence_length), reset,
+                       batch_size, num_classes, start, end, &best_paths,
+                       log_probabilities_output);
+    start = end;
+  }
+  if (tasks.size() == 1) {
+    tasks[0].Run();
+  } else {
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(),
+                                    cpu_backend_context);
+  }
+  for (const DecodeWorkerTask& task : tasks) {
+    TF_LITE_ENSURE(context, task.ok());
   }
 
-  free(input_chip_t_data);
   return StoreAllDecodedSequences(context, best_paths, node, top_paths);
 }
 
@@ -43,9 +43,14 @@ class CTCBeamSearchDecoderOpModel : public SingleOpModel {
   CTCBeamSearchDecoderOpModel(std::initializer_list<int> input_shape,
                               std::initializer_list<int> sequence_length_shape,
                               int beam_width, int top_paths,
-                              bool merge_repeated) {
+                              bool merge_repeated,
+                              int label_selection_size = 0,
+                              bool streaming = false) {
     inputs_ = AddInput(TensorType_FLOAT32);
     sequence_length_ = AddInput(TensorType_INT32);
+    if (streaming) {
+      reset_ = AddInput(TensorType_BOOL);
+    }
 
     for (int i = 0; i < top_paths * 3; ++i) {
       outputs_.push_back(AddOutput(TensorType_INT32));
@@ -57,17 +62,26 @@ class CTCBeamSearchDecoderOpModel : public SingleOpModel {
       fbb.Int("beam_width", beam_width);
       fbb.Int("top_paths", top_paths);
       fbb.Bool("merge_repeated", merge_repeated);
+      fbb.Int("label_selection_size", label_selection_size);
+      fbb.Bool("streaming", streaming);
     });
     fbb.Finish();
     SetCustomOp("CTCBeamSearchDecoder", fbb.GetBuffer(),
                 Register_CTC_BEAM_SEARCH_DECODER);
-    BuildInterpreter({input_shape, sequence_length_shape});
+    if (streaming) {
+      BuildInterpreter(
+          {input_shape, sequence_length_shape, sequence_length_shape});
+    } else {
+      BuildInterpreter({input_shape, sequence_length_shape});
+    }
   }
 
   int inputs() { return inputs_; }
 
   int sequence_length() { return sequence_length_; }
 
+  int reset() { return reset_; }
+
   std::vector<std::vector<int>> GetDecodedOutpus() {
     std::vector<std::vector<int>> outputs;
     for (int i = 0; i < outputs_.size() - 1; ++i) {
@@ -91,6 +105,7 @@ class CTCBeamSearchDecoderOpModel : public SingleOpModel {
  private:
   int inputs_;
   int sequence_length_;
+  int reset_;
   std::vector<int> outputs_;
 };
 
@@ -225,6 +240,81 @@ TEST(CTCBeamSearchTest, NonEqualSequencesTest) {
               ElementsAreArray(ArrayFloatNear({-0.97322, -1.16334, -2.15553})));
 }
 
+TEST(CTCBeamSearchTest, LabelSelectionTest) {
+  // Same inputs as MultiPathsTest, where only the best label of each frame
+  // may extend the beams.
+  CTCBeamSearchDecoderOpModel m({3, 2, 5}, {2}, 3, 2, true,
+                                /*label_selection_size=*/1);
+  m.PopulateTensor<float>(
+      m.inputs(),
+      {-2.206851,   -0.09542714, -0.2393415,  -3.81866197, -0.27241158,
+       -0.20371124, -0.68236623, -1.1397166,  -0.17422639, -1.85224048,
+       -0.9406037,  -0.32544678, -0.21846784, -0.38377237, -0.33498676,
+       -0.10139782, -0.51886883, -0.21678554, -0.15267063, -1.91164412,
+       -0.31328673, -0.27462716, -0.65975336, -1.53671973, -2.76554225,
+       -0.23920634, -1.2370502,  -4.98751576, -3.12995717, -0.43129368});
+  m.PopulateTensor<int>(m.sequence_length(), {3, 3});
+  m.Invoke();
+
+  const std::vector<std::vector<int>>& decoded_outputs = m.GetDecodedOutpus();
+  EXPECT_EQ(decoded_outputs.size(), 6);
+  // The best paths are unchanged, the second ones only use the best labels.
+  EXPECT_THAT(decoded_outputs[0], ElementsAre(0, 0, 0, 1, 1, 0, 1, 1));
+  EXPECT_THAT(decoded_outputs[1], ElementsAre(0, 0, 1, 0));
+  EXPECT_THAT(decoded_outputs[2], ElementsAre(1, 2, 3, 0));
+  EXPECT_THAT(decoded_outputs[3], ElementsAre(1, 3));
+  EXPECT_THAT(decoded_outputs[4], ElementsAre(2, 2));
+  EXPECT_THAT(decoded_outputs[5], ElementsAre(2, 1));
+  EXPECT_THAT(m.GetLogProbabilitiesOutput(),
+              ElementsAreArray(
+                  ArrayFloatNear({-2.65148, -2.94309, -2.12053, -3.13670})));
+}
+
+TEST(CTCBeamSearchTest, StreamingTest) {
+  // Same inputs as MultiPathsTest, fed one frame at a time, with the two
+  // batch elements decoded on separate threads.
+  std::vector<float> inputs = {
+      -2.206851,   -0.09542714, -0.2393415,  -3.81866197, -0.27241158,
+      -0.20371124, -0.68236623, -1.1397166,  -0.17422639, -1.85224048,
+      -0.9406037,  -0.32544678, -0.21846784, -0.38377237, -0.33498676,
+      -0.10139782, -0.51886883, -0.21678554, -0.15267063, -1.91164412,
+      -0.31328673, -0.27462716, -0.65975336, -1.53671973, -2.76554225,
+      -0.23920634, -1.2370502,  -4.98751576, -3.12995717, -0.43129368};
+  CTCBeamSearchDecoderOpModel m({1, 2, 5}, {2}, 3, 2, true,
+                                /*label_selection_size=*/0,
+                                /*streaming=*/true);
+  m.SetNumThreads(2);
+  m.PopulateTensor<int>(m.sequence_length(), {1, 1});
+  for (int t = 0; t < 3; ++t) {
+    m.PopulateTensor<bool>(m.reset(), {t == 0, t == 0});
+    m.PopulateTensor<float>(m.inputs(), 0, inputs.data() + t * 10,
+                            inputs.data() + (t + 1) * 10);
+    m.Invoke();
+  }
+
+  // The outputs are those of decoding the whole sequences at once.
+  const std::vector<std::vector<int>>& decoded_outputs = m.GetDecodedOutpus();
+  EXPECT_EQ(decoded_outputs.size(), 6);
+  EXPECT_THAT(decoded_outputs[0], ElementsAre(0, 0, 0, 1, 1, 0, 1, 1));
+  EXPECT_THAT(decoded_outputs[1], ElementsAre(0, 0, 0, 1, 1, 0));
+  EXPECT_THAT(decoded_outputs[2], ElementsAre(1, 2, 3, 0));
+  EXPECT_THAT(decoded_outputs[3], ElementsAre(2, 1, 0));
+  EXPECT_THAT(decoded_outputs[4], ElementsAre(2, 2));
+  EXPECT_THAT(decoded_outputs[5], ElementsAre(2, 2));
+  EXPECT_THAT(m.GetLogProbabilitiesOutput(),
+              ElementsAreArray(
+                  ArrayFloatNear({-2.65148, -2.65864, -2.17914, -2.61357})));
+
+  // Resetting the first batch element only starts its sequence over.
+  m.PopulateTensor<bool>(m.reset(), {true, false});
+  m.PopulateTensor<int>(m.sequence_length(), {1, 0});
+  m.PopulateTensor<float>(m.inputs(), 0, inputs.data(), inputs.data() + 10);
+  m.Invoke();
+  const std::vector<float> log_probabilities = m.GetLogProbabilitiesOutput();
+  EXPECT_NEAR(log_probabilities[0], -1.04696, 1e-4);
+  EXPECT_NEAR(log_probabilities[2], -2.17914, 1e-4);
+}
+
 }  // namespace
 }  // namespace experimental
 }  // namespace ops
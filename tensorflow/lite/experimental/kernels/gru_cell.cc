@@ -88,6 +88,51 @@ void GruCell(const RuntimeShape& input_shape, const float* input,
   memcpy(output_state, output, n_batch * n_output * sizeof(float));
 }
 
+void GruCellWithInputProjection(
+    const RuntimeShape& state_shape, const float* input_state,
+    const float* input_projection, const float* gate_recurrent_weight,
+    const float* candidate_recurrent_weight, const RuntimeShape& output_shape,
+    float* output, float* output_state, const RuntimeShape& activation_shape,
+    float* activation, float* reset_state,
+    const tflite::FullyConnectedParams& fc_params,
+    tflite::CpuBackendContext* cpu_backend_context) {
+  const int n_batch = state_shape.Dims(0);
+  const int n_output = state_shape.Dims(1);
+  auto x = MapAsArrayWithLastDimAsRows(
+      input_projection, RuntimeShape({n_batch, 3 * n_output}));
+
+  // [r u] = h * gate_recurrent_weight
+  FullyConnected(fc_params, state_shape, input_state,
+                 RuntimeShape({2 * n_output, n_output}), gate_recurrent_weight,
+                 RuntimeShape(), /*optional_bias_data=*/nullptr,
+                 activation_shape, activation, cpu_backend_context);
+
+  // [r u] = sigmoid([r u] + x_ru)
+  auto ru = MapAsArrayWithLastDimAsRows(activation, activation_shape);
+  ru = (ru + x.block(0, 0, 2 * n_output, n_batch))
+           .unaryExpr(Eigen::internal::scalar_logistic_op<float>());
+  auto r = ru.block(0 * n_output, 0, n_output, n_batch);
+  auto u = ru.block(1 * n_output, 0, n_output, n_batch);
+
+  // hr = h .* r
+  auto h = MapAsArrayWithLastDimAsRows(input_state, state_shape);
+  auto hr = MapAsArrayWithLastDimAsRows(reset_state, state_shape);
+  hr = h * r;
+
+  // c = hr * candidate_recurrent_weight + x_c
+  FullyConnected(fc_params, state_shape, reset_state,
+                 RuntimeShape({n_output, n_output}), candidate_recurrent_weight,
+                 RuntimeShape(), /*optional_bias_data=*/nullptr, output_shape,
+                 output, cpu_backend_context);
+
+  auto c = MapAsArrayWithLastDimAsRows(output, output_shape);
+  // output = (1 - u) .* tanh(c) + u .* h
+  c = (1.0 - u) * (c + x.block(2 * n_output, 0, n_output, n_batch)).tanh() +
+      u * h;
+
+  memcpy(output_state, output, n_batch * n_output * sizeof(float));
+}
+
 }  // namespace gru_cell
 }  // namespace experimental
 }  // namespace ops
@@ -38,6 +38,24 @@ void GruCell(const RuntimeShape& input_shape, const float* input,
              const tflite::FullyConnectedParams& fc_params,
              tflite::CpuBackendContext* cpu_backend_context);
 
+// Same as GruCell, with the contribution of the input to the gates and the
+// candidate, i.e. x * [input part of gate_weight, input part of
+// candidate_weight] + [gate_bias, candidate_bias], already computed into
+// input_projection, of shape [n_batch, 3 * n_output]. It does not depend on
+// the state, so it is usually computed for all the time steps of a sequence
+// at once. gate_recurrent_weight, of shape [2 * n_output, n_output], and
+// candidate_recurrent_weight, of shape [n_output, n_output], are the state
+// parts of the weights. reset_state is a scratch buffer of the same shape as
+// the state.
+void GruCellWithInputProjection(
+    const RuntimeShape& state_shape, const float* input_state,
+    const float* input_projection, const float* gate_recurrent_weight,
+    const float* candidate_recurrent_weight, const RuntimeShape& output_shape,
+    float* output, float* output_state, const RuntimeShape& activation_shape,
+    float* activation, float* reset_state,
+    const tflite::FullyConnectedParams& fc_params,
+    tflite::CpuBackendContext* cpu_backend_context);
+
 }  // namespace gru_cell
 }  // namespace experimental
 }  // namespace ops
@@ -13,12 +13,14 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <cstring>
 #include <limits>
 
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/experimental/kernels/gru_cell.h"
 #include "tensorflow/lite/kernels/cpu_backend_context.h"
 #include "tensorflow/lite/kernels/cpu_backend_support.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
 #include "tensorflow/lite/kernels/internal/tensor.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 
@@ -28,50 +30,81 @@ namespace experimental {
 namespace unidirectional_sequence_gru {
 namespace {
 
+// Splits the weights of the gates and the candidate into their input and state
+// parts, and packs the input ones and the biases so that the contribution of
+// the input to the gates and the candidate is computed with a single matrix
+// multiplication.
+void PackWeights(const TfLiteTensor* gate_weight, const TfLiteTensor* gate_bias,
+                 const TfLiteTensor* candidate_weight,
+                 const TfLiteTensor* candidate_bias, TfLiteTensor* input_weight,
+                 TfLiteTensor* recurrent_weight, TfLiteTensor* input_bias) {
+  const int n_output = candidate_weight->dims->data[0];
+  const int n_input = candidate_weight->dims->data[1] - n_output;
+  const float* weight_rows[2] = {GetTensorData<float>(gate_weight),
+                                 GetTensorData<float>(candidate_weight)};
+  const int n_rows[2] = {2 * n_output, n_output};
+  float* input_weight_data = GetTensorData<float>(input_weight);
+  float* recurrent_weight_data = GetTensorData<float>(recurrent_weight);
+  for (int w = 0; w < 2; ++w) {
+    const float* weight_data = weight_rows[w];
+    for (int row = 0; row < n_rows[w]; ++row) {
+      memcpy(input_weight_data, weight_data, n_input * sizeof(float));
+      memcpy(recurrent_weight_data, weight_data + n_input,
+             n_output * sizeof(float));
+      input_weight_data += n_input;
+      recurrent_weight_data += n_output;
+      weight_data += n_input + n_output;
+    }
+  }
+  float* input_bias_data = GetTensorData<float>(input_bias);
+  memcpy(input_bias_data, GetTensorData<float>(gate_bias),
+         2 * n_output * sizeof(float));
+  memcpy(input_bias_data + 2 * n_output, GetTensorData<float>(candidate_bias),
+         n_output * sizeof(float));
+}
+
 void GruImpl(const TfLiteTensor* input, const TfLiteTensor* input_state,
-             const TfLiteTensor* gate_weight, const TfLiteTensor* gate_bias,
-             const TfLiteTensor* candidate_weight,
-             const TfLiteTensor* candidate_bias, TfLiteTensor* output,
+             const TfLiteTensor* input_weight,
+             const TfLiteTensor* recurrent_weight,
+             const TfLiteTensor* input_bias, TfLiteTensor* output,
              TfLiteTensor* output_state, TfLiteTensor* activation,
-             TfLiteTensor* concat,
+             TfLiteTensor* reset_state, TfLiteTensor* input_projection,
              tflite::CpuBackendContext* cpu_backend_context) {
   const int n_time = input->dims->data[0];
   const int n_batch = input->dims->data[1];
   const int n_input = input->dims->data[2];
   const int n_output = output->dims->data[2];
-  const int n_batch_input = n_batch * n_input;
   const int n_batch_output = n_batch * n_output;
-  const RuntimeShape input_shape({n_batch, n_input});
-  const float* input_data = GetTensorData<float>(input);
   const RuntimeShape state_shape = GetTensorShape(input_state);
   const float* input_state_data = GetTensorData<float>(input_state);
-  const RuntimeShape gate_weight_shape = GetTensorShape(gate_weight);
-  const float* gate_weight_data = GetTensorData<float>(gate_weight);
-  const RuntimeShape gate_bias_shape = GetTensorShape(gate_bias);
-  const float* gate_bias_data = GetTensorData<float>(gate_bias);
-  const RuntimeShape candidate_weight_shape = GetTensorShape(candidate_weight);
-  const float* candidate_weight_data = GetTensorData<float>(candidate_weight);
-  const RuntimeShape candidate_bias_shape = GetTensorShape(candidate_bias);
-  const float* candidate_bias_data = GetTensorData<float>(candidate_bias);
+  const float* recurrent_weight_data = GetTensorData<float>(recurrent_weight);
   const RuntimeShape activation_shape = GetTensorShape(activation);
   const RuntimeShape output_shape = RuntimeShape({n_batch, n_output});
   float* output_data = GetTensorData<float>(output);
   float* output_state_data = GetTensorData<float>(output_state);
   float* activation_data = GetTensorData<float>(activation);
-  const RuntimeShape concat_shape = GetTensorShape(concat);
-  float* concat_data = GetTensorData<float>(concat);
+  float* reset_state_data = GetTensorData<float>(reset_state);
+  const float* input_projection_data = GetTensorData<float>(input_projection);
   tflite::FullyConnectedParams fc_params;
   fc_params.float_activation_min = std::numeric_limits<float>::lowest();
   fc_params.float_activation_max = std::numeric_limits<float>::max();
+
+  // The contribution of the input to the gates and the candidate does not
+  // depend on the state, so it is computed for all the time steps at once.
+  optimized_ops::FullyConnected(
+      fc_params, RuntimeShape({n_time * n_batch, n_input}),
+      GetTensorData<float>(input), GetTensorShape(input_weight),
+      GetTensorData<float>(input_weight), GetTensorShape(input_bias),
+      GetTensorData<float>(input_bias), GetTensorShape(input_projection),
+      GetTensorData<float>(input_projection), cpu_backend_context);
+
   for (int i = 0; i < n_time; ++i) {
-    gru_cell::GruCell(
-        input_shape, input_data, state_shape, input_state_data,
-        gate_weight_shape, gate_weight_data, gate_bias_shape, gate_bias_data,
-        candidate_weight_shape, candidate_weight_data, candidate_bias_shape,
-        candidate_bias_data, output_shape, output_data, output_state_data,
-        activation_shape, activation_data, concat_shape, concat_data, fc_params,
-        cpu_backend_context);
-    input_data += n_batch_input;
+    gru_cell::GruCellWithInputProjection(
+        state_shape, input_state_data, input_projection_data,
+        recurrent_weight_data, recurrent_weight_data + 2 * n_output * n_output,
+        output_shape, output_data, output_state_data, activation_shape,
+        activation_data, reset_state_data, fc_params, cpu_backend_context);
+    input_projection_data += 3 * n_batch_output;
     output_data += n_batch_output;
     input_state_data = output_state_data;
   }
@@ -106,25 +139,62 @@ enum OutputTensor {
 enum TemporaryTensor {
   // Scratch buffer for activation of size [n_batch, 2*n_output]
   kActivation = 0,
-  // Scratch buffer for activation of size [n_batch, n_input+n_output]
-  kConcat = 1,
-  kTemporaryNum = 2
+  // Scratch buffer for the state times the reset gate of size
+  // [n_batch, n_output]
+  kResetState = 1,
+  // Input part of the gate and candidate weights of size
+  // [3*n_output, n_input]
+  kInputWeight = 2,
+  // State part of the gate and candidate weights of size
+  // [3*n_output, n_output]
+  kRecurrentWeight = 3,
+  // Gate and candidate biases of size [3*n_output]
+  kInputBias = 4,
+  // Contribution of the input to the gates and the candidate of size
+  // [n_time, n_batch, 3*n_output]
+  kInputProjection = 5,
+  kTemporaryNum = 6
+};
+
+struct OpData {
+  int scratch_tensor_index;
+  // The weights are split and packed into the kInputWeight, kRecurrentWeight
+  // and kInputBias temporaries. Constant weights are only packed once.
+  bool weights_are_constant;
+  bool have_weights_been_packed;
 };
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   cpu_backend_support::IncrementUsageCounter(context);
-  auto* scratch_tensor_index = new int;
-  context->AddTensors(context, kTemporaryNum, scratch_tensor_index);
-  return scratch_tensor_index;
+  auto* op_data = new OpData();
+  context->AddTensors(context, kTemporaryNum, &op_data->scratch_tensor_index);
+  return op_data;
 }
 
 void Free(TfLiteContext* context, void* buffer) {
   cpu_backend_support::DecrementUsageCounter(context);
-  delete reinterpret_cast<int*>(buffer);
+  delete reinterpret_cast<OpData*>(buffer);
+}
+
+// Sets up a temporary tensor of the given shape.
+TfLiteStatus SetUpTemporary(TfLiteContext* context, TfLiteNode* node,
+                            int index, TfLiteAllocationType allocation_type,
+                            std::initializer_list<int> shape) {
+  const OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
+  node->temporaries->data[index] = op_data->scratch_tensor_index + index;
+  TfLiteTensor* tensor = GetTemporary(context, node, index);
+  tensor->type = kTfLiteFloat32;
+  tensor->allocation_type = allocation_type;
+  TfLiteIntArray* size = TfLiteIntArrayCreate(shape.size());
+  int i = 0;
+  for (const int dim : shape) {
+    size->data[i++] = dim;
+  }
+  return context->ResizeTensor(context, tensor, size);
 }
 
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
-  int* scratch_tensor_index = reinterpret_cast<int*>(node->user_data);
+  OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
 
   TF_LITE_ENSURE_EQ(context, node->inputs->size, kInputNum);
   TF_LITE_ENSURE_EQ(context, node->outputs->size, kOutputNum);
@@ -185,26 +255,43 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   node->temporaries = TfLiteIntArrayCreate(kTemporaryNum);
 
   // activation's dim = [n_batch, 2 * n_output]
-  node->temporaries->data[kActivation] = *scratch_tensor_index;
-  TfLiteTensor* activation = GetTemporary(context, node, kActivation);
-  activation->type = input->type;
-  activation->allocation_type = kTfLiteArenaRw;
-  TfLiteIntArray* activation_size = TfLiteIntArrayCreate(2);
-  activation_size->data[0] = n_batch;
-  activation_size->data[1] = 2 * n_output;
+  TF_LITE_ENSURE_OK(context,
+                    SetUpTemporary(context, node, kActivation, kTfLiteArenaRw,
+                                   {n_batch, 2 * n_output}));
+
+  // reset_state's dim = [n_batch, n_output]
+  TF_LITE_ENSURE_OK(context,
+                    SetUpTemporary(context, node, kResetState, kTfLiteArenaRw,
+                                   {n_batch, n_output}));
+
+  // The packed weights are kept across invocations when they are constant.
+  op_data->weights_are_constant =
+      IsConstantTensor(gate_weight) && IsConstantTensor(gate_bias) &&
+      IsConstantTensor(candidate_weight) && IsConstantTensor(candidate_bias);
+  op_data->have_weights_been_packed = false;
+  const TfLiteAllocationType weights_allocation_type =
+      op_data->weights_are_constant ? kTfLiteArenaRwPersistent
+                                    : kTfLiteArenaRw;
+
+  // input_weight's dim = [3 * n_output, n_input]
   TF_LITE_ENSURE_OK(
-      context, context->ResizeTensor(context, activation, activation_size));
-
-  // concat's dim  = [n_batch, n_input + n_output]
-  node->temporaries->data[kConcat] = (*scratch_tensor_index) + kConcat;
-  TfLiteTensor* concat = GetTemporary(context, node, kConcat);
-  concat->type = input->type;
-  concat->allocation_type = kTfLiteArenaRw;
-  TfLiteIntArray* concat_size = TfLiteIntArrayCreate(2);
-  concat_size->data[0] = n_batch;
-  concat_size->data[1] = n_input + n_output;
+      context, SetUpTemporary(context, node, kInputWeight,
+                              weights_allocation_type, {3 * n_output, n_input}));
+
+  // recurrent_weight's dim = [3 * n_output, n_output]
+  TF_LITE_ENSURE_OK(context, SetUpTemporary(context, node, kRecurrentWeight,
+                                            weights_allocation_type,
+                                            {3 * n_output, n_output}));
+
+  // input_bias's dim = [3 * n_output]
   TF_LITE_ENSURE_OK(context,
-                    context->ResizeTensor(context, concat, concat_size));
+                    SetUpTemporary(context, node, kInputBias,
+                                   weights_allocation_type, {3 * n_output}));
+
+  // input_projection's dim = [n_time, n_batch, 3 * n_output]
+  TF_LITE_ENSURE_OK(
+      context, SetUpTemporary(context, node, kInputProjection, kTfLiteArenaRw,
+                              {n_time, n_batch, 3 * n_output}));
 
   return kTfLiteOk;
 }
@@ -220,12 +307,24 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   TfLiteTensor* output = GetOutput(context, node, kOutput);
   TfLiteTensor* output_state = GetOutput(context, node, kOutputState);
   TfLiteTensor* activation = GetTemporary(context, node, kActivation);
-  TfLiteTensor* concat = GetTemporary(context, node, kConcat);
+  TfLiteTensor* reset_state = GetTemporary(context, node, kResetState);
+  TfLiteTensor* input_weight = GetTemporary(context, node, kInputWeight);
+  TfLiteTensor* recurrent_weight =
+      GetTemporary(context, node, kRecurrentWeight);
+  TfLiteTensor* input_bias = GetTemporary(context, node, kInputBias);
+  TfLiteTensor* input_projection =
+      GetTemporary(context, node, kInputProjection);
   auto cpu_backend_context = cpu_backend_support::GetFromContext(context);
+  OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
 
   if (gate_weight->type == kTfLiteFloat32) {
-    GruImpl(input, input_state, gate_weight, gate_bias, candidate_weight,
-            candidate_bias, output, output_state, activation, concat,
+    if (!op_data->weights_are_constant || !op_data->have_weights_been_packed) {
+      PackWeights(gate_weight, gate_bias, candidate_weight, candidate_bias,
+                  input_weight, recurrent_weight, input_bias);
+      op_data->have_weights_been_packed = true;
+    }
+    GruImpl(input, input_state, input_weight, recurrent_weight, input_bias,
+            output, output_state, activation, reset_state, input_projection,
             cpu_backend_context);
   } else {
     context->ReportError(context,
@@ -19,13 +19,17 @@ limitations under the License.
 #include <cstdarg>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 
+#include "tensorflow/lite/allocation.h"
+#include "tensorflow/lite/arena_planner.h"
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/context_util.h"
 #include "tensorflow/lite/core/api/error_reporter.h"
 #include "tensorflow/lite/graph_info.h"
 #include "tensorflow/lite/memory_planner.h"
 #include "tensorflow/lite/minimal_logging.h"
+#include "tensorflow/lite/profiling/time.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/util.h"
 
@@ -49,11 +53,73 @@ TfLiteQuantization GetQuantizationFromLegacy(
   affine_quantization->zero_point = TfLiteIntArrayCreate(1);
   affine_quantization->scale->data[0] = legacy_quantization.scale;
   affine_quantization->zero_point->data[0] = legacy_quantization.zero_point;
+  affine_quantization->quantized_dimension = 0;
   quantization.params = affine_quantization;
 
   return quantization;
 }
 
+// Layout of the files written by SaveArenaPlan: a header, then for each
+// subgraph an ArenaPlanFileSubgraph followed by the ArenaPlanFileAlloc of
+// each of its tensors.
+constexpr uint32_t kArenaPlanFileMagic = 0x504c4654;  // "TFLP"
+constexpr uint32_t kArenaPlanFileVersion = 1;
+
+struct ArenaPlanFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t model_hash;
+  uint64_t num_subgraphs;
+};
+
+struct ArenaPlanFileSubgraph {
+  uint64_t fingerprint;
+  uint64_t arena_size;
+  uint64_t persistent_arena_size;
+  uint64_t num_tensors;
+};
+
+struct ArenaPlanFileAlloc {
+  uint64_t offset;
+  uint64_t size;
+};
+
+template <typename T>
+void AppendToBuffer(const T& value, std::vector<char>* buffer) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  buffer->insert(buffer->end(), bytes, bytes + sizeof(T));
+}
+
+// Reads a T at `*offset` in `buffer` and moves past it. Returns false if
+// `buffer` is too short.
+template <typename T>
+bool ReadFromBuffer(const Allocation& buffer, size_t* offset, T* value) {
+  if (buffer.bytes() < *offset + sizeof(T)) {
+    return false;
+  }
+  memcpy(value, static_cast<const char*>(buffer.base()) + *offset, sizeof(T));
+  *offset += sizeof(T);
+  return true;
+}
+
+// Reads a byte in every page of the read-only tensors of `subgraph`, which
+// makes the system load the pages of a mapped model.
+void FaultInReadOnlyTensors(const Subgraph& subgraph) {
+  constexpr size_t kPageSize = 4096;
+  volatile char sink = 0;
+  for (size_t i = 0; i < subgraph.tensors_size(); ++i) {
+    const TfLiteTensor* tensor = subgraph.tensor(i);
+    if (tensor->allocation_type != kTfLiteMmapRo ||
+        tensor->data.raw_const == nullptr) {
+      continue;
+    }
+    for (size_t offset = 0; offset < tensor->bytes; offset += kPageSize) {
+      sink = tensor->data.raw_const[offset];
+    }
+  }
+  (void)sink;
+}
+
 }  // namespace
 
 Interpreter::Interpreter(ErrorReporter* error_reporter)
@@ -74,7 +140,7 @@ Interpreter::Interpreter(ErrorReporter* error_reporter)
   UseNNAPI(false);
 }
 
-Interpreter::~Interpreter() {}
+Interpreter::~Interpreter() { WaitForWarmup(); }
 
 void Interpreter::SetExternalContext(TfLiteExternalContextType type,
                                      TfLiteExternalContext* ctx) {
@@ -150,6 +216,164 @@ TfLiteStatus Interpreter::ResetVariableTensors() {
   return primary_subgraph().ResetVariableTensors();
 }
 
+size_t Interpreter::VariableTensorsBytes() const {
+  return primary_subgraph().VariableTensorsBytes();
+}
+
+TfLiteStatus Interpreter::SaveVariableTensors(void* buffer, size_t bytes) {
+  return primary_subgraph().SaveVariableTensors(buffer, bytes);
+}
+
+TfLiteStatus Interpreter::RestoreVariableTensors(const void* buffer,
+                                                 size_t bytes) {
+  return primary_subgraph().RestoreVariableTensors(buffer, bytes);
+}
+
+TfLiteStatus Interpreter::SetVariableTensorsBuffer(void* buffer,
+                                                   size_t bytes) {
+  return primary_subgraph().SetVariableTensorsBuffer(buffer, bytes);
+}
+
+TfLiteStatus Interpreter::SaveArenaPlan(const char* filename,
+                                        uint64_t model_hash) {
+  std::vector<char> buffer;
+  AppendToBuffer(ArenaPlanFileHeader{kArenaPlanFileMagic,
+                                     kArenaPlanFileVersion, model_hash,
+                                     subgraphs_.size()},
+                 &buffer);
+  ArenaPlan plan;
+  for (auto& subgraph : subgraphs_) {
+    TF_LITE_ENSURE_STATUS(subgraph->GetArenaPlan(&plan));
+    AppendToBuffer(ArenaPlanFileSubgraph{plan.fingerprint, plan.arena_size,
+                                         plan.persistent_arena_size,
+                                         plan.allocs.size()},
+                   &buffer);
+    for (const ArenaAlloc& alloc : plan.allocs) {
+      AppendToBuffer(ArenaPlanFileAlloc{alloc.offset, alloc.size}, &buffer);
+    }
+  }
+
+  FILE* file = fopen(filename, "wb");
+  if (file == nullptr) {
+    error_reporter_->Report("Could not open '%s' to write the arena plan.",
+                            filename);
+    return kTfLiteError;
+  }
+  const bool written =
+      fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+  if (fclose(file) != 0 || !written) {
+    error_reporter_->Report("Could not write the arena plan to '%s'.",
+                            filename);
+    return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus Interpreter::LoadArenaPlan(const char* filename,
+                                        uint64_t model_hash) {
+  std::unique_ptr<Allocation> file;
+  if (MMAPAllocation::IsSupported()) {
+    file.reset(new MMAPAllocation(filename, error_reporter_));
+  } else {
+    file.reset(new FileCopyAllocation(filename, error_reporter_));
+  }
+  if (!file->valid()) {
+    return kTfLiteError;
+  }
+
+  size_t offset = 0;
+  ArenaPlanFileHeader header;
+  if (!ReadFromBuffer(*file, &offset, &header) ||
+      header.magic != kArenaPlanFileMagic ||
+      header.version != kArenaPlanFileVersion) {
+    error_reporter_->Report("'%s' is not an arena plan file.", filename);
+    return kTfLiteError;
+  }
+  if (header.model_hash != model_hash ||
+      header.num_subgraphs != subgraphs_.size()) {
+    error_reporter_->Report("The arena plan in '%s' is for another model.",
+                            filename);
+    return kTfLiteError;
+  }
+
+  // Only hand the plans to the subgraphs once the whole file was read.
+  std::vector<ArenaPlan> plans(subgraphs_.size());
+  for (ArenaPlan& plan : plans) {
+    ArenaPlanFileSubgraph subgraph;
+    if (!ReadFromBuffer(*file, &offset, &subgraph) ||
+        (file->bytes() - offset) / sizeof(ArenaPlanFileAlloc) <
+            subgraph.num_tensors) {
+      error_reporter_->Report("The arena plan in '%s' is truncated.",
+                              filename);
+      return kTfLiteError;
+    }
+    plan.fingerprint = subgraph.fingerprint;
+    plan.arena_size = subgraph.arena_size;
+    plan.persistent_arena_size = subgraph.persistent_arena_size;
+    plan.allocs.resize(subgraph.num_tensors);
+    for (ArenaAlloc& alloc : plan.allocs) {
+      ArenaPlanFileAlloc file_alloc;
+      ReadFromBuffer(*file, &offset, &file_alloc);
+      alloc.offset = file_alloc.offset;
+      alloc.size = file_alloc.size;
+    }
+  }
+  for (int i = 0; i < subgraphs_.size(); ++i) {
+    subgraphs_[i]->SetArenaPlan(plans[i]);
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus Interpreter::Warmup(WarmupTimings* timings) {
+  WarmupTimings unused_timings;
+  if (timings == nullptr) timings = &unused_timings;
+
+  int64_t start_us = profiling::time::NowMicros();
+  TF_LITE_ENSURE_STATUS(AllocateTensors());
+  int64_t end_us = profiling::time::NowMicros();
+  timings->prepare_us = end_us - start_us;
+
+  start_us = end_us;
+  for (auto& subgraph : subgraphs_) {
+    FaultInReadOnlyTensors(*subgraph);
+  }
+  end_us = profiling::time::NowMicros();
+  timings->fault_in_us = end_us - start_us;
+
+  start_us = end_us;
+  // String tensors are left alone, as zeroes are not a valid string buffer.
+  for (int tensor_index : inputs()) {
+    TfLiteTensor* input = tensor(tensor_index);
+    if (input->type != kTfLiteString && input->data.raw != nullptr) {
+      memset(input->data.raw, 0, input->bytes);
+    }
+  }
+  std::vector<char> variables(VariableTensorsBytes());
+  TF_LITE_ENSURE_STATUS(
+      SaveVariableTensors(variables.data(), variables.size()));
+  // The dry run is not part of any profile.
+  Profiler* profiler = GetProfiler();
+  SetProfiler(nullptr);
+  const TfLiteStatus status = Invoke();
+  SetProfiler(profiler);
+  TF_LITE_ENSURE_STATUS(
+      RestoreVariableTensors(variables.data(), variables.size()));
+  timings->dry_run_us = profiling::time::NowMicros() - start_us;
+  return status;
+}
+
+void Interpreter::WarmupInBackground() {
+  WaitForWarmup();
+  warmup_thread_ = std::thread([this]() { warmup_status_ = Warmup(); });
+}
+
+TfLiteStatus Interpreter::WaitForWarmup() {
+  if (warmup_thread_.joinable()) {
+    warmup_thread_.join();
+  }
+  return warmup_status_;
+}
+
 TfLiteStatus Interpreter::SetTensorParametersReadOnly(
     int tensor_index, TfLiteType type, const char* name,
     const std::vector<int>& dims, TfLiteQuantization quantization,
@@ -186,6 +410,12 @@ TfLiteStatus Interpreter::SetTensorParametersReadWrite(
       tensor_index, type, name, rank, dims, new_quantization, is_variable);
 }
 
+TfLiteStatus Interpreter::SetTensorDimsSignature(
+    int tensor_index, const std::vector<int>& dims_signature) {
+  return primary_subgraph().SetTensorDimsSignature(tensor_index,
+                                                   dims_signature);
+}
+
 TfLiteStatus Interpreter::SetExecutionPlan(const std::vector<int>& new_plan) {
   return primary_subgraph().SetExecutionPlan(new_plan);
 }
@@ -222,6 +452,8 @@ void Interpreter::SetCancellationFunction(void* data,
 
 TfLiteStatus Interpreter::ModifyGraphWithDelegate(TfLiteDelegate* delegate) {
   for (auto& subgraph : subgraphs_) {
+    // The delegate is applied once, so it needs all the subgraphs built.
+    TF_LITE_ENSURE_OK(context_, subgraph->EnsureMaterialized());
     TF_LITE_ENSURE_OK(context_, subgraph->ModifyGraphWithDelegate(delegate));
   }
   return kTfLiteOk;
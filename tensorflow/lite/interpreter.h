@@ -20,6 +20,7 @@ limitations under the License.
 #include <complex>
 #include <cstdio>
 #include <cstdlib>
+#include <thread>  // NOLINT(build/c++11)
 #include <vector>
 
 #include "tensorflow/lite/allocation.h"
@@ -209,6 +210,14 @@ class Interpreter {
       const int* dims, TfLiteQuantizationParams quantization,
       bool is_variable = false);
 #endif  // DOXYGEN_SKIP
+
+  /// Sets the shape signature of a tensor: its shape with -1 for the
+  /// dimensions only known at runtime, e.g. a batch size or a sequence
+  /// length. Once the inputs were resized along these dimensions a few
+  /// times, AllocateTensors() evaluates the memory plan it learned instead of
+  /// planning again. Models carry signatures in `Tensor.shape_signature`.
+  TfLiteStatus SetTensorDimsSignature(int tensor_index,
+                                      const std::vector<int>& dims_signature);
   // Functions to access tensor data
 
   /// Read only access to list of inputs.
@@ -446,6 +455,88 @@ class Interpreter {
   /// WARNING: This is an experimental API and subject to change.
   TfLiteStatus ResetVariableTensors();
 
+  /// Snapshot and restore of the state of the variable tensors, which lets a
+  /// single interpreter run many independent streams (e.g. audio sessions
+  /// fed chunk by chunk to an RNN model), swapping their states in and out
+  /// between invocations.
+  ///
+  /// Returns the size of the buffers taken by the functions below. Must be
+  /// called after `AllocateTensors`.
+  /// WARNING: This is an experimental API and subject to change.
+  size_t VariableTensorsBytes() const;
+
+  /// Copies the state of all variable tensors to `buffer`.
+  /// WARNING: This is an experimental API and subject to change.
+  TfLiteStatus SaveVariableTensors(void* buffer, size_t bytes);
+
+  /// Copies the state of all variable tensors back from `buffer`.
+  /// WARNING: This is an experimental API and subject to change.
+  TfLiteStatus RestoreVariableTensors(const void* buffer, size_t bytes);
+
+  /// Makes the variable tensors use `buffer` as their storage, without any
+  /// copy. Each stream can own such a buffer, and switching streams is then
+  /// one call. `buffer` must stay valid while in use and should be aligned to
+  /// `kDefaultTensorAlignment`. Passing nullptr goes back to the interpreter's
+  /// own storage, as does any reallocation in `AllocateTensors`.
+  /// WARNING: This is an experimental API and subject to change.
+  TfLiteStatus SetVariableTensorsBuffer(void* buffer, size_t bytes);
+
+  /// Saving and loading of the memory plan made by `AllocateTensors`, i.e.
+  /// the location of every tensor in the arenas, to skip computing it again
+  /// when the same model is loaded by another process. The plan is stored in
+  /// a sidecar file tagged with `model_hash`, typically
+  /// `HashBytes(model->allocation()->base(), model->allocation()->bytes())`.
+  /// The file is in the byte order of the host.
+  ///
+  /// Writes the plan of all subgraphs to `filename`. Must be called after
+  /// `AllocateTensors`, on a graph without dynamic tensors.
+  /// WARNING: This is an experimental API and subject to change.
+  TfLiteStatus SaveArenaPlan(const char* filename, uint64_t model_hash);
+
+  /// Maps `filename` and makes the next `AllocateTensors` use the plans it
+  /// holds. Fails, leaving the interpreter as it was, if the file was not
+  /// written for `model_hash` or for as many subgraphs. Ops are still
+  /// prepared as usual, and a subgraph whose tensors or nodes turn out to
+  /// differ from the saved ones, e.g. with another op resolver, is planned
+  /// as usual too.
+  /// WARNING: This is an experimental API and subject to change.
+  TfLiteStatus LoadArenaPlan(const char* filename, uint64_t model_hash);
+
+  /// Timings of the phases of `Warmup`, in microseconds.
+  struct WarmupTimings {
+    /// Allocating the tensors and preparing the ops, if not done yet.
+    int64_t prepare_us = 0;
+    /// Reading every page of the read-only tensors, e.g. the mapped weights.
+    int64_t fault_in_us = 0;
+    /// Running the graph once, which starts the thread pools of the kernels,
+    /// grows their scratch allocators and resizes the dynamic tensors.
+    int64_t dry_run_us = 0;
+  };
+
+  /// Front-loads the costs of the first `Invoke`, so that it takes as long as
+  /// the following ones. This allocates the tensors if needed, faults in the
+  /// read-only tensors and runs the graph once on zeroed inputs. The input and
+  /// output tensors are overwritten, so this should be called before setting
+  /// the inputs. Models whose ops reject zeroed inputs should run a
+  /// representative `Invoke` instead. The phases are timed into `timings` if
+  /// non-null.
+  /// Only the variable tensors are restored after the dry run. Ops that keep
+  /// state of their own see it as an invocation, e.g. the streaming CTC beam
+  /// search decoder steps its beams through the zeroed frames, and should be
+  /// reset before the first real `Invoke`, e.g. through its reset input.
+  /// WARNING: This is an experimental API and subject to change.
+  TfLiteStatus Warmup(WarmupTimings* timings = nullptr);
+
+  /// Runs `Warmup` on another thread and returns immediately. The
+  /// interpreter must not be used until `WaitForWarmup` returns.
+  /// WARNING: This is an experimental API and subject to change.
+  void WarmupInBackground();
+
+  /// Waits for the warmup started by `WarmupInBackground`, if any, and
+  /// returns its status.
+  /// WARNING: This is an experimental API and subject to change.
+  TfLiteStatus WaitForWarmup();
+
   /// Retrieve an operator's description of its work, for profiling purposes.
   const char* OpProfilingString(const TfLiteRegistration& op_reg,
                                 const TfLiteNode* node) const {
@@ -531,6 +622,10 @@ class Interpreter {
 
   // Subgraphs
   std::vector<std::unique_ptr<Subgraph>> subgraphs_;
+
+  // The thread running `Warmup` after `WarmupInBackground`, and its status.
+  std::thread warmup_thread_;
+  TfLiteStatus warmup_status_ = kTfLiteOk;
 };
 
 }  // namespace tflite
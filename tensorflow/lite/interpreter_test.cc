@@ -100,6 +100,321 @@ TEST(BasicInterpreter, TestAllocateTensorsResetVariableTensors) {
   }
 }
 
+// Builds a graph whose only node adds its input to a variable tensor, which
+// it then copies to the output, i.e. the output is the running sum of the
+// inputs.
+void BuildAccumulatorGraph(Interpreter* interpreter) {
+  ASSERT_EQ(interpreter->AddTensors(4), kTfLiteOk);
+  TfLiteQuantizationParams quant;
+  interpreter->SetTensorParametersReadWrite(0, kTfLiteFloat32, "", {2}, quant);
+  interpreter->SetTensorParametersReadWrite(1, kTfLiteFloat32, "", {2}, quant,
+                                            /*is_variable=*/true);
+  interpreter->SetTensorParametersReadWrite(2, kTfLiteFloat32, "", {3}, quant,
+                                            /*is_variable=*/true);
+  interpreter->SetTensorParametersReadWrite(3, kTfLiteFloat32, "", {2}, quant);
+  interpreter->SetInputs({0});
+  interpreter->SetOutputs({3});
+  interpreter->SetVariables({1, 2});
+
+  TfLiteRegistration reg = {nullptr, nullptr, nullptr, nullptr};
+  reg.invoke = [](TfLiteContext* context, TfLiteNode* node) {
+    const TfLiteTensor* input = &context->tensors[node->inputs->data[0]];
+    TfLiteTensor* state = &context->tensors[node->inputs->data[1]];
+    TfLiteTensor* output = &context->tensors[node->outputs->data[0]];
+    for (int i = 0; i < 2; ++i) {
+      state->data.f[i] += input->data.f[i];
+      output->data.f[i] = state->data.f[i];
+    }
+    return kTfLiteOk;
+  };
+  interpreter->AddNodeWithParameters({0, 1, 2}, {3}, nullptr, 0, nullptr,
+                                     &reg);
+}
+
+std::vector<float> InvokeAccumulator(Interpreter* interpreter, float a,
+                                     float b) {
+  interpreter->typed_tensor<float>(0)[0] = a;
+  interpreter->typed_tensor<float>(0)[1] = b;
+  EXPECT_EQ(interpreter->Invoke(), kTfLiteOk);
+  const float* output = interpreter->typed_tensor<float>(3);
+  return {output[0], output[1]};
+}
+
+TEST(BasicInterpreter, TestSaveRestoreVariableTensors) {
+  Interpreter interpreter;
+  BuildAccumulatorGraph(&interpreter);
+  ASSERT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+  // The second variable starts on an aligned boundary.
+  const size_t bytes = interpreter.VariableTensorsBytes();
+  ASSERT_EQ(bytes, 64 + 3 * sizeof(float));
+  std::vector<char> stream_a(bytes);
+  std::vector<char> stream_b(bytes);
+
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 1, 2),
+              testing::ElementsAre(1, 2));
+  ASSERT_EQ(interpreter.SaveVariableTensors(stream_a.data(), bytes),
+            kTfLiteOk);
+
+  ASSERT_EQ(interpreter.ResetVariableTensors(), kTfLiteOk);
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 10, 20),
+              testing::ElementsAre(10, 20));
+  ASSERT_EQ(interpreter.SaveVariableTensors(stream_b.data(), bytes),
+            kTfLiteOk);
+
+  ASSERT_EQ(interpreter.RestoreVariableTensors(stream_a.data(), bytes),
+            kTfLiteOk);
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 1, 2),
+              testing::ElementsAre(2, 4));
+  ASSERT_EQ(interpreter.RestoreVariableTensors(stream_b.data(), bytes),
+            kTfLiteOk);
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 10, 20),
+              testing::ElementsAre(20, 40));
+
+  // Buffers that are too small are rejected.
+  ASSERT_NE(interpreter.SaveVariableTensors(stream_a.data(), bytes - 1),
+            kTfLiteOk);
+}
+
+TEST(BasicInterpreter, TestVariableTensorsBuffer) {
+  Interpreter interpreter;
+  BuildAccumulatorGraph(&interpreter);
+  ASSERT_EQ(interpreter.SetVariableTensorsBuffer(nullptr, 0), kTfLiteError);
+  ASSERT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+  const size_t bytes = interpreter.VariableTensorsBytes();
+  std::vector<char> stream_a(bytes);
+  std::vector<char> stream_b(bytes);
+  char* arena_data = interpreter.tensor(1)->data.raw;
+
+  ASSERT_EQ(interpreter.SetVariableTensorsBuffer(stream_a.data(), bytes),
+            kTfLiteOk);
+  ASSERT_EQ(interpreter.ResetVariableTensors(), kTfLiteOk);
+  EXPECT_EQ(interpreter.tensor(1)->data.raw, stream_a.data());
+  EXPECT_EQ(interpreter.tensor(2)->data.raw, stream_a.data() + 64);
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 1, 2),
+              testing::ElementsAre(1, 2));
+
+  ASSERT_EQ(interpreter.SetVariableTensorsBuffer(stream_b.data(), bytes),
+            kTfLiteOk);
+  ASSERT_EQ(interpreter.ResetVariableTensors(), kTfLiteOk);
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 10, 20),
+              testing::ElementsAre(10, 20));
+
+  ASSERT_EQ(interpreter.SetVariableTensorsBuffer(stream_a.data(), bytes),
+            kTfLiteOk);
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 1, 2),
+              testing::ElementsAre(2, 4));
+  EXPECT_EQ(reinterpret_cast<float*>(stream_a.data())[1], 4);
+  EXPECT_EQ(reinterpret_cast<float*>(stream_b.data())[1], 20);
+
+  // The interpreter's own storage was left untouched.
+  ASSERT_EQ(interpreter.SetVariableTensorsBuffer(nullptr, 0), kTfLiteOk);
+  EXPECT_EQ(interpreter.tensor(1)->data.raw, arena_data);
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 5, 5),
+              testing::ElementsAre(5, 5));
+
+  // Reallocating the tensors also goes back to the arena.
+  ASSERT_EQ(interpreter.SetVariableTensorsBuffer(stream_a.data(), bytes),
+            kTfLiteOk);
+  ASSERT_EQ(interpreter.ResizeInputTensor(0, {3}), kTfLiteOk);
+  ASSERT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+  EXPECT_NE(interpreter.tensor(1)->data.raw, stream_a.data());
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 1, 1),
+              testing::ElementsAre(1, 1));
+}
+
+std::string ArenaPlanFilename() {
+  const char* tmpdir = getenv("TEST_TMPDIR");
+  return std::string(tmpdir ? tmpdir : "/tmp") + "/interpreter_test_plan";
+}
+
+// Swaps the offsets of tensors `a` and `b` of the single subgraph in the
+// arena plan file `filename`, which holds a 24-byte header, a 32-byte
+// subgraph header, and then the offset and size of each tensor.
+void SwapArenaPlanOffsets(const std::string& filename, int a, int b) {
+  std::vector<char> contents(1024);
+  FILE* file = fopen(filename.c_str(), "rb");
+  ASSERT_NE(file, nullptr);
+  contents.resize(fread(contents.data(), 1, contents.size(), file));
+  fclose(file);
+  const int a_offset = 24 + 32 + 16 * a;
+  const int b_offset = 24 + 32 + 16 * b;
+  ASSERT_LE(std::max(a_offset, b_offset) + 8, contents.size());
+  std::swap_ranges(contents.begin() + a_offset, contents.begin() + a_offset + 8,
+                   contents.begin() + b_offset);
+  file = fopen(filename.c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+  fwrite(contents.data(), 1, contents.size(), file);
+  fclose(file);
+}
+
+TEST(BasicInterpreter, TestSaveLoadArenaPlan) {
+  const std::string filename = ArenaPlanFilename();
+  const uint64_t model_hash = 1234;
+  std::vector<ptrdiff_t> offsets;
+  {
+    Interpreter interpreter;
+    BuildAccumulatorGraph(&interpreter);
+    ASSERT_NE(interpreter.SaveArenaPlan(filename.c_str(), model_hash),
+              kTfLiteOk);
+    ASSERT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+    ASSERT_EQ(interpreter.SaveArenaPlan(filename.c_str(), model_hash),
+              kTfLiteOk);
+    for (int i = 0; i < 4; ++i) {
+      offsets.push_back(interpreter.tensor(i)->data.raw -
+                        interpreter.tensor(i == 1 || i == 2 ? 1 : 0)->data.raw);
+    }
+  }
+  // A plan that the planner would not make, with the input and the output,
+  // which have the same size, swapped. Only a loaded plan gives these offsets.
+  ASSERT_NE(offsets[3], 0);
+  SwapArenaPlanOffsets(filename, 0, 3);
+  offsets[3] = -offsets[3];
+
+  Interpreter interpreter;
+  BuildAccumulatorGraph(&interpreter);
+  ASSERT_NE(interpreter.LoadArenaPlan(filename.c_str(), model_hash + 1),
+            kTfLiteOk);
+  ASSERT_NE(interpreter.LoadArenaPlan("/nonexistent/plan", model_hash),
+            kTfLiteOk);
+  ASSERT_EQ(interpreter.LoadArenaPlan(filename.c_str(), model_hash),
+            kTfLiteOk);
+  ASSERT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(interpreter.tensor(i)->data.raw -
+                  interpreter.tensor(i == 1 || i == 2 ? 1 : 0)->data.raw,
+              offsets[i]);
+  }
+  EXPECT_EQ(InvokeAccumulator(&interpreter, 1, 2), std::vector<float>({1, 2}));
+  EXPECT_EQ(InvokeAccumulator(&interpreter, 3, 4), std::vector<float>({4, 6}));
+
+  // The plan is not used for other tensor sizes.
+  ASSERT_EQ(interpreter.ResizeInputTensor(0, {4}), kTfLiteOk);
+  ASSERT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+  EXPECT_EQ(interpreter.tensor(0)->bytes, 4 * sizeof(float));
+  remove(filename.c_str());
+}
+
+TEST(BasicInterpreter, TestWarmup) {
+  Interpreter interpreter;
+  BuildAccumulatorGraph(&interpreter);
+  // The tensors are allocated by the warmup if needed.
+  Interpreter::WarmupTimings timings;
+  ASSERT_EQ(interpreter.Warmup(&timings), kTfLiteOk);
+  EXPECT_GE(timings.prepare_us, 0);
+  EXPECT_GE(timings.fault_in_us, 0);
+  EXPECT_GE(timings.dry_run_us, 0);
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 1, 2),
+              testing::ElementsAre(1, 2));
+
+  // The dry run ignores the inputs and keeps the variables.
+  interpreter.typed_tensor<float>(0)[0] = 100;
+  interpreter.typed_tensor<float>(0)[1] = 100;
+  ASSERT_EQ(interpreter.Warmup(), kTfLiteOk);
+  EXPECT_EQ(interpreter.typed_tensor<float>(0)[0], 0);
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 1, 2),
+              testing::ElementsAre(2, 4));
+
+  interpreter.WarmupInBackground();
+  ASSERT_EQ(interpreter.WaitForWarmup(), kTfLiteOk);
+  EXPECT_THAT(InvokeAccumulator(&interpreter, 1, 2),
+              testing::ElementsAre(3, 6));
+}
+
+TEST(BasicInterpreter, SymbolicDimensions) {
+  Interpreter interpreter;
+  ASSERT_EQ(interpreter.AddTensors(3), kTfLiteOk);
+  TfLiteQuantizationParams quant;
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(interpreter.SetTensorParametersReadWrite(i, kTfLiteFloat32, "",
+                                                       {1, 2}, quant),
+              kTfLiteOk);
+  }
+  ASSERT_EQ(interpreter.SetTensorDimsSignature(0, {-1, 2}), kTfLiteOk);
+  ASSERT_EQ(interpreter.SetTensorDimsSignature(0, {-2, 2}), kTfLiteError);
+  interpreter.SetInputs({0});
+  interpreter.SetOutputs({2});
+
+  // Two elementwise nodes computing 2 * x + 1.
+  TfLiteRegistration times_two = {nullptr, nullptr, nullptr, nullptr};
+  times_two.prepare = [](TfLiteContext* context, TfLiteNode* node) {
+    const TfLiteTensor* input = &context->tensors[node->inputs->data[0]];
+    TfLiteTensor* output = &context->tensors[node->outputs->data[0]];
+    return context->ResizeTensor(context, output,
+                                 TfLiteIntArrayCopy(input->dims));
+  };
+  TfLiteRegistration plus_one = times_two;
+  times_two.invoke = [](TfLiteContext* context, TfLiteNode* node) {
+    const TfLiteTensor* input = &context->tensors[node->inputs->data[0]];
+    TfLiteTensor* output = &context->tensors[node->outputs->data[0]];
+    for (int i = 0; i < NumElements(output); ++i) {
+      output->data.f[i] = 2 * input->data.f[i];
+    }
+    return kTfLiteOk;
+  };
+  plus_one.invoke = [](TfLiteContext* context, TfLiteNode* node) {
+    const TfLiteTensor* input = &context->tensors[node->inputs->data[0]];
+    TfLiteTensor* output = &context->tensors[node->outputs->data[0]];
+    for (int i = 0; i < NumElements(output); ++i) {
+      output->data.f[i] = input->data.f[i] + 1;
+    }
+    return kTfLiteOk;
+  };
+  interpreter.AddNodeWithParameters({0}, {1}, nullptr, 0, nullptr, &times_two);
+  interpreter.AddNodeWithParameters({1}, {2}, nullptr, 0, nullptr, &plus_one);
+
+  // The first batch sizes are planned, the following evaluated.
+  for (int batch : {1, 4, 2, 7, 3, 16}) {
+    ASSERT_EQ(interpreter.ResizeInputTensor(0, {batch, 2}), kTfLiteOk);
+    ASSERT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+    float* input = interpreter.typed_tensor<float>(0);
+    for (int i = 0; i < 2 * batch; ++i) {
+      input[i] = i;
+    }
+    ASSERT_EQ(interpreter.Invoke(), kTfLiteOk);
+    const float* output = interpreter.typed_tensor<float>(2);
+    for (int i = 0; i < 2 * batch; ++i) {
+      ASSERT_EQ(output[i], 2 * i + 1) << batch;
+    }
+  }
+}
+
+TEST(BasicInterpreter, DynamicTensorsKeepTheirBuffers) {
+  Interpreter interpreter;
+  ASSERT_EQ(interpreter.AddTensors(1), kTfLiteOk);
+  ASSERT_EQ(interpreter.SetInputs({0}), kTfLiteOk);
+  ASSERT_EQ(interpreter.SetTensorParametersReadWrite(
+                0, kTfLiteFloat32, "", {3}, TfLiteQuantizationParams()),
+            kTfLiteOk);
+  TfLiteTensor* tensor = interpreter.tensor(0);
+  tensor->data.raw = nullptr;
+  tensor->allocation_type = kTfLiteDynamic;
+
+  ASSERT_EQ(interpreter.ResizeInputTensor(0, {1000}), kTfLiteOk);
+  char* data = tensor->data.raw;
+  ASSERT_NE(data, nullptr);
+  ASSERT_EQ(interpreter.ResizeInputTensor(0, {10}), kTfLiteOk);
+  EXPECT_EQ(tensor->bytes, 10 * sizeof(float));
+  // Growing back within the buffer doesn't reallocate it.
+  ASSERT_EQ(interpreter.ResizeInputTensor(0, {1000}), kTfLiteOk);
+  EXPECT_EQ(tensor->bytes, 1000 * sizeof(float));
+  EXPECT_EQ(tensor->data.raw, data);
+  memset(tensor->data.raw, 0, tensor->bytes);
+}
+
+TEST(BasicInterpreter, FailedMaterializationIsNotRetried) {
+  Interpreter interpreter;
+  interpreter.AddSubgraphs(1);
+  Subgraph* subgraph = interpreter.subgraph(1);
+  int num_calls = 0;
+  subgraph->SetMaterializer([&num_calls](Subgraph*) {
+    ++num_calls;
+    return kTfLiteError;
+  });
+  EXPECT_EQ(subgraph->EnsureMaterialized(), kTfLiteError);
+  EXPECT_EQ(subgraph->EnsureMaterialized(), kTfLiteError);
+  EXPECT_EQ(num_calls, 1);
+}
+
 // Test size accessor functions.
 TEST(BasicInterpreter, TestSizeFunctions) {
   Interpreter interpreter;
@@ -21,6 +21,7 @@ limitations under the License.
 
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/lookup_table.h"
 #include "tensorflow/lite/kernels/internal/optimized/integer_ops/softmax.h"
 #include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
@@ -47,6 +48,8 @@ struct OpData {
   int input_left_shift = 0;
   int32_t input_range_radius = 0;
   int diff_min = 0;
+  // Results of int8 Logistic and Tanh for every input value.
+  int8_t table[optimized_integer_ops::kInt8LookupTableSize];
 };
 
 struct LogSoftmaxOpData : public OpData {
@@ -175,6 +178,18 @@ TfLiteStatus TanhPrepare(TfLiteContext* context, TfLiteNode* node) {
                                      &data->input_left_shift);
     data->input_range_radius =
         CalculateInputRadius(kInputIntegerBits, data->input_left_shift);
+    if (input->type == kTfLiteInt8) {
+      const int32_t input_zero_point = input->params.zero_point;
+      optimized_integer_ops::PopulateLookupTable(
+          [data, input_zero_point](int size, const int8_t* input_data,
+                                   int8_t* output_data) {
+            reference_integer_ops::Tanh(
+                input_zero_point, data->input_range_radius,
+                data->input_multiplier, data->input_left_shift, size,
+                input_data, output_data);
+          },
+          data->table);
+    }
   } else if (input->type == kTfLiteInt16) {
     static constexpr int kInputIntegerBits = 3;
     static constexpr int kOutputFractionalBits = 15;
@@ -244,6 +259,18 @@ TfLiteStatus SigmoidPrepare(TfLiteContext* context, TfLiteNode* node) {
                                      &data->input_left_shift);
     data->input_range_radius =
         CalculateInputRadius(kInputIntegerBits, data->input_left_shift);
+    if (input->type == kTfLiteInt8) {
+      const int32_t input_zero_point = input->params.zero_point;
+      optimized_integer_ops::PopulateLookupTable(
+          [data, input_zero_point](int size, const int8_t* input_data,
+                                   int8_t* output_data) {
+            reference_integer_ops::Logistic(
+                input_zero_point, data->input_range_radius,
+                data->input_multiplier, data->input_left_shift, size,
+                input_data, output_data);
+          },
+          data->table);
+    }
   } else if (input->type == kTfLiteInt16) {
     static constexpr int kInputIntegerBits = 3;
     static constexpr int kOutputFractionalBits = 15;
@@ -539,10 +566,16 @@ TfLiteStatus TanhEval(TfLiteContext* context, TfLiteNode* node) {
       const auto input_shape = GetTensorShape(input);
       const auto output_shape = GetTensorShape(output);
       const int size = MatchingFlatSize(input_shape, output_shape);
-      reference_integer_ops::Tanh(
-          input->params.zero_point, data->input_range_radius,
-          data->input_multiplier, data->input_left_shift, size,
-          GetTensorData<int8_t>(input), GetTensorData<int8_t>(output));
+      if (kernel_type == kGenericOptimized) {
+        optimized_integer_ops::LookupTable(data->table, size,
+                                           GetTensorData<int8_t>(input),
+                                           GetTensorData<int8_t>(output));
+      } else {
+        reference_integer_ops::Tanh(
+            input->params.zero_point, data->input_range_radius,
+            data->input_multiplier, data->input_left_shift, size,
+            GetTensorData<int8_t>(input), GetTensorData<int8_t>(output));
+      }
       return kTfLiteOk;
     } break;
     default:
@@ -607,10 +640,16 @@ TfLiteStatus SigmoidEval(TfLiteContext* context, TfLiteNode* node) {
     case kTfLiteInt8: {
       const int input_size =
           MatchingFlatSize(GetTensorShape(input), GetTensorShape(output));
-      reference_integer_ops::Logistic(
-          input->params.zero_point, data->input_range_radius,
-          data->input_multiplier, data->input_left_shift, input_size,
-          GetTensorData<int8_t>(input), GetTensorData<int8_t>(output));
+      if (kernel_type == kGenericOptimized) {
+        optimized_integer_ops::LookupTable(data->table, input_size,
+                                           GetTensorData<int8_t>(input),
+                                           GetTensorData<int8_t>(output));
+      } else {
+        reference_integer_ops::Logistic(
+            input->params.zero_point, data->input_range_radius,
+            data->input_multiplier, data->input_left_shift, input_size,
+            GetTensorData<int8_t>(input), GetTensorData<int8_t>(output));
+      }
       break;
     }
     default:
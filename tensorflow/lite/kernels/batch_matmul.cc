@@ -0,0 +1,271 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include <algorithm>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/kernels/cpu_backend_support.h"
+#include "tensorflow/lite/kernels/internal/optimized/batch_matmul.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
+#include "tensorflow/lite/kernels/internal/reference/batch_matmul.h"
+#include "tensorflow/lite/kernels/internal/tensor.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/op_macros.h"
+
+namespace tflite {
+namespace ops {
+namespace builtin {
+namespace batch_matmul {
+
+// This file has two implementations of BatchMatMul.
+enum KernelType {
+  kReference,
+  kGenericOptimized,
+};
+
+constexpr int kInputLHSTensor = 0;
+constexpr int kInputRHSTensor = 1;
+constexpr int kOutputTensor = 0;
+
+const int kTensorNotAllocated = -1;
+
+struct OpData {
+  // The optimized kernel needs the lhs as [..., rows, depth] and the rhs as
+  // [..., cols, depth], so with adj_x (resp. without adj_y) the operand is
+  // first transposed into one of these temporaries.
+  int transposed_lhs_id = kTensorNotAllocated;
+  int transposed_rhs_id = kTensorNotAllocated;
+  int32_t transposed_lhs_index;
+  int32_t transposed_rhs_index;
+  bool need_transposed_lhs;
+  bool need_transposed_rhs;
+  // A constant rhs is transposed on the first run only.
+  bool have_rhs_been_transposed;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  cpu_backend_support::IncrementUsageCounter(context);
+  return new OpData;
+}
+
+void Free(TfLiteContext* context, void* buffer) {
+  cpu_backend_support::DecrementUsageCounter(context);
+  delete reinterpret_cast<OpData*>(buffer);
+}
+
+// Returns the shape of `tensor` with its two innermost dimensions swapped.
+TfLiteIntArray* TransposedInnerDimensions(const TfLiteTensor* tensor) {
+  TfLiteIntArray* dims = TfLiteIntArrayCopy(tensor->dims);
+  const int rank = dims->size;
+  std::swap(dims->data[rank - 2], dims->data[rank - 1]);
+  return dims;
+}
+
+TfLiteStatus ResizeOutputTensor(TfLiteContext* context,
+                                const TfLiteBatchMatMulParams* params,
+                                const TfLiteTensor* lhs,
+                                const TfLiteTensor* rhs, TfLiteTensor* output) {
+  const int lhs_rank = NumDimensions(lhs);
+  const int rhs_rank = NumDimensions(rhs);
+  const int output_rank = std::max(lhs_rank, rhs_rank);
+  TfLiteIntArray* output_size = TfLiteIntArrayCreate(output_rank);
+  // The batch dimensions are broadcast against each other, aligned on the
+  // innermost ones.
+  for (int i = 0; i < output_rank - 2; ++i) {
+    const int lhs_index = i - (output_rank - lhs_rank);
+    const int rhs_index = i - (output_rank - rhs_rank);
+    const int lhs_dim = lhs_index >= 0 ? SizeOfDimension(lhs, lhs_index) : 1;
+    const int rhs_dim = rhs_index >= 0 ? SizeOfDimension(rhs, rhs_index) : 1;
+    if (lhs_dim != rhs_dim && lhs_dim != 1 && rhs_dim != 1) {
+      TfLiteIntArrayFree(output_size);
+      context->ReportError(context,
+                           "BatchMatMul batch dimensions %d and %d are not "
+                           "broadcastable.",
+                           lhs_dim, rhs_dim);
+      return kTfLiteError;
+    }
+    output_size->data[i] = lhs_dim == 1 ? rhs_dim : lhs_dim;
+  }
+  output_size->data[output_rank - 2] =
+      SizeOfDimension(lhs, params->adj_x ? lhs_rank - 1 : lhs_rank - 2);
+  output_size->data[output_rank - 1] =
+      SizeOfDimension(rhs, params->adj_y ? rhs_rank - 2 : rhs_rank - 1);
+  return context->ResizeTensor(context, output, output_size);
+}
+
+template <KernelType kernel_type>
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  auto* params =
+      reinterpret_cast<TfLiteBatchMatMulParams*>(node->builtin_data);
+  OpData* data = reinterpret_cast<OpData*>(node->user_data);
+
+  TF_LITE_ENSURE_EQ(context, NumInputs(node), 2);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  const TfLiteTensor* lhs = GetInput(context, node, kInputLHSTensor);
+  const TfLiteTensor* rhs = GetInput(context, node, kInputRHSTensor);
+  TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+
+  // Only float32 is supported currently.
+  TF_LITE_ENSURE_EQ(context, lhs->type, kTfLiteFloat32);
+  TF_LITE_ENSURE_EQ(context, rhs->type, kTfLiteFloat32);
+  TF_LITE_ENSURE_EQ(context, output->type, kTfLiteFloat32);
+
+  const int lhs_rank = NumDimensions(lhs);
+  const int rhs_rank = NumDimensions(rhs);
+  TF_LITE_ENSURE(context, lhs_rank >= 2 && lhs_rank <= 5);
+  TF_LITE_ENSURE(context, rhs_rank >= 2 && rhs_rank <= 5);
+  const int lhs_depth =
+      SizeOfDimension(lhs, params->adj_x ? lhs_rank - 2 : lhs_rank - 1);
+  const int rhs_depth =
+      SizeOfDimension(rhs, params->adj_y ? rhs_rank - 1 : rhs_rank - 2);
+  TF_LITE_ENSURE_EQ(context, lhs_depth, rhs_depth);
+
+  int temporaries_count = 0;
+  data->need_transposed_lhs =
+      kernel_type == kGenericOptimized && params->adj_x;
+  data->need_transposed_rhs =
+      kernel_type == kGenericOptimized && !params->adj_y;
+  if (data->need_transposed_lhs) {
+    data->transposed_lhs_index = temporaries_count++;
+    if (data->transposed_lhs_id == kTensorNotAllocated) {
+      context->AddTensors(context, 1, &data->transposed_lhs_id);
+    }
+  }
+  if (data->need_transposed_rhs) {
+    data->transposed_rhs_index = temporaries_count++;
+    if (data->transposed_rhs_id == kTensorNotAllocated) {
+      context->AddTensors(context, 1, &data->transposed_rhs_id);
+    }
+  }
+  TfLiteIntArrayFree(node->temporaries);
+  node->temporaries = TfLiteIntArrayCreate(temporaries_count);
+
+  if (data->need_transposed_lhs) {
+    node->temporaries->data[data->transposed_lhs_index] =
+        data->transposed_lhs_id;
+    TfLiteTensor* transposed_lhs = GetTemporary(
+        context, node, data->transposed_lhs_index);
+    transposed_lhs->type = lhs->type;
+    transposed_lhs->allocation_type = kTfLiteArenaRw;
+    TF_LITE_ENSURE_OK(context,
+                      context->ResizeTensor(context, transposed_lhs,
+                                            TransposedInnerDimensions(lhs)));
+  }
+  if (data->need_transposed_rhs) {
+    node->temporaries->data[data->transposed_rhs_index] =
+        data->transposed_rhs_id;
+    TfLiteTensor* transposed_rhs = GetTemporary(
+        context, node, data->transposed_rhs_index);
+    transposed_rhs->type = rhs->type;
+    // Weights are transposed once and kept across invocations.
+    transposed_rhs->allocation_type = IsConstantTensor(rhs)
+                                          ? kTfLiteArenaRwPersistent
+                                          : kTfLiteArenaRw;
+    TF_LITE_ENSURE_OK(context,
+                      context->ResizeTensor(context, transposed_rhs,
+                                            TransposedInnerDimensions(rhs)));
+    data->have_rhs_been_transposed = false;
+  }
+
+  return ResizeOutputTensor(context, params, lhs, rhs, output);
+}
+
+// Swaps the two innermost dimensions of `input` into `output`.
+void TransposeInnerDimensions(const TfLiteTensor* input, TfLiteTensor* output,
+                              CpuBackendContext* cpu_backend_context) {
+  const int rank = NumDimensions(input);
+  TransposeParams params;
+  params.perm_count = rank;
+  for (int i = 0; i < rank; ++i) {
+    params.perm[i] = i;
+  }
+  std::swap(params.perm[rank - 2], params.perm[rank - 1]);
+  optimized_ops::Transpose(params, GetTensorShape(input),
+                           GetTensorData<float>(input), GetTensorShape(output),
+                           GetTensorData<float>(output), cpu_backend_context);
+}
+
+template <KernelType kernel_type>
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  auto* params =
+      reinterpret_cast<TfLiteBatchMatMulParams*>(node->builtin_data);
+  OpData* data = reinterpret_cast<OpData*>(node->user_data);
+
+  const TfLiteTensor* lhs = GetInput(context, node, kInputLHSTensor);
+  const TfLiteTensor* rhs = GetInput(context, node, kInputRHSTensor);
+  TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+
+  if (kernel_type == kReference) {
+    BatchMatMulParams op_params;
+    op_params.adj_x = params->adj_x;
+    op_params.adj_y = params->adj_y;
+    reference_ops::BatchMatMul(op_params, GetTensorShape(lhs),
+                               GetTensorData<float>(lhs), GetTensorShape(rhs),
+                               GetTensorData<float>(rhs),
+                               GetTensorShape(output),
+                               GetTensorData<float>(output));
+    return kTfLiteOk;
+  }
+
+  CpuBackendContext* cpu_backend_context =
+      cpu_backend_support::GetFromContext(context);
+  if (data->need_transposed_lhs) {
+    TfLiteTensor* transposed_lhs =
+        GetTemporary(context, node, data->transposed_lhs_index);
+    TransposeInnerDimensions(lhs, transposed_lhs, cpu_backend_context);
+    lhs = transposed_lhs;
+  }
+  if (data->need_transposed_rhs) {
+    TfLiteTensor* transposed_rhs =
+        GetTemporary(context, node, data->transposed_rhs_index);
+    if (!IsConstantTensor(rhs) || !data->have_rhs_been_transposed) {
+      TransposeInnerDimensions(rhs, transposed_rhs, cpu_backend_context);
+      data->have_rhs_been_transposed = true;
+    }
+    rhs = transposed_rhs;
+  }
+  optimized_ops::BatchMatMul(GetTensorShape(lhs), GetTensorData<float>(lhs),
+                             GetTensorShape(rhs), GetTensorData<float>(rhs),
+                             GetTensorShape(output),
+                             GetTensorData<float>(output), cpu_backend_context);
+  return kTfLiteOk;
+}
+
+}  // namespace batch_matmul
+
+TfLiteRegistration* Register_BATCH_MATMUL_REF() {
+  static TfLiteRegistration r = {
+      batch_matmul::Init, batch_matmul::Free,
+      batch_matmul::Prepare<batch_matmul::kReference>,
+      batch_matmul::Eval<batch_matmul::kReference>};
+  return &r;
+}
+
+TfLiteRegistration* Register_BATCH_MATMUL_GENERIC_OPT() {
+  static TfLiteRegistration r = {
+      batch_matmul::Init, batch_matmul::Free,
+      batch_matmul::Prepare<batch_matmul::kGenericOptimized>,
+      batch_matmul::Eval<batch_matmul::kGenericOptimized>};
+  return &r;
+}
+
+TfLiteRegistration* Register_BATCH_MATMUL() {
+  return Register_BATCH_MATMUL_GENERIC_OPT();
+}
+
+}  // namespace builtin
+}  // namespace ops
+}  // namespace tflite
@@ -0,0 +1,173 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include <gtest/gtest.h>
+#include "absl/memory/memory.h"
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/kernels/register.h"
+#include "tensorflow/lite/kernels/test_util.h"
+#include "tensorflow/lite/model.h"
+
+namespace tflite {
+
+namespace ops {
+namespace builtin {
+
+TfLiteRegistration* Register_BATCH_MATMUL_REF();
+TfLiteRegistration* Register_BATCH_MATMUL_GENERIC_OPT();
+
+}  // namespace builtin
+}  // namespace ops
+
+namespace {
+
+using ::testing::ElementsAreArray;
+
+class BatchMatMulOpModel : public SingleOpModel {
+ public:
+  // If `rhs_data` is not empty, the rhs is a constant tensor holding it.
+  BatchMatMulOpModel(TfLiteRegistration* registration,
+                     std::initializer_list<int> lhs_shape,
+                     std::initializer_list<int> rhs_shape, bool adj_x,
+                     bool adj_y, std::initializer_list<float> rhs_data = {}) {
+    lhs_ = AddInput({TensorType_FLOAT32, lhs_shape});
+    if (rhs_data.size() == 0) {
+      rhs_ = AddInput({TensorType_FLOAT32, rhs_shape});
+    } else {
+      rhs_ = AddConstInput(TensorType_FLOAT32, rhs_data, rhs_shape);
+    }
+    output_ = AddOutput(TensorType_FLOAT32);
+    SetBuiltinOp(BuiltinOperator_BATCH_MATMUL,
+                 BuiltinOptions_BatchMatMulOptions,
+                 CreateBatchMatMulOptions(builder_, adj_x, adj_y).Union());
+    resolver_ = absl::make_unique<SingleOpResolver>(
+        BuiltinOperator_BATCH_MATMUL, registration);
+    if (rhs_data.size() == 0) {
+      BuildInterpreter({GetShape(lhs_), GetShape(rhs_)});
+    } else {
+      BuildInterpreter({GetShape(lhs_)});
+    }
+  }
+
+  void SetLhs(std::initializer_list<float> data) {
+    PopulateTensor(lhs_, data);
+  }
+  void SetRhs(std::initializer_list<float> data) {
+    PopulateTensor(rhs_, data);
+  }
+  std::vector<float> GetOutput() { return ExtractVector<float>(output_); }
+  std::vector<int> GetOutputShape() { return GetTensorShape(output_); }
+
+ protected:
+  int lhs_;
+  int rhs_;
+  int output_;
+};
+
+const auto kKernelMap = new std::map<string, TfLiteRegistration*>({
+    {"Reference", ops::builtin::Register_BATCH_MATMUL_REF()},
+    {"GenericOptimized", ops::builtin::Register_BATCH_MATMUL_GENERIC_OPT()},
+});
+
+class BatchMatMulOpTest : public SingleOpTest {
+ protected:
+  const std::map<string, TfLiteRegistration*>& GetKernelMap() override {
+    return *kKernelMap;
+  }
+};
+
+TEST_P(BatchMatMulOpTest, SimpleTest) {
+  BatchMatMulOpModel model(GetRegistration(), {1, 2, 3}, {1, 3, 4},
+                           /*adj_x=*/false, /*adj_y=*/false);
+  model.SetLhs({1, 2, 3, 4, 5, 6});
+  model.SetRhs({7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18});
+  model.Invoke();
+  EXPECT_THAT(model.GetOutput(),
+              ElementsAreArray({74., 80., 86., 92., 173., 188., 203., 218.}));
+  EXPECT_THAT(model.GetOutputShape(), ElementsAreArray({1, 2, 4}));
+}
+
+TEST_P(BatchMatMulOpTest, BatchTest) {
+  BatchMatMulOpModel model(GetRegistration(), {2, 2, 3}, {2, 3, 4},
+                           /*adj_x=*/false, /*adj_y=*/false);
+  model.SetLhs({1, 2, 3, 4, 5, 6, 1, 2, 3, 4, 5, 6});
+  model.SetRhs({7,  8,  9,  10, 11, 12, 13, 14, 15, 16, 17, 18,
+                19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30});
+  model.Invoke();
+  EXPECT_THAT(model.GetOutput(),
+              ElementsAreArray({74., 80., 86., 92., 173., 188., 203., 218.,
+                                146., 152., 158., 164., 353., 368., 383.,
+                                398.}));
+  EXPECT_THAT(model.GetOutputShape(), ElementsAreArray({2, 2, 4}));
+}
+
+TEST_P(BatchMatMulOpTest, AdjointTest) {
+  // Same as SimpleTest, with both inputs transposed.
+  BatchMatMulOpModel model(GetRegistration(), {1, 3, 2}, {1, 4, 3},
+                           /*adj_x=*/true, /*adj_y=*/true);
+  model.SetLhs({1, 4, 2, 5, 3, 6});
+  model.SetRhs({7, 11, 15, 8, 12, 16, 9, 13, 17, 10, 14, 18});
+  model.Invoke();
+  EXPECT_THAT(model.GetOutput(),
+              ElementsAreArray({74., 80., 86., 92., 173., 188., 203., 218.}));
+  EXPECT_THAT(model.GetOutputShape(), ElementsAreArray({1, 2, 4}));
+}
+
+TEST_P(BatchMatMulOpTest, BroadcastTest) {
+  // The rank 2 rhs is shared by all the batches of the lhs.
+  BatchMatMulOpModel model(GetRegistration(), {2, 2, 3}, {3, 4},
+                           /*adj_x=*/false, /*adj_y=*/false);
+  model.SetLhs({1, 2, 3, 4, 5, 6, 1, 2, 3, 4, 5, 6});
+  model.SetRhs({7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18});
+  model.Invoke();
+  EXPECT_THAT(model.GetOutput(),
+              ElementsAreArray({74., 80., 86., 92., 173., 188., 203., 218.,
+                                74., 80., 86., 92., 173., 188., 203., 218.}));
+  EXPECT_THAT(model.GetOutputShape(), ElementsAreArray({2, 2, 4}));
+}
+
+TEST_P(BatchMatMulOpTest, BroadcastBothInputsTest) {
+  // Batch dimensions [2, 1] and [1, 2] broadcast to [2, 2].
+  BatchMatMulOpModel model(GetRegistration(), {2, 1, 1, 2}, {1, 2, 2, 1},
+                           /*adj_x=*/false, /*adj_y=*/false);
+  model.SetLhs({1, 2, 3, 4});
+  model.SetRhs({1, 10, 100, 1000});
+  model.Invoke();
+  EXPECT_THAT(model.GetOutput(), ElementsAreArray({21., 2100., 43., 4300.}));
+  EXPECT_THAT(model.GetOutputShape(), ElementsAreArray({2, 2, 1, 1}));
+}
+
+TEST_P(BatchMatMulOpTest, ConstantRhsTest) {
+  BatchMatMulOpModel model(GetRegistration(), {2, 2, 3}, {3, 4},
+                           /*adj_x=*/false, /*adj_y=*/false,
+                           {7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18});
+  model.SetLhs({1, 2, 3, 4, 5, 6, 1, 0, 0, 0, 1, 0});
+  model.Invoke();
+  EXPECT_THAT(model.GetOutput(),
+              ElementsAreArray({74., 80., 86., 92., 173., 188., 203., 218., 7.,
+                                8., 9., 10., 11., 12., 13., 14.}));
+  // The transposed weights are reused on the following runs.
+  model.SetLhs({0, 0, 1, 1, 1, 1, 1, 2, 3, 4, 5, 6});
+  model.Invoke();
+  EXPECT_THAT(model.GetOutput(),
+              ElementsAreArray({15., 16., 17., 18., 33., 36., 39., 42., 74.,
+                                80., 86., 92., 173., 188., 203., 218.}));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    BatchMatMulOpTest, BatchMatMulOpTest,
+    ::testing::ValuesIn(SingleOpTest::GetKernelTags(*kKernelMap)));
+
+}  // namespace
+}  // namespace tflite
@@ -13,6 +13,7 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstdio>
@@ -23,6 +24,7 @@ limitations under the License.
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/kernels/activation_functor.h"
+#include "tensorflow/lite/kernels/cpu_backend_support.h"
 #include "tensorflow/lite/kernels/internal/kernel_utils.h"
 #include "tensorflow/lite/kernels/internal/tensor_utils.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
@@ -34,6 +36,17 @@ namespace ops {
 namespace builtin {
 namespace bidirectional_sequence_lstm {
 
+struct OpData {
+  // The scratch tensor index.
+  int scratch_tensor_index;
+  // The float kernel packs the gate weights of each cell, see
+  // lstm_eval::PackFloatGateWeights. Constant weights are only packed once.
+  bool fw_gate_weights_are_constant;
+  bool have_fw_gate_weights_been_packed;
+  bool bw_gate_weights_are_constant;
+  bool have_bw_gate_weights_been_packed;
+};
+
 // LINT.IfChange
 
 // Input Tensors of size {max_time, n_batch, n_input}
@@ -147,14 +160,84 @@ enum TemporaryTensor {
   kNumTemporaryTensors = 11
 };
 
+// Temporary tensors of the float kernel, which follows the scratch buffers
+// with these instead of the hybrid kernel ones. Their tensors are added after
+// the hybrid kernel ones.
+enum FloatTemporaryTensor {
+  kFwPackedGateWeights = 2,
+  kFwPackedGateBias = 3,
+  kBwPackedGateWeights = 4,
+  kBwPackedGateBias = 5,
+  // Shared by the two cells, which are evaluated one after the other.
+  kInputGatesBuffer = 6,
+  kNumFloatTemporaryTensors = 7
+};
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
-  auto* scratch_tensor_index = new int;
-  context->AddTensors(context, kNumTemporaryTensors, scratch_tensor_index);
-  return scratch_tensor_index;
+  cpu_backend_support::IncrementUsageCounter(context);
+  auto* op_data = new OpData();
+  context->AddTensors(context,
+                      kNumTemporaryTensors + kNumFloatTemporaryTensors -
+                          kFwPackedGateWeights,
+                      &op_data->scratch_tensor_index);
+  return op_data;
 }
 
 void Free(TfLiteContext* context, void* buffer) {
-  delete reinterpret_cast<int*>(buffer);
+  cpu_backend_support::DecrementUsageCounter(context);
+  delete reinterpret_cast<OpData*>(buffer);
+}
+
+// Returns whether all the given optional input tensors that are present are
+// constant.
+bool AreConstantTensors(TfLiteContext* context, TfLiteNode* node,
+                        std::initializer_list<int> tensor_indices) {
+  for (const int index : tensor_indices) {
+    const TfLiteTensor* tensor = GetOptionalInputTensor(context, node, index);
+    if (tensor != nullptr && !IsConstantTensor(tensor)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Sets up the temporary tensors that hold the packed gate weights and biases
+// of one cell, persistent if the weights are constant.
+TfLiteStatus SetUpPackedGateWeights(TfLiteContext* context, TfLiteNode* node,
+                                    int packed_gate_weights_index,
+                                    int packed_gate_bias_index,
+                                    int n_gate_rows, int n_gate_input,
+                                    bool gate_weights_are_constant) {
+  const OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
+  const int float_tensor_index =
+      op_data->scratch_tensor_index + kNumTemporaryTensors -
+      kFwPackedGateWeights;
+  const TfLiteAllocationType packed_allocation_type =
+      gate_weights_are_constant ? kTfLiteArenaRwPersistent : kTfLiteArenaRw;
+
+  node->temporaries->data[packed_gate_weights_index] =
+      float_tensor_index + packed_gate_weights_index;
+  TfLiteTensor* packed_gate_weights =
+      GetTemporary(context, node, packed_gate_weights_index);
+  packed_gate_weights->type = kTfLiteFloat32;
+  packed_gate_weights->allocation_type = packed_allocation_type;
+  TfLiteIntArray* packed_gate_weights_size = TfLiteIntArrayCreate(2);
+  packed_gate_weights_size->data[0] = n_gate_rows;
+  packed_gate_weights_size->data[1] = n_gate_input;
+  TF_LITE_ENSURE_OK(context,
+                    context->ResizeTensor(context, packed_gate_weights,
+                                          packed_gate_weights_size));
+
+  node->temporaries->data[packed_gate_bias_index] =
+      float_tensor_index + packed_gate_bias_index;
+  TfLiteTensor* packed_gate_bias =
+      GetTemporary(context, node, packed_gate_bias_index);
+  packed_gate_bias->type = kTfLiteFloat32;
+  packed_gate_bias->allocation_type = packed_allocation_type;
+  TfLiteIntArray* packed_gate_bias_size = TfLiteIntArrayCreate(1);
+  packed_gate_bias_size->data[0] = n_gate_rows;
+  return context->ResizeTensor(context, packed_gate_bias,
+                               packed_gate_bias_size);
 }
 
 // Check that input tensor dimensions matches with each other.
@@ -389,7 +472,8 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
 // Resize the output and scratch tensors based on the sizes of the input
 // tensors. Also check that the size of the input tensors match each other.
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
-  int* scratch_tensor_index = reinterpret_cast<int*>(node->user_data);
+  OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
+  int* scratch_tensor_index = &op_data->scratch_tensor_index;
   const auto* params = reinterpret_cast<TfLiteBidirectionalSequenceLSTMParams*>(
       node->builtin_data);
 
@@ -521,7 +605,7 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     node->temporaries = TfLiteIntArrayCreate(
         has_aux_input ? kNumTemporaryTensors : kNumTemporaryTensors - 1);
   } else {
-    node->temporaries = TfLiteIntArrayCreate(2);  // the two scratch buffers.
+    node->temporaries = TfLiteIntArrayCreate(kNumFloatTemporaryTensors);
   }
   // Create a scratch buffer tensor.
   node->temporaries->data[kFwScratchBuffer] = *scratch_tensor_index;
@@ -605,6 +689,63 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   }
   TF_LITE_ENSURE_OK(context, context->ResizeTensor(context, bw_scratch_buffer,
                                                    bw_scratch_buffer_size));
+
+  if (!is_hybrid_op) {
+    const int n_aux_input = has_aux_input ? aux_input->dims->data[2] : 0;
+    const int n_fw_gate_rows = (fw_use_cifg ? 3 : 4) * n_fw_cell;
+    const int n_bw_gate_rows = (bw_use_cifg ? 3 : 4) * n_bw_cell;
+    op_data->fw_gate_weights_are_constant = AreConstantTensors(
+        context, node,
+        {kFwInputToInputWeightsTensor, kFwInputToForgetWeightsTensor,
+         kFwInputToCellWeightsTensor, kFwInputToOutputWeightsTensor,
+         kFwAuxInputToInputWeightsTensor, kFwAuxInputToForgetWeightsTensor,
+         kFwAuxInputToCellWeightsTensor, kFwAuxInputToOutputWeightsTensor,
+         kFwRecurrentToInputWeightsTensor, kFwRecurrentToForgetWeightsTensor,
+         kFwRecurrentToCellWeightsTensor, kFwRecurrentToOutputWeightsTensor,
+         kFwInputGateBiasTensor, kFwForgetGateBiasTensor,
+         kFwCellGateBiasTensor, kFwOutputGateBiasTensor});
+    op_data->have_fw_gate_weights_been_packed = false;
+    TF_LITE_ENSURE_OK(
+        context,
+        SetUpPackedGateWeights(context, node, kFwPackedGateWeights,
+                               kFwPackedGateBias, n_fw_gate_rows,
+                               n_input + n_aux_input + n_fw_output,
+                               op_data->fw_gate_weights_are_constant));
+    op_data->bw_gate_weights_are_constant = AreConstantTensors(
+        context, node,
+        {kBwInputToInputWeightsTensor, kBwInputToForgetWeightsTensor,
+         kBwInputToCellWeightsTensor, kBwInputToOutputWeightsTensor,
+         kBwAuxInputToInputWeightsTensor, kBwAuxInputToForgetWeightsTensor,
+         kBwAuxInputToCellWeightsTensor, kBwAuxInputToOutputWeightsTensor,
+         kBwRecurrentToInputWeightsTensor, kBwRecurrentToForgetWeightsTensor,
+         kBwRecurrentToCellWeightsTensor, kBwRecurrentToOutputWeightsTensor,
+         kBwInputGateBiasTensor, kBwForgetGateBiasTensor,
+         kBwCellGateBiasTensor, kBwOutputGateBiasTensor});
+    op_data->have_bw_gate_weights_been_packed = false;
+    TF_LITE_ENSURE_OK(
+        context,
+        SetUpPackedGateWeights(context, node, kBwPackedGateWeights,
+                               kBwPackedGateBias, n_bw_gate_rows,
+                               n_input + n_aux_input + n_bw_output,
+                               op_data->bw_gate_weights_are_constant));
+
+    // Allocate a temporary tensor for the contribution of the inputs to the
+    // gates, which is computed for the whole sequence at once.
+    node->temporaries->data[kInputGatesBuffer] =
+        *scratch_tensor_index + kNumTemporaryTensors - kFwPackedGateWeights +
+        kInputGatesBuffer;
+    TfLiteTensor* input_gates_buffer =
+        GetTemporary(context, node, kInputGatesBuffer);
+    input_gates_buffer->type = kTfLiteFloat32;
+    input_gates_buffer->allocation_type = kTfLiteArenaRw;
+    TfLiteIntArray* input_gates_buffer_size = TfLiteIntArrayCreate(2);
+    input_gates_buffer_size->data[0] = max_time * n_batch;
+    input_gates_buffer_size->data[1] = std::max(n_fw_gate_rows, n_bw_gate_rows);
+    TF_LITE_ENSURE_OK(context,
+                      context->ResizeTensor(context, input_gates_buffer,
+                                            input_gates_buffer_size));
+  }
+
   if (is_hybrid_op) {
     // Allocate temporary tensors to store quantized values of input, aux_input
     // (if present), activation_state and cell_state tensors.
@@ -912,45 +1053,76 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   switch (fw_input_to_output_weights->type) {
     case kTfLiteFloat32: {
-      TfLiteStatus fw_pass_status = lstm_eval::EvalFloat(
-          input, fw_input_to_input_weights, fw_input_to_forget_weights,
-          fw_input_to_cell_weights, fw_input_to_output_weights,
-          fw_recurrent_to_input_weights, fw_recurrent_to_forget_weights,
-          fw_recurrent_to_cell_weights, fw_recurrent_to_output_weights,
+      OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
+      CpuBackendContext* cpu_backend_context =
+          cpu_backend_support::GetFromContext(context);
+      TfLiteTensor* input_gates_buffer =
+          GetTemporary(context, node, kInputGatesBuffer);
+
+      TfLiteTensor* fw_packed_gate_weights =
+          GetTemporary(context, node, kFwPackedGateWeights);
+      TfLiteTensor* fw_packed_gate_bias =
+          GetTemporary(context, node, kFwPackedGateBias);
+      if (!op_data->fw_gate_weights_are_constant ||
+          !op_data->have_fw_gate_weights_been_packed) {
+        lstm_eval::PackFloatGateWeights(
+            fw_input_to_input_weights, fw_input_to_forget_weights,
+            fw_input_to_cell_weights, fw_input_to_output_weights,
+            fw_aux_input_to_input_weights, fw_aux_input_to_forget_weights,
+            fw_aux_input_to_cell_weights, fw_aux_input_to_output_weights,
+            fw_recurrent_to_input_weights, fw_recurrent_to_forget_weights,
+            fw_recurrent_to_cell_weights, fw_recurrent_to_output_weights,
+            fw_input_gate_bias, fw_forget_gate_bias, fw_cell_bias,
+            fw_output_gate_bias, fw_packed_gate_weights, fw_packed_gate_bias);
+        op_data->have_fw_gate_weights_been_packed = true;
+      }
+      TfLiteStatus fw_pass_status = lstm_eval::EvalFloatWithPackedGateWeights(
+          input, fw_packed_gate_weights, fw_packed_gate_bias,
           fw_cell_to_input_weights, fw_cell_to_forget_weights,
           fw_cell_to_output_weights,
           /*input_layer_norm_coefficients=*/nullptr,
           /*forget_layer_norm_coefficients=*/nullptr,
           /*cell_layer_norm_coefficients=*/nullptr,
           /*output_layer_norm_coefficients=*/nullptr, real_aux_input,
-          fw_aux_input_to_input_weights, fw_aux_input_to_forget_weights,
-          fw_aux_input_to_cell_weights, fw_aux_input_to_output_weights,
           fw_input_gate_bias, fw_forget_gate_bias, fw_cell_bias,
           fw_output_gate_bias, fw_projection_weights, fw_projection_bias,
           &lstm_params,
           /*forward_sequence=*/true, time_major, /*output_offset=*/0,
-          fw_scratch_buffer, fw_activation_state, fw_cell_state, fw_output);
+          input_gates_buffer, fw_scratch_buffer, fw_activation_state,
+          fw_cell_state, fw_output, cpu_backend_context);
       TF_LITE_ENSURE_OK(context, fw_pass_status);
 
-      TfLiteStatus bw_pass_status = lstm_eval::EvalFloat(
-          bw_input, bw_input_to_input_weights, bw_input_to_forget_weights,
-          bw_input_to_cell_weights, bw_input_to_output_weights,
-          bw_recurrent_to_input_weights, bw_recurrent_to_forget_weights,
-          bw_recurrent_to_cell_weights, bw_recurrent_to_output_weights,
+      TfLiteTensor* bw_packed_gate_weights =
+          GetTemporary(context, node, kBwPackedGateWeights);
+      TfLiteTensor* bw_packed_gate_bias =
+          GetTemporary(context, node, kBwPackedGateBias);
+      if (!op_data->bw_gate_weights_are_constant ||
+          !op_data->have_bw_gate_weights_been_packed) {
+        lstm_eval::PackFloatGateWeights(
+            bw_input_to_input_weights, bw_input_to_forget_weights,
+            bw_input_to_cell_weights, bw_input_to_output_weights,
+            bw_aux_input_to_input_weights, bw_aux_input_to_forget_weights,
+            bw_aux_input_to_cell_weights, bw_aux_input_to_output_weights,
+            bw_recurrent_to_input_weights, bw_recurrent_to_forget_weights,
+            bw_recurrent_to_cell_weights, bw_recurrent_to_output_weights,
+            bw_input_gate_bias, bw_forget_gate_bias, bw_cell_bias,
+            bw_output_gate_bias, bw_packed_gate_weights, bw_packed_gate_bias);
+        op_data->have_bw_gate_weights_been_packed = true;
+      }
+      TfLiteStatus bw_pass_status = lstm_eval::EvalFloatWithPackedGateWeights(
+          bw_input, bw_packed_gate_weights, bw_packed_gate_bias,
           bw_cell_to_input_weights, bw_cell_to_forget_weights,
           bw_cell_to_output_weights,
           /*input_layer_norm_coefficients=*/nullptr,
           /*forget_layer_norm_coefficients=*/nullptr,
           /*cell_layer_norm_coefficients=*/nullptr,
           /*output_layer_norm_coefficients=*/nullptr, real_aux_input,
-          bw_aux_input_to_input_weights, bw_aux_input_to_forget_weights,
-          bw_aux_input_to_cell_weights, bw_aux_input_to_output_weights,
           bw_input_gate_bias, bw_forget_gate_bias, bw_cell_bias,
           bw_output_gate_bias, bw_projection_weights, bw_projection_bias,
           &lstm_params,
           /*forward_sequence=*/false, time_major, bw_output_offset,
-          bw_scratch_buffer, bw_activation_state, bw_cell_state,
-          actual_bw_output);
+          input_gates_buffer, bw_scratch_buffer, bw_activation_state,
+          bw_cell_state, actual_bw_output, cpu_backend_context);
       TF_LITE_ENSURE_OK(context, bw_pass_status);
       return kTfLiteOk;
     }
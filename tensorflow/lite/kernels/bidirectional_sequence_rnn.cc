@@ -12,6 +12,7 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstdio>
@@ -22,7 +23,12 @@ limitations under the License.
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/kernels/activation_functor.h"
+#include "tensorflow/lite/kernels/cpu_backend_context.h"
+#include "tensorflow/lite/kernels/cpu_backend_support.h"
 #include "tensorflow/lite/kernels/internal/kernel_utils.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
+#include "tensorflow/lite/kernels/internal/tensor.h"
+#include "tensorflow/lite/kernels/internal/tensor_utils.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/op_macros.h"
 
@@ -66,13 +72,26 @@ enum TemporaryTensor {
   kNumTemporaryTensors = 5
 };
 
+// Temporary tensor of the float kernel, used instead of the hybrid kernel
+// ones. It holds the contribution of the inputs to the cells when it cannot
+// be computed straight into the outputs, i.e. when they are merged. Its tensor
+// is added after the hybrid kernel ones.
+enum FloatTemporaryTensor {
+  kInputProjection = 0,
+  kNumFloatTemporaryTensors = 1
+};
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  cpu_backend_support::IncrementUsageCounter(context);
   auto* scratch_tensor_index = new int;
-  context->AddTensors(context, kNumTemporaryTensors, scratch_tensor_index);
+  context->AddTensors(context,
+                      kNumTemporaryTensors + kNumFloatTemporaryTensors,
+                      scratch_tensor_index);
   return scratch_tensor_index;
 }
 
 void Free(TfLiteContext* context, void* buffer) {
+  cpu_backend_support::DecrementUsageCounter(context);
   delete reinterpret_cast<int*>(buffer);
 }
 
@@ -160,6 +179,26 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
                       bw_aux_input_weights->dims->data[1]);
   }
 
+  if (!IsHybridOp(input, fw_input_weights) && params->merge_outputs) {
+    int* scratch_tensor_index = reinterpret_cast<int*>(node->user_data);
+
+    TfLiteIntArrayFree(node->temporaries);
+    node->temporaries = TfLiteIntArrayCreate(kNumFloatTemporaryTensors);
+    node->temporaries->data[kInputProjection] =
+        *scratch_tensor_index + kNumTemporaryTensors;
+    TfLiteTensor* input_projection =
+        GetTemporary(context, node, kInputProjection);
+    input_projection->type = kTfLiteFloat32;
+    input_projection->allocation_type = kTfLiteArenaRw;
+    // Shared by the two cells, which are evaluated one after the other.
+    TfLiteIntArray* input_projection_size = TfLiteIntArrayCreate(2);
+    input_projection_size->data[0] = max_time * batch_size;
+    input_projection_size->data[1] = std::max(fw_num_units, bw_num_units);
+    TF_LITE_ENSURE_OK(context,
+                      context->ResizeTensor(context, input_projection,
+                                            input_projection_size));
+  }
+
   if (IsHybridOp(input, fw_input_weights)) {
     int* scratch_tensor_index = reinterpret_cast<int*>(node->user_data);
 
@@ -267,6 +306,34 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   return kTfLiteOk;
 }
 
+// Computes the contribution of the input, auxiliary input and bias to a cell
+// for all the time steps at once, since it does not depend on the hidden
+// state. The input projection vectors are in the same order as the input
+// ones.
+void ComputeInputProjection(const TfLiteTensor* input,
+                            const TfLiteTensor* input_weights,
+                            const TfLiteTensor* aux_input,
+                            const TfLiteTensor* aux_input_weights,
+                            const TfLiteTensor* bias, float* input_projection,
+                            CpuBackendContext* cpu_backend_context) {
+  const int n_vectors = input->dims->data[0] * input->dims->data[1];
+  const int input_size = input->dims->data[2];
+  const int num_units = input_weights->dims->data[0];
+  FullyConnectedParams fc_params;
+  fc_params.float_activation_min = std::numeric_limits<float>::lowest();
+  fc_params.float_activation_max = std::numeric_limits<float>::max();
+  optimized_ops::FullyConnected(
+      fc_params, RuntimeShape({n_vectors, input_size}), input->data.f,
+      GetTensorShape(input_weights), input_weights->data.f,
+      GetTensorShape(bias), bias->data.f, RuntimeShape({n_vectors, num_units}),
+      input_projection, cpu_backend_context);
+  if (aux_input != nullptr) {
+    tensor_utils::MatrixBatchVectorMultiplyAccumulate(
+        aux_input_weights->data.f, num_units, aux_input->dims->data[2],
+        aux_input->data.f, n_vectors, input_projection, /*result_stride=*/1);
+  }
+}
+
 TfLiteStatus EvalFloat(const TfLiteTensor* input, const TfLiteTensor* bw_input,
                        const TfLiteTensor* fw_input_weights,
                        const TfLiteTensor* fw_recurrent_weights,
@@ -279,118 +346,95 @@ TfLiteStatus EvalFloat(const TfLiteTensor* input, const TfLiteTensor* bw_input,
                        const TfLiteTensor* bw_aux_input_weights,
                        const TfLiteBidirectionalSequenceRNNParams* params,
                        TfLiteTensor* fw_hidden_state, TfLiteTensor* fw_output,
-                       TfLiteTensor* bw_hidden_state, TfLiteTensor* bw_output) {
+                       TfLiteTensor* bw_hidden_state, TfLiteTensor* bw_output,
+                       TfLiteTensor* input_projection,
+                       CpuBackendContext* cpu_backend_context) {
   const bool time_major = params->time_major;
   const int batch_size =
       (time_major) ? input->dims->data[1] : input->dims->data[0];
   const int max_time =
       (time_major) ? input->dims->data[0] : input->dims->data[1];
-  const int input_size = input->dims->data[2];
-  const int aux_input_size = (aux_input) ? aux_input->dims->data[2] : 0;
 
   const int fw_num_units = fw_input_weights->dims->data[0];
-  const float* fw_bias_ptr = fw_bias->data.f;
-  const float* fw_input_weights_ptr = fw_input_weights->data.f;
   const float* fw_recurrent_weights_ptr = fw_recurrent_weights->data.f;
 
   const int bw_num_units = bw_input_weights->dims->data[0];
-  const float* bw_bias_ptr = bw_bias->data.f;
-  const float* bw_input_weights_ptr = bw_input_weights->data.f;
   const float* bw_recurrent_weights_ptr = bw_recurrent_weights->data.f;
 
-  const float* fw_aux_input_weights_ptr = (fw_aux_input_weights != nullptr)
-                                              ? fw_aux_input_weights->data.f
-                                              : nullptr;
-  const float* bw_aux_input_weights_ptr = (bw_aux_input_weights != nullptr)
-                                              ? bw_aux_input_weights->data.f
-                                              : nullptr;
-
   const int fw_output_step =
       params->merge_outputs ? fw_num_units + bw_num_units : fw_num_units;
   const int bw_output_step =
       params->merge_outputs ? fw_num_units + bw_num_units : bw_num_units;
+  float* bw_output_data = params->merge_outputs
+                              ? fw_output->data.f + fw_num_units
+                              : bw_output->data.f;
+
+  // Unless the outputs are merged, the input projections are computed straight
+  // into them.
+  float* fw_input_projection_ptr =
+      params->merge_outputs ? input_projection->data.f : fw_output->data.f;
+  float* bw_input_projection_ptr =
+      params->merge_outputs ? input_projection->data.f : bw_output->data.f;
+
+  // Forward cell.
+  ComputeInputProjection(input, fw_input_weights, aux_input,
+                         fw_aux_input_weights, fw_bias,
+                         fw_input_projection_ptr, cpu_backend_context);
   if (time_major) {
-    // Forward cell.
     float* fw_hidden_state_ptr_batch = fw_hidden_state->data.f;
     for (int s = 0; s < max_time; s++) {
-      const float* input_ptr_batch =
-          input->data.f + s * input_size * batch_size;
-      const float* aux_input_ptr_batch =
-          (aux_input != nullptr)
-              ? aux_input->data.f + s * input_size * batch_size
-              : nullptr;
       float* output_ptr_batch =
           fw_output->data.f + s * fw_output_step * batch_size;
 
-      kernel_utils::RnnBatchStep(
-          input_ptr_batch, fw_input_weights_ptr, aux_input_ptr_batch,
-          fw_aux_input_weights_ptr, fw_recurrent_weights_ptr, fw_bias_ptr,
-          input_size, aux_input_size, fw_num_units, batch_size, fw_output_step,
+      kernel_utils::RnnBatchStepWithInputProjection(
+          fw_input_projection_ptr + s * fw_num_units * batch_size,
+          fw_recurrent_weights_ptr, fw_num_units, batch_size, fw_output_step,
           params->activation, fw_hidden_state_ptr_batch, output_ptr_batch);
     }
-    // Backward cell.
-    float* bw_hidden_state_ptr_batch = bw_hidden_state->data.f;
-    for (int s = max_time - 1; s >= 0; s--) {
-      const float* input_ptr_batch =
-          bw_input->data.f + s * input_size * batch_size;
-      const float* aux_input_ptr_batch =
-          (aux_input != nullptr)
-              ? aux_input->data.f + s * input_size * batch_size
-              : nullptr;
-      float* output_ptr_batch =
-          (params->merge_outputs ? fw_output->data.f + fw_num_units
-                                 : bw_output->data.f) +
-          s * bw_output_step * batch_size;
-
-      kernel_utils::RnnBatchStep(
-          input_ptr_batch, bw_input_weights_ptr, aux_input_ptr_batch,
-          bw_aux_input_weights_ptr, bw_recurrent_weights_ptr, bw_bias_ptr,
-          input_size, aux_input_size, bw_num_units, batch_size, bw_output_step,
-          params->activation, bw_hidden_state_ptr_batch, output_ptr_batch);
-    }
   } else {
     for (int b = 0; b < batch_size; b++) {
-      // Forward cell.
       float* fw_hidden_state_ptr_batch =
           fw_hidden_state->data.f + b * fw_num_units;
-      float* fw_output_offset =
-          fw_output->data.f + b * fw_output_step * max_time;
       for (int s = 0; s < max_time; s++) {
-        const float* input_ptr_batch =
-            input->data.f + b * input_size * max_time + s * input_size;
-        const float* aux_input_ptr_batch =
-            (aux_input != nullptr)
-                ? aux_input->data.f + b * input_size * max_time + s * input_size
-                : nullptr;
-        float* output_ptr_batch = fw_output_offset + s * fw_output_step;
+        const int time_offset = b * max_time + s;
+        float* output_ptr_batch =
+            fw_output->data.f + time_offset * fw_output_step;
 
-        kernel_utils::RnnBatchStep(
-            input_ptr_batch, fw_input_weights_ptr, aux_input_ptr_batch,
-            fw_aux_input_weights_ptr, fw_recurrent_weights_ptr, fw_bias_ptr,
-            input_size, aux_input_size, fw_num_units, /*batch_size=*/1,
+        kernel_utils::RnnBatchStepWithInputProjection(
+            fw_input_projection_ptr + time_offset * fw_num_units,
+            fw_recurrent_weights_ptr, fw_num_units, /*batch_size=*/1,
             fw_output_step, params->activation, fw_hidden_state_ptr_batch,
             output_ptr_batch);
       }
-      // Backward cell.
+    }
+  }
+
+  // Backward cell.
+  ComputeInputProjection(bw_input, bw_input_weights, aux_input,
+                         bw_aux_input_weights, bw_bias,
+                         bw_input_projection_ptr, cpu_backend_context);
+  if (time_major) {
+    float* bw_hidden_state_ptr_batch = bw_hidden_state->data.f;
+    for (int s = max_time - 1; s >= 0; s--) {
+      float* output_ptr_batch =
+          bw_output_data + s * bw_output_step * batch_size;
+
+      kernel_utils::RnnBatchStepWithInputProjection(
+          bw_input_projection_ptr + s * bw_num_units * batch_size,
+          bw_recurrent_weights_ptr, bw_num_units, batch_size, bw_output_step,
+          params->activation, bw_hidden_state_ptr_batch, output_ptr_batch);
+    }
+  } else {
+    for (int b = 0; b < batch_size; b++) {
       float* bw_hidden_state_ptr_batch =
           bw_hidden_state->data.f + b * bw_num_units;
-      float* bw_output_offset =
-          params->merge_outputs
-              ? fw_output->data.f + b * bw_output_step * max_time + fw_num_units
-              : bw_output->data.f + b * bw_output_step * max_time;
       for (int s = max_time - 1; s >= 0; s--) {
-        const float* input_ptr_batch =
-            input->data.f + b * input_size * max_time + s * input_size;
-        const float* aux_input_ptr_batch =
-            (aux_input != nullptr)
-                ? aux_input->data.f + b * input_size * max_time + s * input_size
-                : nullptr;
-        float* output_ptr_batch = bw_output_offset + s * bw_output_step;
+        const int time_offset = b * max_time + s;
+        float* output_ptr_batch = bw_output_data + time_offset * bw_output_step;
 
-        kernel_utils::RnnBatchStep(
-            input_ptr_batch, bw_input_weights_ptr, aux_input_ptr_batch,
-            bw_aux_input_weights_ptr, bw_recurrent_weights_ptr, bw_bias_ptr,
-            input_size, aux_input_size, bw_num_units, /*batch_size=*/1,
+        kernel_utils::RnnBatchStepWithInputProjection(
+            bw_input_projection_ptr + time_offset * bw_num_units,
+            bw_recurrent_weights_ptr, bw_num_units, /*batch_size=*/1,
             bw_output_step, params->activation, bw_hidden_state_ptr_batch,
             output_ptr_batch);
       }
@@ -634,11 +678,14 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   switch (fw_input_weights->type) {
     case kTfLiteFloat32:
-      return EvalFloat(input, bw_input, fw_input_weights, fw_recurrent_weights,
-                       fw_bias, bw_input_weights, bw_recurrent_weights, bw_bias,
-                       real_aux_input, fw_aux_input_weights,
-                       bw_aux_input_weights, params, fw_hidden_state, fw_output,
-                       bw_hidden_state, bw_output);
+      return EvalFloat(
+          input, bw_input, fw_input_weights, fw_recurrent_weights, fw_bias,
+          bw_input_weights, bw_recurrent_weights, bw_bias, real_aux_input,
+          fw_aux_input_weights, bw_aux_input_weights, params, fw_hidden_state,
+          fw_output, bw_hidden_state, bw_output,
+          params->merge_outputs ? GetTemporary(context, node, kInputProjection)
+                                : nullptr,
+          cpu_backend_support::GetFromContext(context));
     case kTfLiteUInt8:
     case kTfLiteInt8: {
       TfLiteTensor* input_quantized =
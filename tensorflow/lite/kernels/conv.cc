@@ -40,6 +40,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/op_macros.h"
 #include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/weight_cache.h"
 
 namespace tflite {
 namespace ops {
@@ -62,6 +63,9 @@ enum KernelType {
 
 const int kTensorNotAllocated = -1;
 
+// Names the transposition of the filter into hwcn_weights in the weight cache.
+constexpr char kHwcnWeightsTransform[] = "conv/hwcn_weights";
+
 struct OpData {
   // IDs are the arbitrary identifiers used by TF Lite to identify and access
   // memory buffers.
@@ -225,9 +229,15 @@ TfLiteStatus Prepare(KernelType kernel_type, TfLiteContext* context,
   auto* params = reinterpret_cast<TfLiteConvParams*>(node->builtin_data);
   OpData* data = reinterpret_cast<OpData*>(node->user_data);
 
-  bool has_bias = node->inputs->size == 3;
+  // A bias omitted with kOptionalTensor counts as missing, so that it is
+  // rejected below instead of being looked up as a tensor.
+  bool has_bias = node->inputs->size >= 3 &&
+                  node->inputs->data[2] != kOptionalTensor;
+  // An optional fourth input holds a residual that is added to the result of
+  // the convolution before the fused activation is applied.
+  bool has_residual = node->inputs->size == 4;
   // Check number of inputs/outputs
-  TF_LITE_ENSURE(context, has_bias || node->inputs->size == 2);
+  TF_LITE_ENSURE(context, node->inputs->size >= 2 && node->inputs->size <= 4);
   TF_LITE_ENSURE_EQ(context, node->outputs->size, 1);
   TfLiteTensor* output = &context->tensors[node->outputs->data[0]];
   TfLiteTensor* input = &context->tensors[node->inputs->data[0]];
@@ -326,6 +336,15 @@ TfLiteStatus Prepare(KernelType kernel_type, TfLiteContext* context,
 
   if (output_status != kTfLiteOk) return output_status;
 
+  if (has_residual) {
+    // The residual is only supported for float outputs, i.e. by the float and
+    // hybrid kernels.
+    TfLiteTensor* residual = &context->tensors[node->inputs->data[3]];
+    TF_LITE_ENSURE_EQ(context, output->type, kTfLiteFloat32);
+    TF_LITE_ENSURE_EQ(context, residual->type, kTfLiteFloat32);
+    TF_LITE_ENSURE(context, TfLiteIntArrayEqual(residual->dims, output->dims));
+  }
+
   if (data->need_im2col) {
     node->temporaries->data[data->im2col_index] = data->im2col_id;
 
@@ -371,7 +390,10 @@ TfLiteStatus Prepare(KernelType kernel_type, TfLiteContext* context,
 
     // TODO(petewarden): If Resize() is called when the size hasn't actually
     // changed, this will do extra redundant work.
-    data->have_weights_been_transposed = false;
+    WeightCache* weight_cache = WeightCache::FromContext(context);
+    data->have_weights_been_transposed =
+        weight_cache &&
+        weight_cache->UseCached(filter, kHwcnWeightsTransform, hwcn_weights);
   }
 
   if (is_hybrid) {
@@ -522,14 +544,40 @@ void EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
   }
 }
 
+// Adds the residual to the convolution result in place and applies the fused
+// activation. The convolution itself must have run without an activation.
+template <KernelType kernel_type>
+void AddResidual(TfLiteConvParams* params, const TfLiteTensor* residual,
+                 TfLiteTensor* output) {
+  float output_activation_min, output_activation_max;
+  CalculateActivationRange(params->activation, &output_activation_min,
+                           &output_activation_max);
+  ArithmeticParams op_params;
+  SetActivationParams(output_activation_min, output_activation_max,
+                      &op_params);
+  if (kernel_type == kReference) {
+    reference_ops::Add(op_params, GetTensorShape(output),
+                       GetTensorData<float>(output), GetTensorShape(residual),
+                       GetTensorData<float>(residual), GetTensorShape(output),
+                       GetTensorData<float>(output));
+  } else {
+    optimized_ops::Add(op_params, GetTensorShape(output),
+                       GetTensorData<float>(output), GetTensorShape(residual),
+                       GetTensorData<float>(residual), GetTensorShape(output),
+                       GetTensorData<float>(output));
+  }
+}
+
 template <KernelType kernel_type>
 void EvalFloat(TfLiteContext* context, TfLiteNode* node,
                TfLiteConvParams* params, OpData* data, TfLiteTensor* input,
                TfLiteTensor* filter, TfLiteTensor* bias, TfLiteTensor* im2col,
-               TfLiteTensor* hwcn_weights, TfLiteTensor* output) {
+               TfLiteTensor* hwcn_weights, TfLiteTensor* residual,
+               TfLiteTensor* output) {
+  // With a residual, the activation is applied after the residual is added.
   float output_activation_min, output_activation_max;
-  CalculateActivationRange(params->activation, &output_activation_min,
-                           &output_activation_max);
+  CalculateActivationRange(residual ? kTfLiteActNone : params->activation,
+                           &output_activation_min, &output_activation_max);
   KernelType effective_kernel_type = kernel_type;
   // Fall back to the optimized path if multi-threaded conv is unsupported.
   if ((kernel_type == kMultithreadOptimized) &&
@@ -591,16 +639,20 @@ void EvalFloat(TfLiteContext* context, TfLiteNode* node,
 #endif
     }
   }
+  if (residual) {
+    AddResidual<kernel_type>(params, residual, output);
+  }
 }
 
 template <KernelType kernel_type>
 void EvalHybrid(TfLiteContext* context, TfLiteNode* node,
                 TfLiteConvParams* params, OpData* data, TfLiteTensor* input,
                 TfLiteTensor* filter, TfLiteTensor* bias, TfLiteTensor* im2col,
-                TfLiteTensor* hwcn_weights, TfLiteTensor* output) {
+                TfLiteTensor* hwcn_weights, TfLiteTensor* residual,
+                TfLiteTensor* output) {
   float output_activation_min, output_activation_max;
-  CalculateActivationRange(params->activation, &output_activation_min,
-                           &output_activation_max);
+  CalculateActivationRange(residual ? kTfLiteActNone : params->activation,
+                           &output_activation_min, &output_activation_max);
 
   const int input_size = NumElements(input) / SizeOfDimension(input, 0);
   const int batch_size = SizeOfDimension(input, 0);
@@ -664,6 +716,9 @@ void EvalHybrid(TfLiteContext* context, TfLiteNode* node,
       break;
     }
   }
+  if (residual) {
+    AddResidual<kernel_type>(params, residual, output);
+  }
 }
 
 template <KernelType kernel_type>
@@ -674,9 +729,13 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   TfLiteTensor* output = &context->tensors[node->outputs->data[0]];
   TfLiteTensor* input = &context->tensors[node->inputs->data[0]];
   TfLiteTensor* filter = &context->tensors[node->inputs->data[1]];
-  bool has_bias = node->inputs->size == 3;
+  bool has_bias = node->inputs->size >= 3 &&
+                  node->inputs->data[2] != kOptionalTensor;
   TfLiteTensor* bias =
       has_bias ? &context->tensors[node->inputs->data[2]] : nullptr;
+  bool has_residual = node->inputs->size == 4;
+  TfLiteTensor* residual =
+      has_residual ? &context->tensors[node->inputs->data[3]] : nullptr;
   TfLiteTensor* im2col =
       data->need_im2col
           ? &context->tensors[node->temporaries->data[data->im2col_index]]
@@ -689,6 +748,10 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   if (data->need_hwcn_weights && !data->have_weights_been_transposed) {
     TransposeFloatTensor(filter, hwcn_weights);
     data->have_weights_been_transposed = true;
+    WeightCache* weight_cache = WeightCache::FromContext(context);
+    if (weight_cache) {
+      weight_cache->Add(filter, kHwcnWeightsTransform, hwcn_weights);
+    }
   }
 
   // TODO(aselle): Consider whether float conv and quantized conv should be
@@ -697,10 +760,10 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
     case kTfLiteFloat32:
       if (filter->type == kTfLiteUInt8 || filter->type == kTfLiteInt8) {
         EvalHybrid<kernel_type>(context, node, params, data, input, filter,
-                                bias, im2col, hwcn_weights, output);
+                                bias, im2col, hwcn_weights, residual, output);
       } else {
         EvalFloat<kernel_type>(context, node, params, data, input, filter, bias,
-                               im2col, hwcn_weights, output);
+                               im2col, hwcn_weights, residual, output);
       }
       break;
     case kTfLiteUInt8:
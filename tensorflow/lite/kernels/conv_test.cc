@@ -121,6 +121,53 @@ class ConvolutionOpModel : public BaseConvolutionOpModel {
   std::vector<float> GetOutput() { return ExtractVector<float>(output_); }
 };
 
+// A float convolution with a fourth input holding a residual that is added to
+// the result before the activation.
+class ResidualConvolutionOpModel : public SingleOpModel {
+ public:
+  ResidualConvolutionOpModel(TfLiteRegistration* registration,
+                             const TensorData& input, const TensorData& filter,
+                             const TensorData& residual,
+                             const TensorData& output,
+                             enum ActivationFunctionType activation,
+                             bool has_bias = true) {
+    input_ = AddInput(input);
+    filter_ = AddInput(filter);
+    bias_ = has_bias ? AddInput({TensorType_FLOAT32, {GetShape(filter_)[0]}})
+                     : AddNullInput();
+    residual_ = AddInput(residual);
+    output_ = AddOutput(output);
+
+    SetBuiltinOp(BuiltinOperator_CONV_2D, BuiltinOptions_Conv2DOptions,
+                 CreateConv2DOptions(builder_, Padding_VALID,
+                                     /*stride_w=*/2, /*stride_h=*/2, activation)
+                     .Union());
+
+    resolver_ = absl::make_unique<SingleOpResolver>(BuiltinOperator_CONV_2D,
+                                                    registration);
+    BuildInterpreter({GetShape(input_), GetShape(filter_),
+                      has_bias ? GetShape(bias_) : std::vector<int>(),
+                      GetShape(residual_)});
+  }
+
+  void SetInput(std::initializer_list<float> data) {
+    PopulateTensor(input_, data);
+  }
+  void SetFilter(std::initializer_list<float> f) { PopulateTensor(filter_, f); }
+  void SetBias(std::initializer_list<float> f) { PopulateTensor(bias_, f); }
+  void SetResidual(std::initializer_list<float> data) {
+    PopulateTensor(residual_, data);
+  }
+  std::vector<float> GetOutput() { return ExtractVector<float>(output_); }
+
+ private:
+  int input_;
+  int filter_;
+  int bias_;
+  int residual_;
+  int output_;
+};
+
 const auto kKernelMap = new std::map<string, TfLiteRegistration*>({
     {"Reference", ops::builtin::Register_CONVOLUTION_REF()},
     {"GenericOptimized", ops::builtin::Register_CONVOLUTION_GENERIC_OPT()},
@@ -295,6 +342,57 @@ TEST_P(ConvolutionOpTest, ActivationRelu6Test) {
                              }));
 }
 
+TEST_P(ConvolutionOpTest, ResidualTest) {
+  ResidualConvolutionOpModel m(
+      GetRegistration(), {TensorType_FLOAT32, {2, 2, 4, 1}},
+      {TensorType_FLOAT32, {3, 2, 2, 1}}, {TensorType_FLOAT32, {2, 1, 2, 3}},
+      {TensorType_FLOAT32, {}}, ActivationFunctionType_RELU);
+
+  // Same as SimpleTestFloat32, whose output is
+  // {18, 2, 5, 18, 2, 5, 17, 4, 3, 37, 4, 3}.
+  m.SetInput({
+      // First batch
+      1, 1, 1, 1,  // row = 1
+      2, 2, 2, 2,  // row = 2
+      // Second batch
+      1, 2, 3, 4,  // row = 1
+      1, 2, 3, 4,  // row = 2
+  });
+  m.SetFilter({
+      1, 2, 3, 4,    // first 2x2 filter
+      -1, 1, -1, 1,  // second 2x2 filter
+      -1, -1, 1, 1,  // third 2x2 filter
+  });
+  m.SetBias({1, 2, 3});
+  m.SetResidual({
+      -20, -1, 1,  // first batch, left
+      0, -3, 0,    // first batch, right
+      1, -5, 2,    // second batch, left
+      -40, 0, 0,   // second batch, right
+  });
+
+  m.Invoke();
+
+  // The activation applies to the sum, not to the convolution alone.
+  EXPECT_THAT(m.GetOutput(), ElementsAreArray({
+                                 0, 1, 6,   // first batch, left
+                                 18, 0, 5,  // first batch, right
+                                 18, 0, 5,  // second batch, left
+                                 0, 4, 3,   // second batch, right
+                             }));
+}
+
+#ifdef GTEST_HAS_DEATH_TEST
+TEST_P(ConvolutionOpTest, ResidualWithoutBias) {
+  EXPECT_DEATH(ResidualConvolutionOpModel(
+                   GetRegistration(), {TensorType_FLOAT32, {2, 2, 4, 1}},
+                   {TensorType_FLOAT32, {3, 2, 2, 1}},
+                   {TensorType_FLOAT32, {2, 1, 2, 3}}, {TensorType_FLOAT32, {}},
+                   ActivationFunctionType_RELU, /*has_bias=*/false),
+               "Cannot allocate tensors");
+}
+#endif
+
 TEST_P(ConvolutionOpTest, StrideTest) {
   ConvolutionOpModel m(GetRegistration(), {TensorType_FLOAT32, {2, 2, 4, 1}},
                        {TensorType_FLOAT32, {3, 2, 2, 1}},
@@ -26,6 +26,7 @@ limitations under the License.
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/kernels/cpu_backend_support.h"
 #include "tensorflow/lite/kernels/internal/optimized/depthwiseconv_multithread.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
 #include "tensorflow/lite/kernels/internal/reference/depthwiseconv_float.h"
 #include "tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h"
@@ -43,6 +44,7 @@ namespace depthwise_conv {
 constexpr int kInputTensor = 0;
 constexpr int kFilterTensor = 1;
 constexpr int kBiasTensor = 2;
+constexpr int kResidualTensor = 3;
 constexpr int kOutputTensor = 0;
 
 // This file has three implementation of DepthwiseConv.
@@ -86,12 +88,16 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       reinterpret_cast<TfLiteDepthwiseConvParams*>(node->builtin_data);
   OpData* data = reinterpret_cast<OpData*>(node->user_data);
 
-  // TODO(ahentz): use could use GetOptionalInputTensor() here, but we need to
-  // decide whether we are OK with optional tensors being completely absent, as
-  // opposed to having -1 as their index.
-  bool hasBias = NumInputs(node) == 3;
+  // The bias is optional: it may be completely absent or have -1 as its index.
+  bool hasBias = NumInputs(node) >= 3 &&
+                 GetOptionalInputTensor(context, node, kBiasTensor) != nullptr;
+  // An optional fourth input holds a residual that is added to the result of
+  // the convolution before the fused activation is applied.
+  bool hasResidual = NumInputs(node) == 4;
 
-  TF_LITE_ENSURE(context, hasBias || NumInputs(node) == 2);
+  TF_LITE_ENSURE(context, NumInputs(node) >= 2 && NumInputs(node) <= 4);
+  // The residual form keeps the bias in its third slot, so it must be present.
+  TF_LITE_ENSURE(context, hasBias || !hasResidual);
   const TfLiteTensor* input = GetInput(context, node, kInputTensor);
   const TfLiteTensor* filter = GetInput(context, node, kFilterTensor);
   const TfLiteTensor* bias = nullptr;
@@ -171,17 +177,53 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   outputSize->data[1] = out_height;
   outputSize->data[2] = out_width;
   outputSize->data[3] = channels_out;
-  return context->ResizeTensor(context, output, outputSize);
+  TF_LITE_ENSURE_OK(context,
+                    context->ResizeTensor(context, output, outputSize));
+
+  if (hasResidual) {
+    // The residual is only supported by the float kernel.
+    const TfLiteTensor* residual = GetInput(context, node, kResidualTensor);
+    TF_LITE_ENSURE_EQ(context, data_type, kTfLiteFloat32);
+    TF_LITE_ENSURE_EQ(context, residual->type, kTfLiteFloat32);
+    TF_LITE_ENSURE(context, TfLiteIntArrayEqual(residual->dims, output->dims));
+  }
+  return kTfLiteOk;
+}
+
+// Adds the residual to the convolution result in place and applies the fused
+// activation. The convolution itself must have run without an activation.
+template <KernelType kernel_type>
+void AddResidual(TfLiteDepthwiseConvParams* params,
+                 const TfLiteTensor* residual, TfLiteTensor* output) {
+  float output_activation_min, output_activation_max;
+  CalculateActivationRange(params->activation, &output_activation_min,
+                           &output_activation_max);
+  ArithmeticParams op_params;
+  SetActivationParams(output_activation_min, output_activation_max,
+                      &op_params);
+  if (kernel_type == kReference) {
+    reference_ops::Add(op_params, GetTensorShape(output),
+                       GetTensorData<float>(output), GetTensorShape(residual),
+                       GetTensorData<float>(residual), GetTensorShape(output),
+                       GetTensorData<float>(output));
+  } else {
+    optimized_ops::Add(op_params, GetTensorShape(output),
+                       GetTensorData<float>(output), GetTensorShape(residual),
+                       GetTensorData<float>(residual), GetTensorShape(output),
+                       GetTensorData<float>(output));
+  }
 }
 
 template <KernelType kernel_type>
 void EvalFloat(TfLiteContext* context, TfLiteNode* node,
                TfLiteDepthwiseConvParams* params, OpData* data,
                const TfLiteTensor* input, const TfLiteTensor* filter,
-               const TfLiteTensor* bias, TfLiteTensor* output) {
+               const TfLiteTensor* bias, const TfLiteTensor* residual,
+               TfLiteTensor* output) {
+  // With a residual, the activation is applied after the residual is added.
   float output_activation_min, output_activation_max;
-  CalculateActivationRange(params->activation, &output_activation_min,
-                           &output_activation_max);
+  CalculateActivationRange(residual ? kTfLiteActNone : params->activation,
+                           &output_activation_min, &output_activation_max);
 
   DepthwiseParams op_params;
   op_params.padding_type = PaddingType::kSame;
@@ -208,6 +250,9 @@ void EvalFloat(TfLiteContext* context, TfLiteNode* node,
         GetTensorShape(output), GetTensorData<float>(output),
         cpu_backend_support::GetFromContext(context));
   }
+  if (residual) {
+    AddResidual<kernel_type>(params, residual, output);
+  }
 }
 
 template <KernelType kernel_type>
@@ -303,14 +348,19 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteTensor* input = GetInput(context, node, kInputTensor);
   const TfLiteTensor* filter = GetInput(context, node, kFilterTensor);
   const TfLiteTensor* bias =
-      (NumInputs(node) == 3) ? GetInput(context, node, kBiasTensor) : nullptr;
+      (NumInputs(node) >= 3)
+          ? GetOptionalInputTensor(context, node, kBiasTensor)
+          : nullptr;
+  const TfLiteTensor* residual = (NumInputs(node) == 4)
+                                     ? GetInput(context, node, kResidualTensor)
+                                     : nullptr;
 
   // TODO(aselle): Consider whether float conv and quantized conv should be
   // separate ops to avoid dispatch overhead here.
   switch (input->type) {  // Already know in/out types are same.
     case kTfLiteFloat32:
       EvalFloat<kernel_type>(context, node, params, data, input, filter, bias,
-                             output);
+                             residual, output);
       break;
     case kTfLiteUInt8:
       EvalQuantized<kernel_type>(context, node, params, data, input, filter,
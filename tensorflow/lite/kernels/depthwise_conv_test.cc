@@ -128,6 +128,58 @@ class DepthwiseConvolutionOpModel : public BaseDepthwiseConvolutionOpModel {
   std::vector<float> GetOutput() { return ExtractVector<float>(output_); }
 };
 
+// A float depthwise convolution with a fourth input holding a residual that is
+// added to the result before the activation.
+class ResidualDepthwiseConvolutionOpModel : public SingleOpModel {
+ public:
+  ResidualDepthwiseConvolutionOpModel(
+      TfLiteRegistration* registration, const TensorData& input,
+      const TensorData& filter, const TensorData& residual,
+      const TensorData& output,
+      ActivationFunctionType fused_activation_function) {
+    input_ = AddInput(input);
+    filter_ = AddInput(filter);
+    bias_ = AddInput({TensorType_FLOAT32, {GetShape(filter_)[3]}});
+    residual_ = AddInput(residual);
+    output_ = AddOutput(output);
+
+    int input_depth = GetShape(input_)[3];
+    int output_depth = GetShape(filter_)[3];
+    int depth_mul = output_depth / input_depth;
+
+    SetBuiltinOp(BuiltinOperator_DEPTHWISE_CONV_2D,
+                 BuiltinOptions_DepthwiseConv2DOptions,
+                 CreateDepthwiseConv2DOptions(builder_, Padding_VALID,
+                                              /*stride_w=*/1, /*stride_h=*/1,
+                                              depth_mul,
+                                              fused_activation_function)
+                     .Union());
+
+    resolver_ = absl::make_unique<SingleOpResolver>(
+        BuiltinOperator_DEPTHWISE_CONV_2D, registration);
+
+    BuildInterpreter({GetShape(input_), GetShape(filter_), GetShape(bias_),
+                      GetShape(residual_)});
+  }
+
+  void SetInput(std::initializer_list<float> data) {
+    PopulateTensor(input_, data);
+  }
+  void SetFilter(std::initializer_list<float> f) { PopulateTensor(filter_, f); }
+  void SetBias(std::initializer_list<float> f) { PopulateTensor(bias_, f); }
+  void SetResidual(std::initializer_list<float> data) {
+    PopulateTensor(residual_, data);
+  }
+  std::vector<float> GetOutput() { return ExtractVector<float>(output_); }
+
+ private:
+  int input_;
+  int filter_;
+  int bias_;
+  int residual_;
+  int output_;
+};
+
 const auto kKernelMap = new std::map<string, TfLiteRegistration*>({
     {"Reference", ops::builtin::Register_DEPTHWISE_CONVOLUTION_REF()},
     {"GenericOptimized",
@@ -173,6 +225,40 @@ TEST_P(DepthwiseConvolutionOpTest, ActivationReluTest) {
                              }));
 }
 
+TEST_P(DepthwiseConvolutionOpTest, ResidualTest) {
+  ResidualDepthwiseConvolutionOpModel m(
+      GetRegistration(), {TensorType_FLOAT32, {1, 3, 2, 2}},
+      {TensorType_FLOAT32, {1, 2, 2, 4}}, {TensorType_FLOAT32, {1, 2, 1, 4}},
+      {TensorType_FLOAT32, {}}, ActivationFunctionType_RELU);
+
+  // Without residual and activation the output is
+  // {71, -34, 99, -20, 91, -26, 127, -4}.
+  m.SetInput({
+      1, 2, 7, 8,    // column 1
+      3, 4, 9, 10,   // column 2
+      5, 6, 11, 12,  // column 3
+  });
+  m.SetFilter({
+      1, 2, 3, 4,        //
+      -9, 10, -11, 12,   //
+      5, 6, 7, 8,        //
+      13, -14, 15, -16,  //
+  });
+  m.SetBias({1, 2, 3, 4});
+  m.SetResidual({
+      -80, 40, 1, 10,  //
+      0, 30, -130, 3,  //
+  });
+
+  m.Invoke();
+
+  // The activation applies to the sum, not to the convolution alone.
+  EXPECT_THAT(m.GetOutput(), ElementsAreArray({
+                                 0, 6, 100, 0,  //
+                                 91, 4, 0, 0,   //
+                             }));
+}
+
 TEST_P(DepthwiseConvolutionOpTest, ActivationReluN1Test) {
   DepthwiseConvolutionOpModel m(
       GetRegistration(), {TensorType_FLOAT32, {1, 3, 2, 2}},
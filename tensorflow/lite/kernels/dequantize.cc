@@ -26,6 +26,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/tensor.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/op_macros.h"
+#include "tensorflow/lite/weight_cache.h"
 
 namespace tflite {
 namespace ops {
@@ -41,14 +42,20 @@ struct OpContext {
   TfLiteTensor* output;
 };
 
+// Names the dequantization of constant inputs in the weight cache.
+constexpr char kDequantizeTransform[] = "dequantize";
+
 struct OpData {
-  // This boolean value is only used when the input tensor is constant.
+  // These boolean values are only used when the input tensor is constant.
   bool float_dequantized_weights_initialized;
+  // Whether the output points at weights mapped from the weight cache.
+  bool float_dequantized_weights_cached;
 };
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   auto* op_data = new OpData();
   op_data->float_dequantized_weights_initialized = false;
+  op_data->float_dequantized_weights_cached = false;
   return op_data;
 }
 
@@ -72,8 +79,22 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   if (IsConstantTensor(op_context.input)) {
     op_context.output->allocation_type = kTfLiteArenaRwPersistent;
   }
-  return context->ResizeTensor(context, op_context.output,
-                               TfLiteIntArrayCopy(op_context.input->dims));
+  TF_LITE_ENSURE_OK(context,
+                    context->ResizeTensor(
+                        context, op_context.output,
+                        TfLiteIntArrayCopy(op_context.input->dims)));
+  // The dequantized weights may have been saved by another process.
+  OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
+  WeightCache* weight_cache = WeightCache::FromContext(context);
+  const bool cached =
+      weight_cache && weight_cache->UseCached(op_context.input,
+                                              kDequantizeTransform,
+                                              op_context.output);
+  if (cached || op_data->float_dequantized_weights_cached) {
+    op_data->float_dequantized_weights_initialized = cached;
+  }
+  op_data->float_dequantized_weights_cached = cached;
+  return kTfLiteOk;
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
@@ -117,6 +138,11 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   if (IsConstantTensor(op_context.input)) {
     op_data->float_dequantized_weights_initialized = true;
+    WeightCache* weight_cache = WeightCache::FromContext(context);
+    if (weight_cache) {
+      weight_cache->Add(op_context.input, kDequantizeTransform,
+                        op_context.output);
+    }
   }
 
   return kTfLiteOk;
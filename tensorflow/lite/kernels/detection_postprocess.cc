@@ -13,11 +13,16 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 #include <string.h>
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <vector>
 #include "flatbuffers/flexbuffers.h"  // TF:flatbuffers
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/kernels/cpu_backend_context.h"
+#include "tensorflow/lite/kernels/cpu_backend_support.h"
+#include "tensorflow/lite/kernels/cpu_backend_threadpool.h"
 #include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
 #include "tensorflow/lite/kernels/internal/reference/reference_ops.h"
 #include "tensorflow/lite/kernels/internal/tensor.h"
@@ -77,6 +82,18 @@ static_assert(sizeof(BoxCornerEncoding) == sizeof(float) * kNumCoordBox,
 static_assert(sizeof(CenterSizeEncoding) == sizeof(float) * kNumCoordBox,
               "Size of CenterSizeEncoding is 4 float values");
 
+// Scratch space of NonMaxSuppressionSingleClassHelper, one per thread.
+struct NonMaxSuppressionScratch {
+  std::vector<int> keep_indices;
+  std::vector<float> keep_scores;
+  std::vector<int> sorted_indices;
+  // The kept boxes and their areas in decreasing score order, so that the
+  // pairwise IoU loop reads them contiguously.
+  std::vector<BoxCornerEncoding> sorted_boxes;
+  std::vector<float> sorted_areas;
+  std::vector<uint8_t> active_box_candidate;
+};
+
 struct OpData {
   int max_detections;
   int max_classes_per_detection;  // Fast Non-Max-Suppression
@@ -89,10 +106,21 @@ struct OpData {
   // Indices of Temporary tensors
   int decoded_boxes_index;
   int scores_index;
-  int active_candidate_index;
+  // Buffers sized in Prepare and reused by every invocation, so that Eval
+  // does not allocate.
+  std::vector<float> box_areas;
+  std::vector<NonMaxSuppressionScratch> nms_scratch;
+  std::vector<int> selected;
+  std::vector<int> num_selected_per_class;  // Regular Non-Max-Suppression
+  std::vector<int> candidate_box_indices;   // Regular Non-Max-Suppression
+  std::vector<float> candidate_scores;      // Regular Non-Max-Suppression
+  std::vector<int> sorted_candidates;       // Regular Non-Max-Suppression
+  std::vector<float> max_scores;            // Fast Non-Max-Suppression
+  std::vector<int> sorted_class_indices;    // Fast Non-Max-Suppression
 };
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  cpu_backend_support::IncrementUsageCounter(context);
   auto* op_data = new OpData;
   const uint8_t* buffer_t = reinterpret_cast<const uint8_t*>(buffer);
   const flexbuffers::Map& m = flexbuffers::GetRoot(buffer_t, length).AsMap();
@@ -117,11 +145,11 @@ void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   op_data->scale_values.w = m["w_scale"].AsFloat();
   context->AddTensors(context, 1, &op_data->decoded_boxes_index);
   context->AddTensors(context, 1, &op_data->scores_index);
-  context->AddTensors(context, 1, &op_data->active_candidate_index);
   return op_data;
 }
 
 void Free(TfLiteContext* context, void* buffer) {
+  cpu_backend_support::DecrementUsageCounter(context);
   delete reinterpret_cast<OpData*>(buffer);
 }
 
@@ -136,6 +164,15 @@ TfLiteStatus SetTensorSizes(TfLiteContext* context, TfLiteTensor* tensor,
   return context->ResizeTensor(context, tensor, size);
 }
 
+void ResizeScratch(NonMaxSuppressionScratch* scratch, int num_boxes) {
+  scratch->keep_indices.resize(num_boxes);
+  scratch->keep_scores.resize(num_boxes);
+  scratch->sorted_indices.resize(num_boxes);
+  scratch->sorted_boxes.resize(num_boxes);
+  scratch->sorted_areas.resize(num_boxes);
+  scratch->active_box_candidate.resize(num_boxes);
+}
+
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   auto* op_data = reinterpret_cast<OpData*>(node->user_data);
   // Inputs: box_encodings, scores, anchors
@@ -184,10 +221,9 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
 
   // Temporary tensors
   TfLiteIntArrayFree(node->temporaries);
-  node->temporaries = TfLiteIntArrayCreate(3);
+  node->temporaries = TfLiteIntArrayCreate(2);
   node->temporaries->data[0] = op_data->decoded_boxes_index;
   node->temporaries->data[1] = op_data->scores_index;
-  node->temporaries->data[2] = op_data->active_candidate_index;
 
   // decoded_boxes
   TfLiteTensor* decoded_boxes = &context->tensors[op_data->decoded_boxes_index];
@@ -204,13 +240,29 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
                  {input_class_predictions->dims->data[1],
                   input_class_predictions->dims->data[2]});
 
-  // active_candidate
-  TfLiteTensor* active_candidate =
-      &context->tensors[op_data->active_candidate_index];
-  active_candidate->type = kTfLiteUInt8;
-  active_candidate->allocation_type = kTfLiteArenaRw;
-  SetTensorSizes(context, active_candidate,
-                 {input_box_encodings->dims->data[1]});
+  // Scratch buffers. Eval only adds per-thread scratch when it runs on more
+  // threads than before.
+  const int num_boxes = input_box_encodings->dims->data[1];
+  op_data->box_areas.resize(num_boxes);
+  if (op_data->nms_scratch.empty()) {
+    op_data->nms_scratch.resize(1);
+  }
+  for (auto& scratch : op_data->nms_scratch) {
+    ResizeScratch(&scratch, num_boxes);
+  }
+  if (op_data->use_regular_non_max_suppression) {
+    const int num_candidates =
+        op_data->num_classes * std::max(op_data->detections_per_class, 0);
+    op_data->selected.resize(num_candidates);
+    op_data->num_selected_per_class.resize(op_data->num_classes);
+    op_data->candidate_box_indices.resize(num_candidates);
+    op_data->candidate_scores.resize(num_candidates);
+    op_data->sorted_candidates.resize(num_candidates);
+  } else {
+    op_data->selected.resize(std::max(op_data->max_detections, 0));
+    op_data->max_scores.resize(num_boxes);
+    op_data->sorted_class_indices.resize(num_boxes * op_data->num_classes);
+  }
 
   return kTfLiteOk;
 }
@@ -260,6 +312,65 @@ T ReInterpretTensor(TfLiteTensor* tensor) {
   return reinterpret_cast<T>(tensor_base);
 }
 
+// Decodes one box, see the formulas above BoxCornerEncoding. The scales are
+// given as their reciprocals, which saves four divisions per box.
+inline void DecodeCenterSizeBox(const CenterSizeEncoding& box_centersize,
+                                const CenterSizeEncoding& anchor,
+                                const CenterSizeEncoding& inverse_scales,
+                                BoxCornerEncoding* box) {
+  const float ycenter =
+      box_centersize.y * inverse_scales.y * anchor.h + anchor.y;
+  const float xcenter =
+      box_centersize.x * inverse_scales.x * anchor.w + anchor.x;
+  const float half_h =
+      0.5f * std::exp(box_centersize.h * inverse_scales.h) * anchor.h;
+  const float half_w =
+      0.5f * std::exp(box_centersize.w * inverse_scales.w) * anchor.w;
+  box->ymin = ycenter - half_h;
+  box->xmin = xcenter - half_w;
+  box->ymax = ycenter + half_h;
+  box->xmax = xcenter + half_w;
+}
+
+// Decodes float boxes whose encodings are `box_stride` floats apart.
+void DecodeFloatCenterSizeBoxes(const float* boxes, int box_stride,
+                                const CenterSizeEncoding* anchors,
+                                int num_boxes,
+                                const CenterSizeEncoding& inverse_scales,
+                                BoxCornerEncoding* decoded_boxes) {
+#ifdef USE_NEON
+  // (y, x) and (h, w) are the two halves of a CenterSizeEncoding, and
+  // (ymin, xmin) and (ymax, xmax) the two halves of a BoxCornerEncoding, so a
+  // box is decoded with 2-lane operations, only the exponentials being
+  // scalar.
+  const float32x2_t inverse_scale_yx = vld1_f32(&inverse_scales.y);
+  const float32x2_t inverse_scale_hw = vld1_f32(&inverse_scales.h);
+  for (int idx = 0; idx < num_boxes; ++idx) {
+    const float32x4_t box = vld1q_f32(boxes + idx * box_stride);
+    const float32x4_t anchor = vld1q_f32(&anchors[idx].y);
+    const float32x2_t anchor_yx = vget_low_f32(anchor);
+    const float32x2_t anchor_hw = vget_high_f32(anchor);
+    const float32x2_t center = vmla_f32(
+        anchor_yx, vmul_f32(vget_low_f32(box), inverse_scale_yx), anchor_hw);
+    const float32x2_t log_size =
+        vmul_f32(vget_high_f32(box), inverse_scale_hw);
+    const float size[2] = {std::exp(vget_lane_f32(log_size, 0)),
+                           std::exp(vget_lane_f32(log_size, 1))};
+    const float32x2_t half_size =
+        vmul_f32(vmul_n_f32(vld1_f32(size), 0.5f), anchor_hw);
+    vst1q_f32(&decoded_boxes[idx].ymin,
+              vcombine_f32(vsub_f32(center, half_size),
+                           vadd_f32(center, half_size)));
+  }
+#else
+  for (int idx = 0; idx < num_boxes; ++idx) {
+    DecodeCenterSizeBox(
+        *reinterpret_cast<const CenterSizeEncoding*>(boxes + idx * box_stride),
+        anchors[idx], inverse_scales, &decoded_boxes[idx]);
+  }
+#endif
+}
+
 TfLiteStatus DecodeCenterSizeBoxes(TfLiteContext* context, TfLiteNode* node,
                                    OpData* op_data) {
   // Parse input tensor boxencodings
@@ -267,60 +378,55 @@ TfLiteStatus DecodeCenterSizeBoxes(TfLiteContext* context, TfLiteNode* node,
       GetInput(context, node, kInputTensorBoxEncodings);
   TF_LITE_ENSURE_EQ(context, input_box_encodings->dims->data[0], kBatchSize);
   const int num_boxes = input_box_encodings->dims->data[1];
-  TF_LITE_ENSURE(context, input_box_encodings->dims->data[2] >= kNumCoordBox);
+  const int length_box_encoding = input_box_encodings->dims->data[2];
+  TF_LITE_ENSURE(context, length_box_encoding >= kNumCoordBox);
   const TfLiteTensor* input_anchors =
       GetInput(context, node, kInputTensorAnchors);
+  TfLiteTensor* decoded_boxes = &context->tensors[op_data->decoded_boxes_index];
+  BoxCornerEncoding* decoded_boxes_data =
+      ReInterpretTensor<BoxCornerEncoding*>(decoded_boxes);
 
   // Decode the boxes to get (ymin, xmin, ymax, xmax) based on the anchors
-  CenterSizeEncoding box_centersize;
-  CenterSizeEncoding scale_values = op_data->scale_values;
-  CenterSizeEncoding anchor;
-  for (int idx = 0; idx < num_boxes; ++idx) {
-    switch (input_box_encodings->type) {
-        // Quantized
-      case kTfLiteUInt8:
-        DequantizeBoxEncodings(
-            input_box_encodings, idx,
-            static_cast<float>(input_box_encodings->params.zero_point),
-            static_cast<float>(input_box_encodings->params.scale),
-            input_box_encodings->dims->data[2], &box_centersize);
-        DequantizeBoxEncodings(
-            input_anchors, idx,
-            static_cast<float>(input_anchors->params.zero_point),
-            static_cast<float>(input_anchors->params.scale), kNumCoordBox,
-            &anchor);
-        break;
-        // Float
-      case kTfLiteFloat32: {
-        // Please see DequantizeBoxEncodings function for the support detail.
-        const int box_encoding_idx = idx * input_box_encodings->dims->data[2];
-        const float* boxes =
-            &(GetTensorData<float>(input_box_encodings)[box_encoding_idx]);
-        box_centersize = *reinterpret_cast<const CenterSizeEncoding*>(boxes);
-        anchor =
-            ReInterpretTensor<const CenterSizeEncoding*>(input_anchors)[idx];
-        break;
+  CenterSizeEncoding inverse_scales;
+  inverse_scales.y = 1.0f / op_data->scale_values.y;
+  inverse_scales.x = 1.0f / op_data->scale_values.x;
+  inverse_scales.h = 1.0f / op_data->scale_values.h;
+  inverse_scales.w = 1.0f / op_data->scale_values.w;
+  switch (input_box_encodings->type) {
+      // Quantized
+    case kTfLiteUInt8: {
+      const float box_zero_point =
+          static_cast<float>(input_box_encodings->params.zero_point);
+      const float box_scale =
+          static_cast<float>(input_box_encodings->params.scale);
+      const float anchor_zero_point =
+          static_cast<float>(input_anchors->params.zero_point);
+      const float anchor_scale =
+          static_cast<float>(input_anchors->params.scale);
+      CenterSizeEncoding box_centersize;
+      CenterSizeEncoding anchor;
+      for (int idx = 0; idx < num_boxes; ++idx) {
+        DequantizeBoxEncodings(input_box_encodings, idx, box_zero_point,
+                               box_scale, length_box_encoding,
+                               &box_centersize);
+        DequantizeBoxEncodings(input_anchors, idx, anchor_zero_point,
+                               anchor_scale, kNumCoordBox, &anchor);
+        DecodeCenterSizeBox(box_centersize, anchor, inverse_scales,
+                            &decoded_boxes_data[idx]);
       }
-      default:
-        // Unsupported type.
-        return kTfLiteError;
+      break;
     }
-
-    float ycenter = box_centersize.y / scale_values.y * anchor.h + anchor.y;
-    float xcenter = box_centersize.x / scale_values.x * anchor.w + anchor.x;
-    float half_h =
-        0.5f * static_cast<float>(std::exp(box_centersize.h / scale_values.h)) *
-        anchor.h;
-    float half_w =
-        0.5f * static_cast<float>(std::exp(box_centersize.w / scale_values.w)) *
-        anchor.w;
-    TfLiteTensor* decoded_boxes =
-        &context->tensors[op_data->decoded_boxes_index];
-    auto& box = ReInterpretTensor<BoxCornerEncoding*>(decoded_boxes)[idx];
-    box.ymin = ycenter - half_h;
-    box.xmin = xcenter - half_w;
-    box.ymax = ycenter + half_h;
-    box.xmax = xcenter + half_w;
+      // Float
+    case kTfLiteFloat32:
+      // Please see DequantizeBoxEncodings function for the support detail.
+      DecodeFloatCenterSizeBoxes(
+          GetTensorData<float>(input_box_encodings), length_box_encoding,
+          ReInterpretTensor<const CenterSizeEncoding*>(input_anchors),
+          num_boxes, inverse_scales, decoded_boxes_data);
+      break;
+    default:
+      // Unsupported type.
+      return kTfLiteError;
   }
   return kTfLiteOk;
 }
@@ -333,35 +439,25 @@ void DecreasingPartialArgSort(const float* values, int num_values,
       [&values](const int i, const int j) { return values[i] > values[j]; });
 }
 
-void SelectDetectionsAboveScoreThreshold(const std::vector<float>& values,
-                                         const float threshold,
-                                         std::vector<float>* keep_values,
-                                         std::vector<int>* keep_indices) {
-  for (int i = 0; i < values.size(); i++) {
-    if (values[i] >= threshold) {
-      keep_values->emplace_back(values[i]);
-      keep_indices->emplace_back(i);
-    }
-  }
-}
-
-bool ValidateBoxes(const TfLiteTensor* decoded_boxes, const int num_boxes) {
+// Computes the areas of the decoded boxes. Returns false if a box does not
+// have ymax > ymin and xmax > xmin.
+bool ComputeBoxAreas(const BoxCornerEncoding* boxes, const int num_boxes,
+                     float* areas) {
+  bool valid = true;
   for (int i = 0; i < num_boxes; ++i) {
-    // ymax>=ymin, xmax>=xmin
-    auto& box = ReInterpretTensor<const BoxCornerEncoding*>(decoded_boxes)[i];
-    if (box.ymin >= box.ymax || box.xmin >= box.xmax) {
-      return false;
-    }
+    const BoxCornerEncoding& box = boxes[i];
+    valid &= box.ymin < box.ymax && box.xmin < box.xmax;
+    areas[i] = (box.ymax - box.ymin) * (box.xmax - box.xmin);
   }
-  return true;
+  return valid;
 }
 
-float ComputeIntersectionOverUnion(const TfLiteTensor* decoded_boxes,
-                                   const int i, const int j) {
-  auto& box_i = ReInterpretTensor<const BoxCornerEncoding*>(decoded_boxes)[i];
-  auto& box_j = ReInterpretTensor<const BoxCornerEncoding*>(decoded_boxes)[j];
-  const float area_i = (box_i.ymax - box_i.ymin) * (box_i.xmax - box_i.xmin);
-  const float area_j = (box_j.ymax - box_j.ymin) * (box_j.xmax - box_j.xmin);
+// The areas of the boxes are computed once per invocation rather than for
+// every pair of boxes.
+inline float ComputeIntersectionOverUnion(const BoxCornerEncoding& box_i,
+                                          const float area_i,
+                                          const BoxCornerEncoding& box_j,
+                                          const float area_j) {
   if (area_i <= 0 || area_j <= 0) return 0.0;
   const float intersection_ymin = std::max<float>(box_i.ymin, box_j.ymin);
   const float intersection_xmin = std::max<float>(box_i.xmin, box_j.xmin);
@@ -379,67 +475,63 @@ float ComputeIntersectionOverUnion(const TfLiteTensor* decoded_boxes,
 // If lower-scoring box has too much overlap with a higher-scoring box,
 // we get rid of the lower-scoring box.
 // Complexity is O(N^2) pairwise comparison between boxes
-TfLiteStatus NonMaxSuppressionSingleClassHelper(
-    TfLiteContext* context, TfLiteNode* node, OpData* op_data,
-    const std::vector<float>& scores, std::vector<int>* selected,
-    int max_detections) {
-  const TfLiteTensor* input_box_encodings =
-      GetInput(context, node, kInputTensorBoxEncodings);
-  const TfLiteTensor* decoded_boxes =
-      &context->tensors[op_data->decoded_boxes_index];
-  const int num_boxes = input_box_encodings->dims->data[1];
+// The score of box i is scores[i * scores_stride], so that the scores of one
+// class are read in place. The indices of the selected boxes are written to
+// `selected` and their number is returned.
+int NonMaxSuppressionSingleClassHelper(
+    const OpData* op_data, const BoxCornerEncoding* decoded_boxes,
+    const float* box_areas, int num_boxes, const float* scores,
+    int scores_stride, int max_detections, NonMaxSuppressionScratch* scratch,
+    int* selected) {
   const float non_max_suppression_score_threshold =
       op_data->non_max_suppression_score_threshold;
   const float intersection_over_union_threshold =
       op_data->intersection_over_union_threshold;
-  // Maximum detections should be positive.
-  TF_LITE_ENSURE(context, (max_detections >= 0));
-  // intersection_over_union_threshold should be positive
-  // and should be less than 1.
-  TF_LITE_ENSURE(context, (intersection_over_union_threshold > 0.0f) &&
-                              (intersection_over_union_threshold <= 1.0f));
-  // Validate boxes
-  TF_LITE_ENSURE(context, ValidateBoxes(decoded_boxes, num_boxes));
 
   // threshold scores
-  std::vector<int> keep_indices;
-  // TODO (chowdhery): Remove the dynamic allocation and replace it
-  // with temporaries, esp for std::vector<float>
-  std::vector<float> keep_scores;
-  SelectDetectionsAboveScoreThreshold(
-      scores, non_max_suppression_score_threshold, &keep_scores, &keep_indices);
+  int* keep_indices = scratch->keep_indices.data();
+  float* keep_scores = scratch->keep_scores.data();
+  int num_boxes_kept = 0;
+  for (int i = 0; i < num_boxes; ++i) {
+    const float score = scores[i * scores_stride];
+    if (score >= non_max_suppression_score_threshold) {
+      keep_scores[num_boxes_kept] = score;
+      keep_indices[num_boxes_kept] = i;
+      ++num_boxes_kept;
+    }
+  }
 
-  int num_scores_kept = keep_scores.size();
-  std::vector<int> sorted_indices;
-  sorted_indices.resize(num_scores_kept);
-  DecreasingPartialArgSort(keep_scores.data(), num_scores_kept, num_scores_kept,
-                           sorted_indices.data());
-  const int num_boxes_kept = num_scores_kept;
-  const int output_size = std::min(num_boxes_kept, max_detections);
-  selected->clear();
-  TfLiteTensor* active_candidate =
-      &context->tensors[op_data->active_candidate_index];
-  TF_LITE_ENSURE(context, (active_candidate->dims->data[0]) == num_boxes);
-  int num_active_candidate = num_boxes_kept;
-  uint8_t* active_box_candidate = (active_candidate->data.uint8);
-  for (int row = 0; row < num_boxes_kept; row++) {
-    active_box_candidate[row] = 1;
+  int* sorted_indices = scratch->sorted_indices.data();
+  DecreasingPartialArgSort(keep_scores, num_boxes_kept, num_boxes_kept,
+                           sorted_indices);
+  BoxCornerEncoding* sorted_boxes = scratch->sorted_boxes.data();
+  float* sorted_areas = scratch->sorted_areas.data();
+  uint8_t* active_box_candidate = scratch->active_box_candidate.data();
+  for (int i = 0; i < num_boxes_kept; ++i) {
+    const int box_index = keep_indices[sorted_indices[i]];
+    sorted_indices[i] = box_index;
+    sorted_boxes[i] = decoded_boxes[box_index];
+    sorted_areas[i] = box_areas[box_index];
+    active_box_candidate[i] = 1;
   }
 
+  int num_selected = 0;
+  int num_active_candidate = num_boxes_kept;
   for (int i = 0; i < num_boxes_kept; ++i) {
-    if (num_active_candidate == 0 || selected->size() >= output_size) break;
+    if (num_active_candidate == 0 || num_selected >= max_detections) break;
     if (active_box_candidate[i] == 1) {
-      selected->push_back(keep_indices[sorted_indices[i]]);
+      selected[num_selected++] = sorted_indices[i];
       active_box_candidate[i] = 0;
       num_active_candidate--;
     } else {
       continue;
     }
+    const BoxCornerEncoding& box_i = sorted_boxes[i];
+    const float area_i = sorted_areas[i];
     for (int j = i + 1; j < num_boxes_kept; ++j) {
       if (active_box_candidate[j] == 1) {
         float intersection_over_union = ComputeIntersectionOverUnion(
-            decoded_boxes, keep_indices[sorted_indices[i]],
-            keep_indices[sorted_indices[j]]);
+            box_i, area_i, sorted_boxes[j], sorted_areas[j]);
 
         if (intersection_over_union > intersection_over_union_threshold) {
           active_box_candidate[j] = 0;
@@ -448,9 +540,51 @@ TfLiteStatus NonMaxSuppressionSingleClassHelper(
       }
     }
   }
-  return kTfLiteOk;
+  return num_selected;
 }
 
+// Runs the single class non-max suppression of the classes in [start, end).
+struct NonMaxSuppressionWorkerTask : cpu_backend_threadpool::Task {
+  NonMaxSuppressionWorkerTask(OpData* op_data,
+                              const BoxCornerEncoding* decoded_boxes,
+                              int num_boxes, const float* scores,
+                              int num_classes_with_background,
+                              int label_offset, int start, int end,
+                              NonMaxSuppressionScratch* scratch)
+      : op_data_(op_data),
+        decoded_boxes_(decoded_boxes),
+        num_boxes_(num_boxes),
+        scores_(scores),
+        num_classes_with_background_(num_classes_with_background),
+        label_offset_(label_offset),
+        start_(start),
+        end_(end),
+        scratch_(scratch) {}
+
+  void Run() override {
+    const int num_detections_per_class = op_data_->detections_per_class;
+    for (int col = start_; col < end_; ++col) {
+      op_data_->num_selected_per_class[col] =
+          NonMaxSuppressionSingleClassHelper(
+              op_data_, decoded_boxes_, op_data_->box_areas.data(), num_boxes_,
+              scores_ + col + label_offset_, num_classes_with_background_,
+              num_detections_per_class, scratch_,
+              op_data_->selected.data() + col * num_detections_per_class);
+    }
+  }
+
+ private:
+  OpData* op_data_;
+  const BoxCornerEncoding* decoded_boxes_;
+  int num_boxes_;
+  const float* scores_;
+  int num_classes_with_background_;
+  int label_offset_;
+  int start_;
+  int end_;
+  NonMaxSuppressionScratch* scratch_;
+};
+
 // This function implements a regular version of Non Maximal Suppression (NMS)
 // for multiple classes where
 // 1) we do NMS separately for each class across all anchors and
@@ -458,6 +592,7 @@ TfLiteStatus NonMaxSuppressionSingleClassHelper(
 // 3) The worst runtime of the regular NMS is O(K*N^2)
 // where N is the number of anchors and K the number of
 // classes.
+// The classes are independent until 2), so 1) is split across threads.
 TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
                                                       TfLiteNode* node,
                                                       OpData* op_data,
@@ -487,78 +622,82 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
   // The row index offset is 1 if background class is included and 0 otherwise.
   int label_offset = num_classes_with_background - num_classes;
   TF_LITE_ENSURE(context, num_detections_per_class > 0);
-
-  // For each class, perform non-max suppression.
-  std::vector<float> class_scores(num_boxes);
-
-  std::vector<int> box_indices_after_regular_non_max_suppression(
-      num_boxes + max_detections);
-  std::vector<float> scores_after_regular_non_max_suppression(num_boxes +
-                                                              max_detections);
-
-  int size_of_sorted_indices = 0;
-  std::vector<int> sorted_indices;
-  sorted_indices.resize(max_detections);
-  std::vector<float> sorted_values;
-  sorted_values.resize(max_detections);
-
-  for (int col = 0; col < num_classes; col++) {
-    for (int row = 0; row < num_boxes; row++) {
-      // Get scores of boxes corresponding to all anchors for single class
-      class_scores[row] =
-          *(scores + row * num_classes_with_background + col + label_offset);
-    }
-    // Perform non-maximal suppression on single class
-    std::vector<int> selected;
-    TF_LITE_ENSURE_STATUS(NonMaxSuppressionSingleClassHelper(
-        context, node, op_data, class_scores, &selected,
-        num_detections_per_class));
-    // Add selected indices from non-max suppression of boxes in this class
-    int output_index = size_of_sorted_indices;
-    for (const auto& selected_index : selected) {
-      box_indices_after_regular_non_max_suppression[output_index] =
-          (selected_index * num_classes_with_background + col + label_offset);
-      scores_after_regular_non_max_suppression[output_index] =
-          class_scores[selected_index];
-      output_index++;
+  TF_LITE_ENSURE(context, max_detections >= 0);
+  const BoxCornerEncoding* decoded_boxes_data =
+      ReInterpretTensor<const BoxCornerEncoding*>(decoded_boxes);
+
+  // For each class, perform non-max suppression. A thread handles at least
+  // kMinScoresPerThread scores, below which the synchronization costs more
+  // than it saves.
+  constexpr int kMinScoresPerThread = 1 << 14;
+  CpuBackendContext* cpu_backend_context =
+      cpu_backend_support::GetFromContext(context);
+  const int thread_count = std::min(
+      {cpu_backend_context->max_num_threads(), num_classes,
+       num_boxes * num_classes / kMinScoresPerThread});
+  if (thread_count <= 1) {
+    NonMaxSuppressionWorkerTask task(
+        op_data, decoded_boxes_data, num_boxes, scores,
+        num_classes_with_background, label_offset, 0, num_classes,
+        &op_data->nms_scratch[0]);
+    task.Run();
+  } else {
+    if (op_data->nms_scratch.size() < static_cast<size_t>(thread_count)) {
+      op_data->nms_scratch.resize(thread_count);
+      for (auto& scratch : op_data->nms_scratch) {
+        ResizeScratch(&scratch, num_boxes);
+      }
     }
-    // Sort the max scores among the selected indices
-    // Get the indices for top scores
-    int num_indices_to_sort = std::min(output_index, max_detections);
-    DecreasingPartialArgSort(scores_after_regular_non_max_suppression.data(),
-                             output_index, num_indices_to_sort,
-                             sorted_indices.data());
-
-    // Copy values to temporary vectors
-    for (int row = 0; row < num_indices_to_sort; row++) {
-      int temp = sorted_indices[row];
-      sorted_indices[row] = box_indices_after_regular_non_max_suppression[temp];
-      sorted_values[row] = scores_after_regular_non_max_suppression[temp];
+    std::vector<NonMaxSuppressionWorkerTask> tasks;
+    tasks.reserve(thread_count);
+    int start = 0;
+    for (int i = 0; i < thread_count; ++i) {
+      const int end = start + (num_classes - start) / (thread_count - i);
+      tasks.emplace_back(op_data, decoded_boxes_data, num_boxes, scores,
+                         num_classes_with_background, label_offset, start,
+                         end, &op_data->nms_scratch[i]);
+      start = end;
     }
-    // Copy scores and indices from temporary vectors
-    for (int row = 0; row < num_indices_to_sort; row++) {
-      box_indices_after_regular_non_max_suppression[row] = sorted_indices[row];
-      scores_after_regular_non_max_suppression[row] = sorted_values[row];
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(),
+                                    cpu_backend_context);
+  }
+
+  // Gather the boxes selected in each class, as indices into the scores.
+  int* candidate_box_indices = op_data->candidate_box_indices.data();
+  float* candidate_scores = op_data->candidate_scores.data();
+  int num_candidates = 0;
+  for (int col = 0; col < num_classes; col++) {
+    const int* selected =
+        op_data->selected.data() + col * num_detections_per_class;
+    for (int i = 0; i < op_data->num_selected_per_class[col]; ++i) {
+      const int score_index =
+          selected[i] * num_classes_with_background + col + label_offset;
+      candidate_box_indices[num_candidates] = score_index;
+      candidate_scores[num_candidates] = scores[score_index];
+      num_candidates++;
     }
-    size_of_sorted_indices = num_indices_to_sort;
   }
+  // Sort the max scores among the selected indices
+  // Get the indices for top scores
+  const int size_of_sorted_indices = std::min(num_candidates, max_detections);
+  int* sorted_candidates = op_data->sorted_candidates.data();
+  DecreasingPartialArgSort(candidate_scores, num_candidates,
+                           size_of_sorted_indices, sorted_candidates);
 
   // Allocate output tensors
   for (int output_box_index = 0; output_box_index < max_detections;
        output_box_index++) {
     if (output_box_index < size_of_sorted_indices) {
-      const int anchor_index = floor(
-          box_indices_after_regular_non_max_suppression[output_box_index] /
-          num_classes_with_background);
-      const int class_index =
-          box_indices_after_regular_non_max_suppression[output_box_index] -
-          anchor_index * num_classes_with_background - label_offset;
-      const float selected_score =
-          scores_after_regular_non_max_suppression[output_box_index];
+      const int candidate = sorted_candidates[output_box_index];
+      const int anchor_index =
+          candidate_box_indices[candidate] / num_classes_with_background;
+      const int class_index = candidate_box_indices[candidate] -
+                              anchor_index * num_classes_with_background -
+                              label_offset;
+      const float selected_score = candidate_scores[candidate];
       // detection_boxes
       ReInterpretTensor<BoxCornerEncoding*>(detection_boxes)[output_box_index] =
-          ReInterpretTensor<const BoxCornerEncoding*>(
-              decoded_boxes)[anchor_index];
+          decoded_boxes_data[anchor_index];
       // detection_classes
       detection_classes->data.f[output_box_index] = class_index;
       // detection_scores
@@ -573,8 +712,6 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
     }
   }
   num_detections->data.f[0] = size_of_sorted_indices;
-  box_indices_after_regular_non_max_suppression.clear();
-  scores_after_regular_non_max_suppression.clear();
   return kTfLiteOk;
 }
 
@@ -613,38 +750,42 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
   // The row index offset is 1 if background class is included and 0 otherwise.
   int label_offset = num_classes_with_background - num_classes;
   TF_LITE_ENSURE(context, (max_categories_per_anchor > 0));
+  // Maximum detections should be positive.
+  TF_LITE_ENSURE(context, (op_data->max_detections >= 0));
   const int num_categories_per_anchor =
       std::min(max_categories_per_anchor, num_classes);
-  std::vector<float> max_scores;
-  max_scores.resize(num_boxes);
-  std::vector<int> sorted_class_indices;
-  sorted_class_indices.resize(num_boxes * num_classes);
+  float* max_scores = op_data->max_scores.data();
+  int* sorted_class_indices = op_data->sorted_class_indices.data();
   for (int row = 0; row < num_boxes; row++) {
     const float* box_scores =
         scores + row * num_classes_with_background + label_offset;
-    int* class_indices = sorted_class_indices.data() + row * num_classes;
+    int* class_indices = sorted_class_indices + row * num_classes;
     DecreasingPartialArgSort(box_scores, num_classes, num_categories_per_anchor,
                              class_indices);
     max_scores[row] = box_scores[class_indices[0]];
   }
   // Perform non-maximal suppression on max scores
-  std::vector<int> selected;
-  TF_LITE_ENSURE_STATUS(NonMaxSuppressionSingleClassHelper(
-      context, node, op_data, max_scores, &selected, op_data->max_detections));
+  const BoxCornerEncoding* decoded_boxes_data =
+      ReInterpretTensor<const BoxCornerEncoding*>(decoded_boxes);
+  const int* selected = op_data->selected.data();
+  const int num_selected = NonMaxSuppressionSingleClassHelper(
+      op_data, decoded_boxes_data, op_data->box_areas.data(), num_boxes,
+      max_scores, /*scores_stride=*/1, op_data->max_detections,
+      &op_data->nms_scratch[0], op_data->selected.data());
   // Allocate output tensors
   int output_box_index = 0;
-  for (const auto& selected_index : selected) {
+  for (int i = 0; i < num_selected; ++i) {
+    const int selected_index = selected[i];
     const float* box_scores =
         scores + selected_index * num_classes_with_background + label_offset;
     const int* class_indices =
-        sorted_class_indices.data() + selected_index * num_classes;
+        sorted_class_indices + selected_index * num_classes;
 
     for (int col = 0; col < num_categories_per_anchor; ++col) {
       int box_offset = num_categories_per_anchor * output_box_index + col;
       // detection_boxes
       ReInterpretTensor<BoxCornerEncoding*>(detection_boxes)[box_offset] =
-          ReInterpretTensor<const BoxCornerEncoding*>(
-              decoded_boxes)[selected_index];
+          decoded_boxes_data[selected_index];
       // detection_classes
       detection_classes->data.f[box_offset] = class_indices[col];
       // detection_scores
@@ -688,6 +829,20 @@ TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
   TF_LITE_ENSURE(context, (num_classes_with_background - num_classes <= 1));
   TF_LITE_ENSURE(context, (num_classes_with_background >= num_classes));
 
+  // intersection_over_union_threshold should be positive
+  // and should be less than 1.
+  const float intersection_over_union_threshold =
+      op_data->intersection_over_union_threshold;
+  TF_LITE_ENSURE(context, (intersection_over_union_threshold > 0.0f) &&
+                              (intersection_over_union_threshold <= 1.0f));
+  // Validate boxes
+  const TfLiteTensor* decoded_boxes =
+      &context->tensors[op_data->decoded_boxes_index];
+  TF_LITE_ENSURE(context, ComputeBoxAreas(
+                              ReInterpretTensor<const BoxCornerEncoding*>(
+                                  decoded_boxes),
+                              num_boxes, op_data->box_areas.data()));
+
   const TfLiteTensor* scores;
   switch (input_class_predictions->type) {
     case kTfLiteUInt8: {
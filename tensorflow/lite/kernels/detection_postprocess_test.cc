@@ -12,6 +12,7 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -791,7 +792,150 @@ TEST(DetectionPostprocessOpTest, FloatTestwithNoBackgroudClassAndKeypoints) {
   EXPECT_THAT(m.GetOutput4<float>(),
               ElementsAreArray(ArrayFloatNear({3.0}, 1e-1)));
 }
+
+// Regular non-max suppression on float inputs of arbitrary sizes, with the
+// options of the COCO SSD models.
+class LargeDetectionPostprocessOpModel : public SingleOpModel {
+ public:
+  LargeDetectionPostprocessOpModel(int num_boxes, int num_classes,
+                                   int num_threads) {
+    box_encodings_ = AddInput({TensorType_FLOAT32, {1, num_boxes, 4}});
+    class_predictions_ =
+        AddInput({TensorType_FLOAT32, {1, num_boxes, num_classes + 1}});
+    anchors_ = AddInput({TensorType_FLOAT32, {num_boxes, 4}});
+    detection_boxes_ = AddOutput(TensorType_FLOAT32);
+    detection_classes_ = AddOutput(TensorType_FLOAT32);
+    detection_scores_ = AddOutput(TensorType_FLOAT32);
+    num_detections_ = AddOutput(TensorType_FLOAT32);
+
+    flexbuffers::Builder fbb;
+    fbb.Map([&]() {
+      fbb.Int("max_detections", 100);
+      fbb.Int("max_classes_per_detection", 1);
+      fbb.Int("detections_per_class", 100);
+      fbb.Bool("use_regular_nms", true);
+      fbb.Float("nms_score_threshold", 1e-8);
+      fbb.Float("nms_iou_threshold", 0.6);
+      fbb.Int("num_classes", num_classes);
+      fbb.Float("y_scale", 10.0);
+      fbb.Float("x_scale", 10.0);
+      fbb.Float("h_scale", 5.0);
+      fbb.Float("w_scale", 5.0);
+    });
+    fbb.Finish();
+    SetCustomOp("TFLite_Detection_PostProcess", fbb.GetBuffer(),
+                Register_DETECTION_POSTPROCESS);
+    BuildInterpreter({GetShape(box_encodings_), GetShape(class_predictions_),
+                      GetShape(anchors_)});
+    SetNumThreads(num_threads);
+  }
+
+  // Fills the inputs with overlapping anchors on a grid and pseudo-random
+  // encodings and scores.
+  void SetInputs(int num_boxes, int num_classes) {
+    std::vector<float> box_encodings(num_boxes * 4);
+    std::vector<float> class_predictions(num_boxes * (num_classes + 1));
+    std::vector<float> anchors(num_boxes * 4);
+    uint32_t seed = 1;
+    auto random = [&seed]() {
+      seed = seed * 1664525 + 1013904223;
+      return (seed >> 8) / static_cast<float>(1 << 24);
+    };
+    for (int i = 0; i < num_boxes; ++i) {
+      anchors[i * 4 + 0] = (i % 32) / 32.0f;
+      anchors[i * 4 + 1] = (i / 32 % 32) / 32.0f;
+      anchors[i * 4 + 2] = 0.1f;
+      anchors[i * 4 + 3] = 0.1f;
+      for (int j = 0; j < 4; ++j) {
+        box_encodings[i * 4 + j] = random() - 0.5f;
+      }
+    }
+    for (float& score : class_predictions) {
+      score = random();
+    }
+    PopulateTensor(box_encodings_, box_encodings);
+    PopulateTensor(class_predictions_, class_predictions);
+    PopulateTensor(anchors_, anchors);
+  }
+
+  std::vector<float> GetDetectionBoxes() {
+    return ExtractVector<float>(detection_boxes_);
+  }
+  std::vector<float> GetDetectionClasses() {
+    return ExtractVector<float>(detection_classes_);
+  }
+  std::vector<float> GetDetectionScores() {
+    return ExtractVector<float>(detection_scores_);
+  }
+  std::vector<float> GetNumDetections() {
+    return ExtractVector<float>(num_detections_);
+  }
+
+ protected:
+  int box_encodings_;
+  int class_predictions_;
+  int anchors_;
+  int detection_boxes_;
+  int detection_classes_;
+  int detection_scores_;
+  int num_detections_;
+};
+
+TEST(DetectionPostprocessOpTest, FloatTestRegularNMSMultithreaded) {
+  // Enough scores for the classes to be split across threads.
+  constexpr int kNumBoxes = 512;
+  constexpr int kNumClasses = 90;
+  LargeDetectionPostprocessOpModel single_threaded(kNumBoxes, kNumClasses,
+                                                   /*num_threads=*/1);
+  single_threaded.SetInputs(kNumBoxes, kNumClasses);
+  single_threaded.Invoke();
+  LargeDetectionPostprocessOpModel multi_threaded(kNumBoxes, kNumClasses,
+                                                  /*num_threads=*/4);
+  multi_threaded.SetInputs(kNumBoxes, kNumClasses);
+  multi_threaded.Invoke();
+
+  EXPECT_THAT(single_threaded.GetNumDetections(), ElementsAre(100));
+  const std::vector<float> scores = single_threaded.GetDetectionScores();
+  EXPECT_TRUE(std::is_sorted(scores.rbegin(), scores.rend()));
+  EXPECT_THAT(multi_threaded.GetNumDetections(),
+              ElementsAreArray(single_threaded.GetNumDetections()));
+  EXPECT_THAT(multi_threaded.GetDetectionBoxes(),
+              ElementsAreArray(single_threaded.GetDetectionBoxes()));
+  EXPECT_THAT(multi_threaded.GetDetectionClasses(),
+              ElementsAreArray(single_threaded.GetDetectionClasses()));
+  EXPECT_THAT(multi_threaded.GetDetectionScores(), ElementsAreArray(scores));
+}
 }  // namespace
 }  // namespace custom
 }  // namespace ops
 }  // namespace tflite
+
+#ifdef DETECTION_POSTPROCESS_BENCHMARKS
+
+#include "testing/base/public/benchmark.h"
+
+// Compile with --copt="-DGOOGLE_COMMANDLINEFLAGS_FULL_API=1" and
+// --copt="-DDETECTION_POSTPROCESS_BENCHMARKS"
+// Run with --benchmarks=all
+//
+// Regular non-max suppression over the 90 COCO classes, with state.range(0)
+// anchors (1917 for SSD MobileNet at 300x300, 5118 for SSD at 512x512) on
+// state.range(1) threads.
+void BM_DetectionPostprocessRegularNMS(benchmark::State& state) {
+  const int num_boxes = state.range(0);
+  constexpr int kNumClasses = 90;
+  tflite::ops::custom::LargeDetectionPostprocessOpModel m(
+      num_boxes, kNumClasses, state.range(1));
+  m.SetInputs(num_boxes, kNumClasses);
+  for (auto _ : state) {
+    m.Invoke();
+  }
+}
+
+BENCHMARK(BM_DetectionPostprocessRegularNMS)
+    ->ArgPair(1917, 1)
+    ->ArgPair(1917, 4)
+    ->ArgPair(5118, 1)
+    ->ArgPair(5118, 4);
+
+#endif  // DETECTION_POSTPROCESS_BENCHMARKS
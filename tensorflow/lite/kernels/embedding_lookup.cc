@@ -28,6 +28,12 @@ limitations under the License.
 //   or a dequantized value in the case of a uint8 input.
 //   When indices are out of bound, the ops will not succeed.
 //
+// A hybrid (int8 or uint8) Tensor[1] can be quantized either per tensor or
+// per row, with one symmetric scale for each of its rows (quantized dimension
+// 0). Only the looked up rows are read and dequantized, so the pages of a
+// large table that is memory mapped with the model are not touched unless
+// some of their rows are looked up.
+//
 
 #include <cassert>
 #include <cmath>
@@ -59,6 +65,18 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE(context, NumDimensions(value) >= 2);
 
   TfLiteTensor* output = GetOutput(context, node, 0);
+  if (value->quantization.type == kTfLiteAffineQuantization &&
+      output->type == kTfLiteFloat32) {
+    const auto* affine_quantization =
+        reinterpret_cast<const TfLiteAffineQuantization*>(
+            value->quantization.params);
+    TF_LITE_ENSURE(context, affine_quantization->scale != nullptr);
+    if (affine_quantization->scale->size > 1) {
+      TF_LITE_ENSURE_EQ(context, affine_quantization->quantized_dimension, 0);
+      TF_LITE_ENSURE_EQ(context, affine_quantization->scale->size,
+                        SizeOfDimension(value, 0));
+    }
+  }
   TfLiteIntArray* outputSize = TfLiteIntArrayCreate(NumDimensions(value));
 
   outputSize->data[0] = SizeOfDimension(lookup, 0);
@@ -73,7 +91,8 @@ TfLiteStatus EvalSimple(TfLiteContext* context, TfLiteNode* node,
                         const TfLiteTensor* lookup, const TfLiteTensor* value,
                         TfLiteTensor* output) {
   const int row_size = SizeOfDimension(value, 0);
-  const int row_bytes = value->bytes / row_size;
+  // Tables may be larger than 2GB.
+  const size_t row_bytes = value->bytes / row_size;
 
   for (int i = 0; i < SizeOfDimension(lookup, 0); i++) {
     int idx = lookup->data.i32[i];
@@ -96,7 +115,16 @@ TfLiteStatus EvalHybrid(TfLiteContext* context, TfLiteNode* node,
                         const TfLiteTensor* lookup, const TfLiteTensor* value,
                         TfLiteTensor* output) {
   const int row_size = SizeOfDimension(value, 0);
-  const double scaling_factor = value->params.scale;
+  // Per row scales, if any.
+  const float* row_scales = nullptr;
+  if (value->quantization.type == kTfLiteAffineQuantization) {
+    const auto* affine_quantization =
+        reinterpret_cast<const TfLiteAffineQuantization*>(
+            value->quantization.params);
+    if (affine_quantization->scale->size > 1) {
+      row_scales = affine_quantization->scale->data;
+    }
+  }
 
   // col_size after we flatten tensor into 2D.
   int col_size = 1;
@@ -104,6 +132,13 @@ TfLiteStatus EvalHybrid(TfLiteContext* context, TfLiteNode* node,
     col_size *= SizeOfDimension(value, i);
   }
 
+  const int8_t* value_ptr;
+  if (value->type == kTfLiteUInt8) {
+    value_ptr = reinterpret_cast<int8_t*>(value->data.uint8);
+  } else {
+    value_ptr = value->data.int8;
+  }
+
   for (int i = 0; i < SizeOfDimension(lookup, 0); i++) {
     int idx = lookup->data.i32[i];
     if (idx >= row_size || idx < 0) {
@@ -116,15 +151,13 @@ TfLiteStatus EvalHybrid(TfLiteContext* context, TfLiteNode* node,
       // Dequantize embedding values.
       // TODO(alanchiao): refactor scalar multiply into separate function
       // for ease of adding a neon equivalent if ever necessary.
+      const double scaling_factor =
+          row_scales != nullptr ? row_scales[idx] : value->params.scale;
+      const int8_t* row_ptr =
+          value_ptr + static_cast<size_t>(idx) * col_size;
+      float* output_ptr = output->data.f + i * col_size;
       for (int j = 0; j < col_size; j++) {
-        const int8_t* value_ptr;
-        if (value->type == kTfLiteUInt8) {
-          value_ptr = reinterpret_cast<int8_t*>(value->data.uint8);
-        } else {
-          value_ptr = value->data.int8;
-        }
-        output->data.f[j + i * col_size] =
-            value_ptr[j + idx * col_size] * scaling_factor;
+        output_ptr[j] = row_ptr[j] * scaling_factor;
       }
     }
   }
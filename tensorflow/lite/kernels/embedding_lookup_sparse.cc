@@ -67,6 +67,7 @@ limitations under the License.
 
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/kernels/internal/common.h"
 #include "tensorflow/lite/kernels/internal/tensor_utils.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/op_macros.h"
@@ -77,6 +78,9 @@ namespace builtin {
 
 namespace {
 
+// How many lookups ahead the rows of the embedding table are prefetched.
+constexpr int kPrefetchDistance = 8;
+
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_EQ(context, NumInputs(node), 5);
   TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
@@ -185,6 +189,16 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   int num_elements = 0;
 
   for (int i = 0; i < num_lookups; i++) {
+    // Ids are random accesses into a potentially large table, so start
+    // loading upcoming rows while the current one is aggregated.
+    if (i + kPrefetchDistance < num_lookups) {
+      const int next_idx = ids->data.i32[i + kPrefetchDistance];
+      if (next_idx >= 0 && next_idx < num_rows) {
+        optimized_ops_preload_l1_keep(value->data.f +
+                                      next_idx * embedding_size);
+      }
+    }
+
     int idx = ids->data.i32[i];
     if (idx >= num_rows || idx < 0) {
       context->ReportError(context,
@@ -98,6 +98,38 @@ class HybridEmbeddingLookupOpModel : public BaseEmbeddingLookupOpModel {
   }
 };
 
+// Quantizes the weights with one scale per row.
+class PerRowHybridEmbeddingLookupOpModel : public SingleOpModel {
+ public:
+  PerRowHybridEmbeddingLookupOpModel(std::initializer_list<int> index_shape,
+                                     std::initializer_list<int> weight_shape,
+                                     const std::vector<float>& row_scales) {
+    input_ = AddInput(TensorType_INT32);
+    weight_ = AddInput({TensorType_INT8, weight_shape, 0, 0, 0, 0,
+                        /*per_channel_quantization=*/true, row_scales,
+                        std::vector<int64_t>(row_scales.size(), 0),
+                        /*channel_index=*/0});
+    output_ = AddOutput(TensorType_FLOAT32);
+    SetBuiltinOp(BuiltinOperator_EMBEDDING_LOOKUP, BuiltinOptions_NONE, 0);
+    BuildInterpreter({index_shape, weight_shape});
+  }
+
+  void SetInput(std::initializer_list<int> data) {
+    PopulateTensor(input_, data);
+  }
+
+  void SetWeight(const std::vector<float>& data) {
+    PerChannelSymmetricQuantizeAndPopulate(weight_, data);
+  }
+
+  std::vector<float> GetOutput() { return ExtractVector<float>(output_); }
+
+ private:
+  int input_;
+  int weight_;
+  int output_;
+};
+
 // TODO(ahentz): write more tests that exercise the details of the op, such as
 // lookup errors and variable input shapes.
 TEST(EmbeddingLookupOpTest, SimpleTest) {
@@ -258,5 +290,34 @@ TEST(EmbeddingLookupHybridOpTest, Simple3DTestQuantized) {
               }));
 }
 
+TEST(HybridEmbeddingLookupHybridOpTest, Simple4DTestPerRowInt8) {
+  // The rows have very different ranges, which a single scale could not
+  // represent accurately.
+  PerRowHybridEmbeddingLookupOpModel m({4}, {3, 1, 2, 2},
+                                       {0.04 / 127, 4.0 / 127, 400.0 / 127});
+  m.SetInput({1, 0, 2, 0});
+  m.SetWeight({
+      0.01, -0.02, 0.03, 0.04,  // Row 0
+      1.0,  -2.0,  3.0,  4.0,   // Row 1
+      100,  -200,  300,  400,   // Row 2
+  });
+
+  m.Invoke();
+
+  const std::vector<float> output = m.GetOutput();
+  EXPECT_THAT(std::vector<float>(output.begin(), output.begin() + 4),
+              ElementsAreArray(ArrayFloatNear({1.0, -2.0, 3.0, 4.0},
+                                              4.0 / 127)));
+  EXPECT_THAT(std::vector<float>(output.begin() + 4, output.begin() + 8),
+              ElementsAreArray(ArrayFloatNear({0.01, -0.02, 0.03, 0.04},
+                                              0.04 / 127)));
+  EXPECT_THAT(std::vector<float>(output.begin() + 8, output.begin() + 12),
+              ElementsAreArray(ArrayFloatNear({100, -200, 300, 400},
+                                              400.0 / 127)));
+  EXPECT_THAT(std::vector<float>(output.begin() + 12, output.end()),
+              ElementsAreArray(ArrayFloatNear({0.01, -0.02, 0.03, 0.04},
+                                              0.04 / 127)));
+}
+
 }  // namespace
 }  // namespace tflite
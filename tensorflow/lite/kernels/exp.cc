@@ -16,6 +16,7 @@ limitations under the License.
 #include <vector>
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
 #include "tensorflow/lite/kernels/internal/reference/reference_ops.h"
 #include "tensorflow/lite/kernels/internal/tensor.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
@@ -26,9 +27,10 @@ namespace ops {
 namespace builtin {
 namespace exp {
 
-// This file has reference implementation of Exp.
+// This file has reference and optimized implementations of Exp.
 enum KernelType {
   kReference,
+  kGenericOptimized,
 };
 
 struct ExpContext {
@@ -60,17 +62,21 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
                               GetTensorData<data_type>(op_context.output))
 
   // TODO(kanlig): supports half, bfloat16, float64, complex64, and complex128.
-  if (kernel_type == kReference) {
-    switch (op_context.input->type) {
-      case kTfLiteFloat32:
+  switch (op_context.input->type) {
+    case kTfLiteFloat32:
+      if (kernel_type == kReference) {
         TF_LITE_EXP(reference_ops, float);
-        break;
-      default:
-        context->ReportError(context,
-                             "Type %d is currently not supported by Exp.",
-                             op_context.input->type);
-        return kTfLiteError;
-    }
+      } else {
+        optimized_ops::Exp(GetTensorData<float>(op_context.input),
+                           NumElements(op_context.input),
+                           GetTensorData<float>(op_context.output));
+      }
+      break;
+    default:
+      context->ReportError(context,
+                           "Type %d is currently not supported by Exp.",
+                           op_context.input->type);
+      return kTfLiteError;
   }
 #undef TF_LITE_EXP
   return kTfLiteOk;
@@ -84,8 +90,13 @@ TfLiteRegistration* Register_EXP_REF() {
   return &r;
 }
 
-// TODO(kanlig): add optimized implementation of Exp.
-TfLiteRegistration* Register_EXP() { return Register_EXP_REF(); }
+TfLiteRegistration* Register_EXP_GENERIC_OPT() {
+  static TfLiteRegistration r = {nullptr, nullptr, exp::Prepare,
+                                 exp::Eval<exp::kGenericOptimized>};
+  return &r;
+}
+
+TfLiteRegistration* Register_EXP() { return Register_EXP_GENERIC_OPT(); }
 
 }  // namespace builtin
 }  // namespace ops
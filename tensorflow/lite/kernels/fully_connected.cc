@@ -71,7 +71,11 @@ inline TfLiteStatus CheckTypes(TfLiteContext* context,
                                const TfLiteTensor* filter,
                                const TfLiteTensor* bias, TfLiteTensor* output,
                                TfLiteFullyConnectedParams* params) {
+  // Palettized weights are uint8 indices into float values.
+  const bool is_palettized =
+      filter->quantization.type == kTfLitePaletteQuantization;
   const bool is_quantized =
+      !is_palettized &&
       ((filter->type == kTfLiteUInt8) || (filter->type == kTfLiteInt8));
   const bool is_hybrid = is_quantized && (input->type == kTfLiteFloat32);
   const bool is_shuffled =
@@ -104,7 +108,8 @@ inline TfLiteStatus CheckTypes(TfLiteContext* context,
     // Only float32 is supported currently
     TF_LITE_ENSURE_EQ(context, input->type, kTfLiteFloat32);
     TF_LITE_ENSURE_EQ(context, output->type, kTfLiteFloat32);
-    TF_LITE_ENSURE_EQ(context, filter->type, kTfLiteFloat32);
+    TF_LITE_ENSURE_EQ(context, filter->type,
+                      is_palettized ? kTfLiteUInt8 : kTfLiteFloat32);
     TF_LITE_ENSURE_EQ(context, is_optional_bias_float, true);
   }
 
@@ -181,8 +186,24 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   // If we have to perform on-the-fly quantization (with quantized weights and
   // float inputs) first we need to quantize the inputs. Allocate a temporary
   // buffer to store the intermediate quantized values.
-  if (input->type == kTfLiteFloat32 &&
-      (filter->type == kTfLiteUInt8 || filter->type == kTfLiteInt8)) {
+  if (filter->quantization.type == kTfLitePaletteQuantization) {
+    // The weights are looked up one row at a time into a temporary buffer.
+    TfLiteIntArrayFree(node->temporaries);
+    node->temporaries = TfLiteIntArrayCreate(1);
+    node->temporaries->data[0] = data->scratch_tensor_index;
+
+    TfLiteTensor* filter_row = GetTemporary(context, node, /*index=*/0);
+    filter_row->type = kTfLiteFloat32;
+    filter_row->allocation_type = kTfLiteArenaRw;
+    int filter_row_dims[1] = {SizeOfDimension(filter, 1)};
+    if (!TfLiteIntArrayEqualsArray(filter_row->dims, 1, filter_row_dims)) {
+      TfLiteIntArray* filter_row_size = TfLiteIntArrayCreate(1);
+      filter_row_size->data[0] = filter_row_dims[0];
+      TF_LITE_ENSURE_OK(context, context->ResizeTensor(context, filter_row,
+                                                       filter_row_size));
+    }
+  } else if (input->type == kTfLiteFloat32 &&
+             (filter->type == kTfLiteUInt8 || filter->type == kTfLiteInt8)) {
     TfLiteIntArrayFree(node->temporaries);
     node->temporaries = TfLiteIntArrayCreate(2);
     node->temporaries->data[0] = data->scratch_tensor_index;
@@ -518,6 +539,48 @@ TfLiteStatus EvalFloat(TfLiteContext* context, TfLiteNode* node,
   return kTfLiteOk;
 }
 
+// Looks up each row of palettized weights once, and multiplies it with all the
+// batches, so the weights stay compressed in memory.
+TfLiteStatus EvalPalettized(TfLiteContext* context, TfLiteNode* node,
+                            TfLiteFullyConnectedParams* params,
+                            const TfLiteTensor* input,
+                            const TfLiteTensor* filter,
+                            const TfLiteTensor* bias, TfLiteTensor* output) {
+  float output_activation_min, output_activation_max;
+  CalculateActivationRange(params->activation, &output_activation_min,
+                           &output_activation_max);
+  const float* palette =
+      reinterpret_cast<const TfLitePaletteQuantization*>(
+          filter->quantization.params)
+          ->values->data;
+  TfLiteTensor* filter_row = GetTemporary(context, node, /*index=*/0);
+  float* filter_row_data = GetTensorData<float>(filter_row);
+
+  const int num_units = SizeOfDimension(filter, 0);
+  const int input_size = SizeOfDimension(filter, 1);
+  const int batch_size = NumElements(input) / input_size;
+  const uint8_t* filter_data = GetTensorData<uint8_t>(filter);
+  const float* input_data = GetTensorData<float>(input);
+  const float* bias_data = bias ? GetTensorData<float>(bias) : nullptr;
+  float* output_data = GetTensorData<float>(output);
+  for (int unit = 0; unit < num_units; ++unit) {
+    const uint8_t* filter_indices = filter_data + unit * input_size;
+    for (int i = 0; i < input_size; ++i) {
+      filter_row_data[i] = palette[filter_indices[i]];
+    }
+    for (int batch = 0; batch < batch_size; ++batch) {
+      float total = tensor_utils::VectorVectorDotProduct(
+          filter_row_data, input_data + batch * input_size, input_size);
+      if (bias_data) {
+        total += bias_data[unit];
+      }
+      output_data[batch * num_units + unit] = ActivationFunctionWithMinMax(
+          total, output_activation_min, output_activation_max);
+    }
+  }
+  return kTfLiteOk;
+}
+
 template <KernelType kernel_type>
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   auto* params =
@@ -529,6 +592,9 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteTensor* bias = GetOptionalInputTensor(context, node, kBiasTensor);
   TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
 
+  if (filter->quantization.type == kTfLitePaletteQuantization) {
+    return EvalPalettized(context, node, params, input, filter, bias, output);
+  }
   switch (filter->type) {
     case kTfLiteFloat32:
       return EvalFloat<kernel_type>(context, node, params, data, input, filter,
@@ -50,6 +50,15 @@ class GatherOpModel : public SingleOpModel {
     PopulateTensor<T>(positions_, data);
   }
 
+  template <typename T>
+  void SetPositions(std::vector<T> data) {
+    PopulateTensor<T>(positions_, 0, data.data(), data.data() + data.size());
+  }
+
+  void SetFloatInput(std::vector<float> data) {
+    PopulateTensor<float>(input_, 0, data.data(), data.data() + data.size());
+  }
+
   template <typename T>
   std::vector<T> GetOutput() {
     return ExtractVector<T>(output_);
@@ -294,5 +303,113 @@ TEST(GatherOpTest, SimpleString) {
   ASSERT_THAT(m.GetOutputShape(), ElementsAreArray({2}));
   EXPECT_THAT(m.GetStringOutput(), ElementsAreArray({"A", "C"}));
 }
+
+TEST(GatherOpTest, LargeGatherMultithreaded) {
+  // Enough rows to prefetch ahead and to split the copies across threads,
+  // with repeated positions as in real lookups.
+  constexpr int kRows = 1000;
+  constexpr int kCols = 64;
+  constexpr int kPositions = 2048;
+  GatherOpModel m({TensorType_FLOAT32, {kRows, kCols}},
+                  {TensorType_INT32, {kPositions}});
+  m.SetNumThreads(4);
+  std::vector<float> input(kRows * kCols);
+  for (int i = 0; i < input.size(); ++i) {
+    input[i] = i;
+  }
+  m.SetFloatInput(input);
+  std::vector<int32_t> positions(kPositions);
+  uint32_t seed = 1;
+  for (int i = 0; i < kPositions; ++i) {
+    seed = seed * 1664525 + 1013904223;
+    positions[i] = (seed >> 8) % (i % 3 == 0 ? 10 : kRows);
+  }
+  m.SetPositions<int32_t>(positions);
+  m.Invoke();
+
+  std::vector<float> expected;
+  for (int position : positions) {
+    expected.insert(expected.end(), input.begin() + position * kCols,
+                    input.begin() + (position + 1) * kCols);
+  }
+  EXPECT_THAT(m.GetOutput<float>(), ElementsAreArray(expected));
+}
 }  // namespace
 }  // namespace tflite
+
+#ifdef GATHER_BENCHMARKS
+
+#include <random>
+
+#include "tensorflow/lite/kernels/cpu_backend_context.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
+#include "testing/base/public/benchmark.h"
+
+// Compile with --copt="-DGOOGLE_COMMANDLINEFLAGS_FULL_API=1" and
+// --copt="-DGATHER_BENCHMARKS"
+// Run with --benchmarks=all
+//
+// Gathers state.range(0) rows of 32 floats from a 128MB table, with positions
+// either uniform or following a Zipf distribution (exponent 1.05), which is
+// close to the popularity of ids in recommendation models.
+void BM_Gather(benchmark::State& state, bool zipf) {
+  constexpr int kRows = 1 << 20;
+  constexpr int kCols = 32;
+  const int num_positions = state.range(0);
+  const int num_threads = state.range(1);
+
+  std::vector<float> table(static_cast<size_t>(kRows) * kCols, 1.0f);
+  std::vector<int32_t> positions(num_positions);
+  std::mt19937 generator(1);
+  if (zipf) {
+    std::vector<double> weights(kRows);
+    for (int i = 0; i < kRows; ++i) {
+      weights[i] = 1.0 / std::pow(i + 1, 1.05);
+    }
+    std::discrete_distribution<int32_t> distribution(weights.begin(),
+                                                     weights.end());
+    // Popular ids are not clustered in the table.
+    std::vector<int32_t> permutation(kRows);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), generator);
+    for (int32_t& position : positions) {
+      position = permutation[distribution(generator)];
+    }
+  } else {
+    std::uniform_int_distribution<int32_t> distribution(0, kRows - 1);
+    for (int32_t& position : positions) {
+      position = distribution(generator);
+    }
+  }
+  std::vector<float> output(static_cast<size_t>(num_positions) * kCols);
+
+  tflite::CpuBackendContext cpu_backend_context;
+  cpu_backend_context.set_max_num_threads(num_threads);
+  tflite::GatherParams params;
+  params.axis = 0;
+  const tflite::RuntimeShape table_shape({kRows, kCols});
+  const tflite::RuntimeShape positions_shape({num_positions});
+  const tflite::RuntimeShape output_shape({num_positions, kCols});
+  for (auto _ : state) {
+    tflite::optimized_ops::Gather(params, table_shape, table.data(),
+                                  positions_shape, positions.data(),
+                                  output_shape, output.data(),
+                                  &cpu_backend_context);
+  }
+}
+
+void BM_GatherUniform(benchmark::State& state) { BM_Gather(state, false); }
+void BM_GatherZipf(benchmark::State& state) { BM_Gather(state, true); }
+
+BENCHMARK(BM_GatherUniform)
+    ->ArgPair(256, 1)
+    ->ArgPair(4096, 1)
+    ->ArgPair(65536, 1)
+    ->ArgPair(65536, 4);
+BENCHMARK(BM_GatherZipf)
+    ->ArgPair(256, 1)
+    ->ArgPair(4096, 1)
+    ->ArgPair(65536, 1)
+    ->ArgPair(65536, 4);
+
+#endif  // GATHER_BENCHMARKS
@@ -16,9 +16,9 @@ limitations under the License.
 // Op that looks up items from hashtable.
 //
 // Input:
-//     Tensor[0]: Hash key to lookup, dim.size == 1, int32
-//     Tensor[1]: Key of hashtable, dim.size == 1, int32
-//                *MUST* be sorted in ascending order.
+//     Tensor[0]: Hash key to lookup, dim.size == 1, int32 or string
+//     Tensor[1]: Key of hashtable, dim.size == 1, same type as Tensor[0]
+//                Non-constant int32 keys *MUST* be sorted in ascending order.
 //     Tensor[2]: Value of hashtable, dim.size >= 1
 //                Tensor[1].Dim[0] == Tensor[2].Dim[0]
 //
@@ -30,7 +30,12 @@ limitations under the License.
 //   Output[1].dim = { Tensor[0].dim[0] }, num of lookups
 //   Each item indicates whether the corresponding lookup has a returned value.
 //   0 for missing key, 1 for found key.
+//
+// Constant keys and string keys are indexed by an open-addressing hash table,
+// so that each lookup is O(1), usually with a single cache miss. The index of
+// constant keys is built once, at Prepare time.
 
+#include <farmhash.h>
 #include <cassert>
 #include <cmath>
 #include <cstdio>
@@ -38,6 +43,8 @@ limitations under the License.
 #include <cstring>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <vector>
 
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
@@ -51,21 +58,111 @@ namespace builtin {
 
 namespace {
 
+constexpr int32_t kEmptySlot = -1;
+
+struct OpData {
+  // Open-addressing (linear probing) index of the hashtable keys. Each slot
+  // holds a row of the key tensor, or kEmptySlot. The number of slots is a
+  // power of two, at least twice the number of keys.
+  std::vector<int32_t> slots;
+  // Whether `slots` indexes constant keys, and can be kept across invocations.
+  bool has_constant_index;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  auto* op_data = new OpData;
+  op_data->has_constant_index = false;
+  return op_data;
+}
+
+void Free(TfLiteContext* context, void* buffer) {
+  delete reinterpret_cast<OpData*>(buffer);
+}
+
 int greater(const void* a, const void* b) {
   return *static_cast<const int*>(a) - *static_cast<const int*>(b);
 }
 
+// The finalizer of MurmurHash3, which spreads all the bits of the key over
+// the low bits used to pick a slot.
+uint32_t HashInt32(int32_t key) {
+  uint32_t h = static_cast<uint32_t>(key);
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+  return h;
+}
+
+// Returns the hash of element `i` of the int32 or string tensor `tensor`.
+size_t HashElement(const TfLiteTensor* tensor, int i) {
+  if (tensor->type == kTfLiteString) {
+    const StringRef str = GetString(tensor, i);
+    return static_cast<size_t>(::util::Fingerprint64(str.str, str.len));
+  }
+  return HashInt32(tensor->data.i32[i]);
+}
+
+bool ElementsEqual(const TfLiteTensor* a, int i, const TfLiteTensor* b,
+                   int j) {
+  if (a->type == kTfLiteString) {
+    const StringRef a_str = GetString(a, i);
+    const StringRef b_str = GetString(b, j);
+    return a_str.len == b_str.len &&
+           memcmp(a_str.str, b_str.str, a_str.len) == 0;
+  }
+  return a->data.i32[i] == b->data.i32[j];
+}
+
+void BuildIndex(const TfLiteTensor* key, std::vector<int32_t>* slots) {
+  const int num_keys = SizeOfDimension(key, 0);
+  size_t num_slots = 1;
+  while (num_slots < 2 * static_cast<size_t>(num_keys)) {
+    num_slots <<= 1;
+  }
+  const size_t mask = num_slots - 1;
+  slots->assign(num_slots, kEmptySlot);
+  for (int row = 0; row < num_keys; ++row) {
+    size_t slot = HashElement(key, row) & mask;
+    // On duplicate keys the first row wins.
+    while ((*slots)[slot] != kEmptySlot &&
+           !ElementsEqual(key, (*slots)[slot], key, row)) {
+      slot = (slot + 1) & mask;
+    }
+    if ((*slots)[slot] == kEmptySlot) {
+      (*slots)[slot] = row;
+    }
+  }
+}
+
+// Returns the row of `key` equal to element `i` of `lookup`, or -1.
+int FindInIndex(const std::vector<int32_t>& slots, const TfLiteTensor* key,
+                const TfLiteTensor* lookup, int i) {
+  const size_t mask = slots.size() - 1;
+  size_t slot = HashElement(lookup, i) & mask;
+  while (slots[slot] != kEmptySlot) {
+    if (ElementsEqual(key, slots[slot], lookup, i)) {
+      return slots[slot];
+    }
+    slot = (slot + 1) & mask;
+  }
+  return -1;
+}
+
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
   TF_LITE_ENSURE_EQ(context, NumInputs(node), 3);
   TF_LITE_ENSURE_EQ(context, NumOutputs(node), 2);
 
   const TfLiteTensor* lookup = GetInput(context, node, 0);
   TF_LITE_ENSURE_EQ(context, NumDimensions(lookup), 1);
-  TF_LITE_ENSURE_EQ(context, lookup->type, kTfLiteInt32);
+  TF_LITE_ENSURE(context,
+                 lookup->type == kTfLiteInt32 || lookup->type == kTfLiteString);
 
   const TfLiteTensor* key = GetInput(context, node, 1);
   TF_LITE_ENSURE_EQ(context, NumDimensions(key), 1);
-  TF_LITE_ENSURE_EQ(context, key->type, kTfLiteInt32);
+  TF_LITE_ENSURE_EQ(context, key->type, lookup->type);
 
   const TfLiteTensor* value = GetInput(context, node, 2);
   TF_LITE_ENSURE(context, NumDimensions(value) >= 1);
@@ -75,6 +172,11 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     TF_LITE_ENSURE_EQ(context, NumDimensions(value), 1);
   }
 
+  if (IsConstantTensor(key) && !op_data->has_constant_index) {
+    BuildIndex(key, &op_data->slots);
+    op_data->has_constant_index = true;
+  }
+
   TfLiteTensor* hits = GetOutput(context, node, 1);
   TF_LITE_ENSURE_EQ(context, hits->type, kTfLiteUInt8);
   TfLiteIntArray* hitSize = TfLiteIntArrayCreate(1);
@@ -99,6 +201,7 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
   TfLiteTensor* output = GetOutput(context, node, 0);
   TfLiteTensor* hits = GetOutput(context, node, 1);
   const TfLiteTensor* lookup = GetInput(context, node, 0);
@@ -108,27 +211,51 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const int num_rows = SizeOfDimension(value, 0);
   const int row_bytes = value->bytes / num_rows;
   void* pointer = nullptr;
-  DynamicBuffer buf;
+  const int num_lookups = SizeOfDimension(lookup, 0);
+  // Strings are written straight into the output, whose size is estimated
+  // from the average length of the values.
+  std::unique_ptr<StringTensorWriter> writer;
+  std::unique_ptr<StringTensorView> values;
+  if (output->type == kTfLiteString) {
+    values.reset(new StringTensorView(value));
+    const size_t average_length =
+        values->size() == 0 ? 0 : values->total_length() / values->size();
+    writer.reset(new StringTensorWriter(output, num_lookups,
+                                        num_lookups * average_length));
+  }
 
-  for (int i = 0; i < SizeOfDimension(lookup, 0); i++) {
+  // Sorted int32 keys that change between invocations are binary searched, as
+  // indexing them would cost more than the lookups. String keys are not
+  // sorted, so they are indexed anew.
+  const bool use_index =
+      op_data->has_constant_index || key->type == kTfLiteString;
+  if (use_index && !op_data->has_constant_index) {
+    BuildIndex(key, &op_data->slots);
+  }
+
+  for (int i = 0; i < num_lookups; i++) {
     int idx = -1;
-    pointer = bsearch(&(lookup->data.i32[i]), key->data.i32, num_rows,
-                      sizeof(int32_t), greater);
-    if (pointer != nullptr) {
-      idx = (reinterpret_cast<char*>(pointer) - (key->data.raw)) /
-            sizeof(int32_t);
+    if (use_index) {
+      idx = FindInIndex(op_data->slots, key, lookup, i);
+    } else {
+      pointer = bsearch(&(lookup->data.i32[i]), key->data.i32, num_rows,
+                        sizeof(int32_t), greater);
+      if (pointer != nullptr) {
+        idx = (reinterpret_cast<char*>(pointer) - (key->data.raw)) /
+              sizeof(int32_t);
+      }
     }
 
     if (idx >= num_rows || idx < 0) {
       if (output->type == kTfLiteString) {
-        buf.AddString(nullptr, 0);
+        writer->AddString(nullptr, 0);
       } else {
         memset(output->data.raw + i * row_bytes, 0, row_bytes);
       }
       hits->data.uint8[i] = 0;
     } else {
       if (output->type == kTfLiteString) {
-        buf.AddString(GetString(value, idx));
+        writer->AddString((*values)[idx]);
       } else {
         memcpy(output->data.raw + i * row_bytes,
                value->data.raw + idx * row_bytes, row_bytes);
@@ -137,7 +264,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
     }
   }
   if (output->type == kTfLiteString) {
-    buf.WriteToTensorAsVector(output);
+    writer->FinishAsVector();
   }
 
   return kTfLiteOk;
@@ -145,7 +272,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 }  // namespace
 
 TfLiteRegistration* Register_HASHTABLE_LOOKUP() {
-  static TfLiteRegistration r = {nullptr, nullptr, Prepare, Eval};
+  static TfLiteRegistration r = {Init, Free, Prepare, Eval};
   return &r;
 }
 
@@ -35,9 +35,10 @@ class HashtableLookupOpModel : public SingleOpModel {
   HashtableLookupOpModel(std::initializer_list<int> lookup_shape,
                          std::initializer_list<int> key_shape,
                          std::initializer_list<int> value_shape,
-                         TensorType type) {
-    lookup_ = AddInput(TensorType_INT32);
-    key_ = AddInput(TensorType_INT32);
+                         TensorType type,
+                         TensorType key_type = TensorType_INT32) {
+    lookup_ = AddInput(key_type);
+    key_ = AddInput(key_type);
     value_ = AddInput(type);
     output_ = AddOutput(type);
     hit_ = AddOutput(TensorType_UINT8);
@@ -45,14 +46,37 @@ class HashtableLookupOpModel : public SingleOpModel {
     BuildInterpreter({lookup_shape, key_shape, value_shape});
   }
 
+  // Uses the constant, unsorted `keys` as the keys of the hashtable.
+  HashtableLookupOpModel(std::initializer_list<int> lookup_shape,
+                         std::initializer_list<int> keys,
+                         std::initializer_list<int> value_shape) {
+    lookup_ = AddInput(TensorType_INT32);
+    key_ = AddConstInput(TensorType_INT32, keys,
+                         {static_cast<int>(keys.size())});
+    value_ = AddInput(TensorType_FLOAT32);
+    output_ = AddOutput(TensorType_FLOAT32);
+    hit_ = AddOutput(TensorType_UINT8);
+    SetBuiltinOp(BuiltinOperator_HASHTABLE_LOOKUP, BuiltinOptions_NONE, 0);
+    BuildInterpreter(
+        {lookup_shape, {static_cast<int>(keys.size())}, value_shape});
+  }
+
   void SetLookup(std::initializer_list<int> data) {
     PopulateTensor<int>(lookup_, data);
   }
 
+  void SetLookup(const std::vector<string>& data) {
+    PopulateStringTensor(lookup_, data);
+  }
+
   void SetHashtableKey(std::initializer_list<int> data) {
     PopulateTensor<int>(key_, data);
   }
 
+  void SetHashtableKey(const std::vector<string>& data) {
+    PopulateStringTensor(key_, data);
+  }
+
   void SetHashtableValue(const std::vector<string>& content) {
     PopulateStringTensor(value_, content);
   }
@@ -169,5 +193,49 @@ TEST(HashtableLookupOpTest, TestString) {
                           }));
 }
 
+TEST(HashtableLookupOpTest, TestConstantUnsortedKeys) {
+  HashtableLookupOpModel m({5}, {1234, -11, 7, 0, 7}, {5});
+
+  m.SetLookup({0, 7, -292, 1234, -11});
+  m.SetHashtableValue([](int i) { return i / 10.0f; });
+
+  m.Invoke();
+
+  EXPECT_THAT(m.GetOutput(), ElementsAreArray(ArrayFloatNear({
+                                 0.3,  // 3-rd item
+                                 0.2,  // First 7 wins.
+                                 0,    // Not found
+                                 0.0,  // 0-th item
+                                 0.1,  // 1-st item
+                             })));
+  EXPECT_THAT(m.GetHit(), ElementsAreArray({1, 1, 0, 1, 1}));
+
+  // The index built at Prepare time is reused.
+  m.SetLookup({-11, 8, 1234, 7, 1});
+  m.Invoke();
+  EXPECT_THAT(m.GetOutput(),
+              ElementsAreArray(ArrayFloatNear({0.1, 0, 0.0, 0.2, 0})));
+  EXPECT_THAT(m.GetHit(), ElementsAreArray({1, 0, 1, 1, 0}));
+}
+
+TEST(HashtableLookupOpTest, TestStringKeys) {
+  HashtableLookupOpModel m({4}, {3}, {3}, TensorType_STRING,
+                           TensorType_STRING);
+
+  m.SetLookup({"world", "hello!", "", "hello"});
+  m.SetHashtableKey({"hello", "world", ""});
+  m.SetHashtableValue({"Hello", "World", "Empty"});
+
+  m.Invoke();
+
+  EXPECT_THAT(m.GetStringOutput(), ElementsAreArray({
+                                       "World",  // 1-st item
+                                       "",       // Not found
+                                       "Empty",  // 2-nd item
+                                       "Hello",  // 0-th item
+                                   }));
+  EXPECT_THAT(m.GetHit(), ElementsAreArray({1, 0, 1, 1}));
+}
+
 }  // namespace
 }  // namespace tflite
@@ -69,6 +69,7 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   Subgraph* else_subgraph = (*subgraphs)[op_data->else_subgraph_index].get();
 
   for (auto* subgraph : {then_subgraph, else_subgraph}) {
+    TF_LITE_ENSURE_OK(context, subgraph->EnsureMaterialized());
     TF_LITE_ENSURE_EQ(context, num_inputs, subgraph->inputs().size());
     TF_LITE_ENSURE_EQ(context, num_outputs, subgraph->outputs().size());
   }
@@ -0,0 +1,230 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Micro-benchmark of the optimized int8 kernels of the "minor" ops against
+// the reference kernels they replace, on shapes typical of detection models.
+// Prints the time per call of each, e.g.
+//
+//   bazel run -c opt --copt=-msse4.1 \
+//     //tensorflow/lite/kernels/internal:integer_ops_benchmark
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/l2normalization.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/lookup_table.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/mean.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/l2normalization.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/logistic.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/mean.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/tanh.h"
+#include "tensorflow/lite/kernels/internal/reference/reference_ops.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace {
+
+// Returns the time per call in microseconds, running `function` repeatedly
+// for at least `min_seconds`.
+double MicrosecondsPerCall(const std::function<void()>& function,
+                           double min_seconds) {
+  typedef std::chrono::steady_clock Clock;
+  // Warm up caches.
+  function();
+  long long calls = 0;
+  const Clock::time_point start = Clock::now();
+  double elapsed = 0;
+  do {
+    for (int i = 0; i < 8; ++i) {
+      function();
+    }
+    calls += 8;
+    elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+  } while (elapsed < min_seconds);
+  return elapsed * 1e6 / calls;
+}
+
+struct BenchmarkCase {
+  const char* name;
+  std::function<void()> optimized;
+  std::function<void()> reference;
+};
+
+void RunBenchmarks() {
+  std::mt19937 random_engine;
+  std::uniform_int_distribution<int> distribution(-128, 127);
+  std::vector<int8_t> input(1 << 20);
+  for (int8_t& value : input) {
+    value = static_cast<int8_t>(distribution(random_engine));
+  }
+  std::vector<int8_t> output(4 << 20);
+  const int8_t* input_data = input.data();
+  int8_t* output_data = output.data();
+
+  // Logistic and Tanh, with an input scale of 1/16.
+  static constexpr int kInputIntegerBits = 4;
+  int32 input_multiplier;
+  int input_left_shift;
+  QuantizeMultiplierGreaterThanOne(
+      1.0 / 16 * static_cast<double>(1 << (31 - kInputIntegerBits)),
+      &input_multiplier, &input_left_shift);
+  const int32 input_range_radius =
+      CalculateInputRadius(kInputIntegerBits, input_left_shift);
+  const int activation_size = 40 * 40 * 64;
+  int8_t logistic_table[optimized_integer_ops::kInt8LookupTableSize];
+  optimized_integer_ops::PopulateLookupTable(
+      [&](int size, const int8_t* in, int8_t* out) {
+        reference_integer_ops::Logistic(0, input_range_radius,
+                                        input_multiplier, input_left_shift,
+                                        size, in, out);
+      },
+      logistic_table);
+  int8_t tanh_table[optimized_integer_ops::kInt8LookupTableSize];
+  optimized_integer_ops::PopulateLookupTable(
+      [&](int size, const int8_t* in, int8_t* out) {
+        reference_integer_ops::Tanh(0, input_range_radius, input_multiplier,
+                                    input_left_shift, size, in, out);
+      },
+      tanh_table);
+
+  // Mean over a 10x10x1024 feature map.
+  const RuntimeShape mean_input_shape({1, 10, 10, 1024});
+  const RuntimeShape mean_output_shape({1, 1, 1, 1024});
+  MeanParams mean_params;
+  mean_params.axis_count = 2;
+  mean_params.axis[0] = 1;
+  mean_params.axis[1] = 2;
+  int32_t mean_multiplier;
+  int mean_shift;
+  QuantizeMultiplier(1.0, &mean_multiplier, &mean_shift);
+
+  // L2Normalization of 1000 embeddings of depth 128.
+  const int l2norm_outer_size = 1000;
+  const int l2norm_depth = 128;
+
+  // 2x ResizeBilinear of a 20x20x128 feature map.
+  const RuntimeShape resize_input_shape({1, 20, 20, 128});
+  const RuntimeShape resize_output_shape({1, 40, 40, 128});
+  const RuntimeShape resize_size_shape({1, 1, 1, 2});
+  const int32 resize_size[] = {40, 40};
+  ResizeBilinearParams resize_params;
+  resize_params.align_corners = false;
+
+  // Image-style Pad of a 80x80x32 feature map by one pixel on each side.
+  const RuntimeShape pad_input_shape({1, 80, 80, 32});
+  const RuntimeShape pad_output_shape({1, 82, 82, 32});
+  PadParams pad_params;
+  pad_params.left_padding_count = 4;
+  pad_params.right_padding_count = 4;
+  const int paddings[] = {0, 1, 1, 0};
+  for (int i = 0; i < 4; ++i) {
+    pad_params.left_padding[i] = paddings[i];
+    pad_params.right_padding[i] = paddings[i];
+  }
+  const int8_t pad_value = -128;
+
+  const BenchmarkCase cases[] = {
+      {"Logistic",
+       [&] {
+         optimized_integer_ops::LookupTable(logistic_table, activation_size,
+                                            input_data, output_data);
+       },
+       [&] {
+         reference_integer_ops::Logistic(0, input_range_radius,
+                                         input_multiplier, input_left_shift,
+                                         activation_size, input_data,
+                                         output_data);
+       }},
+      {"Tanh",
+       [&] {
+         optimized_integer_ops::LookupTable(tanh_table, activation_size,
+                                            input_data, output_data);
+       },
+       [&] {
+         reference_integer_ops::Tanh(0, input_range_radius, input_multiplier,
+                                     input_left_shift, activation_size,
+                                     input_data, output_data);
+       }},
+      {"Mean",
+       [&] {
+         optimized_integer_ops::Mean(mean_params, mean_multiplier, mean_shift,
+                                     mean_input_shape, input_data, 3,
+                                     mean_output_shape, output_data, -2);
+       },
+       [&] {
+         reference_integer_ops::Mean(mean_params, mean_multiplier, mean_shift,
+                                     mean_input_shape, input_data, 3,
+                                     mean_output_shape, output_data, -2);
+       }},
+      {"L2Normalization",
+       [&] {
+         optimized_integer_ops::L2Normalization(
+             3, l2norm_outer_size, l2norm_depth, input_data, output_data);
+       },
+       [&] {
+         reference_integer_ops::L2Normalization(
+             3, l2norm_outer_size, l2norm_depth, input_data, output_data);
+       }},
+      {"ResizeBilinear",
+       [&] {
+         optimized_ops::ResizeBilinear(resize_params, resize_input_shape,
+                                       input_data, resize_size_shape,
+                                       resize_size, resize_output_shape,
+                                       output_data);
+       },
+       [&] {
+         reference_ops::ResizeBilinear(resize_params, resize_input_shape,
+                                       input_data, resize_size_shape,
+                                       resize_size, resize_output_shape,
+                                       output_data);
+       }},
+      {"PadImageStyle",
+       [&] {
+         optimized_ops::PadImageStyle(pad_params, pad_input_shape, input_data,
+                                      &pad_value, pad_output_shape,
+                                      output_data);
+       },
+       [&] {
+         reference_ops::PadImageStyle(pad_params, pad_input_shape, input_data,
+                                      &pad_value, pad_output_shape,
+                                      output_data);
+       }},
+  };
+  const double kMinSeconds = 0.2;
+
+  std::printf("%-16s %14s %14s %8s\n", "op", "optimized us", "reference us",
+              "speedup");
+  for (const BenchmarkCase& benchmark_case : cases) {
+    const double optimized_us =
+        MicrosecondsPerCall(benchmark_case.optimized, kMinSeconds);
+    const double reference_us =
+        MicrosecondsPerCall(benchmark_case.reference, kMinSeconds);
+    std::printf("%-16s %14.2f %14.2f %7.2fx\n", benchmark_case.name,
+                optimized_us, reference_us, reference_us / optimized_us);
+  }
+}
+
+}  // namespace
+}  // namespace tflite
+
+int main(int argc, char** argv) {
+  tflite::RunBenchmarks();
+  return 0;
+}
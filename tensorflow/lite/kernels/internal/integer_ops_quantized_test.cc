@@ -0,0 +1,143 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/l2normalization.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/lookup_table.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/mean.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/l2normalization.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/logistic.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/mean.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/tanh.h"
+#include "tensorflow/lite/kernels/internal/test_util.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+// The optimized int8 kernels below are expected to give exactly the same
+// results as the reference ones, so they are compared bit for bit.
+
+namespace tflite {
+namespace {
+
+std::vector<int8_t> RandomInt8Data(int size) {
+  std::vector<int8_t> data(size);
+  for (int8_t& value : data) {
+    value = static_cast<int8_t>(UniformRandomInt(-128, 127));
+  }
+  return data;
+}
+
+TEST(IntegerOpsQuantizedTest, Mean) {
+  RandomEngine().seed(38291);
+  for (int i = 0; i < 200; ++i) {
+    const int batch = UniformRandomInt(1, 2);
+    const int height = ExponentialRandomPositiveInt(0.9f, 10, 40);
+    const int width = ExponentialRandomPositiveInt(0.9f, 10, 40);
+    const int depth = ExponentialRandomPositiveInt(0.9f, 40, 200);
+    const RuntimeShape input_shape({batch, height, width, depth});
+    const RuntimeShape output_shape({batch, 1, 1, depth});
+    const std::vector<int8_t> input =
+        RandomInt8Data(input_shape.FlatSize());
+    const int32 input_zero_point = UniformRandomInt(-128, 127);
+    const int32 output_zero_point = UniformRandomInt(-128, 127);
+    int32_t multiplier;
+    int shift;
+    QuantizeMultiplier(UniformRandomFloat(0.5f, 2.f), &multiplier, &shift);
+
+    MeanParams op_params;
+    op_params.axis_count = 2;
+    op_params.axis[0] = 1;
+    op_params.axis[1] = 2;
+    std::vector<int8_t> reference_output(output_shape.FlatSize());
+    std::vector<int8_t> output(output_shape.FlatSize());
+    reference_integer_ops::Mean(op_params, multiplier, shift, input_shape,
+                                input.data(), input_zero_point, output_shape,
+                                reference_output.data(), output_zero_point);
+    optimized_integer_ops::Mean(op_params, multiplier, shift, input_shape,
+                                input.data(), input_zero_point, output_shape,
+                                output.data(), output_zero_point);
+    ASSERT_EQ(output, reference_output);
+  }
+}
+
+TEST(IntegerOpsQuantizedTest, L2Normalization) {
+  RandomEngine().seed(38291);
+  for (int i = 0; i < 200; ++i) {
+    const int outer_size = UniformRandomInt(1, 20);
+    // Rows whose values all equal the zero point are not supported.
+    const int depth = 8 + ExponentialRandomPositiveInt(0.9f, 40, 1000);
+    const std::vector<int8_t> input = RandomInt8Data(outer_size * depth);
+    const int32 input_zero_point = UniformRandomInt(-128, 127);
+
+    std::vector<int8_t> reference_output(input.size());
+    std::vector<int8_t> output(input.size());
+    reference_integer_ops::L2Normalization(input_zero_point, outer_size, depth,
+                                           input.data(),
+                                           reference_output.data());
+    optimized_integer_ops::L2Normalization(input_zero_point, outer_size, depth,
+                                           input.data(), output.data());
+    ASSERT_EQ(output, reference_output);
+  }
+}
+
+TEST(IntegerOpsQuantizedTest, LookupTable) {
+  RandomEngine().seed(38291);
+  const int32 input_zero_point = -5;
+  // Same as the Logistic and Tanh kernels compute in Prepare(), for an input
+  // scale of 1/16.
+  static constexpr int kInputIntegerBits = 4;
+  int32 input_multiplier;
+  int input_left_shift;
+  QuantizeMultiplierGreaterThanOne(
+      1.0 / 16 * static_cast<double>(1 << (31 - kInputIntegerBits)),
+      &input_multiplier, &input_left_shift);
+  const int32 input_range_radius =
+      CalculateInputRadius(kInputIntegerBits, input_left_shift);
+  const auto logistic = [&](int size, const int8_t* input, int8_t* output) {
+    reference_integer_ops::Logistic(input_zero_point, input_range_radius,
+                                    input_multiplier, input_left_shift, size,
+                                    input, output);
+  };
+  const auto tanh = [&](int size, const int8_t* input, int8_t* output) {
+    reference_integer_ops::Tanh(input_zero_point, input_range_radius,
+                                input_multiplier, input_left_shift, size,
+                                input, output);
+  };
+  int8_t logistic_table[optimized_integer_ops::kInt8LookupTableSize];
+  int8_t tanh_table[optimized_integer_ops::kInt8LookupTableSize];
+  optimized_integer_ops::PopulateLookupTable(logistic, logistic_table);
+  optimized_integer_ops::PopulateLookupTable(tanh, tanh_table);
+
+  // Sizes that exercise both the vectorized loop and its tail.
+  for (int size : {1, 15, 16, 17, 100, 1000}) {
+    const std::vector<int8_t> input = RandomInt8Data(size);
+    std::vector<int8_t> reference_output(size);
+    std::vector<int8_t> output(size);
+
+    logistic(size, input.data(), reference_output.data());
+    optimized_integer_ops::LookupTable(logistic_table, size, input.data(),
+                                       output.data());
+    EXPECT_EQ(output, reference_output);
+
+    tanh(size, input.data(), reference_output.data());
+    optimized_integer_ops::LookupTable(tanh_table, size, input.data(),
+                                       output.data());
+    EXPECT_EQ(output, reference_output);
+  }
+}
+
+}  // namespace
+}  // namespace tflite
@@ -117,6 +117,52 @@ void RnnBatchStep(const float* input_ptr_batch, const float* input_weights_ptr,
   }
 }
 
+void RnnBatchStepWithInputProjection(const float* input_projection_ptr_batch,
+                                     const float* recurrent_weights_ptr,
+                                     int num_units, int batch_size,
+                                     int output_batch_leading_dim,
+                                     TfLiteFusedActivation activation,
+                                     float* hidden_state_ptr_batch,
+                                     float* output_ptr_batch) {
+  if (output_batch_leading_dim == num_units) {
+    // Output = input_projection
+    if (output_ptr_batch != input_projection_ptr_batch) {
+      tensor_utils::CopyVector(input_projection_ptr_batch,
+                               num_units * batch_size, output_ptr_batch);
+    }
+
+    // Output += recurrent_weights * hidden_state
+    tensor_utils::MatrixBatchVectorMultiplyAccumulate(
+        recurrent_weights_ptr, num_units, num_units, hidden_state_ptr_batch,
+        batch_size, output_ptr_batch, /*result_stride=*/1);
+
+    // Output = activation(Output) and update hidden_state
+    tensor_utils::ApplyActivationToVector(
+        output_ptr_batch, num_units * batch_size, activation, output_ptr_batch);
+    tensor_utils::CopyVector(output_ptr_batch, num_units * batch_size,
+                             hidden_state_ptr_batch);
+  } else {
+    for (int k = 0; k < batch_size; k++) {
+      float* output_ptr = output_ptr_batch + k * output_batch_leading_dim;
+      // Output = input_projection
+      tensor_utils::CopyVector(input_projection_ptr_batch + k * num_units,
+                               num_units, output_ptr);
+
+      // Output += recurrent_weights * hidden_state
+      tensor_utils::MatrixBatchVectorMultiplyAccumulate(
+          recurrent_weights_ptr, num_units, num_units,
+          hidden_state_ptr_batch + k * num_units,
+          /*n_batch=*/1, output_ptr, /*result_stride=*/1);
+
+      // Output = activation(Output) and update hidden_state
+      tensor_utils::ApplyActivationToVector(output_ptr, num_units, activation,
+                                            output_ptr);
+      tensor_utils::CopyVector(output_ptr, num_units,
+                               hidden_state_ptr_batch + k * num_units);
+    }
+  }
+}
+
 void RnnBatchStep(
     const float* input_ptr_batch, const int8_t* input_weights_ptr,
     float input_weights_scale, const int8_t* recurrent_weights_ptr,
@@ -53,6 +53,19 @@ void RnnBatchStep(const float* input_ptr_batch, const float* input_weights_ptr,
                   TfLiteFusedActivation activation,
                   float* hidden_state_ptr_batch, float* output_ptr_batch);
 
+// Same as above, with the contribution of the inputs and the bias already
+// computed into input_projection_ptr_batch, e.g. for all the time steps of a
+// sequence at once, since it does not depend on the hidden state. It holds
+// batch_size contiguous vectors of num_units, and may be the same as
+// output_ptr_batch when output_batch_leading_dim is num_units.
+void RnnBatchStepWithInputProjection(const float* input_projection_ptr_batch,
+                                     const float* recurrent_weights_ptr,
+                                     int num_units, int batch_size,
+                                     int output_batch_leading_dim,
+                                     TfLiteFusedActivation activation,
+                                     float* hidden_state_ptr_batch,
+                                     float* output_ptr_batch);
+
 // Performs a quantized RNN batch inference step. Same as above, but for
 // quantization purposes, we also pass in quantized_hidden_state_ptr_batch and
 // quantized_input_ptr_batch pointers for temporary storage of the quantized
@@ -0,0 +1,119 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_BATCH_MATMUL_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_BATCH_MATMUL_H_
+
+#include "profiling/instrumentation.h"
+#include "tensorflow/lite/kernels/cpu_backend_context.h"
+#include "tensorflow/lite/kernels/cpu_backend_gemm.h"
+#include "tensorflow/lite/kernels/cpu_backend_gemm_params.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/reference/batch_matmul.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_ops {
+
+// Same as reference_ops::BatchMatMul with adj_x = false and adj_y = true, i.e.
+// lhs has shape [..., rows, depth] and transposed_rhs has shape
+// [..., cols, depth]. That is the layout that cpu_backend_gemm takes as is:
+// the output, in row-major order, is computed as the column-major product
+// transposed_rhs * lhs^T. Callers transpose the operands beforehand when
+// needed, which for a constant rhs only has to be done once.
+inline void BatchMatMul(const RuntimeShape& lhs_shape, const float* lhs_data,
+                        const RuntimeShape& transposed_rhs_shape,
+                        const float* transposed_rhs_data,
+                        const RuntimeShape& output_shape, float* output_data,
+                        CpuBackendContext* cpu_backend_context) {
+  gemmlowp::ScopedProfilingLabel label("BatchMatMul");
+  TFLITE_DCHECK_LE(lhs_shape.DimensionsCount(), 5);
+  TFLITE_DCHECK_LE(transposed_rhs_shape.DimensionsCount(), 5);
+  TFLITE_DCHECK_LE(output_shape.DimensionsCount(), 5);
+  const RuntimeShape extended_lhs_shape =
+      RuntimeShape::ExtendedShape(5, lhs_shape);
+  const RuntimeShape extended_rhs_shape =
+      RuntimeShape::ExtendedShape(5, transposed_rhs_shape);
+  const RuntimeShape extended_output_shape =
+      RuntimeShape::ExtendedShape(5, output_shape);
+
+  const int lhs_rows = extended_lhs_shape.Dims(3);
+  const int rhs_cols = extended_rhs_shape.Dims(3);
+  const int accum_depth =
+      MatchingDim(extended_lhs_shape, 4, extended_rhs_shape, 4);
+  TFLITE_DCHECK_EQ(lhs_rows, extended_output_shape.Dims(3));
+  TFLITE_DCHECK_EQ(rhs_cols, extended_output_shape.Dims(4));
+
+  cpu_backend_gemm::MatrixParams<float> lhs_params;
+  lhs_params.order = cpu_backend_gemm::Order::kRowMajor;
+  lhs_params.rows = rhs_cols;
+  lhs_params.cols = accum_depth;
+  cpu_backend_gemm::MatrixParams<float> rhs_params;
+  rhs_params.order = cpu_backend_gemm::Order::kColMajor;
+  rhs_params.rows = accum_depth;
+  rhs_params.cols = lhs_rows;
+  cpu_backend_gemm::MatrixParams<float> dst_params;
+  dst_params.order = cpu_backend_gemm::Order::kColMajor;
+  dst_params.rows = rhs_cols;
+  dst_params.cols = lhs_rows;
+  cpu_backend_gemm::GemmParams<float, float> gemm_params;
+
+  const int rhs_batches = extended_rhs_shape.Dims(0) *
+                          extended_rhs_shape.Dims(1) *
+                          extended_rhs_shape.Dims(2);
+  if (rhs_batches == 1) {
+    // All the lhs matrices are multiplied by the same rhs, so they are
+    // contiguous in both the lhs and the output and can go through a single
+    // Gemm, which packs the rhs only once.
+    const int lhs_batches = extended_lhs_shape.Dims(0) *
+                            extended_lhs_shape.Dims(1) *
+                            extended_lhs_shape.Dims(2);
+    rhs_params.cols = lhs_rows * lhs_batches;
+    dst_params.cols = lhs_rows * lhs_batches;
+    cpu_backend_gemm::Gemm(lhs_params, transposed_rhs_data, rhs_params,
+                           lhs_data, dst_params, output_data, gemm_params,
+                           cpu_backend_context);
+    return;
+  }
+
+  using reference_ops::batch_matmul::BatchStride;
+  const int lhs_stride0 = BatchStride(extended_lhs_shape, 0);
+  const int lhs_stride1 = BatchStride(extended_lhs_shape, 1);
+  const int lhs_stride2 = BatchStride(extended_lhs_shape, 2);
+  const int rhs_stride0 = BatchStride(extended_rhs_shape, 0);
+  const int rhs_stride1 = BatchStride(extended_rhs_shape, 1);
+  const int rhs_stride2 = BatchStride(extended_rhs_shape, 2);
+  const int output_stride = lhs_rows * rhs_cols;
+
+  float* output_ptr = output_data;
+  for (int b0 = 0; b0 < extended_output_shape.Dims(0); ++b0) {
+    for (int b1 = 0; b1 < extended_output_shape.Dims(1); ++b1) {
+      for (int b2 = 0; b2 < extended_output_shape.Dims(2); ++b2) {
+        const float* lhs_ptr = lhs_data + b0 * lhs_stride0 +
+                               b1 * lhs_stride1 + b2 * lhs_stride2;
+        const float* rhs_ptr = transposed_rhs_data + b0 * rhs_stride0 +
+                               b1 * rhs_stride1 + b2 * rhs_stride2;
+        cpu_backend_gemm::Gemm(lhs_params, rhs_ptr, rhs_params, lhs_ptr,
+                               dst_params, output_ptr, gemm_params,
+                               cpu_backend_context);
+        output_ptr += output_stride;
+      }
+    }
+  }
+}
+
+}  // namespace optimized_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_BATCH_MATMUL_H_
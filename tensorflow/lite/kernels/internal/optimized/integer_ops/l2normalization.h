@@ -0,0 +1,105 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_L2NORMALIZATION_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_L2NORMALIZATION_H_
+
+#include <algorithm>
+#include <limits>
+
+#include "fixedpoint/fixedpoint.h"
+#include "profiling/instrumentation.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Gives the same results as reference_integer_ops::L2Normalization.
+inline void L2Normalization(int32_t input_zero_point, int32_t outer_size,
+                            int32_t depth, const int8* input_data,
+                            int8* output_data) {
+  gemmlowp::ScopedProfilingLabel label("L2NormalizationInt8/8bit");
+  static constexpr int32_t kMinInt8 = std::numeric_limits<int8_t>::min();
+  static constexpr int32_t kMaxInt8 = std::numeric_limits<int8_t>::max();
+  // The output scale must be in sync with Prepare().
+  static constexpr int32_t kOutputScale = 7;
+  for (int outer_index = 0; outer_index < outer_size; ++outer_index) {
+    const int8* input_ptr = input_data + depth * outer_index;
+    int8* output_ptr = output_data + depth * outer_index;
+
+    // Each squared difference is at most 2^16, so the int32 accumulator is
+    // safe for depths up to 2^15.
+    int32_t acc = 0;
+    int i = 0;
+#ifdef USE_NEON
+    const int16x8_t zero_point = vdupq_n_s16(input_zero_point);
+    int32x4_t acc_vector = vdupq_n_s32(0);
+    for (; i <= depth - 8; i += 8) {
+      const int16x8_t input =
+          vsubq_s16(vmovl_s8(vld1_s8(input_ptr + i)), zero_point);
+      acc_vector = vmlal_s16(acc_vector, vget_low_s16(input),
+                             vget_low_s16(input));
+      acc_vector = vmlal_s16(acc_vector, vget_high_s16(input),
+                             vget_high_s16(input));
+    }
+    acc = vgetq_lane_s32(acc_vector, 0) + vgetq_lane_s32(acc_vector, 1) +
+          vgetq_lane_s32(acc_vector, 2) + vgetq_lane_s32(acc_vector, 3);
+#endif  // USE_NEON
+    for (; i < depth; ++i) {
+      const int32_t input = input_ptr[i] - input_zero_point;
+      acc += input * input;
+    }
+    int32_t inv_l2norm_multiplier;
+    int inv_l2norm_shift;
+    GetInvSqrtQuantizedMultiplierExp(acc, /*reverse_shift*/ -1,
+                                     &inv_l2norm_multiplier, &inv_l2norm_shift);
+    // Rescale and downcast. Rescale is folded into the division.
+    const int shift = inv_l2norm_shift + kOutputScale;
+
+    i = 0;
+#ifdef USE_NEON
+    const int left_shift = shift > 0 ? shift : 0;
+    const int right_shift = shift > 0 ? 0 : -shift;
+    const int32x4_t left_shift_vector = vdupq_n_s32(left_shift);
+    for (; i <= depth - 8; i += 8) {
+      const int16x8_t input =
+          vsubq_s16(vmovl_s8(vld1_s8(input_ptr + i)), zero_point);
+      int32x4_t output_low = vshlq_s32(vmovl_s16(vget_low_s16(input)),
+                                       left_shift_vector);
+      int32x4_t output_high = vshlq_s32(vmovl_s16(vget_high_s16(input)),
+                                        left_shift_vector);
+      output_low = vqrdmulhq_n_s32(output_low, inv_l2norm_multiplier);
+      output_high = vqrdmulhq_n_s32(output_high, inv_l2norm_multiplier);
+      using gemmlowp::RoundingDivideByPOT;
+      output_low = RoundingDivideByPOT(output_low, right_shift);
+      output_high = RoundingDivideByPOT(output_high, right_shift);
+      const int16x8_t output = vcombine_s16(vqmovn_s32(output_low),
+                                            vqmovn_s32(output_high));
+      vst1_s8(output_ptr + i, vqmovn_s16(output));
+    }
+#endif  // USE_NEON
+    for (; i < depth; ++i) {
+      const int32_t input = input_ptr[i] - input_zero_point;
+      int32_t output_in_q24 =
+          MultiplyByQuantizedMultiplier(input, inv_l2norm_multiplier, shift);
+      output_in_q24 = std::min(kMaxInt8, std::max(kMinInt8, output_in_q24));
+      output_ptr[i] = static_cast<int8>(output_in_q24);
+    }
+  }
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_L2NORMALIZATION_H_
@@ -0,0 +1,93 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_LOOKUP_TABLE_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_LOOKUP_TABLE_H_
+
+#include <cstdint>
+
+#include "profiling/instrumentation.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Elementwise int8 functions with fixed quantization parameters, such as
+// Logistic and Tanh, have only 256 possible inputs. Evaluating them once per
+// possible input at Prepare() time and then looking the results up is exact
+// and much faster than running the fixed-point math for every element.
+constexpr int kInt8LookupTableSize = 256;
+
+// Fills `table` by running `function`, which takes the size and the input and
+// output arrays like the reference_integer_ops elementwise functions, on every
+// int8 value. `table` is indexed by the input value as uint8.
+template <typename Function>
+inline void PopulateLookupTable(const Function& function, int8_t* table) {
+  int8_t inputs[kInt8LookupTableSize];
+  for (int i = 0; i < kInt8LookupTableSize; ++i) {
+    inputs[static_cast<uint8_t>(i)] = static_cast<int8_t>(i);
+  }
+  function(kInt8LookupTableSize, inputs, table);
+}
+
+inline void LookupTable(const int8_t* table, int size, const int8_t* input_data,
+                        int8_t* output_data) {
+  gemmlowp::ScopedProfilingLabel label("LookupTable/Int8");
+  int i = 0;
+#if defined(USE_NEON) && defined(__aarch64__)
+  // TBL looks up 16 bytes at once in a table of up to 64 bytes, returning 0
+  // for out-of-range indices, so OR-ing the lookups in the four quarters of the
+  // table (with the indices offset accordingly) gives the full lookup.
+  const uint8_t* table_u8 = reinterpret_cast<const uint8_t*>(table);
+  uint8x16x4_t table0, table1, table2, table3;
+  for (int j = 0; j < 4; ++j) {
+    table0.val[j] = vld1q_u8(table_u8 + 16 * j);
+    table1.val[j] = vld1q_u8(table_u8 + 64 + 16 * j);
+    table2.val[j] = vld1q_u8(table_u8 + 128 + 16 * j);
+    table3.val[j] = vld1q_u8(table_u8 + 192 + 16 * j);
+  }
+  const uint8x16_t offset = vdupq_n_u8(64);
+  for (; i <= size - 16; i += 16) {
+    uint8x16_t index =
+        vld1q_u8(reinterpret_cast<const uint8_t*>(input_data + i));
+    uint8x16_t output = vqtbl4q_u8(table0, index);
+    index = vsubq_u8(index, offset);
+    output = vorrq_u8(output, vqtbl4q_u8(table1, index));
+    index = vsubq_u8(index, offset);
+    output = vorrq_u8(output, vqtbl4q_u8(table2, index));
+    index = vsubq_u8(index, offset);
+    output = vorrq_u8(output, vqtbl4q_u8(table3, index));
+    vst1q_u8(reinterpret_cast<uint8_t*>(output_data + i), output);
+  }
+#endif  // USE_NEON && __aarch64__
+  // Unrolled so that the loads of several lookups are in flight at once.
+  for (; i <= size - 4; i += 4) {
+    const int8_t output0 = table[static_cast<uint8_t>(input_data[i])];
+    const int8_t output1 = table[static_cast<uint8_t>(input_data[i + 1])];
+    const int8_t output2 = table[static_cast<uint8_t>(input_data[i + 2])];
+    const int8_t output3 = table[static_cast<uint8_t>(input_data[i + 3])];
+    output_data[i] = output0;
+    output_data[i + 1] = output1;
+    output_data[i + 2] = output2;
+    output_data[i + 3] = output3;
+  }
+  for (; i < size; ++i) {
+    output_data[i] = table[static_cast<uint8_t>(input_data[i])];
+  }
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_LOOKUP_TABLE_H_
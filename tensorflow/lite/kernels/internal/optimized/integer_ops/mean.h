@@ -0,0 +1,111 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_MEAN_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_MEAN_H_
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "profiling/instrumentation.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Mean over width and height of a 4D int8 tensor. Gives the same results as
+// reference_integer_ops::Mean, but sums whole rows of channels at a time
+// instead of striding through the input once per output channel.
+inline void Mean(const tflite::MeanParams& op_params, int32_t multiplier,
+                 int32_t shift, const RuntimeShape& unextended_input_shape,
+                 const int8_t* input_data, int32 input_zero_point,
+                 const RuntimeShape& unextended_output_shape,
+                 int8_t* output_data, int32 output_zero_point) {
+  gemmlowp::ScopedProfilingLabel label("Mean4D/Int8");
+  // Current implementation only supports dimension equals 4 and simultaneous
+  // reduction over width and height.
+  TFLITE_CHECK_EQ(unextended_input_shape.DimensionsCount(), 4);
+  TFLITE_CHECK_LE(unextended_output_shape.DimensionsCount(), 4);
+  const RuntimeShape input_shape =
+      RuntimeShape::ExtendedShape(4, unextended_input_shape);
+  const RuntimeShape output_shape =
+      RuntimeShape::ExtendedShape(4, unextended_output_shape);
+  const int output_batch = output_shape.Dims(0);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int num_elements_in_axis = input_width * input_height;
+
+  TFLITE_DCHECK_EQ(op_params.axis_count, 2);
+  TFLITE_DCHECK((op_params.axis[0] == 1 && op_params.axis[1] == 2) ||
+                (op_params.axis[0] == 2 && op_params.axis[1] == 1));
+  TFLITE_DCHECK_EQ(output_height, 1);
+  TFLITE_DCHECK_EQ(output_width, 1);
+
+  static constexpr int32_t kMinInt8 = std::numeric_limits<int8_t>::min();
+  static constexpr int32_t kMaxInt8 = std::numeric_limits<int8_t>::max();
+
+  // The zero point is subtracted once per channel after summing, which is
+  // exact since the sums cannot overflow for any realistic image size.
+  std::vector<int32> acc(depth);
+  for (int b = 0; b < output_batch; ++b) {
+    std::fill(acc.begin(), acc.end(), 0);
+    const int8_t* input_ptr = input_data + Offset(input_shape, b, 0, 0, 0);
+    for (int i = 0; i < num_elements_in_axis; ++i) {
+      int d = 0;
+#ifdef USE_NEON
+      for (; d <= depth - 16; d += 16) {
+        const int8x16_t input = vld1q_s8(input_ptr + d);
+        const int16x8_t input_low = vmovl_s8(vget_low_s8(input));
+        const int16x8_t input_high = vmovl_s8(vget_high_s8(input));
+        int32* acc_ptr = acc.data() + d;
+        vst1q_s32(acc_ptr, vaddw_s16(vld1q_s32(acc_ptr),
+                                     vget_low_s16(input_low)));
+        vst1q_s32(acc_ptr + 4, vaddw_s16(vld1q_s32(acc_ptr + 4),
+                                         vget_high_s16(input_low)));
+        vst1q_s32(acc_ptr + 8, vaddw_s16(vld1q_s32(acc_ptr + 8),
+                                         vget_low_s16(input_high)));
+        vst1q_s32(acc_ptr + 12, vaddw_s16(vld1q_s32(acc_ptr + 12),
+                                          vget_high_s16(input_high)));
+      }
+#endif  // USE_NEON
+      for (; d < depth; ++d) {
+        acc[d] += input_ptr[d];
+      }
+      input_ptr += depth;
+    }
+
+    int8_t* output_ptr = output_data + Offset(output_shape, b, 0, 0, 0);
+    const int32 zero_point_sum = input_zero_point * num_elements_in_axis;
+    for (int d = 0; d < depth; ++d) {
+      int32 value = MultiplyByQuantizedMultiplier(acc[d] - zero_point_sum,
+                                                  multiplier, shift);
+      value = value > 0
+                  ? (value + num_elements_in_axis / 2) / num_elements_in_axis
+                  : (value - num_elements_in_axis / 2) / num_elements_in_axis;
+      value += output_zero_point;
+      value = std::min(std::max(value, kMinInt8), kMaxInt8);
+      output_ptr[d] = static_cast<int8_t>(value);
+    }
+  }
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_MEAN_H_
@@ -25,7 +25,9 @@ limitations under the License.
 #include "tensorflow/lite/kernels/activation_functor.h"
 #include "tensorflow/lite/kernels/internal/common.h"
 #include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/kernels/internal/optimized/neon_tensor_utils_impl.h"
 #include "tensorflow/lite/kernels/internal/optimized/tensor_utils_impl.h"
+#include "tensorflow/lite/kernels/internal/optimized/vector_math.h"
 #include "tensorflow/lite/kernels/internal/round.h"
 
 #ifdef USE_NEON
@@ -526,6 +528,48 @@ void NeonMatrixBatchVectorMultiplyAccumulate(
   free(aligned_vec_free);
 }
 
+void NeonMatrixBatchVectorMultiplyAccumulate(
+    const int8_t* __restrict__ matrix, int m_rows, int m_cols,
+    const int8_t* __restrict__ vectors, const int32_t* bias, int n_batch,
+    int32_t multiplier, int shift, int32_t* __restrict__ result) {
+  const int kWeightsPerNeonLane = 16;
+  const int postamble_start = m_cols - (m_cols & (kWeightsPerNeonLane - 1));
+  for (int batch = 0; batch < n_batch; ++batch, vectors += m_cols) {
+    const int8_t* row_ptr = matrix;
+    for (int row = 0; row < m_rows; ++row, row_ptr += m_cols, ++result) {
+      int32x4_t dotprod = vmovq_n_s32(0);
+
+      // Prefetch the row to cache.
+      __builtin_prefetch(row_ptr, 0 /* prefetch for read */,
+                         3 /* temporal locality */);
+
+      int col = 0;
+      for (; col < postamble_start; col += kWeightsPerNeonLane) {
+        const int8x16_t s1_8x16 = vld1q_s8(vectors + col);
+        const int8x16_t s2_8x16 = vld1q_s8(row_ptr + col);
+        // The matrix is in [-127, 127] and the vectors in [-128, 127], so the
+        // sum of two products always fits in 16 bits.
+        int16x8_t prod_16x8 =
+            vmull_s8(vget_low_s8(s1_8x16), vget_low_s8(s2_8x16));
+        prod_16x8 =
+            vmlal_s8(prod_16x8, vget_high_s8(s1_8x16), vget_high_s8(s2_8x16));
+        dotprod = vpadalq_s16(dotprod, prod_16x8);
+      }  // for col
+
+      int32 postamble_sum = bias ? bias[row] : 0;
+      for (; col < m_cols; ++col) {
+        postamble_sum += row_ptr[col] * vectors[col];
+      }  // for col
+
+      int64x2_t pairwise_added = vpaddlq_s32(dotprod);
+      const int32 neon_sum =
+          vgetq_lane_s64(pairwise_added, 0) + vgetq_lane_s64(pairwise_added, 1);
+      *result += MultiplyByQuantizedMultiplier(neon_sum + postamble_sum,
+                                               multiplier, shift);
+    }  // for row
+  }    // for batch
+}
+
 void NeonSparseMatrixBatchVectorMultiplyAccumulate(
     const float* __restrict__ matrix, const uint8_t* __restrict__ ledger,
     int m_rows, int m_cols, const float* __restrict__ vector, int n_batch,
@@ -754,6 +798,10 @@ void NeonVectorBatchVectorCwiseProductAccumulate(const float* vector,
   }
 }
 
+void NeonApplySigmoidToVector(const float* vector, int v_size, float* result) {
+  vector_math::Logistic(vector, v_size, result);
+}
+
 void NeonSub1Vector(const float* vector, int v_size, float* result) {
   // If v_size is not divisible by kWeightsPerNeonLane, we cannot use the main
   // vectorized loop, and we need to process sequentially. postamble_start shows
@@ -19,6 +19,7 @@ limitations under the License.
 // structure.
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/kernels/internal/optimized/cpu_check.h"
+#include "tensorflow/lite/kernels/internal/optimized/neon_tensor_utils_impl.h"
 #include "tensorflow/lite/kernels/internal/optimized/tensor_utils_impl.h"
 
 namespace tflite {
@@ -58,6 +59,14 @@ void SparseMatrixBatchVectorMultiplyAccumulate(
                                                 n_batch, result, result_stride);
 }
 
+void MatrixBatchVectorMultiplyAccumulate(
+    const int8_t* __restrict__ matrix, int m_rows, int m_cols,
+    const int8_t* __restrict__ vectors, const int32_t* bias, int n_batch,
+    int32_t multiplier, int shift, int32_t* __restrict__ result) {
+  NEON_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols,
+                   vectors, bias, n_batch, multiplier, shift, result);
+}
+
 void VectorVectorCwiseProduct(const float* vector1, const float* vector2,
                               int v_size, float* result) {
   NEON_OR_PORTABLE(VectorVectorCwiseProduct, vector1, vector2, v_size, result);
@@ -108,7 +117,7 @@ void VectorBatchVectorAssign(const float* vector, int v_size, int n_batch,
 }
 
 void ApplySigmoidToVector(const float* vector, int v_size, float* result) {
-  PortableApplySigmoidToVector(vector, v_size, result);
+  NEON_OR_PORTABLE(ApplySigmoidToVector, vector, v_size, result);
 }
 
 void ApplyActivationToVector(const float* vector, int v_size,
@@ -42,6 +42,13 @@ void NeonMatrixBatchVectorMultiplyAccumulate(
     const int8_t* __restrict__ vectors, const float* scaling_factors,
     int n_batch, float* __restrict__ result, int result_stride);
 
+// Matrix multiplication for the fully integer LSTM, with the products
+// rescaled to fixed-point and accumulated to int32.
+void NeonMatrixBatchVectorMultiplyAccumulate(
+    const int8_t* __restrict__ matrix, int m_rows, int m_cols,
+    const int8_t* __restrict__ vectors, const int32_t* bias, int n_batch,
+    int32_t multiplier, int shift, int32_t* __restrict__ result);
+
 // Multiply a matrix by a batch vector, and store results in a batch-size
 // vector. Sparse version.
 void NeonSparseMatrixBatchVectorMultiplyAccumulate(
@@ -90,6 +97,9 @@ void NeonVectorBatchVectorCwiseProductAccumulate(const float* vector,
                                                  const float* batch_vector,
                                                  int n_batch, float* result);
 
+// Apply sigmoid to elements of a vector.
+void NeonApplySigmoidToVector(const float* vector, int v_size, float* result);
+
 // Compute "1.0f - elements of vector" (used in CIFG).
 void NeonSub1Vector(const float* vector, int v_size, float* result);
 
@@ -44,6 +44,8 @@ limitations under the License.
 #include "tensorflow/lite/kernels/cpu_backend_threadpool.h"
 #include "tensorflow/lite/kernels/internal/common.h"
 #include "tensorflow/lite/kernels/internal/optimized/im2col_utils.h"
+#include "tensorflow/lite/kernels/internal/optimized/transpose_utils.h"
+#include "tensorflow/lite/kernels/internal/optimized/vector_math.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
 #include "tensorflow/lite/kernels/internal/reference/reference_ops.h"
 #include "tensorflow/lite/kernels/internal/round.h"
@@ -78,7 +80,6 @@ using reference_ops::Div;
 using reference_ops::Elu;
 using reference_ops::FakeQuant;
 using reference_ops::Fill;
-using reference_ops::Gather;
 using reference_ops::Greater;
 using reference_ops::GreaterEqual;
 using reference_ops::GreaterEqualWithScaling;
@@ -100,7 +101,6 @@ using reference_ops::SpaceToBatchND;
 using reference_ops::Split;
 using reference_ops::StridedSlice;
 using reference_ops::Sub16;
-using reference_ops::Transpose;
 
 // TODO(b/80247582) Remove this constant.
 // This will be phased out as the shifts are revised with more thought. Use of a
@@ -3406,20 +3406,35 @@ inline void Softmax(const SoftmaxParams& params,
                     const RuntimeShape& input_shape, const float* input_data,
                     const RuntimeShape& output_shape, float* output_data) {
   gemmlowp::ScopedProfilingLabel label("Softmax");
-  MatchingFlatSize(input_shape, output_shape);
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size =
+      MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth =
+      MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
 
-  const auto in_mat = MapAsMatrixWithLastDimAsRows(input_data, input_shape);
-  auto out_mat = MapAsMatrixWithLastDimAsRows(output_data, output_shape);
-  // Compute the exponential first, removing the max coefficient for numerical
-  // stability.
-  out_mat =
-      (in_mat.rowwise() - in_mat.colwise().maxCoeff()).array() * params.beta;
-  // We are separating out the exp function so that exp can be vectorized.
-  out_mat = out_mat.array().exp();
-  // Normalize to get the activations.
-  Eigen::Array<float, 1, Eigen::Dynamic> scale =
-      out_mat.array().colwise().sum().inverse();
-  out_mat.array().rowwise() *= scale;
+  for (int i = 0; i < outer_size; ++i) {
+    const float* block_input_data = input_data + i * depth;
+    float* block_output_data = output_data + i * depth;
+    // Compute the exponential first, removing the max coefficient for
+    // numerical stability.
+    float max = std::numeric_limits<float>::lowest();
+    for (int c = 0; c < depth; ++c) {
+      max = std::max(max, block_input_data[c]);
+    }
+    for (int c = 0; c < depth; ++c) {
+      block_output_data[c] = (block_input_data[c] - max) * params.beta;
+    }
+    vector_math::Exp(block_output_data, depth, block_output_data);
+    // Normalize to get the activations.
+    float sum = 0.f;
+    for (int c = 0; c < depth; ++c) {
+      sum += block_output_data[c];
+    }
+    const float scale = 1.f / sum;
+    for (int c = 0; c < depth; ++c) {
+      block_output_data[c] *= scale;
+    }
+  }
 }
 
 inline void Softmax(const SoftmaxParams& params,
@@ -3624,8 +3639,6 @@ inline void Softmax(const SoftmaxParams& params,
   }
 }
 
-// TODO(myenik): This is the same as the reference implementation, not actually
-// optimized yet.
 inline void LogSoftmax(const SoftmaxParams& params,
                        const RuntimeShape& input_shape, const float* input_data,
                        const RuntimeShape& output_shape, float* output_data) {
@@ -3647,10 +3660,14 @@ inline void LogSoftmax(const SoftmaxParams& params,
       max = std::max(max, block_input_data[c]);
     }
 
-    // Compute sum.
+    // Compute sum, using the output row as scratch space for the exponentials.
+    for (int c = 0; c < depth; ++c) {
+      block_output_data[c] = block_input_data[c] - max;
+    }
+    vector_math::Exp(block_output_data, depth, block_output_data);
     float sum = 0.f;
     for (int c = 0; c < depth; ++c) {
-      sum += std::exp(block_input_data[c] - max);
+      sum += block_output_data[c];
     }
 
     // Compute result.
@@ -3751,13 +3768,17 @@ inline void LogSoftmax(const SoftmaxParams& params,
   }
 }
 
+inline void Exp(const float* input_data, const size_t num_elements,
+                float* output_data) {
+  gemmlowp::ScopedProfilingLabel label("Exp");
+  vector_math::Exp(input_data, num_elements, output_data);
+}
+
 inline void Logistic(const RuntimeShape& input_shape, const float* input_data,
                      const RuntimeShape& output_shape, float* output_data) {
   gemmlowp::ScopedProfilingLabel label("Logistic");
-  auto input_map = MapAsVector(input_data, input_shape);
-  auto output_map = MapAsVector(output_data, output_shape);
-  output_map.array() =
-      input_map.array().unaryExpr(Eigen::internal::scalar_logistic_op<float>());
+  const int flat_size = MatchingFlatSize(input_shape, output_shape);
+  vector_math::Logistic(input_data, flat_size, output_data);
 }
 
 // Convenience version that allows, for example, generated-code calls to be
@@ -3973,9 +3994,8 @@ inline void Logistic(const LogisticParams& params,
 inline void Tanh(const RuntimeShape& input_shape, const float* input_data,
                  const RuntimeShape& output_shape, float* output_data) {
   gemmlowp::ScopedProfilingLabel label("Tanh");
-  auto input_map = MapAsVector(input_data, input_shape);
-  auto output_map = MapAsVector(output_data, output_shape);
-  output_map.array() = input_map.array().tanh();
+  const int flat_size = MatchingFlatSize(input_shape, output_shape);
+  vector_math::Tanh(input_data, flat_size, output_data);
 }
 
 // Convenience version that allows, for example, generated-code calls to be
@@ -4719,6 +4739,71 @@ inline void ResizeBilinear(const tflite::ResizeBilinearParams& op_params,
       output_data);
 }
 
+// Gives the same results as the reference int8 kernel, which interpolates the
+// raw int8 values since input and output share their quantization parameters.
+// The float expression is kept as in the reference (rather than precomputing
+// the four corner weights as the uint8 version does) so that the truncation
+// to int8 matches exactly. The index computations are hoisted out of the
+// channel loop, which the compiler can then vectorize.
+inline void ResizeBilinear(const tflite::ResizeBilinearParams& op_params,
+                           const RuntimeShape& unextended_input_shape,
+                           const int8* input_data,
+                           const RuntimeShape& output_size_shape,
+                           const int32* output_size_data,
+                           const RuntimeShape& unextended_output_shape,
+                           int8* output_data) {
+  gemmlowp::ScopedProfilingLabel label("ResizeBilinear/Int8");
+  TFLITE_DCHECK_LE(unextended_input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_LE(unextended_output_shape.DimensionsCount(), 4);
+  const RuntimeShape input_shape =
+      RuntimeShape::ExtendedShape(4, unextended_input_shape);
+  const RuntimeShape output_shape =
+      RuntimeShape::ExtendedShape(4, unextended_output_shape);
+
+  int32 batches = MatchingDim(input_shape, 0, output_shape, 0);
+  int32 input_height = input_shape.Dims(1);
+  int32 input_width = input_shape.Dims(2);
+  int32 depth = MatchingDim(input_shape, 3, output_shape, 3);
+
+  TFLITE_DCHECK_EQ(output_size_shape.FlatSize(), 2);
+  int32 output_height = output_size_data[0];
+  int32 output_width = output_size_data[1];
+
+  float height_scale = static_cast<float>(input_height) / output_height;
+  float width_scale = static_cast<float>(input_width) / output_width;
+  if (op_params.align_corners && output_height > 1) {
+    height_scale = static_cast<float>(input_height - 1) / (output_height - 1);
+  }
+  if (op_params.align_corners && output_width > 1) {
+    width_scale = static_cast<float>(input_width - 1) / (output_width - 1);
+  }
+
+  int8* output_ptr = output_data;
+  for (int b = 0; b < batches; ++b) {
+    for (int y = 0; y < output_height; ++y) {
+      const float input_y = y * height_scale;
+      const int32 y0 = static_cast<int32>(std::floor(input_y));
+      const int32 y1 = std::min(y0 + 1, input_height - 1);
+      const float dy = input_y - y0;
+      for (int x = 0; x < output_width; ++x) {
+        const float input_x = x * width_scale;
+        const int32 x0 = static_cast<int32>(std::floor(input_x));
+        const int32 x1 = std::min(x0 + 1, input_width - 1);
+        const float dx = input_x - x0;
+        const int8* input_00 = input_data + Offset(input_shape, b, y0, x0, 0);
+        const int8* input_10 = input_data + Offset(input_shape, b, y1, x0, 0);
+        const int8* input_01 = input_data + Offset(input_shape, b, y0, x1, 0);
+        const int8* input_11 = input_data + Offset(input_shape, b, y1, x1, 0);
+        for (int c = 0; c < depth; ++c) {
+          *output_ptr++ = static_cast<int8>(
+              input_00[c] * (1 - dy) * (1 - dx) + input_10[c] * dy * (1 - dx) +
+              input_01[c] * (1 - dy) * dx + input_11[c] * dy * dx);
+        }
+      }
+    }
+  }
+}
+
 // Helper methods for BatchToSpaceND.
 // `spatial_index_dim` specifies post-crop offset index in this spatial
 // dimension, i.e. spatial offset introduced by flattening batch to spatial
@@ -5109,6 +5194,15 @@ inline void PadImageStyle(const tflite::PadParams& op_params,
                       output_shape, output_data);
 }
 
+template <typename P>
+inline void PadImageStyle(const tflite::PadParams& op_params,
+                          const RuntimeShape& input_shape,
+                          const int8* input_data, const P* pad_value_ptr,
+                          const RuntimeShape& output_shape, int8* output_data) {
+  PadImageStyleMemset(op_params, input_shape, input_data, pad_value_ptr,
+                      output_shape, output_data);
+}
+
 template <typename P>
 inline void PadImageStyle(const tflite::PadParams& op_params,
                           const RuntimeShape& input_shape,
@@ -5297,6 +5391,260 @@ void TransposeIm2col(const ConvParams& params, uint8 zero_byte,
   }
 }
 
+template <typename T>
+struct TransposeWorkerTask : cpu_backend_threadpool::Task {
+  TransposeWorkerTask(const transpose_utils::TransposePlan& plan,
+                      const T* input_data, T* output_data, int start_unit,
+                      int end_unit)
+      : plan_(plan),
+        input_data_(input_data),
+        output_data_(output_data),
+        start_unit_(start_unit),
+        end_unit_(end_unit) {}
+
+  void Run() override {
+    transpose_utils::TransposeImpl(plan_, input_data_, output_data_,
+                                   start_unit_, end_unit_);
+  }
+
+ private:
+  const transpose_utils::TransposePlan& plan_;
+  const T* input_data_;
+  T* output_data_;
+  int start_unit_;
+  int end_unit_;
+};
+
+// Transposes tensors of up to 6 dimensions. The permutation is first reduced
+// to a copy or a batch of 2D transposes (see transpose_utils::TransposePlan),
+// which are done in cache-sized tiles, split across threads if a
+// cpu_backend_context is given.
+template <typename T>
+void Transpose(const TransposeParams& params, const RuntimeShape& input_shape,
+               const T* input_data, const RuntimeShape& output_shape,
+               T* output_data,
+               CpuBackendContext* cpu_backend_context = nullptr) {
+  gemmlowp::ScopedProfilingLabel label("Transpose");
+  const int dims_count = input_shape.DimensionsCount();
+  TFLITE_DCHECK_LE(dims_count, transpose_utils::kTransposeMaxDimensions);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), dims_count);
+  TFLITE_DCHECK_EQ(params.perm_count, dims_count);
+  for (int i = 0; i < dims_count; ++i) {
+    TFLITE_DCHECK_EQ(output_shape.Dims(i), input_shape.Dims(params.perm[i]));
+  }
+  // The plan divides by the number of row blocks and outer sizes, so an empty
+  // tensor, which has nothing to move anyway, is not planned at all.
+  if (input_shape.FlatSize() == 0) {
+    return;
+  }
+
+  transpose_utils::TransposePlan plan;
+  transpose_utils::MakeTransposePlan(params, input_shape, &plan);
+
+  // Only split the work if each thread gets a sizable amount of it.
+  constexpr int kMinElementsPerThread = 1 << 14;
+  int thread_count = 1;
+  if (cpu_backend_context != nullptr) {
+    thread_count = std::min(cpu_backend_context->max_num_threads(),
+                            input_shape.FlatSize() / kMinElementsPerThread);
+    thread_count = std::min(thread_count, plan.num_units);
+  }
+
+  if (thread_count <= 1) {
+    transpose_utils::TransposeImpl(plan, input_data, output_data, 0,
+                                   plan.num_units);
+  } else {
+    std::vector<TransposeWorkerTask<T>> tasks;
+    tasks.reserve(thread_count);
+    int start_unit = 0;
+    for (int i = 0; i < thread_count; ++i) {
+      // Try to distribute the tasks as even as possible.
+      const int end_unit =
+          start_unit + (plan.num_units - start_unit) / (thread_count - i);
+      tasks.emplace_back(plan, input_data, output_data, start_unit, end_unit);
+      start_unit = end_unit;
+    }
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(),
+                                    cpu_backend_context);
+  }
+}
+
+// Number of slices ahead of the one being copied that GatherSlices prefetches,
+// and how many bytes of each of them, so that the cache misses of random
+// lookups into large tables overlap instead of being paid one at a time.
+constexpr int kGatherPrefetchDistance = 8;
+constexpr int kGatherPrefetchBytes = 256;
+
+// Copies slices [start, end) of `slice_size` elements each, with slice i
+// starting at `input_data + slice_offset(i)`, to consecutive locations of
+// `output_data`.
+template <typename T, typename SliceOffsetFn>
+inline void GatherSlicesImpl(const T* input_data,
+                             const SliceOffsetFn& slice_offset,
+                             int slice_size, int start, int end,
+                             T* output_data) {
+  const int prefetch_bytes = std::min<int>(slice_size * sizeof(T),
+                                           kGatherPrefetchBytes);
+  const int prefetch_end = std::max(start, end - kGatherPrefetchDistance);
+  for (int i = start; i < end; ++i) {
+    if (i < prefetch_end) {
+      const char* next_slice = reinterpret_cast<const char*>(
+          input_data + slice_offset(i + kGatherPrefetchDistance));
+      for (int b = 0; b < prefetch_bytes; b += 64) {
+        optimized_ops_preload_l1_keep(next_slice + b);
+      }
+    }
+    const T* src = input_data + slice_offset(i);
+    T* dst = output_data + static_cast<size_t>(i) * slice_size;
+    if (slice_size == 1) {
+      // Avoid a call to memcpy for scalar lookups.
+      *dst = *src;
+    } else {
+      memcpy(dst, src, slice_size * sizeof(T));
+    }
+  }
+}
+
+template <typename T, typename SliceOffsetFn>
+struct GatherWorkerTask : cpu_backend_threadpool::Task {
+  GatherWorkerTask(const T* input_data, const SliceOffsetFn& slice_offset,
+                   int slice_size, int start, int end, T* output_data)
+      : input_data_(input_data),
+        slice_offset_(slice_offset),
+        slice_size_(slice_size),
+        start_(start),
+        end_(end),
+        output_data_(output_data) {}
+
+  void Run() override {
+    GatherSlicesImpl(input_data_, slice_offset_, slice_size_, start_, end_,
+                     output_data_);
+  }
+
+ private:
+  const T* input_data_;
+  const SliceOffsetFn& slice_offset_;
+  int slice_size_;
+  int start_;
+  int end_;
+  T* output_data_;
+};
+
+// Gathers `num_slices` slices as GatherSlicesImpl does, split across threads
+// if a cpu_backend_context is given and there is enough to copy.
+template <typename T, typename SliceOffsetFn>
+inline void GatherSlices(const T* input_data,
+                         const SliceOffsetFn& slice_offset, int num_slices,
+                         int slice_size, T* output_data,
+                         CpuBackendContext* cpu_backend_context) {
+  constexpr int kMinBytesPerThread = 1 << 16;
+  int thread_count = 1;
+  if (cpu_backend_context != nullptr) {
+    const size_t total_bytes =
+        static_cast<size_t>(num_slices) * slice_size * sizeof(T);
+    thread_count = static_cast<int>(std::min<size_t>(
+        cpu_backend_context->max_num_threads(),
+        total_bytes / kMinBytesPerThread));
+  }
+
+  if (thread_count <= 1) {
+    GatherSlicesImpl(input_data, slice_offset, slice_size, 0, num_slices,
+                     output_data);
+    return;
+  }
+  std::vector<GatherWorkerTask<T, SliceOffsetFn>> tasks;
+  tasks.reserve(thread_count);
+  int start = 0;
+  for (int i = 0; i < thread_count; ++i) {
+    const int end = start + (num_slices - start) / (thread_count - i);
+    tasks.emplace_back(input_data, slice_offset, slice_size, start, end,
+                       output_data);
+    start = end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(),
+                                  cpu_backend_context);
+}
+
+template <typename T, typename CoordsT = int32>
+inline void Gather(const tflite::GatherParams& op_params,
+                   const RuntimeShape& input_shape, const T* input_data,
+                   const RuntimeShape& coords_shape, const CoordsT* coords_data,
+                   const RuntimeShape& output_shape, T* output_data,
+                   CpuBackendContext* cpu_backend_context = nullptr) {
+  gemmlowp::ScopedProfilingLabel label("Gather");
+  int axis = op_params.axis;
+  if (axis < 0) {
+    axis += input_shape.DimensionsCount();
+  }
+  TFLITE_DCHECK_GE(axis, 0);
+  TFLITE_DCHECK_LT(axis, input_shape.DimensionsCount());
+  const int axis_size = input_shape.Dims(axis);
+  const int coords_count = coords_shape.FlatSize();
+
+  int outer_size = 1;
+  for (int i = 0; i < axis; ++i) {
+    outer_size *= input_shape.Dims(i);
+  }
+
+  int inner_size = 1;
+  for (int i = axis + 1; i < input_shape.DimensionsCount(); ++i) {
+    inner_size *= input_shape.Dims(i);
+  }
+
+  // Offsets are computed in size_t, as tables may have more than 2^31
+  // elements.
+  auto slice_offset = [coords_data, inner_size](int i) {
+    TFLITE_DCHECK_GE(coords_data[i], 0);
+    return static_cast<size_t>(coords_data[i]) * inner_size;
+  };
+  for (int outer = 0; outer < outer_size; ++outer) {
+    GatherSlices(
+        input_data + static_cast<size_t>(outer) * axis_size * inner_size,
+        slice_offset, coords_count, inner_size,
+        output_data + static_cast<size_t>(outer) * coords_count * inner_size,
+        cpu_backend_context);
+  }
+}
+
+template <typename ParamsT, typename IndicesT = int32>
+inline void GatherNd(const RuntimeShape& params_shape,
+                     const ParamsT* params_data,
+                     const RuntimeShape& indices_shape,
+                     const IndicesT* indices_data,
+                     const RuntimeShape& output_shape, ParamsT* output_data,
+                     CpuBackendContext* cpu_backend_context = nullptr) {
+  gemmlowp::ScopedProfilingLabel label("GatherNd");
+
+  int n_slices = 1;
+  int slice_size = 1;
+  const int indices_dims = indices_shape.DimensionsCount();
+  const int indices_nd = indices_shape.Dims(indices_dims - 1);
+  const int params_dims = params_shape.DimensionsCount();
+  for (int i = 0; i < indices_dims - 1; ++i) {
+    n_slices *= indices_shape.Dims(i);
+  }
+  for (int i = indices_nd; i < params_dims; ++i) {
+    slice_size *= params_shape.Dims(i);
+  }
+
+  size_t remain_flat_size = params_shape.FlatSize();
+  std::vector<size_t> dims_to_count(indices_nd, 0);
+  for (int i = 0; i < indices_nd; ++i) {
+    dims_to_count[i] = remain_flat_size / params_shape.Dims(i);
+    remain_flat_size = dims_to_count[i];
+  }
+
+  auto slice_offset = [indices_data, indices_nd, &dims_to_count](int i) {
+    size_t from_pos = 0;
+    for (int j = 0; j < indices_nd; ++j) {
+      from_pos += indices_data[i * indices_nd + j] * dims_to_count[j];
+    }
+    return from_pos;
+  };
+  GatherSlices(params_data, slice_offset, n_slices, slice_size, output_data,
+               cpu_backend_context);
+}
+
 // Returns in 'im_data' (assumes to be zero-initialized) image patch in storage
 // order (height, width, depth), constructed from patches in 'col_data', which
 // is required to be in storage order (out_height * out_width, filter_height,
@@ -20,6 +20,7 @@ limitations under the License.
 #include <smmintrin.h>  // SSE4.1
 #include <tmmintrin.h>  // SSSE3
 
+#include "tensorflow/lite/kernels/internal/common.h"
 #include "tensorflow/lite/kernels/internal/compatibility.h"
 
 namespace tflite {
@@ -105,6 +106,39 @@ void SseMatrixBatchVectorMultiplyAccumulate(
   }  // for batch
 }
 
+void SseMatrixBatchVectorMultiplyAccumulate(
+    const int8_t* __restrict__ matrix, int m_rows, int m_cols,
+    const int8_t* __restrict__ vectors, const int32_t* bias, int n_batch,
+    int32_t multiplier, int shift, int32_t* __restrict__ result) {
+  static constexpr int kBlockSize = 8;
+  for (int batch = 0; batch < n_batch; ++batch, vectors += m_cols) {
+    const int8_t* row_ptr = matrix;
+    for (int row = 0; row < m_rows; ++row, row_ptr += m_cols, ++result) {
+      __m128i dotprod_32x4 = _mm_setzero_si128();  // SSE2
+      int col = 0;
+      for (; col < (m_cols & ~(kBlockSize - 1)); col += kBlockSize) {
+        const __m128i vec_8x8 =
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(vectors + col));
+        const __m128i row_8x8 =
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row_ptr + col));
+        dotprod_32x4 = MatrixBatchVectorMultiplyAccumulateLoopBodySse(
+            dotprod_32x4, vec_8x8, row_8x8);
+      }  // for col
+      int32_t sum = ReduceInt32x4(dotprod_32x4);
+
+      // Postamble loop.
+      for (; col < m_cols; ++col) {
+        sum += row_ptr[col] * vectors[col];
+      }  // for col
+
+      if (bias) {
+        sum += bias[row];
+      }
+      *result += MultiplyByQuantizedMultiplier(sum, multiplier, shift);
+    }  // for row
+  }    // for batch
+}
+
 void SseSparseMatrixBatchVectorMultiplyAccumulate(
     const int8_t* __restrict__ matrix, const uint8_t* ledger, const int m_rows,
     const int m_cols, const int8_t* __restrict__ vectors,
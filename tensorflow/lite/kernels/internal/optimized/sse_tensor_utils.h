@@ -52,6 +52,14 @@ void MatrixBatchVectorMultiplyAccumulate(
                   vectors, scaling_factors, n_batch, result, result_stride);
 }
 
+void MatrixBatchVectorMultiplyAccumulate(
+    const int8_t* __restrict__ matrix, int m_rows, int m_cols,
+    const int8_t* __restrict__ vectors, const int32_t* bias, int n_batch,
+    int32_t multiplier, int shift, int32_t* __restrict__ result) {
+  SSE_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols,
+                  vectors, bias, n_batch, multiplier, shift, result);
+}
+
 void SparseMatrixBatchVectorMultiplyAccumulate(
     const float* __restrict__ matrix, const uint8_t* __restrict__ ledger,
     int m_rows, int m_cols, const float* __restrict__ vector, int n_batch,
@@ -120,7 +128,7 @@ void VectorBatchVectorAssign(const float* vector, int v_size, int n_batch,
 }
 
 void ApplySigmoidToVector(const float* vector, int v_size, float* result) {
-  PortableApplySigmoidToVector(vector, v_size, result);
+  NEON_OR_PORTABLE(ApplySigmoidToVector, vector, v_size, result);
 }
 
 void ApplyActivationToVector(const float* vector, int v_size,
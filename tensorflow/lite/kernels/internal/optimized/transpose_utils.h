@@ -0,0 +1,373 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_TRANSPOSE_UTILS_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_TRANSPOSE_UTILS_H_
+
+#include <string.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_ops {
+namespace transpose_utils {
+
+constexpr int kTransposeMaxDimensions = 6;
+
+// Number of rows of the inner 2D transpose handled by one unit of work. The
+// rows end up contiguous in the output, so 16 of them fill a whole cache line
+// of the output for 4-byte types.
+constexpr int kTransposeRowBlock = 16;
+
+// Describes a transpose as a loop over "outer" output dimensions around one
+// of two inner kernels:
+//  - if the innermost input dimension stays innermost in the output, a copy
+//    of `cols` contiguous elements;
+//  - otherwise a 2D transpose of a `rows` x `cols` matrix, where the columns
+//    are the innermost input dimension and the rows are the input dimension
+//    that becomes innermost in the output.
+// Size-1 dimensions are dropped and input dimensions that stay adjacent and in
+// the same order in the output are merged beforehand, so e.g. NHWC -> NCHW is
+// a batch of (H*W) x C transposes.
+struct TransposePlan {
+  bool is_copy;
+  int rows;
+  int cols;
+  // Distance between rows in the input, and between columns in the output.
+  int input_row_stride;
+  int output_col_stride;
+  int row_blocks;
+  int outer_rank;
+  int outer_sizes[kTransposeMaxDimensions];
+  int outer_input_strides[kTransposeMaxDimensions];
+  int outer_output_strides[kTransposeMaxDimensions];
+  // Each unit of work is one copy or one block of kTransposeRowBlock rows of
+  // the 2D transpose, for one position in the outer loop.
+  int num_units;
+};
+
+inline void MakeTransposePlan(const TransposeParams& params,
+                              const RuntimeShape& input_shape,
+                              TransposePlan* plan) {
+  const int dims_count = input_shape.DimensionsCount();
+  TFLITE_DCHECK_LE(dims_count, kTransposeMaxDimensions);
+  TFLITE_DCHECK_EQ(dims_count, params.perm_count);
+
+  // Drop the size-1 dimensions.
+  int new_index[kTransposeMaxDimensions];
+  int dims[kTransposeMaxDimensions];
+  int rank = 0;
+  for (int i = 0; i < dims_count; ++i) {
+    if (input_shape.Dims(i) == 1) {
+      new_index[i] = -1;
+    } else {
+      new_index[i] = rank;
+      dims[rank++] = input_shape.Dims(i);
+    }
+  }
+  int perm[kTransposeMaxDimensions];
+  int perm_size = 0;
+  for (int i = 0; i < dims_count; ++i) {
+    if (new_index[params.perm[i]] >= 0) {
+      perm[perm_size++] = new_index[params.perm[i]];
+    }
+  }
+  TFLITE_DCHECK_EQ(perm_size, rank);
+
+  // Merge the runs of consecutive input dimensions in the output, recording
+  // the first input dimension of each run in output order.
+  int run_start[kTransposeMaxDimensions];
+  int run_size[kTransposeMaxDimensions];
+  int runs = 0;
+  for (int i = 0; i < rank; ++i) {
+    if (i > 0 && perm[i] == perm[i - 1] + 1) {
+      run_size[runs - 1] *= dims[perm[i]];
+    } else {
+      run_start[runs] = perm[i];
+      run_size[runs] = dims[perm[i]];
+      ++runs;
+    }
+  }
+  // The merged input dimensions are the runs in input order; a run's index
+  // in that order is the number of runs starting before it in the input.
+  int merged_perm[kTransposeMaxDimensions];
+  int merged_dims[kTransposeMaxDimensions];
+  for (int i = 0; i < runs; ++i) {
+    int index = 0;
+    for (int j = 0; j < runs; ++j) {
+      if (run_start[j] < run_start[i]) ++index;
+    }
+    merged_perm[i] = index;
+    merged_dims[index] = run_size[i];
+  }
+
+  int input_strides[kTransposeMaxDimensions];
+  int output_strides[kTransposeMaxDimensions];
+  int stride = 1;
+  for (int i = runs - 1; i >= 0; --i) {
+    input_strides[i] = stride;
+    stride *= merged_dims[i];
+  }
+  stride = 1;
+  for (int i = runs - 1; i >= 0; --i) {
+    output_strides[i] = stride;
+    stride *= merged_dims[merged_perm[i]];
+  }
+
+  plan->outer_rank = 0;
+  plan->row_blocks = 1;
+  if (runs <= 1) {
+    // A plain copy.
+    plan->is_copy = true;
+    plan->rows = 1;
+    plan->cols = runs == 0 ? 1 : merged_dims[0];
+    plan->input_row_stride = plan->cols;
+    plan->output_col_stride = 1;
+    plan->num_units = 1;
+    return;
+  }
+
+  const int last = runs - 1;
+  // Position in the output of the innermost input dimension.
+  int innermost_input_position = 0;
+  while (merged_perm[innermost_input_position] != last) {
+    ++innermost_input_position;
+  }
+  plan->is_copy = innermost_input_position == last;
+  plan->cols = merged_dims[last];
+  if (plan->is_copy) {
+    plan->rows = 1;
+    plan->input_row_stride = 0;
+    plan->output_col_stride = 1;
+  } else {
+    plan->rows = merged_dims[merged_perm[last]];
+    plan->input_row_stride = input_strides[merged_perm[last]];
+    plan->output_col_stride = output_strides[innermost_input_position];
+    plan->row_blocks =
+        (plan->rows + kTransposeRowBlock - 1) / kTransposeRowBlock;
+  }
+  int outer_count = 1;
+  for (int i = 0; i < last; ++i) {
+    if (i == innermost_input_position) continue;
+    const int outer = plan->outer_rank++;
+    plan->outer_sizes[outer] = merged_dims[merged_perm[i]];
+    plan->outer_input_strides[outer] = input_strides[merged_perm[i]];
+    plan->outer_output_strides[outer] = output_strides[i];
+    outer_count *= plan->outer_sizes[outer];
+  }
+  plan->num_units = outer_count * plan->row_blocks;
+}
+
+// Transposes a `rows` x `cols` matrix tile, i.e.
+//   output[c * output_stride + r] = input[r * input_stride + c].
+template <typename T>
+inline void TransposeTileScalar(int rows, int cols, const T* input,
+                                int input_stride, T* output,
+                                int output_stride) {
+  for (int c = 0; c < cols; ++c) {
+    const T* input_ptr = input + c;
+    T* output_ptr = output + c * output_stride;
+    for (int r = 0; r < rows; ++r) {
+      output_ptr[r] = input_ptr[r * input_stride];
+    }
+  }
+}
+
+// Same as TransposeTileScalar, in register tiles of 4x4 32-bit or 8x8 8-bit
+// elements where NEON is available, and 8x8 scalar tiles otherwise.
+template <typename T>
+inline void TransposeTile(int rows, int cols, const T* input, int input_stride,
+                          T* output, int output_stride) {
+  constexpr int kTile = 8;
+  for (int r = 0; r < rows; r += kTile) {
+    const int tile_rows = std::min(kTile, rows - r);
+    for (int c = 0; c < cols; c += kTile) {
+      const int tile_cols = std::min(kTile, cols - c);
+      TransposeTileScalar(tile_rows, tile_cols, input + r * input_stride + c,
+                          input_stride, output + c * output_stride + r,
+                          output_stride);
+    }
+  }
+}
+
+#ifdef USE_NEON
+template <>
+inline void TransposeTile(int rows, int cols, const uint32_t* input,
+                          int input_stride, uint32_t* output,
+                          int output_stride) {
+  int r = 0;
+  for (; r <= rows - 4; r += 4) {
+    const uint32_t* input_ptr = input + r * input_stride;
+    uint32_t* output_ptr = output + r;
+    int c = 0;
+    for (; c <= cols - 4; c += 4) {
+      const uint32x4_t row0 = vld1q_u32(input_ptr + c);
+      const uint32x4_t row1 = vld1q_u32(input_ptr + input_stride + c);
+      const uint32x4_t row2 = vld1q_u32(input_ptr + 2 * input_stride + c);
+      const uint32x4_t row3 = vld1q_u32(input_ptr + 3 * input_stride + c);
+      const uint32x4x2_t row01 = vtrnq_u32(row0, row1);
+      const uint32x4x2_t row23 = vtrnq_u32(row2, row3);
+      uint32_t* output_col = output_ptr + c * output_stride;
+      vst1q_u32(output_col, vcombine_u32(vget_low_u32(row01.val[0]),
+                                         vget_low_u32(row23.val[0])));
+      vst1q_u32(output_col + output_stride,
+                vcombine_u32(vget_low_u32(row01.val[1]),
+                             vget_low_u32(row23.val[1])));
+      vst1q_u32(output_col + 2 * output_stride,
+                vcombine_u32(vget_high_u32(row01.val[0]),
+                             vget_high_u32(row23.val[0])));
+      vst1q_u32(output_col + 3 * output_stride,
+                vcombine_u32(vget_high_u32(row01.val[1]),
+                             vget_high_u32(row23.val[1])));
+    }
+    TransposeTileScalar(4, cols - c, input_ptr + c, input_stride,
+                        output_ptr + c * output_stride, output_stride);
+  }
+  TransposeTileScalar(rows - r, cols, input + r * input_stride, input_stride,
+                      output + r, output_stride);
+}
+
+template <>
+inline void TransposeTile(int rows, int cols, const uint8_t* input,
+                          int input_stride, uint8_t* output,
+                          int output_stride) {
+  int r = 0;
+  for (; r <= rows - 8; r += 8) {
+    const uint8_t* input_ptr = input + r * input_stride;
+    uint8_t* output_ptr = output + r;
+    int c = 0;
+    for (; c <= cols - 8; c += 8) {
+      uint8x8_t row[8];
+      for (int i = 0; i < 8; ++i) {
+        row[i] = vld1_u8(input_ptr + i * input_stride + c);
+      }
+      // Transpose 1x1, then 2x2, then 4x4 blocks.
+      const uint8x8x2_t row01 = vtrn_u8(row[0], row[1]);
+      const uint8x8x2_t row23 = vtrn_u8(row[2], row[3]);
+      const uint8x8x2_t row45 = vtrn_u8(row[4], row[5]);
+      const uint8x8x2_t row67 = vtrn_u8(row[6], row[7]);
+      const uint16x4x2_t row02 = vtrn_u16(vreinterpret_u16_u8(row01.val[0]),
+                                          vreinterpret_u16_u8(row23.val[0]));
+      const uint16x4x2_t row13 = vtrn_u16(vreinterpret_u16_u8(row01.val[1]),
+                                          vreinterpret_u16_u8(row23.val[1]));
+      const uint16x4x2_t row46 = vtrn_u16(vreinterpret_u16_u8(row45.val[0]),
+                                          vreinterpret_u16_u8(row67.val[0]));
+      const uint16x4x2_t row57 = vtrn_u16(vreinterpret_u16_u8(row45.val[1]),
+                                          vreinterpret_u16_u8(row67.val[1]));
+      const uint32x2x2_t col04 = vtrn_u32(vreinterpret_u32_u16(row02.val[0]),
+                                          vreinterpret_u32_u16(row46.val[0]));
+      const uint32x2x2_t col15 = vtrn_u32(vreinterpret_u32_u16(row13.val[0]),
+                                          vreinterpret_u32_u16(row57.val[0]));
+      const uint32x2x2_t col26 = vtrn_u32(vreinterpret_u32_u16(row02.val[1]),
+                                          vreinterpret_u32_u16(row46.val[1]));
+      const uint32x2x2_t col37 = vtrn_u32(vreinterpret_u32_u16(row13.val[1]),
+                                          vreinterpret_u32_u16(row57.val[1]));
+      uint8_t* output_col = output_ptr + c * output_stride;
+      vst1_u8(output_col, vreinterpret_u8_u32(col04.val[0]));
+      vst1_u8(output_col + output_stride, vreinterpret_u8_u32(col15.val[0]));
+      vst1_u8(output_col + 2 * output_stride,
+              vreinterpret_u8_u32(col26.val[0]));
+      vst1_u8(output_col + 3 * output_stride,
+              vreinterpret_u8_u32(col37.val[0]));
+      vst1_u8(output_col + 4 * output_stride,
+              vreinterpret_u8_u32(col04.val[1]));
+      vst1_u8(output_col + 5 * output_stride,
+              vreinterpret_u8_u32(col15.val[1]));
+      vst1_u8(output_col + 6 * output_stride,
+              vreinterpret_u8_u32(col26.val[1]));
+      vst1_u8(output_col + 7 * output_stride,
+              vreinterpret_u8_u32(col37.val[1]));
+    }
+    TransposeTileScalar(8, cols - c, input_ptr + c, input_stride,
+                        output_ptr + c * output_stride, output_stride);
+  }
+  TransposeTileScalar(rows - r, cols, input + r * input_stride, input_stride,
+                      output + r, output_stride);
+}
+#endif  // USE_NEON
+
+// Only the size of the elements matters to a transpose, so all types are
+// moved as unsigned integers of the same size to share the kernels above.
+template <typename T>
+struct TransposeStorageType {
+  using type = T;
+};
+template <>
+struct TransposeStorageType<int8_t> {
+  using type = uint8_t;
+};
+template <>
+struct TransposeStorageType<float> {
+  using type = uint32_t;
+};
+template <>
+struct TransposeStorageType<int32_t> {
+  using type = uint32_t;
+};
+
+// Runs the units of work in [start_unit, end_unit) of `plan`.
+template <typename T>
+void TransposeImpl(const TransposePlan& plan, const T* input_data,
+                   T* output_data, int start_unit, int end_unit) {
+  using Storage = typename TransposeStorageType<T>::type;
+  static_assert(sizeof(Storage) == sizeof(T), "");
+  const Storage* input = reinterpret_cast<const Storage*>(input_data);
+  Storage* output = reinterpret_cast<Storage*>(output_data);
+
+  // Position in the outer loop of the first unit.
+  int index[kTransposeMaxDimensions];
+  int input_offset = 0;
+  int output_offset = 0;
+  int outer_index = start_unit / plan.row_blocks;
+  for (int i = plan.outer_rank - 1; i >= 0; --i) {
+    index[i] = outer_index % plan.outer_sizes[i];
+    outer_index /= plan.outer_sizes[i];
+    input_offset += index[i] * plan.outer_input_strides[i];
+    output_offset += index[i] * plan.outer_output_strides[i];
+  }
+
+  int row_block = start_unit % plan.row_blocks;
+  for (int unit = start_unit; unit < end_unit; ++unit) {
+    if (plan.is_copy) {
+      memcpy(output + output_offset, input + input_offset,
+             plan.cols * sizeof(Storage));
+    } else {
+      const int row = row_block * kTransposeRowBlock;
+      TransposeTile(std::min(kTransposeRowBlock, plan.rows - row), plan.cols,
+                    input + input_offset + row * plan.input_row_stride,
+                    plan.input_row_stride, output + output_offset + row,
+                    plan.output_col_stride);
+    }
+    if (++row_block < plan.row_blocks) continue;
+    row_block = 0;
+    for (int i = plan.outer_rank - 1; i >= 0; --i) {
+      input_offset += plan.outer_input_strides[i];
+      output_offset += plan.outer_output_strides[i];
+      if (++index[i] < plan.outer_sizes[i]) break;
+      input_offset -= plan.outer_sizes[i] * plan.outer_input_strides[i];
+      output_offset -= plan.outer_sizes[i] * plan.outer_output_strides[i];
+      index[i] = 0;
+    }
+  }
+}
+
+}  // namespace transpose_utils
+}  // namespace optimized_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_TRANSPOSE_UTILS_H_
@@ -0,0 +1,622 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_VECTOR_MATH_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_VECTOR_MATH_H_
+
+// Vectorized polynomial approximations of the float transcendental functions
+// used by the activation kernels.
+//
+// Every function is written once against a small set of SIMD primitives and
+// instantiated for AVX2+FMA (8 lanes), SSE2 (4 lanes, using SSE4.1 rounding
+// and blends where available), NEON (4 lanes) and a portable scalar fallback,
+// which is also used for the tail of each array. The selection is made at
+// compile time from the target flags, so a build with -mavx2 -mfma gets the
+// 8-lane code and any x86-64 build gets at least the 4-lane code. Unlike most
+// of the optimized kernels, the x86 paths use native SSE and AVX intrinsics
+// rather than the NEON_2_SSE translation layer, which requires SSE4.1.
+//
+// Maximum errors relative to the correctly rounded result, as checked against
+// a double precision reference by vector_math_test.cc:
+//
+//   Exp       2 ULP   (including subnormal results)
+//   Log       2 ULP
+//   Logistic  3 ULP
+//   Tanh      2 ULP
+//
+// The ARMv7 NEON path has no division instruction and uses two Newton-Raphson
+// refinement steps on the reciprocal estimate instead, which adds up to 1 ULP
+// to Logistic and Tanh. NaN inputs produce NaN outputs on all paths.
+
+#include <stdint.h>
+#include <string.h>
+
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#define TFLITE_VECTOR_MATH_USE_AVX2
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TFLITE_VECTOR_MATH_USE_SSE
+#include <emmintrin.h>
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define TFLITE_VECTOR_MATH_USE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace tflite {
+namespace vector_math {
+namespace detail {
+
+// Range reduction constants for exp: ln(2) is split into a high part with few
+// mantissa bits, so that n * kLn2Hi is exact, and a low correction term.
+constexpr float kLog2e = 1.44269504088896341f;
+constexpr float kLn2Hi = 0.693359375f;
+constexpr float kLn2Lo = -2.12194440e-4f;
+// Below kExpLowerBound the result is 0 even as a subnormal, above
+// kExpUpperBound it is +inf. Clamping to these keeps the exponent arithmetic
+// in range.
+constexpr float kExpLowerBound = -104.0f;
+constexpr float kExpUpperBound = 89.0f;
+// Minimax coefficients of e^r on [-ln(2)/2, ln(2)/2] (Cephes expf).
+constexpr float kExpP0 = 1.9875691500e-4f;
+constexpr float kExpP1 = 1.3981999507e-3f;
+constexpr float kExpP2 = 8.3334519073e-3f;
+constexpr float kExpP3 = 4.1665795894e-2f;
+constexpr float kExpP4 = 1.6666665459e-1f;
+constexpr float kExpP5 = 5.0000001201e-1f;
+
+// Coefficients of log(1 + m) for m in [sqrt(0.5) - 1, sqrt(2) - 1] (Cephes
+// logf).
+constexpr float kSqrtHalf = 0.707106781186547524f;
+constexpr float kLogP0 = 7.0376836292e-2f;
+constexpr float kLogP1 = -1.1514610310e-1f;
+constexpr float kLogP2 = 1.1676998740e-1f;
+constexpr float kLogP3 = -1.2420140846e-1f;
+constexpr float kLogP4 = 1.4249322787e-1f;
+constexpr float kLogP5 = -1.6668057665e-1f;
+constexpr float kLogP6 = 2.0000714765e-1f;
+constexpr float kLogP7 = -2.4999993993e-1f;
+constexpr float kLogP8 = 3.3333331174e-1f;
+// Subnormal inputs to log are scaled up by 2^25 before the exponent is taken
+// apart.
+constexpr float kLogSubnormalScale = 33554432.0f;
+constexpr float kLogSubnormalExponent = 25.0f;
+
+// Below kTanhSmallThreshold tanh is evaluated as an odd polynomial, above it
+// through exp. Above kTanhSaturation tanh(x) rounds to 1.
+constexpr float kTanhSmallThreshold = 0.625f;
+constexpr float kTanhSaturation = 10.0f;
+// Coefficients of (tanh(x) - x) / x^3 in x^2 on [0, 0.625] (Cephes tanhf).
+constexpr float kTanhP0 = -5.70498872745e-3f;
+constexpr float kTanhP1 = 2.06390887954e-2f;
+constexpr float kTanhP2 = -5.37397155531e-2f;
+constexpr float kTanhP3 = 1.33314422036e-1f;
+constexpr float kTanhP4 = -3.33332819422e-1f;
+
+// Primitives for one lane of float, used for the portable fallback and for the
+// elements left over after the SIMD loops.
+struct PortableOps {
+  typedef float Float;
+  typedef int32_t Int;
+  typedef bool Mask;
+  static constexpr int kLanes = 1;
+
+  static Float Load(const float* p) { return *p; }
+  static void Store(float* p, Float v) { *p = v; }
+  static Float Set(float v) { return v; }
+  static Int SetInt(int32_t v) { return v; }
+
+  static Float Add(Float a, Float b) { return a + b; }
+  static Float Sub(Float a, Float b) { return a - b; }
+  static Float Mul(Float a, Float b) { return a * b; }
+  static Float Div(Float a, Float b) { return a / b; }
+  static Float MulAdd(Float a, Float b, Float c) { return a * b + c; }
+  // Like the SSE instructions, return b if either operand is NaN.
+  static Float Min(Float a, Float b) { return a < b ? a : b; }
+  static Float Max(Float a, Float b) { return a > b ? a : b; }
+  static Float Floor(Float a) { return std::floor(a); }
+  static Float Abs(Float a) { return std::fabs(a); }
+  static Float CopySign(Float magnitude, Float sign) {
+    return std::copysign(magnitude, sign);
+  }
+
+  static Mask Less(Float a, Float b) { return a < b; }
+  static Mask Equal(Float a, Float b) { return a == b; }
+  static Mask GreaterEqual(Float a, Float b) { return a >= b; }
+  static Float Select(Mask m, Float a, Float b) { return m ? a : b; }
+
+  static Int BitCastToInt(Float a) {
+    Int result;
+    memcpy(&result, &a, sizeof(result));
+    return result;
+  }
+  static Float BitCastToFloat(Int a) {
+    Float result;
+    memcpy(&result, &a, sizeof(result));
+    return result;
+  }
+  // Like vcvtq_s32_f32, saturate out-of-range values and map NaN to 0, where a
+  // plain cast is undefined.
+  static Int TruncateToInt(Float a) {
+    if (std::isnan(a)) return 0;
+    if (a >= 2147483648.0f) return std::numeric_limits<Int>::max();
+    if (a < -2147483648.0f) return std::numeric_limits<Int>::min();
+    return static_cast<Int>(a);
+  }
+  static Float ConvertToFloat(Int a) { return static_cast<Float>(a); }
+  static Int AddInt(Int a, Int b) { return a + b; }
+  static Int SubInt(Int a, Int b) { return a - b; }
+  static Int AndInt(Int a, Int b) { return a & b; }
+  static Int OrInt(Int a, Int b) { return a | b; }
+  template <int kShift>
+  static Int ShiftLeft(Int a) {
+    return static_cast<Int>(static_cast<uint32_t>(a) << kShift);
+  }
+  template <int kShift>
+  static Int ShiftRightLogical(Int a) {
+    return static_cast<Int>(static_cast<uint32_t>(a) >> kShift);
+  }
+  template <int kShift>
+  static Int ShiftRightArithmetic(Int a) {
+    // Floor division rather than >> to stay clear of implementation-defined
+    // behavior on negative values.
+    return a >= 0 ? a / (1 << kShift)
+                  : -((-a + (1 << kShift) - 1) / (1 << kShift));
+  }
+};
+
+#ifdef TFLITE_VECTOR_MATH_USE_AVX2
+struct Avx2Ops {
+  typedef __m256 Float;
+  typedef __m256i Int;
+  typedef __m256 Mask;
+  static constexpr int kLanes = 8;
+
+  static Float Load(const float* p) { return _mm256_loadu_ps(p); }
+  static void Store(float* p, Float v) { _mm256_storeu_ps(p, v); }
+  static Float Set(float v) { return _mm256_set1_ps(v); }
+  static Int SetInt(int32_t v) { return _mm256_set1_epi32(v); }
+
+  static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+  static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+  static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+  static Float Div(Float a, Float b) { return _mm256_div_ps(a, b); }
+  static Float MulAdd(Float a, Float b, Float c) {
+    return _mm256_fmadd_ps(a, b, c);
+  }
+  static Float Min(Float a, Float b) { return _mm256_min_ps(a, b); }
+  static Float Max(Float a, Float b) { return _mm256_max_ps(a, b); }
+  static Float Floor(Float a) { return _mm256_floor_ps(a); }
+  static Float Abs(Float a) {
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+  }
+  static Float CopySign(Float magnitude, Float sign) {
+    const Float sign_mask = _mm256_set1_ps(-0.0f);
+    return _mm256_or_ps(_mm256_andnot_ps(sign_mask, magnitude),
+                        _mm256_and_ps(sign_mask, sign));
+  }
+
+  static Mask Less(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+  static Mask Equal(Float a, Float b) {
+    return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+  }
+  static Mask GreaterEqual(Float a, Float b) {
+    return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+  }
+  static Float Select(Mask m, Float a, Float b) {
+    return _mm256_blendv_ps(b, a, m);
+  }
+
+  static Int BitCastToInt(Float a) { return _mm256_castps_si256(a); }
+  static Float BitCastToFloat(Int a) { return _mm256_castsi256_ps(a); }
+  static Int TruncateToInt(Float a) { return _mm256_cvttps_epi32(a); }
+  static Float ConvertToFloat(Int a) { return _mm256_cvtepi32_ps(a); }
+  static Int AddInt(Int a, Int b) { return _mm256_add_epi32(a, b); }
+  static Int SubInt(Int a, Int b) { return _mm256_sub_epi32(a, b); }
+  static Int AndInt(Int a, Int b) { return _mm256_and_si256(a, b); }
+  static Int OrInt(Int a, Int b) { return _mm256_or_si256(a, b); }
+  template <int kShift>
+  static Int ShiftLeft(Int a) {
+    return _mm256_slli_epi32(a, kShift);
+  }
+  template <int kShift>
+  static Int ShiftRightLogical(Int a) {
+    return _mm256_srli_epi32(a, kShift);
+  }
+  template <int kShift>
+  static Int ShiftRightArithmetic(Int a) {
+    return _mm256_srai_epi32(a, kShift);
+  }
+};
+#endif  // TFLITE_VECTOR_MATH_USE_AVX2
+
+#ifdef TFLITE_VECTOR_MATH_USE_SSE
+struct SseOps {
+  typedef __m128 Float;
+  typedef __m128i Int;
+  typedef __m128 Mask;
+  static constexpr int kLanes = 4;
+
+  static Float Load(const float* p) { return _mm_loadu_ps(p); }
+  static void Store(float* p, Float v) { _mm_storeu_ps(p, v); }
+  static Float Set(float v) { return _mm_set1_ps(v); }
+  static Int SetInt(int32_t v) { return _mm_set1_epi32(v); }
+
+  static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+  static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+  static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+  static Float Div(Float a, Float b) { return _mm_div_ps(a, b); }
+  static Float MulAdd(Float a, Float b, Float c) {
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+  }
+  static Float Min(Float a, Float b) { return _mm_min_ps(a, b); }
+  static Float Max(Float a, Float b) { return _mm_max_ps(a, b); }
+  static Float Floor(Float a) {
+#ifdef __SSE4_1__
+    return _mm_floor_ps(a);
+#else
+    // Truncation rounds negative values up, so correct those by one. Only
+    // used on values well within the int32 range.
+    const Float truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+    return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, a),
+                                            _mm_set1_ps(1.0f)));
+#endif
+  }
+  static Float Abs(Float a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+  static Float CopySign(Float magnitude, Float sign) {
+    const Float sign_mask = _mm_set1_ps(-0.0f);
+    return _mm_or_ps(_mm_andnot_ps(sign_mask, magnitude),
+                     _mm_and_ps(sign_mask, sign));
+  }
+
+  static Mask Less(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+  static Mask Equal(Float a, Float b) { return _mm_cmpeq_ps(a, b); }
+  static Mask GreaterEqual(Float a, Float b) { return _mm_cmpge_ps(a, b); }
+  static Float Select(Mask m, Float a, Float b) {
+#ifdef __SSE4_1__
+    return _mm_blendv_ps(b, a, m);
+#else
+    return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+#endif
+  }
+
+  static Int BitCastToInt(Float a) { return _mm_castps_si128(a); }
+  static Float BitCastToFloat(Int a) { return _mm_castsi128_ps(a); }
+  static Int TruncateToInt(Float a) { return _mm_cvttps_epi32(a); }
+  static Float ConvertToFloat(Int a) { return _mm_cvtepi32_ps(a); }
+  static Int AddInt(Int a, Int b) { return _mm_add_epi32(a, b); }
+  static Int SubInt(Int a, Int b) { return _mm_sub_epi32(a, b); }
+  static Int AndInt(Int a, Int b) { return _mm_and_si128(a, b); }
+  static Int OrInt(Int a, Int b) { return _mm_or_si128(a, b); }
+  template <int kShift>
+  static Int ShiftLeft(Int a) {
+    return _mm_slli_epi32(a, kShift);
+  }
+  template <int kShift>
+  static Int ShiftRightLogical(Int a) {
+    return _mm_srli_epi32(a, kShift);
+  }
+  template <int kShift>
+  static Int ShiftRightArithmetic(Int a) {
+    return _mm_srai_epi32(a, kShift);
+  }
+};
+#endif  // TFLITE_VECTOR_MATH_USE_SSE
+
+#ifdef TFLITE_VECTOR_MATH_USE_NEON
+struct NeonOps {
+  typedef float32x4_t Float;
+  typedef int32x4_t Int;
+  typedef uint32x4_t Mask;
+  static constexpr int kLanes = 4;
+
+  static Float Load(const float* p) { return vld1q_f32(p); }
+  static void Store(float* p, Float v) { vst1q_f32(p, v); }
+  static Float Set(float v) { return vdupq_n_f32(v); }
+  static Int SetInt(int32_t v) { return vdupq_n_s32(v); }
+
+  static Float Add(Float a, Float b) { return vaddq_f32(a, b); }
+  static Float Sub(Float a, Float b) { return vsubq_f32(a, b); }
+  static Float Mul(Float a, Float b) { return vmulq_f32(a, b); }
+  static Float Div(Float a, Float b) {
+#ifdef __aarch64__
+    return vdivq_f32(a, b);
+#else
+    Float reciprocal = vrecpeq_f32(b);
+    reciprocal = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+    reciprocal = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+    return vmulq_f32(a, reciprocal);
+#endif
+  }
+  static Float MulAdd(Float a, Float b, Float c) {
+#ifdef __aarch64__
+    return vfmaq_f32(c, a, b);
+#else
+    return vmlaq_f32(c, a, b);
+#endif
+  }
+  static Float Min(Float a, Float b) { return vminq_f32(a, b); }
+  static Float Max(Float a, Float b) { return vmaxq_f32(a, b); }
+  static Float Floor(Float a) {
+#ifdef __aarch64__
+    return vrndmq_f32(a);
+#else
+    // Truncation rounds negative values up, so correct those by one. Only
+    // used on values well within the int32 range.
+    const Float truncated = vcvtq_f32_s32(vcvtq_s32_f32(a));
+    const Mask too_large = vcgtq_f32(truncated, a);
+    return vsubq_f32(truncated,
+                     vreinterpretq_f32_u32(vandq_u32(
+                         too_large, vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+#endif
+  }
+  static Float Abs(Float a) { return vabsq_f32(a); }
+  static Float CopySign(Float magnitude, Float sign) {
+    return vbslq_f32(vdupq_n_u32(0x80000000u), sign, magnitude);
+  }
+
+  static Mask Less(Float a, Float b) { return vcltq_f32(a, b); }
+  static Mask Equal(Float a, Float b) { return vceqq_f32(a, b); }
+  static Mask GreaterEqual(Float a, Float b) { return vcgeq_f32(a, b); }
+  static Float Select(Mask m, Float a, Float b) { return vbslq_f32(m, a, b); }
+
+  static Int BitCastToInt(Float a) { return vreinterpretq_s32_f32(a); }
+  static Float BitCastToFloat(Int a) { return vreinterpretq_f32_s32(a); }
+  static Int TruncateToInt(Float a) { return vcvtq_s32_f32(a); }
+  static Float ConvertToFloat(Int a) { return vcvtq_f32_s32(a); }
+  static Int AddInt(Int a, Int b) { return vaddq_s32(a, b); }
+  static Int SubInt(Int a, Int b) { return vsubq_s32(a, b); }
+  static Int AndInt(Int a, Int b) { return vandq_s32(a, b); }
+  static Int OrInt(Int a, Int b) { return vorrq_s32(a, b); }
+  template <int kShift>
+  static Int ShiftLeft(Int a) {
+    return vshlq_n_s32(a, kShift);
+  }
+  template <int kShift>
+  static Int ShiftRightLogical(Int a) {
+    return vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(a), kShift));
+  }
+  template <int kShift>
+  static Int ShiftRightArithmetic(Int a) {
+    return vshrq_n_s32(a, kShift);
+  }
+};
+#endif  // TFLITE_VECTOR_MATH_USE_NEON
+
+// Returns 2^n for integral n in [-126, 127].
+template <typename Ops>
+inline typename Ops::Float Pow2(typename Ops::Int n) {
+  return Ops::BitCastToFloat(
+      Ops::template ShiftLeft<23>(Ops::AddInt(n, Ops::SetInt(127))));
+}
+
+template <typename Ops>
+inline typename Ops::Float ExpImpl(typename Ops::Float x) {
+  typedef typename Ops::Float Float;
+  typedef typename Ops::Int Int;
+  // Min and Max return their second operand if either is NaN, so a NaN x
+  // propagates through to the result.
+  const Float clamped = Ops::Min(Ops::Set(kExpUpperBound),
+                                 Ops::Max(Ops::Set(kExpLowerBound), x));
+  // exp(x) = 2^n * exp(r) with n = round(x / ln(2)), |r| <= ln(2) / 2.
+  const Float n = Ops::Floor(
+      Ops::MulAdd(clamped, Ops::Set(kLog2e), Ops::Set(0.5f)));
+  Float r = Ops::MulAdd(n, Ops::Set(-kLn2Hi), clamped);
+  r = Ops::MulAdd(n, Ops::Set(-kLn2Lo), r);
+
+  Float p = Ops::Set(kExpP0);
+  p = Ops::MulAdd(p, r, Ops::Set(kExpP1));
+  p = Ops::MulAdd(p, r, Ops::Set(kExpP2));
+  p = Ops::MulAdd(p, r, Ops::Set(kExpP3));
+  p = Ops::MulAdd(p, r, Ops::Set(kExpP4));
+  p = Ops::MulAdd(p, r, Ops::Set(kExpP5));
+  p = Ops::MulAdd(p, Ops::Mul(r, r), Ops::Add(r, Ops::Set(1.0f)));
+
+  // n lies in [-150, 128], outside the range of normal exponents, so scale by
+  // 2^n in two halves. This yields correctly rounded subnormals and +inf on
+  // overflow without further special-casing.
+  const Int n_int = Ops::TruncateToInt(n);
+  const Int n_half = Ops::template ShiftRightArithmetic<1>(n_int);
+  return Ops::Mul(Ops::Mul(p, Pow2<Ops>(n_half)),
+                  Pow2<Ops>(Ops::SubInt(n_int, n_half)));
+}
+
+template <typename Ops>
+inline typename Ops::Float LogImpl(typename Ops::Float x) {
+  typedef typename Ops::Float Float;
+  typedef typename Ops::Int Int;
+  const Float zero = Ops::Set(0.0f);
+  const Float one = Ops::Set(1.0f);
+
+  const typename Ops::Mask is_subnormal =
+      Ops::Less(x, Ops::Set(std::numeric_limits<float>::min()));
+  const Float scaled =
+      Ops::Select(is_subnormal, Ops::Mul(x, Ops::Set(kLogSubnormalScale)), x);
+
+  // Split x = m * 2^e with m in [0.5, 1).
+  const Int bits = Ops::BitCastToInt(scaled);
+  Float e = Ops::ConvertToFloat(Ops::SubInt(
+      Ops::template ShiftRightLogical<23>(bits), Ops::SetInt(126)));
+  e = Ops::Sub(e, Ops::Select(is_subnormal, Ops::Set(kLogSubnormalExponent),
+                              zero));
+  Float m = Ops::BitCastToFloat(
+      Ops::OrInt(Ops::AndInt(bits, Ops::SetInt(0x007fffff)),
+                 Ops::SetInt(0x3f000000)));
+
+  // Move m into [sqrt(0.5), sqrt(2)) and compute log(1 + m) around 0.
+  const typename Ops::Mask is_small = Ops::Less(m, Ops::Set(kSqrtHalf));
+  e = Ops::Sub(e, Ops::Select(is_small, one, zero));
+  m = Ops::Sub(Ops::Add(m, Ops::Select(is_small, m, zero)), one);
+
+  const Float m2 = Ops::Mul(m, m);
+  Float p = Ops::Set(kLogP0);
+  p = Ops::MulAdd(p, m, Ops::Set(kLogP1));
+  p = Ops::MulAdd(p, m, Ops::Set(kLogP2));
+  p = Ops::MulAdd(p, m, Ops::Set(kLogP3));
+  p = Ops::MulAdd(p, m, Ops::Set(kLogP4));
+  p = Ops::MulAdd(p, m, Ops::Set(kLogP5));
+  p = Ops::MulAdd(p, m, Ops::Set(kLogP6));
+  p = Ops::MulAdd(p, m, Ops::Set(kLogP7));
+  p = Ops::MulAdd(p, m, Ops::Set(kLogP8));
+  p = Ops::Mul(Ops::Mul(p, m), m2);
+  p = Ops::MulAdd(e, Ops::Set(kLn2Lo), p);
+  p = Ops::MulAdd(m2, Ops::Set(-0.5f), p);
+  Float result = Ops::Add(m, p);
+  result = Ops::MulAdd(e, Ops::Set(kLn2Hi), result);
+
+  const float kInfinity = std::numeric_limits<float>::infinity();
+  result = Ops::Select(Ops::Equal(x, Ops::Set(kInfinity)), x, result);
+  result = Ops::Select(Ops::Equal(x, zero), Ops::Set(-kInfinity), result);
+  return Ops::Select(Ops::GreaterEqual(x, zero), result,
+                     Ops::Set(std::numeric_limits<float>::quiet_NaN()));
+}
+
+template <typename Ops>
+inline typename Ops::Float LogisticImpl(typename Ops::Float x) {
+  typedef typename Ops::Float Float;
+  // With e = exp(-|x|), logistic(x) is 1 / (1 + e) for positive x and
+  // e / (1 + e) for negative x. Taking exp of a non-positive argument keeps it
+  // from overflowing where the result is still a representable subnormal.
+  const Float one = Ops::Set(1.0f);
+  const Float e = ExpImpl<Ops>(Ops::Sub(Ops::Set(0.0f), Ops::Abs(x)));
+  const Float numerator =
+      Ops::Select(Ops::Less(x, Ops::Set(0.0f)), e, one);
+  return Ops::Div(numerator, Ops::Add(one, e));
+}
+
+template <typename Ops>
+inline typename Ops::Float TanhImpl(typename Ops::Float x) {
+  typedef typename Ops::Float Float;
+  // tanh is odd, so work on |x| and restore the sign at the end.
+  const Float abs_x = Ops::Abs(x);
+
+  // tanh(x) = x + x^3 * P(x^2) close to 0, where 1 - 2 / (exp(2x) + 1) would
+  // lose precision to cancellation.
+  const Float x2 = Ops::Mul(abs_x, abs_x);
+  Float p = Ops::Set(kTanhP0);
+  p = Ops::MulAdd(p, x2, Ops::Set(kTanhP1));
+  p = Ops::MulAdd(p, x2, Ops::Set(kTanhP2));
+  p = Ops::MulAdd(p, x2, Ops::Set(kTanhP3));
+  p = Ops::MulAdd(p, x2, Ops::Set(kTanhP4));
+  const Float small_result = Ops::MulAdd(Ops::Mul(p, x2), abs_x, abs_x);
+
+  const Float one = Ops::Set(1.0f);
+  const Float exp_2x = ExpImpl<Ops>(
+      Ops::Mul(Ops::Min(Ops::Set(kTanhSaturation), abs_x), Ops::Set(2.0f)));
+  const Float large_result =
+      Ops::Sub(one, Ops::Div(Ops::Set(2.0f), Ops::Add(exp_2x, one)));
+
+  return Ops::CopySign(
+      Ops::Select(Ops::Less(abs_x, Ops::Set(kTanhSmallThreshold)),
+                  small_result, large_result),
+      x);
+}
+
+// Applies Functor::Apply to every element of input, using the widest SIMD
+// primitives available and the portable ones for the remainder.
+template <typename Functor>
+inline void ApplyToVector(const float* input, size_t size, float* output) {
+  size_t i = 0;
+#ifdef TFLITE_VECTOR_MATH_USE_AVX2
+  for (; i + Avx2Ops::kLanes <= size; i += Avx2Ops::kLanes) {
+    Avx2Ops::Store(output + i,
+                   Functor::template Apply<Avx2Ops>(Avx2Ops::Load(input + i)));
+  }
+#endif
+#ifdef TFLITE_VECTOR_MATH_USE_SSE
+  for (; i + SseOps::kLanes <= size; i += SseOps::kLanes) {
+    SseOps::Store(output + i,
+                  Functor::template Apply<SseOps>(SseOps::Load(input + i)));
+  }
+#endif
+#ifdef TFLITE_VECTOR_MATH_USE_NEON
+  for (; i + NeonOps::kLanes <= size; i += NeonOps::kLanes) {
+    NeonOps::Store(output + i,
+                   Functor::template Apply<NeonOps>(NeonOps::Load(input + i)));
+  }
+#endif
+  for (; i < size; ++i) {
+    output[i] = Functor::template Apply<PortableOps>(input[i]);
+  }
+}
+
+struct ExpFunctor {
+  template <typename Ops>
+  static typename Ops::Float Apply(typename Ops::Float x) {
+    return ExpImpl<Ops>(x);
+  }
+};
+
+struct LogFunctor {
+  template <typename Ops>
+  static typename Ops::Float Apply(typename Ops::Float x) {
+    return LogImpl<Ops>(x);
+  }
+};
+
+struct LogisticFunctor {
+  template <typename Ops>
+  static typename Ops::Float Apply(typename Ops::Float x) {
+    return LogisticImpl<Ops>(x);
+  }
+};
+
+struct TanhFunctor {
+  template <typename Ops>
+  static typename Ops::Float Apply(typename Ops::Float x) {
+    return TanhImpl<Ops>(x);
+  }
+};
+
+}  // namespace detail
+
+// Each function below reads `size` floats from `input` and writes the results
+// to `output`. The two may alias exactly, for in-place evaluation.
+
+inline void Exp(const float* input, size_t size, float* output) {
+  detail::ApplyToVector<detail::ExpFunctor>(input, size, output);
+}
+
+inline void Log(const float* input, size_t size, float* output) {
+  detail::ApplyToVector<detail::LogFunctor>(input, size, output);
+}
+
+inline void Logistic(const float* input, size_t size, float* output) {
+  detail::ApplyToVector<detail::LogisticFunctor>(input, size, output);
+}
+
+inline void Tanh(const float* input, size_t size, float* output) {
+  detail::ApplyToVector<detail::TanhFunctor>(input, size, output);
+}
+
+// Scalar versions, computing bit-identical results to the portable path.
+inline float Exp(float x) { return detail::ExpImpl<detail::PortableOps>(x); }
+inline float Log(float x) { return detail::LogImpl<detail::PortableOps>(x); }
+inline float Logistic(float x) {
+  return detail::LogisticImpl<detail::PortableOps>(x);
+}
+inline float Tanh(float x) { return detail::TanhImpl<detail::PortableOps>(x); }
+
+}  // namespace vector_math
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_VECTOR_MATH_H_
@@ -0,0 +1,105 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_REFERENCE_BATCH_MATMUL_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_REFERENCE_BATCH_MATMUL_H_
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace reference_ops {
+namespace batch_matmul {
+
+// Returns the distance between consecutive matrices of `shape`, an extended
+// 5D shape, along batch dimension `dim`, or 0 if that dimension is
+// broadcast.
+inline int BatchStride(const RuntimeShape& shape, int dim) {
+  if (shape.Dims(dim) == 1) {
+    return 0;
+  }
+  int stride = 1;
+  for (int i = dim + 1; i < 5; ++i) {
+    stride *= shape.Dims(i);
+  }
+  return stride;
+}
+
+}  // namespace batch_matmul
+
+// Multiplies the matrices in the two innermost dimensions of lhs and rhs,
+// broadcasting the (up to three) outer batch dimensions against each other.
+template <typename T>
+inline void BatchMatMul(const BatchMatMulParams& params,
+                        const RuntimeShape& lhs_shape, const T* lhs_data,
+                        const RuntimeShape& rhs_shape, const T* rhs_data,
+                        const RuntimeShape& output_shape, T* output_data) {
+  TFLITE_DCHECK_LE(lhs_shape.DimensionsCount(), 5);
+  TFLITE_DCHECK_LE(rhs_shape.DimensionsCount(), 5);
+  TFLITE_DCHECK_LE(output_shape.DimensionsCount(), 5);
+  const RuntimeShape extended_lhs_shape =
+      RuntimeShape::ExtendedShape(5, lhs_shape);
+  const RuntimeShape extended_rhs_shape =
+      RuntimeShape::ExtendedShape(5, rhs_shape);
+  const RuntimeShape extended_output_shape =
+      RuntimeShape::ExtendedShape(5, output_shape);
+
+  const int lhs_rows = extended_lhs_shape.Dims(params.adj_x ? 4 : 3);
+  const int accum_depth = extended_lhs_shape.Dims(params.adj_x ? 3 : 4);
+  const int rhs_cols = extended_rhs_shape.Dims(params.adj_y ? 3 : 4);
+  TFLITE_DCHECK_EQ(accum_depth, extended_rhs_shape.Dims(params.adj_y ? 4 : 3));
+  TFLITE_DCHECK_EQ(lhs_rows, extended_output_shape.Dims(3));
+  TFLITE_DCHECK_EQ(rhs_cols, extended_output_shape.Dims(4));
+
+  // Strides of the elements of one matrix.
+  const int lhs_row_stride = params.adj_x ? 1 : accum_depth;
+  const int lhs_depth_stride = params.adj_x ? lhs_rows : 1;
+  const int rhs_col_stride = params.adj_y ? accum_depth : 1;
+  const int rhs_depth_stride = params.adj_y ? 1 : rhs_cols;
+
+  const int lhs_stride0 = batch_matmul::BatchStride(extended_lhs_shape, 0);
+  const int lhs_stride1 = batch_matmul::BatchStride(extended_lhs_shape, 1);
+  const int lhs_stride2 = batch_matmul::BatchStride(extended_lhs_shape, 2);
+  const int rhs_stride0 = batch_matmul::BatchStride(extended_rhs_shape, 0);
+  const int rhs_stride1 = batch_matmul::BatchStride(extended_rhs_shape, 1);
+  const int rhs_stride2 = batch_matmul::BatchStride(extended_rhs_shape, 2);
+
+  T* output_ptr = output_data;
+  for (int b0 = 0; b0 < extended_output_shape.Dims(0); ++b0) {
+    for (int b1 = 0; b1 < extended_output_shape.Dims(1); ++b1) {
+      for (int b2 = 0; b2 < extended_output_shape.Dims(2); ++b2) {
+        const T* lhs_ptr = lhs_data + b0 * lhs_stride0 + b1 * lhs_stride1 +
+                           b2 * lhs_stride2;
+        const T* rhs_ptr = rhs_data + b0 * rhs_stride0 + b1 * rhs_stride1 +
+                           b2 * rhs_stride2;
+        for (int i = 0; i < lhs_rows; ++i) {
+          for (int j = 0; j < rhs_cols; ++j) {
+            T total = 0;
+            for (int k = 0; k < accum_depth; ++k) {
+              total += lhs_ptr[i * lhs_row_stride + k * lhs_depth_stride] *
+                       rhs_ptr[j * rhs_col_stride + k * rhs_depth_stride];
+            }
+            *output_ptr++ = total;
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace reference_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_REFERENCE_BATCH_MATMUL_H_
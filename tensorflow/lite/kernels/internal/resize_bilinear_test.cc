@@ -14,6 +14,7 @@ limitations under the License.
 ==============================================================================*/
 #include <algorithm>
 #include <cmath>
+#include <type_traits>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -41,8 +42,10 @@ void TestOneResizeBilinear(int batch, int depth, int input_width,
   // issue with kernels failing to initialize the output.
   std::vector<T> output_data(output_buffer_size, 3);
 
-  const T min_amplitude = static_cast<T>(0);
-  const T max_amplitude = static_cast<T>(255);
+  const T min_amplitude =
+      std::is_same<T, int8>::value ? static_cast<T>(-128) : static_cast<T>(0);
+  const T max_amplitude =
+      std::is_same<T, int8>::value ? static_cast<T>(127) : static_cast<T>(255);
   FillRandom(&input_data, min_amplitude, max_amplitude);
 
   RuntimeShape output_size_dims({1, 1, 1, 2});
@@ -91,6 +94,22 @@ TEST(ResizeBilinear, TestResizeBilinear8Bit) {
   }
 }
 
+TEST(ResizeBilinear, TestResizeBilinearInt8) {
+  RandomEngine().seed(38291);
+  const int kTestsToRun = 1000;
+  for (int i = 0; i < kTestsToRun; i++) {
+    const int batch = UniformRandomInt(1, 2);
+    const int depth = ExponentialRandomPositiveInt(0.9f, 6, 50);
+    const int input_width = ExponentialRandomPositiveInt(0.9f, 20, 200);
+    const int input_height = ExponentialRandomPositiveInt(0.9f, 20, 200);
+    const int output_width = ExponentialRandomPositiveInt(0.9f, 20, 200);
+    const int output_height = ExponentialRandomPositiveInt(0.9f, 20, 200);
+
+    TestOneResizeBilinear<int8>(batch, depth, input_width, input_height,
+                                output_width, output_height, 1e-5);
+  }
+}
+
 TEST(ResizeBilinear2x2, TestResizeBilinear8Bit) {
   RandomEngine().seed(38291);
   const int kTestsToRun = 1000;
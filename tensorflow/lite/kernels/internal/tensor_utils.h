@@ -100,6 +100,18 @@ void SparseMatrixBatchVectorMultiplyAccumulate(
     const float* scaling_factors, int n_batch, float* __restrict__ result,
     int result_stride);
 
+// Same as the function above, but for the fully integer LSTM: the vectors are
+// 8-bit quantized (possibly asymmetric, with the zero point folded into the
+// bias) and the matrix is symmetric quantized to [-127, 127].
+// The dot product of each row with each vector is added to bias[row] (if
+// bias is not null), rescaled with the fixed-point multiplier and shift (see
+// MultiplyByQuantizedMultiplier) and accumulated to the int32 result buffer,
+// which is laid out as [n_batch, m_rows].
+void MatrixBatchVectorMultiplyAccumulate(
+    const int8_t* __restrict__ matrix, int m_rows, int m_cols,
+    const int8_t* __restrict__ vectors, const int32_t* bias, int n_batch,
+    int32_t multiplier, int shift, int32_t* __restrict__ result);
+
 // Cwise product of two vectors.
 void VectorVectorCwiseProduct(const float* vector1, const float* vector2,
                               int v_size, float* result);
@@ -147,6 +147,30 @@ TEST(uKernels, MatrixBatchVectorMultiplyAccumulateTest) {
                                                -1., 3., 7., 3., 23., 3.})));
 }
 
+TEST(uKernels, QuantizedMatrixBatchVectorMultiplyAccumulateRescaleTest) {
+  // 19 columns exercise both the vectorized and the postamble loops.
+  constexpr int kRow = 2;
+  constexpr int kCol = 19;
+  constexpr int kBatch = 2;
+  static int8_t matrix[kRow * kCol] = {
+      -3,  -2,   -1,  0,    1,   2,    3,   -3,   -2,  -1,
+      0,   1,    2,   3,    -3,  -2,   -1,  0,    1,   //
+      127, -127, 127, -127, 127, -127, 127, -127, 127, -127,
+      127, -127, 127, -127, 127, -127, 127, -127, 127};
+  static int8_t vectors[kCol * kBatch] = {
+      -9,   -8,  -7,  -6,   -5,  -4,  -3,   -2,  -1,  0,
+      1,    2,   3,   4,    5,   6,   7,    8,   9,  //
+      -128, 100, 100, -128, 100, 100, -128, 100, 100, -128,
+      100,  100, -128, 100, 100, -128, 100, 100, -128};
+  static int32_t bias[kRow] = {10, -3};
+  std::vector<int32_t> output = {1, 2, 3, 4};
+  // Rescales the dot products by 0.5.
+  MatrixBatchVectorMultiplyAccumulate(matrix, kRow, kCol, vectors, bias,
+                                      kBatch, /*multiplier=*/1 << 30,
+                                      /*shift=*/0, output.data());
+  EXPECT_THAT(output, testing::ElementsAre(22, 1, -242, -8125));
+}
+
 struct MatrixVectorData {
   // Contains dense parameters.
   std::vector<int8_t> matrix;
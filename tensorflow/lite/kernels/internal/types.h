@@ -759,6 +759,13 @@ struct ArithmeticParams {
   int broadcast_shape[5];
 };
 
+struct BatchMatMulParams {
+  // Whether the inner two dimensions of the lhs and rhs are transposed
+  // (adjoint, for real types) before multiplying.
+  bool adj_x;
+  bool adj_y;
+};
+
 struct ConcatenationParams {
   int8 axis;
   const int32* input_zeropoint;
@@ -1013,7 +1020,8 @@ struct TanhParams {
 
 struct TransposeParams {
   int8 perm_count;
-  int32 perm[4];
+  // Reference kernels support up to 4 dimensions, optimized ones up to 6.
+  int32 perm[6];
 };
 
 struct UnpackParams {
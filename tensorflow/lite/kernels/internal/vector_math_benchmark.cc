@@ -0,0 +1,117 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Micro-benchmark of the vector_math functions against the std:: scalar
+// functions they replace. Prints the throughput of each function for a few
+// array sizes, e.g.
+//
+//   bazel run -c opt --copt=-mavx2 --copt=-mfma \
+//     //tensorflow/lite/kernels/internal:vector_math_benchmark
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/kernels/internal/optimized/vector_math.h"
+
+namespace tflite {
+namespace {
+
+typedef void (*VectorFunction)(const float*, size_t, float*);
+
+template <float (*kScalarFunction)(float)>
+void ApplyScalar(const float* input, size_t size, float* output) {
+  for (size_t i = 0; i < size; ++i) {
+    output[i] = kScalarFunction(input[i]);
+  }
+}
+
+float StdExp(float x) { return std::exp(x); }
+float StdLog(float x) { return std::log(x); }
+float StdLogistic(float x) { return 1.f / (1.f + std::exp(-x)); }
+float StdTanh(float x) { return std::tanh(x); }
+
+// Returns the time per element in nanoseconds, running `function` over
+// `input` repeatedly for at least `min_seconds`.
+double NanosecondsPerElement(VectorFunction function,
+                             const std::vector<float>& input,
+                             std::vector<float>* output, double min_seconds) {
+  typedef std::chrono::steady_clock Clock;
+  const size_t size = input.size();
+  // Warm up caches.
+  function(input.data(), size, output->data());
+  long long elements = 0;
+  const Clock::time_point start = Clock::now();
+  double elapsed = 0;
+  do {
+    for (int i = 0; i < 16; ++i) {
+      function(input.data(), size, output->data());
+    }
+    elements += 16LL * size;
+    elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+  } while (elapsed < min_seconds);
+  return elapsed * 1e9 / elements;
+}
+
+struct BenchmarkCase {
+  const char* name;
+  VectorFunction vectorized;
+  VectorFunction scalar;
+  float min_input;
+  float max_input;
+};
+
+void RunBenchmarks() {
+  const BenchmarkCase cases[] = {
+      {"Exp", vector_math::Exp, ApplyScalar<StdExp>, -20.f, 20.f},
+      {"Log", vector_math::Log, ApplyScalar<StdLog>, 1e-3f, 1e3f},
+      {"Logistic", vector_math::Logistic, ApplyScalar<StdLogistic>, -10.f,
+       10.f},
+      {"Tanh", vector_math::Tanh, ApplyScalar<StdTanh>, -5.f, 5.f},
+  };
+  const int sizes[] = {64, 1024, 16384, 262144};
+  const double kMinSeconds = 0.2;
+
+  std::mt19937 random_engine;
+  std::printf("%-10s %8s %14s %14s %8s\n", "function", "size", "vector ns/el",
+              "std ns/el", "speedup");
+  for (const BenchmarkCase& benchmark_case : cases) {
+    std::uniform_real_distribution<float> distribution(
+        benchmark_case.min_input, benchmark_case.max_input);
+    for (int size : sizes) {
+      std::vector<float> input(size);
+      for (float& value : input) {
+        value = distribution(random_engine);
+      }
+      std::vector<float> output(size);
+      const double vector_ns = NanosecondsPerElement(
+          benchmark_case.vectorized, input, &output, kMinSeconds);
+      const double scalar_ns = NanosecondsPerElement(
+          benchmark_case.scalar, input, &output, kMinSeconds);
+      std::printf("%-10s %8d %14.3f %14.3f %7.2fx\n", benchmark_case.name, size,
+                  vector_ns, scalar_ns, scalar_ns / vector_ns);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace tflite
+
+int main(int argc, char** argv) {
+  tflite::RunBenchmarks();
+  return 0;
+}
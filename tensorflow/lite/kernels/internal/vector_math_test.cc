@@ -0,0 +1,220 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/kernels/internal/optimized/vector_math.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace tflite {
+namespace {
+
+typedef void (*VectorFunction)(const float*, size_t, float*);
+
+// Maps floats to integers that are ordered the same way, so that the distance
+// between two of them is their distance in units in the last place.
+int64_t OrderedBits(float value) {
+  int32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits < 0 ? -static_cast<int64_t>(bits & 0x7fffffff) : bits;
+}
+
+float FromOrderedBits(int64_t ordered) {
+  const int32_t bits = ordered < 0
+                           ? static_cast<int32_t>(-ordered) | INT32_MIN
+                           : static_cast<int32_t>(ordered);
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+int64_t UlpDistance(float a, float b) {
+  return std::abs(OrderedBits(a) - OrderedBits(b));
+}
+
+// Returns every `stride`-th float in [begin, end), plus `end` itself.
+std::vector<float> FloatsInRange(float begin, float end, int stride) {
+  std::vector<float> values;
+  const int64_t last = OrderedBits(end);
+  for (int64_t i = OrderedBits(begin); i < last; i += stride) {
+    values.push_back(FromOrderedBits(i));
+  }
+  values.push_back(end);
+  return values;
+}
+
+// Runs `func` on `inputs` and returns the largest distance to the correctly
+// rounded result of `reference`.
+int64_t MaxUlpError(const std::vector<float>& inputs, VectorFunction func,
+                    double reference(double)) {
+  std::vector<float> outputs(inputs.size());
+  func(inputs.data(), static_cast<int>(inputs.size()), outputs.data());
+  int64_t max_error = 0;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    const float expected =
+        static_cast<float>(reference(static_cast<double>(inputs[i])));
+    const int64_t error = UlpDistance(outputs[i], expected);
+    EXPECT_LE(error, 64) << "input " << inputs[i] << " output " << outputs[i]
+                         << " expected " << expected;
+    max_error = std::max(max_error, error);
+  }
+  return max_error;
+}
+
+double ReferenceExp(double x) { return std::exp(x); }
+double ReferenceLog(double x) { return std::log(x); }
+double ReferenceLogistic(double x) { return 1.0 / (1.0 + std::exp(-x)); }
+double ReferenceTanh(double x) { return std::tanh(x); }
+
+TEST(VectorMathTest, ExpAccuracy) {
+  const std::vector<float> inputs = FloatsInRange(-104.f, 89.f, 2003);
+  EXPECT_LE(MaxUlpError(inputs, vector_math::Exp, ReferenceExp), 2);
+}
+
+TEST(VectorMathTest, ExpSpecialValues) {
+  const float inf = std::numeric_limits<float>::infinity();
+  const std::vector<float> inputs = {
+      0.f, -0.f, 1.f, -1000.f, 1000.f, -inf, inf, 88.72f, -103.9f};
+  std::vector<float> outputs(inputs.size());
+  vector_math::Exp(inputs.data(), inputs.size(), outputs.data());
+  EXPECT_EQ(outputs[0], 1.f);
+  EXPECT_EQ(outputs[1], 1.f);
+  EXPECT_EQ(UlpDistance(outputs[2], static_cast<float>(std::exp(1.0))), 0);
+  EXPECT_EQ(outputs[3], 0.f);
+  EXPECT_EQ(outputs[4], inf);
+  EXPECT_EQ(outputs[5], 0.f);
+  EXPECT_EQ(outputs[6], inf);
+  EXPECT_TRUE(std::isfinite(outputs[7]));
+  EXPECT_GT(outputs[8], 0.f);
+}
+
+TEST(VectorMathTest, LogAccuracy) {
+  const float denorm_min = std::numeric_limits<float>::denorm_min();
+  const float max = std::numeric_limits<float>::max();
+  EXPECT_LE(MaxUlpError(FloatsInRange(denorm_min, max, 2003), vector_math::Log,
+                        ReferenceLog),
+            2);
+  // Densely around 1, where the result goes through zero.
+  EXPECT_LE(MaxUlpError(FloatsInRange(0.5f, 2.f, 7), vector_math::Log,
+                        ReferenceLog),
+            2);
+}
+
+TEST(VectorMathTest, LogSpecialValues) {
+  const float inf = std::numeric_limits<float>::infinity();
+  const std::vector<float> inputs = {1.f, 0.f, -0.f, -1.f, inf, -inf};
+  std::vector<float> outputs(inputs.size());
+  vector_math::Log(inputs.data(), inputs.size(), outputs.data());
+  EXPECT_EQ(outputs[0], 0.f);
+  EXPECT_EQ(outputs[1], -inf);
+  EXPECT_EQ(outputs[2], -inf);
+  EXPECT_TRUE(std::isnan(outputs[3]));
+  EXPECT_EQ(outputs[4], inf);
+  EXPECT_TRUE(std::isnan(outputs[5]));
+}
+
+TEST(VectorMathTest, LogisticAccuracy) {
+  const std::vector<float> inputs = FloatsInRange(-100.f, 100.f, 2003);
+  EXPECT_LE(MaxUlpError(inputs, vector_math::Logistic, ReferenceLogistic), 3);
+}
+
+TEST(VectorMathTest, LogisticSaturates) {
+  const float inf = std::numeric_limits<float>::infinity();
+  const std::vector<float> inputs = {-inf, -1000.f, 0.f, 1000.f, inf};
+  std::vector<float> outputs(inputs.size());
+  vector_math::Logistic(inputs.data(), inputs.size(), outputs.data());
+  EXPECT_THAT(outputs, ::testing::ElementsAre(0.f, 0.f, 0.5f, 1.f, 1.f));
+}
+
+TEST(VectorMathTest, TanhAccuracy) {
+  EXPECT_LE(MaxUlpError(FloatsInRange(-20.f, 20.f, 2003), vector_math::Tanh,
+                        ReferenceTanh),
+            2);
+  // Densely around the switch between the two approximations.
+  EXPECT_LE(MaxUlpError(FloatsInRange(0.5f, 0.75f, 3), vector_math::Tanh,
+                        ReferenceTanh),
+            2);
+}
+
+TEST(VectorMathTest, TanhSpecialValues) {
+  const float inf = std::numeric_limits<float>::infinity();
+  const float tiny = std::numeric_limits<float>::denorm_min();
+  const std::vector<float> inputs = {-inf, -1000.f, -0.f, 0.f, tiny, 1000.f,
+                                     inf};
+  std::vector<float> outputs(inputs.size());
+  vector_math::Tanh(inputs.data(), inputs.size(), outputs.data());
+  EXPECT_THAT(outputs,
+              ::testing::ElementsAre(-1.f, -1.f, 0.f, 0.f, tiny, 1.f, 1.f));
+  EXPECT_TRUE(std::signbit(outputs[2]));
+}
+
+TEST(VectorMathTest, NanPropagates) {
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  // More elements than the widest SIMD width, so both the vector and the
+  // scalar code see a NaN.
+  std::vector<float> inputs(19, 0.5f);
+  inputs[3] = nan;
+  inputs[18] = nan;
+  std::vector<float> outputs(inputs.size());
+  for (VectorFunction func :
+       std::initializer_list<VectorFunction>{vector_math::Exp, vector_math::Log,
+                                             vector_math::Logistic,
+                                             vector_math::Tanh}) {
+    func(inputs.data(), inputs.size(), outputs.data());
+    EXPECT_TRUE(std::isnan(outputs[3]));
+    EXPECT_TRUE(std::isnan(outputs[18]));
+    EXPECT_FALSE(std::isnan(outputs[17]));
+  }
+}
+
+TEST(VectorMathTest, AllSizesAndInPlace) {
+  // Every size up to a few SIMD widths, so that each combination of vector
+  // loops and scalar tail runs.
+  for (int size = 0; size <= 40; ++size) {
+    std::vector<float> data(size);
+    for (int i = 0; i < size; ++i) {
+      data[i] = 0.37f * (i - size / 2);
+    }
+    std::vector<float> expected = data;
+    for (float& value : expected) {
+      value = std::tanh(value);
+    }
+    vector_math::Tanh(data.data(), size, data.data());
+    for (int i = 0; i < size; ++i) {
+      EXPECT_LE(UlpDistance(data[i], expected[i]), 2) << "size " << size;
+    }
+  }
+}
+
+TEST(VectorMathTest, ScalarMatchesVector) {
+  const std::vector<float> inputs = FloatsInRange(-10.f, 10.f, 2003);
+  std::vector<float> outputs(inputs.size());
+  vector_math::Exp(inputs.data(), inputs.size(), outputs.data());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    EXPECT_LE(UlpDistance(vector_math::Exp(inputs[i]), outputs[i]), 1);
+  }
+}
+
+}  // namespace
+}  // namespace tflite
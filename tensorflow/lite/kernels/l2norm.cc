@@ -14,6 +14,7 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/l2normalization.h"
 #include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
 #include "tensorflow/lite/kernels/internal/reference/integer_ops/l2normalization.h"
 #include "tensorflow/lite/kernels/internal/reference/reference_ops.h"
@@ -112,9 +113,15 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
         MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
     const int outer_size =
         MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
-    reference_integer_ops::L2Normalization(input->params.zero_point, outer_size,
-                                           depth, GetTensorData<int8>(input),
-                                           GetTensorData<int8>(output));
+    if (kernel_type == kGenericOptimized) {
+      optimized_integer_ops::L2Normalization(
+          input->params.zero_point, outer_size, depth,
+          GetTensorData<int8>(input), GetTensorData<int8>(output));
+    } else {
+      reference_integer_ops::L2Normalization(
+          input->params.zero_point, outer_size, depth,
+          GetTensorData<int8>(input), GetTensorData<int8>(output));
+    }
   } else {
     context->ReportError(context, "Output type is %d, requires float.",
                          output->type);
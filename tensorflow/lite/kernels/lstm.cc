@@ -26,6 +26,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/cpu_backend_support.h"
 #include "tensorflow/lite/kernels/internal/kernel_utils.h"
 #include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
 #include "tensorflow/lite/kernels/internal/tensor.h"
 #include "tensorflow/lite/kernels/internal/tensor_utils.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
@@ -51,6 +52,16 @@ struct OpData {
   int activation_state_tensor_index;
   int cell_state_tensor_index;
   int scratch_tensor_index;
+
+  // The float full kernel packs the gate weights into one matrix, see
+  // lstm_eval::PackFloatGateWeights. Constant weights are only packed once.
+  bool gate_weights_are_constant;
+  bool have_gate_weights_been_packed;
+
+  // The fully integer full kernel, used for int8 inputs, folds the zero
+  // points into packed gate biases, also only computed once for constant
+  // weights, and rescales with integer_lstm_params.
+  lstm_eval::IntegerLstmParams integer_lstm_params;
 };
 
 // For full inputs kernel (24-inputs).
@@ -107,7 +118,7 @@ constexpr int kOutputTensor = 0;
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   auto* op_data = new OpData();
   op_data->kernel_type = kTfLiteLSTMFullKernel;
-  context->AddTensors(context, /*tensors_to_add=*/7,
+  context->AddTensors(context, /*tensors_to_add=*/10,
                       &op_data->scratch_tensor_index);
   return op_data;
 }
@@ -116,7 +127,8 @@ void* Init(TfLiteContext* context, const char* buffer, size_t length) {
 TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
                                         TfLiteNode* node, int n_input,
                                         int n_output, int n_cell,
-                                        bool is_layer_norm_lstm) {
+                                        bool is_layer_norm_lstm,
+                                        bool is_integer) {
   const auto* params = reinterpret_cast<TfLiteLSTMParams*>(node->builtin_data);
 
   // Making sure clipping parameters have valid values.
@@ -193,13 +205,16 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
        (recurrent_to_input_weights == nullptr));
   TF_LITE_ENSURE(context, cifg_weights_all_or_none == true);
 
+  // The integer kernel has int16 peephole weights.
+  const TfLiteType peephole_weights_type =
+      is_integer ? kTfLiteInt16 : input_to_forget_weights->type;
   const TfLiteTensor* cell_to_input_weights =
       GetOptionalInputTensor(context, node, kCellToInputWeightsTensor);
   if (cell_to_input_weights) {
     TF_LITE_ENSURE_EQ(context, cell_to_input_weights->dims->size, 1);
     TF_LITE_ENSURE_EQ(context, cell_to_input_weights->dims->data[0], n_cell);
     TF_LITE_ENSURE_EQ(context, cell_to_input_weights->type,
-                      input_to_forget_weights->type);
+                      peephole_weights_type);
   }
 
   const TfLiteTensor* cell_to_forget_weights =
@@ -208,7 +223,7 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
     TF_LITE_ENSURE_EQ(context, cell_to_forget_weights->dims->size, 1);
     TF_LITE_ENSURE_EQ(context, cell_to_forget_weights->dims->data[0], n_cell);
     TF_LITE_ENSURE_EQ(context, cell_to_forget_weights->type,
-                      input_to_forget_weights->type);
+                      peephole_weights_type);
   }
 
   const TfLiteTensor* cell_to_output_weights =
@@ -217,7 +232,7 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
     TF_LITE_ENSURE_EQ(context, cell_to_output_weights->dims->size, 1);
     TF_LITE_ENSURE_EQ(context, cell_to_output_weights->dims->data[0], n_cell);
     TF_LITE_ENSURE_EQ(context, cell_to_output_weights->type,
-                      input_to_forget_weights->type);
+                      peephole_weights_type);
   }
 
   // Making sure the peephole weights are there all or none.
@@ -230,6 +245,9 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
        (cell_to_output_weights == nullptr));
   TF_LITE_ENSURE(context, peephole_weights_all_or_none == true);
 
+  // The integer kernel has int32 biases.
+  const TfLiteType bias_type = is_integer ? kTfLiteInt32 : kTfLiteFloat32;
+
   // Make sure the input gate bias is present only when not a CIFG-LSTM.
   const TfLiteTensor* input_gate_bias =
       GetOptionalInputTensor(context, node, kInputGateBiasTensor);
@@ -238,25 +256,25 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
   } else {
     TF_LITE_ENSURE_EQ(context, input_gate_bias->dims->size, 1);
     TF_LITE_ENSURE_EQ(context, input_gate_bias->dims->data[0], n_cell);
-    TF_LITE_ENSURE_EQ(context, input_gate_bias->type, kTfLiteFloat32);
+    TF_LITE_ENSURE_EQ(context, input_gate_bias->type, bias_type);
   }
 
   const TfLiteTensor* forget_gate_bias =
       GetInput(context, node, kForgetGateBiasTensor);
   TF_LITE_ENSURE_EQ(context, forget_gate_bias->dims->size, 1);
   TF_LITE_ENSURE_EQ(context, forget_gate_bias->dims->data[0], n_cell);
-  TF_LITE_ENSURE_EQ(context, forget_gate_bias->type, kTfLiteFloat32);
+  TF_LITE_ENSURE_EQ(context, forget_gate_bias->type, bias_type);
 
   const TfLiteTensor* cell_bias = GetInput(context, node, kCellGateBiasTensor);
   TF_LITE_ENSURE_EQ(context, cell_bias->dims->size, 1);
   TF_LITE_ENSURE_EQ(context, cell_bias->dims->data[0], n_cell);
-  TF_LITE_ENSURE_EQ(context, cell_bias->type, kTfLiteFloat32);
+  TF_LITE_ENSURE_EQ(context, cell_bias->type, bias_type);
 
   const TfLiteTensor* output_gate_bias =
       GetInput(context, node, kOutputGateBiasTensor);
   TF_LITE_ENSURE_EQ(context, output_gate_bias->dims->size, 1);
   TF_LITE_ENSURE_EQ(context, output_gate_bias->dims->data[0], n_cell);
-  TF_LITE_ENSURE_EQ(context, output_gate_bias->type, kTfLiteFloat32);
+  TF_LITE_ENSURE_EQ(context, output_gate_bias->type, bias_type);
 
   const TfLiteTensor* projection_weights =
       GetOptionalInputTensor(context, node, kProjectionWeightsTensor);
@@ -273,7 +291,7 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
   if (projection_bias != nullptr) {
     TF_LITE_ENSURE_EQ(context, projection_bias->dims->size, 1);
     TF_LITE_ENSURE_EQ(context, projection_bias->dims->data[0], n_output);
-    TF_LITE_ENSURE_EQ(context, projection_bias->type, kTfLiteFloat32);
+    TF_LITE_ENSURE_EQ(context, projection_bias->type, bias_type);
   }
 
   // Making sure the projection tensors are consistent:
@@ -286,6 +304,9 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
   TF_LITE_ENSURE(context, projection_tensors_consistent == true);
 
   if (is_layer_norm_lstm) {
+    // The integer kernel has int16 layer norm coefficients.
+    const TfLiteType layer_norm_type =
+        is_integer ? kTfLiteInt16 : kTfLiteFloat32;
     const TfLiteTensor* input_layer_norm_coefficients = GetOptionalInputTensor(
         context, node, kInputLayerNormCoefficientsTensor);
     if (use_cifg) {
@@ -296,7 +317,7 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
       TF_LITE_ENSURE_EQ(context, input_layer_norm_coefficients->dims->data[0],
                         n_cell);
       TF_LITE_ENSURE_EQ(context, input_layer_norm_coefficients->type,
-                        kTfLiteFloat32);
+                        layer_norm_type);
     }
 
     const TfLiteTensor* forget_layer_norm_coefficients =
@@ -306,7 +327,7 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
     TF_LITE_ENSURE_EQ(context, forget_layer_norm_coefficients->dims->data[0],
                       n_cell);
     TF_LITE_ENSURE_EQ(context, forget_layer_norm_coefficients->type,
-                      kTfLiteFloat32);
+                      layer_norm_type);
 
     const TfLiteTensor* cell_layer_norm_coefficients =
         GetInput(context, node, kCellLayerNormCoefficientsTensor);
@@ -315,7 +336,7 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
     TF_LITE_ENSURE_EQ(context, cell_layer_norm_coefficients->dims->data[0],
                       n_cell);
     TF_LITE_ENSURE_EQ(context, cell_layer_norm_coefficients->type,
-                      kTfLiteFloat32);
+                      layer_norm_type);
 
     const TfLiteTensor* output_layer_norm_coefficients =
         GetInput(context, node, kOutputLayerNormCoefficientsTensor);
@@ -324,12 +345,180 @@ TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
     TF_LITE_ENSURE_EQ(context, output_layer_norm_coefficients->dims->data[0],
                       n_cell);
     TF_LITE_ENSURE_EQ(context, output_layer_norm_coefficients->type,
-                      kTfLiteFloat32);
+                      layer_norm_type);
   }
 
   return kTfLiteOk;
 }
 
+// Returns true if the input and recurrent weights and the gate biases, i.e.
+// what lstm_eval::PackFloatGateWeights reads, are all constant.
+bool GateWeightsAreConstant(TfLiteContext* context, TfLiteNode* node) {
+  for (const int index :
+       {kInputToInputWeightsTensor, kInputToForgetWeightsTensor,
+        kInputToCellWeightsTensor, kInputToOutputWeightsTensor,
+        kRecurrentToInputWeightsTensor, kRecurrentToForgetWeightsTensor,
+        kRecurrentToCellWeightsTensor, kRecurrentToOutputWeightsTensor,
+        kInputGateBiasTensor, kForgetGateBiasTensor, kCellGateBiasTensor,
+        kOutputGateBiasTensor}) {
+    const TfLiteTensor* tensor = GetOptionalInputTensor(context, node, index);
+    if (tensor != nullptr && !IsConstantTensor(tensor)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Checks the quantization parameters of a fully integer LSTM, derives its
+// rescaling parameters into op_data and allocates its temporaries, besides the
+// int16 gates scratch buffer: an int32 accumulator, the int8 input of the
+// projection and the packed gate biases of lstm_eval::PackIntegerGateBias.
+TfLiteStatus PrepareInteger(TfLiteContext* context, TfLiteNode* node,
+                            OpData* op_data, int n_batch, int n_output,
+                            int n_cell) {
+  const auto* params = reinterpret_cast<TfLiteLSTMParams*>(node->builtin_data);
+  TF_LITE_ENSURE_EQ(context, params->activation, kTfLiteActTanh);
+
+  const TfLiteTensor* input = GetInput(context, node, kInputTensor);
+  const TfLiteTensor* input_to_output_weights =
+      GetInput(context, node, kInputToOutputWeightsTensor);
+  TF_LITE_ENSURE_EQ(context, input_to_output_weights->type, kTfLiteInt8);
+  const TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+  TF_LITE_ENSURE_EQ(context, output->type, kTfLiteInt8);
+  const TfLiteTensor* activation_state =
+      &context->tensors[op_data->activation_state_tensor_index];
+  TF_LITE_ENSURE_EQ(context, activation_state->type, kTfLiteInt8);
+  // The output is the next activation state, so both share their
+  // quantization.
+  TF_LITE_ENSURE(context,
+                 activation_state->params.scale == output->params.scale);
+  TF_LITE_ENSURE_EQ(context, activation_state->params.zero_point,
+                    output->params.zero_point);
+  const TfLiteTensor* cell_state =
+      &context->tensors[op_data->cell_state_tensor_index];
+  TF_LITE_ENSURE_EQ(context, cell_state->type, kTfLiteInt16);
+  int cell_scale_log2;
+  TF_LITE_ENSURE(context,
+                 CheckedLog2(cell_state->params.scale, &cell_scale_log2));
+  TF_LITE_ENSURE(context, cell_scale_log2 <= 0 && cell_scale_log2 >= -15);
+
+  lstm_eval::IntegerLstmParams* integer_params =
+      &op_data->integer_lstm_params;
+  *integer_params = lstm_eval::IntegerLstmParams();
+  const double gate_scale = std::pow(2.0, lstm_eval::kIntegerLstmGateScaleLog2);
+  const double cell_scale = cell_state->params.scale;
+  const int input_weights_tensors[] = {
+      kInputToInputWeightsTensor, kInputToForgetWeightsTensor,
+      kInputToCellWeightsTensor, kInputToOutputWeightsTensor};
+  const int recurrent_weights_tensors[] = {
+      kRecurrentToInputWeightsTensor, kRecurrentToForgetWeightsTensor,
+      kRecurrentToCellWeightsTensor, kRecurrentToOutputWeightsTensor};
+  const int peephole_weights_tensors[] = {kCellToInputWeightsTensor,
+                                          kCellToForgetWeightsTensor, -1,
+                                          kCellToOutputWeightsTensor};
+  const int layer_norm_tensors[] = {
+      kInputLayerNormCoefficientsTensor, kForgetLayerNormCoefficientsTensor,
+      kCellLayerNormCoefficientsTensor, kOutputLayerNormCoefficientsTensor};
+  for (int gate = 0; gate < 4; ++gate) {
+    const TfLiteTensor* input_weights =
+        GetOptionalInputTensor(context, node, input_weights_tensors[gate]);
+    if (input_weights == nullptr) {
+      // No input gate with CIFG.
+      continue;
+    }
+    const TfLiteTensor* recurrent_weights =
+        GetInput(context, node, recurrent_weights_tensors[gate]);
+    QuantizeMultiplier(
+        input->params.scale * input_weights->params.scale / gate_scale,
+        &integer_params->input_multiplier[gate],
+        &integer_params->input_shift[gate]);
+    QuantizeMultiplier(activation_state->params.scale *
+                           recurrent_weights->params.scale / gate_scale,
+                       &integer_params->recurrent_multiplier[gate],
+                       &integer_params->recurrent_shift[gate]);
+    const TfLiteTensor* peephole_weights =
+        peephole_weights_tensors[gate] < 0
+            ? nullptr
+            : GetOptionalInputTensor(context, node,
+                                     peephole_weights_tensors[gate]);
+    if (peephole_weights != nullptr) {
+      QuantizeMultiplier(
+          peephole_weights->params.scale * cell_scale / gate_scale,
+          &integer_params->cell_multiplier[gate],
+          &integer_params->cell_shift[gate]);
+    }
+    if (op_data->is_layer_norm_lstm) {
+      const TfLiteTensor* layer_norm_coefficients =
+          GetInput(context, node, layer_norm_tensors[gate]);
+      QuantizeMultiplier(
+          layer_norm_coefficients->params.scale *
+              std::pow(2.0, lstm_eval::kIntegerLstmLayerNormScaleLog2) /
+              gate_scale,
+          &integer_params->layer_norm_multiplier[gate],
+          &integer_params->layer_norm_shift[gate]);
+    }
+  }
+  const TfLiteTensor* projection_weights =
+      GetOptionalInputTensor(context, node, kProjectionWeightsTensor);
+  const double hidden_scale =
+      projection_weights != nullptr
+          ? projection_weights->params.scale *
+                std::pow(2.0, lstm_eval::kIntegerLstmHiddenScaleLog2)
+          : std::pow(2.0, -30);
+  QuantizeMultiplier(hidden_scale / output->params.scale,
+                     &integer_params->output_multiplier,
+                     &integer_params->output_shift);
+  integer_params->input_zero_point = input->params.zero_point;
+  integer_params->output_zero_point = output->params.zero_point;
+  integer_params->cell_scale_log2 = cell_scale_log2;
+  if (params->cell_clip > 0.0) {
+    integer_params->quantized_cell_clip = static_cast<int16_t>(
+        std::min(std::round(params->cell_clip / cell_scale), 32767.0));
+  }
+  if (params->proj_clip > 0.0) {
+    integer_params->quantized_proj_clip = static_cast<int8_t>(std::min(
+        std::round(params->proj_clip / output->params.scale), 127.0f));
+  }
+
+  node->temporaries->data[1] = op_data->scratch_tensor_index + 1;
+  TfLiteTensor* accumulator_scratch = GetTemporary(context, node, /*index=*/1);
+  accumulator_scratch->type = kTfLiteInt32;
+  accumulator_scratch->allocation_type = kTfLiteArenaRw;
+  TfLiteIntArray* accumulator_scratch_size = TfLiteIntArrayCreate(2);
+  accumulator_scratch_size->data[0] = n_batch;
+  accumulator_scratch_size->data[1] = std::max(n_cell, n_output);
+  TF_LITE_ENSURE_OK(context,
+                    context->ResizeTensor(context, accumulator_scratch,
+                                          accumulator_scratch_size));
+  node->temporaries->data[2] = op_data->scratch_tensor_index + 2;
+  TfLiteTensor* hidden_scratch = GetTemporary(context, node, /*index=*/2);
+  hidden_scratch->type = kTfLiteInt8;
+  hidden_scratch->allocation_type = kTfLiteArenaRw;
+  TfLiteIntArray* hidden_scratch_size = TfLiteIntArrayCreate(2);
+  hidden_scratch_size->data[0] = n_batch;
+  hidden_scratch_size->data[1] = n_cell;
+  TF_LITE_ENSURE_OK(context, context->ResizeTensor(context, hidden_scratch,
+                                                   hidden_scratch_size));
+
+  // The packed gate biases of constant weights are computed once.
+  op_data->gate_weights_are_constant = GateWeightsAreConstant(context, node);
+  op_data->have_gate_weights_been_packed = false;
+  const bool use_cifg =
+      GetOptionalInputTensor(context, node, kInputToInputWeightsTensor) ==
+      nullptr;
+  node->temporaries->data[3] = op_data->scratch_tensor_index + 3;
+  TfLiteTensor* packed_gate_bias = GetTemporary(context, node, /*index=*/3);
+  packed_gate_bias->type = kTfLiteInt32;
+  packed_gate_bias->allocation_type = op_data->gate_weights_are_constant
+                                          ? kTfLiteArenaRwPersistent
+                                          : kTfLiteArenaRw;
+  TfLiteIntArray* packed_gate_bias_size = TfLiteIntArrayCreate(2);
+  packed_gate_bias_size->data[0] = 2 * (use_cifg ? 3 : 4);
+  packed_gate_bias_size->data[1] = n_cell;
+  return context->ResizeTensor(context, packed_gate_bias,
+                               packed_gate_bias_size);
+}
+
 // Resize the output, state tensors based on the sizes of the input tensors.
 // Allocate a temporary scratch tensor. Also check that the sizes of the input
 // tensors match each other.
@@ -370,7 +559,10 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   // Inferring batch size, number of outputs and number of cells from the
   // input tensors.
   const TfLiteTensor* input = GetInput(context, node, kInputTensor);
-  TF_LITE_ENSURE_EQ(context, input->type, kTfLiteFloat32);
+  // int8 inputs run the fully integer kernel.
+  TF_LITE_ENSURE(context,
+                 input->type == kTfLiteFloat32 || input->type == kTfLiteInt8);
+  const bool is_integer = input->type == kTfLiteInt8;
   TF_LITE_ENSURE(context, input->dims->size > 1);
   const int n_batch = input->dims->data[0];
   const int n_input = input->dims->data[1];
@@ -391,7 +583,8 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   // Check that input tensor dimensions matches with each other.
   TF_LITE_ENSURE_OK(context,
                     CheckInputTensorDimensions(context, node, n_input, n_output,
-                                               n_cell, is_layer_norm_lstm));
+                                               n_cell, is_layer_norm_lstm,
+                                               is_integer));
 
   // Get the pointer to output, activation_state and cell_state tensors.
   TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
@@ -421,13 +614,14 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   if (is_hybrid_op) {
     node->temporaries = TfLiteIntArrayCreate(7);
   } else {
-    node->temporaries = TfLiteIntArrayCreate(1);
+    node->temporaries = TfLiteIntArrayCreate(4);
   }
   node->temporaries->data[0] = op_data->scratch_tensor_index;
 
-  // Create a scratch buffer tensor.
+  // Create a scratch buffer tensor. The integer kernel keeps its gates in
+  // int16.
   TfLiteTensor* scratch_buffer = GetTemporary(context, node, /*index=*/0);
-  scratch_buffer->type = input->type;
+  scratch_buffer->type = is_integer ? kTfLiteInt16 : input->type;
   scratch_buffer->allocation_type = kTfLiteArenaRw;
 
   const TfLiteTensor* input_to_input_weights =
@@ -445,6 +639,53 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_OK(context, context->ResizeTensor(context, scratch_buffer,
                                                    scratch_buffer_size));
 
+  if (is_integer) {
+    TF_LITE_ENSURE_OK(context, PrepareInteger(context, node, op_data, n_batch,
+                                              n_output, n_cell));
+  } else if (!is_hybrid_op) {
+    // Allocate the packed gate weights and biases. Constant weights are kept
+    // packed across invocations, others are packed at every invocation.
+    const int n_gate_rows = (use_cifg ? 3 : 4) * n_cell;
+    op_data->gate_weights_are_constant = GateWeightsAreConstant(context, node);
+    op_data->have_gate_weights_been_packed = false;
+    const TfLiteAllocationType packed_allocation_type =
+        op_data->gate_weights_are_constant ? kTfLiteArenaRwPersistent
+                                           : kTfLiteArenaRw;
+    node->temporaries->data[1] = op_data->scratch_tensor_index + 7;
+    TfLiteTensor* packed_gate_weights =
+        GetTemporary(context, node, /*index=*/1);
+    packed_gate_weights->type = kTfLiteFloat32;
+    packed_gate_weights->allocation_type = packed_allocation_type;
+    TfLiteIntArray* packed_gate_weights_size = TfLiteIntArrayCreate(2);
+    packed_gate_weights_size->data[0] = n_gate_rows;
+    packed_gate_weights_size->data[1] = n_input + n_output;
+    TF_LITE_ENSURE_OK(context,
+                      context->ResizeTensor(context, packed_gate_weights,
+                                            packed_gate_weights_size));
+    node->temporaries->data[2] = op_data->scratch_tensor_index + 8;
+    TfLiteTensor* packed_gate_bias = GetTemporary(context, node, /*index=*/2);
+    packed_gate_bias->type = kTfLiteFloat32;
+    packed_gate_bias->allocation_type = packed_allocation_type;
+    TfLiteIntArray* packed_gate_bias_size = TfLiteIntArrayCreate(1);
+    packed_gate_bias_size->data[0] = n_gate_rows;
+    TF_LITE_ENSURE_OK(context, context->ResizeTensor(context, packed_gate_bias,
+                                                     packed_gate_bias_size));
+
+    // Allocate a temporary tensor for the contribution of the input to the
+    // gates.
+    node->temporaries->data[3] = op_data->scratch_tensor_index + 9;
+    TfLiteTensor* input_gates_buffer =
+        GetTemporary(context, node, /*index=*/3);
+    input_gates_buffer->type = kTfLiteFloat32;
+    input_gates_buffer->allocation_type = kTfLiteArenaRw;
+    TfLiteIntArray* input_gates_buffer_size = TfLiteIntArrayCreate(2);
+    input_gates_buffer_size->data[0] = n_batch;
+    input_gates_buffer_size->data[1] = n_gate_rows;
+    TF_LITE_ENSURE_OK(context,
+                      context->ResizeTensor(context, input_gates_buffer,
+                                            input_gates_buffer_size));
+  }
+
   if (is_hybrid_op) {
     // Allocate temporary tensors to store quantized values of input,
     // activation_state and cell_state tensors.
@@ -605,26 +846,74 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
 
-  switch (input_to_output_weights->type) {
-    case kTfLiteFloat32: {
-      return lstm_eval::EvalFloat(
-          input, input_to_input_weights, input_to_forget_weights,
+  if (input->type == kTfLiteInt8) {
+    TfLiteTensor* accumulator_scratch =
+        GetTemporary(context, node, /*index=*/1);
+    TfLiteTensor* hidden_scratch = GetTemporary(context, node, /*index=*/2);
+    TfLiteTensor* packed_gate_bias = GetTemporary(context, node, /*index=*/3);
+    if (!op_data->gate_weights_are_constant ||
+        !op_data->have_gate_weights_been_packed) {
+      lstm_eval::PackIntegerGateBias(
+          input_to_input_weights, input_to_forget_weights,
           input_to_cell_weights, input_to_output_weights,
           recurrent_to_input_weights, recurrent_to_forget_weights,
           recurrent_to_cell_weights, recurrent_to_output_weights,
-          cell_to_input_weights, cell_to_forget_weights, cell_to_output_weights,
+          input_gate_bias, forget_gate_bias, cell_bias, output_gate_bias,
+          is_layer_norm_lstm, input->params.zero_point,
+          activation_state->params.zero_point, packed_gate_bias);
+      op_data->have_gate_weights_been_packed = true;
+    }
+    return lstm_eval::EvalInteger(
+        input, input_to_input_weights, input_to_forget_weights,
+        input_to_cell_weights, input_to_output_weights,
+        recurrent_to_input_weights, recurrent_to_forget_weights,
+        recurrent_to_cell_weights, recurrent_to_output_weights,
+        cell_to_input_weights, cell_to_forget_weights, cell_to_output_weights,
+        input_layer_norm_coefficients, forget_layer_norm_coefficients,
+        cell_layer_norm_coefficients, output_layer_norm_coefficients,
+        input_gate_bias, forget_gate_bias, cell_bias, output_gate_bias,
+        projection_weights, projection_bias, params,
+        op_data->integer_lstm_params, packed_gate_bias, scratch_buffer,
+        accumulator_scratch, hidden_scratch, activation_state, cell_state,
+        output);
+  }
+
+  switch (input_to_output_weights->type) {
+    case kTfLiteFloat32: {
+      TfLiteTensor* packed_gate_weights =
+          GetTemporary(context, node, /*index=*/1);
+      // Layer norm LSTMs add the gate biases after the normalization.
+      TfLiteTensor* packed_gate_bias =
+          is_layer_norm_lstm ? nullptr
+                             : GetTemporary(context, node, /*index=*/2);
+      TfLiteTensor* input_gates_buffer =
+          GetTemporary(context, node, /*index=*/3);
+      if (!op_data->gate_weights_are_constant ||
+          !op_data->have_gate_weights_been_packed) {
+        lstm_eval::PackFloatGateWeights(
+            input_to_input_weights, input_to_forget_weights,
+            input_to_cell_weights, input_to_output_weights,
+            /*aux_input_to_input_weights=*/nullptr,
+            /*aux_input_to_forget_weights=*/nullptr,
+            /*aux_input_to_cell_weights=*/nullptr,
+            /*aux_input_to_output_weights=*/nullptr,
+            recurrent_to_input_weights, recurrent_to_forget_weights,
+            recurrent_to_cell_weights, recurrent_to_output_weights,
+            input_gate_bias, forget_gate_bias, cell_bias, output_gate_bias,
+            packed_gate_weights, packed_gate_bias);
+        op_data->have_gate_weights_been_packed = true;
+      }
+      return lstm_eval::EvalFloatWithPackedGateWeights(
+          input, packed_gate_weights, packed_gate_bias, cell_to_input_weights,
+          cell_to_forget_weights, cell_to_output_weights,
           input_layer_norm_coefficients, forget_layer_norm_coefficients,
           cell_layer_norm_coefficients, output_layer_norm_coefficients,
-          /*aux_input=*/nullptr,
-          /*aux_input_to_input_weights=*/nullptr,
-          /*aux_input_to_forget_weights=*/nullptr,
-          /*aux_input_to_cell_weights=*/nullptr,
-          /*aux_input_to_output_weights=*/nullptr, input_gate_bias,
-          forget_gate_bias, cell_bias, output_gate_bias, projection_weights,
-          projection_bias, params, /*forward_sequence=*/true,
-          /*time_major=*/true,
-          /*output_offset=*/0, scratch_buffer, activation_state, cell_state,
-          output);
+          /*aux_input=*/nullptr, input_gate_bias, forget_gate_bias, cell_bias,
+          output_gate_bias, projection_weights, projection_bias, params,
+          /*forward_sequence=*/true, /*time_major=*/true,
+          /*output_offset=*/0, input_gates_buffer, scratch_buffer,
+          activation_state, cell_state, output,
+          cpu_backend_support::GetFromContext(context));
     }
     case kTfLiteUInt8:
     case kTfLiteInt8: {
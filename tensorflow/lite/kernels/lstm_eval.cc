@@ -14,7 +14,9 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/lite/kernels/lstm_eval.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 
 #ifdef GEMMLOWP_PROFILING
 #include "profiling/profiler.h"
@@ -23,7 +25,12 @@ limitations under the License.
 #include "third_party/eigen3/Eigen/Core"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/kernels/cpu_backend_gemm.h"
+#include "tensorflow/lite/kernels/cpu_backend_gemm_params.h"
+#include "tensorflow/lite/kernels/internal/common.h"
 #include "tensorflow/lite/kernels/internal/kernel_utils.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
+#include "tensorflow/lite/kernels/internal/optimized/vector_math.h"
 #include "tensorflow/lite/kernels/internal/tensor_utils.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/op_macros.h"
@@ -371,6 +378,241 @@ inline void LstmStepWithAuxInput(
   }
 }
 
+// Computes result = matrix * vector + bias for the n_batch contiguous vectors
+// of vector_batch with a single GEMM, matrix being a row-major
+// m_rows x m_cols matrix. bias_ptr may be null.
+inline void MatrixBatchVectorMultiply(const float* matrix_ptr, int m_rows,
+                                      int m_cols, const float* vector_batch,
+                                      int n_batch, const float* bias_ptr,
+                                      float* result,
+                                      CpuBackendContext* cpu_backend_context) {
+  cpu_backend_gemm::MatrixParams<float> lhs_params;
+  lhs_params.order = cpu_backend_gemm::Order::kRowMajor;
+  lhs_params.rows = m_rows;
+  lhs_params.cols = m_cols;
+  cpu_backend_gemm::MatrixParams<float> rhs_params;
+  rhs_params.order = cpu_backend_gemm::Order::kColMajor;
+  rhs_params.rows = m_cols;
+  rhs_params.cols = n_batch;
+  cpu_backend_gemm::MatrixParams<float> dst_params;
+  dst_params.order = cpu_backend_gemm::Order::kColMajor;
+  dst_params.rows = m_rows;
+  dst_params.cols = n_batch;
+  cpu_backend_gemm::GemmParams<float, float> gemm_params;
+  gemm_params.bias = bias_ptr;
+  cpu_backend_gemm::Gemm(lhs_params, matrix_ptr, rhs_params, vector_batch,
+                         dst_params, result, gemm_params, cpu_backend_context);
+}
+
+// Applies the cell activation (usually tanh) with the vectorized math
+// functions when possible.
+void ApplyCellActivationToVector(const float* input, int input_size,
+                                 TfLiteFusedActivation activation_type,
+                                 float* output) {
+  switch (activation_type) {
+    case kTfLiteActTanh:
+      vector_math::Tanh(input, input_size, output);
+      break;
+    case kTfLiteActSigmoid:
+      vector_math::Logistic(input, input_size, output);
+      break;
+    default:
+      tensor_utils::ApplyActivationToVector(input, input_size, activation_type,
+                                            output);
+  }
+}
+
+// Layer-normalizes the pre-activations of one gate of one batch, then scales
+// and biases them.
+inline void LayerNormGate(const float* layer_norm_coefficients_ptr,
+                          const float* gate_bias_ptr, int n_cell,
+                          float* gate_ptr) {
+  tensor_utils::MeanStddevNormalization(gate_ptr, gate_ptr, n_cell,
+                                        /*n_batch=*/1, kLayerNormEpsilon);
+  tensor_utils::VectorVectorCwiseProduct(layer_norm_coefficients_ptr, gate_ptr,
+                                         n_cell, gate_ptr);
+  tensor_utils::VectorBatchVectorAdd(gate_bias_ptr, n_cell, /*n_batch=*/1,
+                                     gate_ptr);
+}
+
+// Computes the gates of one batch from their pre-activations in gates_ptr,
+// laid out as in PackFloatGateWeights, and updates its cell state. The cell
+// output, i.e. the output gate times the activated cell state, is written to
+// cell_output_ptr. That may point to the first gate of gates_ptr, or to any
+// memory that is not read anymore.
+inline void UpdateLstmCellWithPackedGates(
+    const float* cell_to_input_weights_ptr,
+    const float* cell_to_forget_weights_ptr,
+    const float* cell_to_output_weights_ptr,
+    const float* input_layer_norm_coefficients_ptr,
+    const float* forget_layer_norm_coefficients_ptr,
+    const float* cell_layer_norm_coefficients_ptr,
+    const float* output_layer_norm_coefficients_ptr,
+    const float* input_gate_bias_ptr, const float* forget_gate_bias_ptr,
+    const float* cell_bias_ptr, const float* output_gate_bias_ptr,
+    const TfLiteLSTMParams* params, bool use_cifg, int n_cell,
+    float* gates_ptr, float* cell_state_ptr, float* cell_output_ptr) {
+  const bool use_peephole = (cell_to_output_weights_ptr != nullptr);
+  const bool is_layer_norm_lstm =
+      (forget_layer_norm_coefficients_ptr != nullptr);
+  float* input_gate_ptr = use_cifg ? nullptr : gates_ptr;
+  float* forget_gate_ptr = use_cifg ? gates_ptr : gates_ptr + n_cell;
+  float* cell_gate_ptr = forget_gate_ptr + n_cell;
+  float* output_gate_ptr = cell_gate_ptr + n_cell;
+
+  if (use_peephole) {
+    if (!use_cifg) {
+      tensor_utils::VectorVectorCwiseProductAccumulate(
+          cell_to_input_weights_ptr, cell_state_ptr, n_cell, input_gate_ptr);
+    }
+    tensor_utils::VectorVectorCwiseProductAccumulate(
+        cell_to_forget_weights_ptr, cell_state_ptr, n_cell, forget_gate_ptr);
+  }
+  if (is_layer_norm_lstm) {
+    if (!use_cifg) {
+      LayerNormGate(input_layer_norm_coefficients_ptr, input_gate_bias_ptr,
+                    n_cell, input_gate_ptr);
+    }
+    LayerNormGate(forget_layer_norm_coefficients_ptr, forget_gate_bias_ptr,
+                  n_cell, forget_gate_ptr);
+    LayerNormGate(cell_layer_norm_coefficients_ptr, cell_bias_ptr, n_cell,
+                  cell_gate_ptr);
+  }
+  // The input and forget gates are contiguous.
+  vector_math::Logistic(gates_ptr, use_cifg ? n_cell : 2 * n_cell, gates_ptr);
+  ApplyCellActivationToVector(cell_gate_ptr, n_cell, params->activation,
+                              cell_gate_ptr);
+
+  const float cell_clip = params->cell_clip;
+  if (use_cifg) {
+    for (int i = 0; i < n_cell; ++i) {
+      cell_state_ptr[i] = forget_gate_ptr[i] * cell_state_ptr[i] +
+                          (1.0f - forget_gate_ptr[i]) * cell_gate_ptr[i];
+    }
+  } else {
+    for (int i = 0; i < n_cell; ++i) {
+      cell_state_ptr[i] = forget_gate_ptr[i] * cell_state_ptr[i] +
+                          input_gate_ptr[i] * cell_gate_ptr[i];
+    }
+  }
+  if (cell_clip > 0.0f) {
+    tensor_utils::ClipVector(cell_state_ptr, n_cell, cell_clip,
+                             cell_state_ptr);
+  }
+
+  if (use_peephole) {
+    tensor_utils::VectorVectorCwiseProductAccumulate(
+        cell_to_output_weights_ptr, cell_state_ptr, n_cell, output_gate_ptr);
+  }
+  if (is_layer_norm_lstm) {
+    LayerNormGate(output_layer_norm_coefficients_ptr, output_gate_bias_ptr,
+                  n_cell, output_gate_ptr);
+  }
+  vector_math::Logistic(output_gate_ptr, n_cell, output_gate_ptr);
+  ApplyCellActivationToVector(cell_state_ptr, n_cell, params->activation,
+                              cell_gate_ptr);
+  for (int i = 0; i < n_cell; ++i) {
+    cell_output_ptr[i] = output_gate_ptr[i] * cell_gate_ptr[i];
+  }
+}
+
+// Same as LstmStepWithAuxInput, with the contribution of the inputs and the
+// biases to the gates already computed into input_gates_ptr_batch, and the
+// recurrent weights packed by PackFloatGateWeights. A single GEMM computes the
+// recurrent contribution to all the gates of all the batches into
+// gate_scratch, which holds n_batch * n_gates * n_cell floats.
+inline void LstmStepWithPackedGateWeights(
+    const float* input_gates_ptr_batch,
+    const float* packed_recurrent_weights_ptr,
+    const float* cell_to_input_weights_ptr,
+    const float* cell_to_forget_weights_ptr,
+    const float* cell_to_output_weights_ptr,
+    const float* input_layer_norm_coefficients_ptr,
+    const float* forget_layer_norm_coefficients_ptr,
+    const float* cell_layer_norm_coefficients_ptr,
+    const float* output_layer_norm_coefficients_ptr,
+    const float* input_gate_bias_ptr, const float* forget_gate_bias_ptr,
+    const float* cell_bias_ptr, const float* output_gate_bias_ptr,
+    const float* projection_weights_ptr, const float* projection_bias_ptr,
+    const TfLiteLSTMParams* params, bool use_cifg, int n_batch, int n_cell,
+    int n_output, int output_batch_leading_dim, float* output_state_ptr,
+    float* cell_state_ptr, float* gate_scratch, float* output_ptr_batch,
+    CpuBackendContext* cpu_backend_context) {
+#ifdef GEMMLOWP_PROFILING
+  gemmlowp::ScopedProfilingLabel label("LstmStepWithPackedGateWeights");
+#endif
+  const int n_gate_rows = (use_cifg ? 3 : 4) * n_cell;
+
+  MatrixBatchVectorMultiply(packed_recurrent_weights_ptr, n_gate_rows,
+                            n_output, output_state_ptr, n_batch,
+                            /*bias_ptr=*/nullptr, gate_scratch,
+                            cpu_backend_context);
+  tensor_utils::VectorBatchVectorAdd(input_gates_ptr_batch,
+                                     n_batch * n_gate_rows, /*n_batch=*/1,
+                                     gate_scratch);
+
+  // The cell outputs are compacted at the beginning of gate_scratch, over the
+  // gates of the batches that have already been processed.
+  for (int b = 0; b < n_batch; ++b) {
+    UpdateLstmCellWithPackedGates(
+        cell_to_input_weights_ptr, cell_to_forget_weights_ptr,
+        cell_to_output_weights_ptr, input_layer_norm_coefficients_ptr,
+        forget_layer_norm_coefficients_ptr, cell_layer_norm_coefficients_ptr,
+        output_layer_norm_coefficients_ptr, input_gate_bias_ptr,
+        forget_gate_bias_ptr, cell_bias_ptr, output_gate_bias_ptr, params,
+        use_cifg, n_cell, gate_scratch + b * n_gate_rows,
+        cell_state_ptr + b * n_cell, gate_scratch + b * n_cell);
+  }
+  const float* cell_output_ptr = gate_scratch;
+
+  if (projection_weights_ptr != nullptr) {
+    cpu_backend_gemm::MatrixParams<float> proj_lhs_params;
+    proj_lhs_params.order = cpu_backend_gemm::Order::kRowMajor;
+    proj_lhs_params.rows = n_output;
+    proj_lhs_params.cols = n_cell;
+    cpu_backend_gemm::MatrixParams<float> proj_rhs_params;
+    proj_rhs_params.order = cpu_backend_gemm::Order::kColMajor;
+    proj_rhs_params.rows = n_cell;
+    cpu_backend_gemm::MatrixParams<float> proj_dst_params;
+    proj_dst_params.order = cpu_backend_gemm::Order::kColMajor;
+    proj_dst_params.rows = n_output;
+    cpu_backend_gemm::GemmParams<float, float> proj_gemm_params;
+    proj_gemm_params.bias = projection_bias_ptr;
+    if (params->proj_clip > 0.0) {
+      proj_gemm_params.clamp_min = -params->proj_clip;
+      proj_gemm_params.clamp_max = params->proj_clip;
+    }
+    // The output batch rows may not be contiguous, see LstmStepWithAuxInput.
+    if (output_batch_leading_dim == n_output) {
+      proj_rhs_params.cols = n_batch;
+      proj_dst_params.cols = n_batch;
+      cpu_backend_gemm::Gemm(proj_lhs_params, projection_weights_ptr,
+                             proj_rhs_params, cell_output_ptr, proj_dst_params,
+                             output_ptr_batch, proj_gemm_params,
+                             cpu_backend_context);
+    } else {
+      proj_rhs_params.cols = 1;
+      proj_dst_params.cols = 1;
+      for (int b = 0; b < n_batch; ++b) {
+        cpu_backend_gemm::Gemm(
+            proj_lhs_params, projection_weights_ptr, proj_rhs_params,
+            cell_output_ptr + b * n_cell, proj_dst_params,
+            output_ptr_batch + b * output_batch_leading_dim, proj_gemm_params,
+            cpu_backend_context);
+      }
+    }
+  } else {
+    for (int b = 0; b < n_batch; ++b) {
+      tensor_utils::CopyVector(cell_output_ptr + b * n_cell, n_output,
+                               output_ptr_batch + b * output_batch_leading_dim);
+    }
+  }
+  for (int b = 0; b < n_batch; ++b) {
+    tensor_utils::CopyVector(output_ptr_batch + b * output_batch_leading_dim,
+                             n_output, output_state_ptr + b * n_output);
+  }
+}
+
 void ApplyActivationsToVector(float* input, int input_size,
                               TfLiteFusedActivation activation_type,
                               float* output) {
@@ -892,6 +1134,136 @@ inline void LstmStepWithAuxInput(
   }
 }
 
+// Gate indices of IntegerLstmParams.
+enum IntegerLstmGate { kInputGate = 0, kForgetGate, kCellGate, kOutputGate };
+
+inline int16_t SaturateToInt16(int32_t x) {
+  return static_cast<int16_t>(std::min<int32_t>(
+      std::max<int32_t>(x, std::numeric_limits<int16_t>::min()),
+      std::numeric_limits<int16_t>::max()));
+}
+
+// Adds to result the sum of each row of the int8 matrix times -zero_point.
+void AddZeroPointRowSums(const TfLiteTensor* weights, int32_t zero_point,
+                         int32_t* result) {
+  const int rows = weights->dims->data[0];
+  const int cols = weights->dims->data[1];
+  const int8_t* row_ptr = GetTensorData<int8_t>(weights);
+  for (int r = 0; r < rows; ++r) {
+    int32_t row_sum = 0;
+    for (int c = 0; c < cols; ++c) {
+      row_sum += row_ptr[c];
+    }
+    result[r] -= zero_point * row_sum;
+    row_ptr += cols;
+  }
+}
+
+// Normalizes each batch of the int32 Q.12 gate pre-activations in accumulator
+// to zero mean and unit variance, with 10 fractional bits, then applies the
+// layer norm coefficients and bias and rescales the result back to the gate
+// pre-activation format.
+void IntegerLayerNorm(const int16_t* layer_norm_coefficients,
+                      const int32_t* bias, int32_t multiplier, int shift,
+                      int n_batch, int n_cell, int32_t* accumulator) {
+  for (int b = 0; b < n_batch; ++b) {
+    int32_t* row = accumulator + b * n_cell;
+    int64_t sum = 0;
+    int64_t sum_of_squares = 0;
+    for (int i = 0; i < n_cell; ++i) {
+      sum += row[i];
+      sum_of_squares += static_cast<int64_t>(row[i]) * row[i];
+    }
+    const int32_t mean = static_cast<int32_t>(sum / n_cell);
+    // A floor on the variance plays the role of the float epsilon and keeps
+    // the inverse square root below one.
+    int64_t variance = std::max<int64_t>(
+        sum_of_squares / n_cell - static_cast<int64_t>(mean) * mean, 16);
+    int variance_shift = 0;
+    while (variance > std::numeric_limits<int32_t>::max()) {
+      variance >>= 2;
+      ++variance_shift;
+    }
+    int32_t inv_stddev_multiplier;
+    int inv_stddev_shift;
+    GetInvSqrtQuantizedMultiplierExp(static_cast<int32_t>(variance),
+                                     /*reverse_shift=*/-1,
+                                     &inv_stddev_multiplier, &inv_stddev_shift);
+    for (int i = 0; i < n_cell; ++i) {
+      const int64_t centered =
+          static_cast<int64_t>(row[i] - mean)
+          << -kIntegerLstmLayerNormScaleLog2;
+      const int32_t normalized = gemmlowp::RoundingDivideByPOT(
+          MultiplyByQuantizedMultiplierSmallerThanOneExp(
+              static_cast<int32_t>(std::min<int64_t>(
+                  std::max<int64_t>(centered,
+                                    std::numeric_limits<int32_t>::min()),
+                  std::numeric_limits<int32_t>::max())),
+              inv_stddev_multiplier, inv_stddev_shift),
+          variance_shift);
+      const int64_t scaled =
+          static_cast<int64_t>(normalized) * layer_norm_coefficients[i] +
+          bias[i];
+      row[i] = MultiplyByQuantizedMultiplier(
+          static_cast<int32_t>(std::min<int64_t>(
+              std::max<int64_t>(scaled, std::numeric_limits<int32_t>::min()),
+              std::numeric_limits<int32_t>::max())),
+          multiplier, shift);
+    }
+  }
+}
+
+// Computes one gate of the integer LSTM into gate, int16 Q0.15: the input and
+// recurrent weights products, the peephole if cell_to_gate_weights is not
+// null and the layer norm if layer_norm_coefficients is not null, followed by
+// a sigmoid, or a tanh for the cell gate.
+void CalculateIntegerLstmGate(
+    const int8_t* input, const int8_t* input_to_gate_weights,
+    const int32_t* input_bias, int32_t input_multiplier, int input_shift,
+    const int8_t* activation_state, const int8_t* recurrent_to_gate_weights,
+    const int32_t* recurrent_bias, int32_t recurrent_multiplier,
+    int recurrent_shift, const int16_t* cell_state,
+    const int16_t* cell_to_gate_weights, int32_t cell_multiplier,
+    int cell_shift, const int16_t* layer_norm_coefficients,
+    const int32_t* layer_norm_bias, int32_t layer_norm_multiplier,
+    int layer_norm_shift, int n_batch, int n_input, int n_output, int n_cell,
+    bool use_tanh, int32_t* accumulator, int16_t* gate) {
+  std::fill_n(accumulator, n_batch * n_cell, 0);
+  tensor_utils::MatrixBatchVectorMultiplyAccumulate(
+      input_to_gate_weights, n_cell, n_input, input, input_bias, n_batch,
+      input_multiplier, input_shift, accumulator);
+  tensor_utils::MatrixBatchVectorMultiplyAccumulate(
+      recurrent_to_gate_weights, n_cell, n_output, activation_state,
+      recurrent_bias, n_batch, recurrent_multiplier, recurrent_shift,
+      accumulator);
+  if (cell_to_gate_weights) {
+    for (int b = 0; b < n_batch; ++b) {
+      for (int i = 0; i < n_cell; ++i) {
+        const int index = b * n_cell + i;
+        accumulator[index] += MultiplyByQuantizedMultiplier(
+            static_cast<int32_t>(cell_to_gate_weights[i]) * cell_state[index],
+            cell_multiplier, cell_shift);
+      }
+    }
+  }
+  if (layer_norm_coefficients) {
+    IntegerLayerNorm(layer_norm_coefficients, layer_norm_bias,
+                     layer_norm_multiplier, layer_norm_shift, n_batch, n_cell,
+                     accumulator);
+  }
+  for (int i = 0; i < n_batch * n_cell; ++i) {
+    gate[i] = SaturateToInt16(accumulator[i]);
+  }
+  const RuntimeShape shape({n_batch * n_cell});
+  if (use_tanh) {
+    TanhParams tanh_params;
+    tanh_params.input_left_shift = 0;
+    optimized_ops::Tanh(tanh_params, shape, gate, shape, gate);
+  } else {
+    optimized_ops::Logistic(LogisticParams(), shape, gate, shape, gate);
+  }
+}
+
 }  // namespace
 
 TfLiteStatus EvalFloat(
@@ -1092,6 +1464,215 @@ TfLiteStatus EvalFloat(
   return kTfLiteOk;
 }
 
+void PackFloatGateWeights(
+    const TfLiteTensor* input_to_input_weights,
+    const TfLiteTensor* input_to_forget_weights,
+    const TfLiteTensor* input_to_cell_weights,
+    const TfLiteTensor* input_to_output_weights,
+    const TfLiteTensor* aux_input_to_input_weights,
+    const TfLiteTensor* aux_input_to_forget_weights,
+    const TfLiteTensor* aux_input_to_cell_weights,
+    const TfLiteTensor* aux_input_to_output_weights,
+    const TfLiteTensor* recurrent_to_input_weights,
+    const TfLiteTensor* recurrent_to_forget_weights,
+    const TfLiteTensor* recurrent_to_cell_weights,
+    const TfLiteTensor* recurrent_to_output_weights,
+    const TfLiteTensor* input_gate_bias, const TfLiteTensor* forget_gate_bias,
+    const TfLiteTensor* cell_bias, const TfLiteTensor* output_gate_bias,
+    TfLiteTensor* packed_gate_weights, TfLiteTensor* packed_gate_bias) {
+  const int n_cell = input_to_output_weights->dims->data[0];
+  const int n_input = input_to_output_weights->dims->data[1];
+  const int n_aux_input = (aux_input_to_output_weights)
+                              ? aux_input_to_output_weights->dims->data[1]
+                              : 0;
+  const int n_output = recurrent_to_output_weights->dims->data[1];
+
+  const bool use_cifg = (input_to_input_weights == nullptr);
+  const TfLiteTensor* input_weights[] = {
+      input_to_input_weights, input_to_forget_weights, input_to_cell_weights,
+      input_to_output_weights};
+  const TfLiteTensor* aux_input_weights[] = {
+      aux_input_to_input_weights, aux_input_to_forget_weights,
+      aux_input_to_cell_weights, aux_input_to_output_weights};
+  const TfLiteTensor* recurrent_weights[] = {
+      recurrent_to_input_weights, recurrent_to_forget_weights,
+      recurrent_to_cell_weights, recurrent_to_output_weights};
+  const TfLiteTensor* gate_biases[] = {input_gate_bias, forget_gate_bias,
+                                       cell_bias, output_gate_bias};
+
+  const int n_gate_rows = (use_cifg ? 3 : 4) * n_cell;
+  float* packed_input_weights_ptr = packed_gate_weights->data.f;
+  float* packed_aux_input_weights_ptr =
+      packed_input_weights_ptr + n_gate_rows * n_input;
+  float* packed_recurrent_weights_ptr =
+      packed_aux_input_weights_ptr + n_gate_rows * n_aux_input;
+  float* packed_bias_ptr =
+      (packed_gate_bias) ? packed_gate_bias->data.f : nullptr;
+  for (int gate = use_cifg ? 1 : 0; gate < 4; ++gate) {
+    // The weights of each gate are contiguous row-major matrices of n_cell
+    // rows, so each block is copied as a whole.
+    tensor_utils::CopyVector(input_weights[gate]->data.f, n_cell * n_input,
+                             packed_input_weights_ptr);
+    packed_input_weights_ptr += n_cell * n_input;
+    if (n_aux_input > 0) {
+      tensor_utils::CopyVector(aux_input_weights[gate]->data.f,
+                               n_cell * n_aux_input,
+                               packed_aux_input_weights_ptr);
+      packed_aux_input_weights_ptr += n_cell * n_aux_input;
+    }
+    tensor_utils::CopyVector(recurrent_weights[gate]->data.f,
+                             n_cell * n_output, packed_recurrent_weights_ptr);
+    packed_recurrent_weights_ptr += n_cell * n_output;
+    if (packed_bias_ptr) {
+      tensor_utils::CopyVector(gate_biases[gate]->data.f, n_cell,
+                               packed_bias_ptr);
+      packed_bias_ptr += n_cell;
+    }
+  }
+}
+
+TfLiteStatus EvalFloatWithPackedGateWeights(
+    const TfLiteTensor* input, const TfLiteTensor* packed_gate_weights,
+    const TfLiteTensor* packed_gate_bias,
+    const TfLiteTensor* cell_to_input_weights,
+    const TfLiteTensor* cell_to_forget_weights,
+    const TfLiteTensor* cell_to_output_weights,
+    const TfLiteTensor* input_layer_norm_coefficients,
+    const TfLiteTensor* forget_layer_norm_coefficients,
+    const TfLiteTensor* cell_layer_norm_coefficients,
+    const TfLiteTensor* output_layer_norm_coefficients,
+    const TfLiteTensor* aux_input, const TfLiteTensor* input_gate_bias,
+    const TfLiteTensor* forget_gate_bias, const TfLiteTensor* cell_bias,
+    const TfLiteTensor* output_gate_bias,
+    const TfLiteTensor* projection_weights, const TfLiteTensor* projection_bias,
+    const TfLiteLSTMParams* params, bool forward_sequence, bool time_major,
+    int output_offset, TfLiteTensor* input_gates_buffer,
+    TfLiteTensor* scratch_buffer, TfLiteTensor* activation_state,
+    TfLiteTensor* cell_state, TfLiteTensor* output,
+    CpuBackendContext* cpu_backend_context) {
+  TF_LITE_ASSERT(input->dims->size >= 2 && input->dims->size <= 3);
+  int max_time, n_batch;
+  if (input->dims->size == 3) {
+    max_time = (time_major) ? input->dims->data[0] : input->dims->data[1];
+    n_batch = (time_major) ? input->dims->data[1] : input->dims->data[0];
+  } else {
+    max_time = 1;
+    n_batch = input->dims->data[0];
+  }
+  const int n_input = input->dims->data[input->dims->size - 1];
+  const int aux_input_size =
+      (aux_input) ? aux_input->dims->data[aux_input->dims->size - 1] : 0;
+
+  const int n_cell = cell_bias->dims->data[0];
+  const int n_gate_rows = packed_gate_weights->dims->data[0];
+  const int n_output =
+      packed_gate_weights->dims->data[1] - n_input - aux_input_size;
+  const bool use_cifg = (n_gate_rows == 3 * n_cell);
+  const bool use_peephole = (cell_to_output_weights != nullptr);
+  const bool is_layer_norm_lstm = (forget_layer_norm_coefficients != nullptr);
+
+  // Check optional tensors, the respective pointers can be null.
+  const float* packed_gate_bias_ptr =
+      (packed_gate_bias == nullptr) ? nullptr : packed_gate_bias->data.f;
+  const float* cell_to_input_weights_ptr =
+      (use_peephole && !use_cifg) ? cell_to_input_weights->data.f : nullptr;
+  const float* cell_to_forget_weights_ptr =
+      (use_peephole) ? cell_to_forget_weights->data.f : nullptr;
+  const float* cell_to_output_weights_ptr =
+      (use_peephole) ? cell_to_output_weights->data.f : nullptr;
+  const float* input_layer_norm_coefficients_ptr =
+      (is_layer_norm_lstm && !use_cifg) ? input_layer_norm_coefficients->data.f
+                                        : nullptr;
+  const float* forget_layer_norm_coefficients_ptr =
+      is_layer_norm_lstm ? forget_layer_norm_coefficients->data.f : nullptr;
+  const float* cell_layer_norm_coefficients_ptr =
+      is_layer_norm_lstm ? cell_layer_norm_coefficients->data.f : nullptr;
+  const float* output_layer_norm_coefficients_ptr =
+      is_layer_norm_lstm ? output_layer_norm_coefficients->data.f : nullptr;
+  const float* input_gate_bias_ptr =
+      (use_cifg) ? nullptr : input_gate_bias->data.f;
+  const float* projection_weights_ptr =
+      (projection_weights == nullptr) ? nullptr : projection_weights->data.f;
+  const float* projection_bias_ptr =
+      (projection_bias == nullptr) ? nullptr : projection_bias->data.f;
+
+  // The input (and auxiliary input) contribution to the gates does not depend
+  // on the state, so it is computed for all the time steps at once. The
+  // vectors of the input, and so of input_gates_buffer, are in the same order
+  // whether the input is time or batch major.
+  const int n_vectors = max_time * n_batch;
+  const float* packed_input_weights_ptr = packed_gate_weights->data.f;
+  const float* packed_aux_input_weights_ptr =
+      packed_input_weights_ptr + n_gate_rows * n_input;
+  const float* packed_recurrent_weights_ptr =
+      packed_aux_input_weights_ptr + n_gate_rows * aux_input_size;
+  float* input_gates_ptr = input_gates_buffer->data.f;
+  MatrixBatchVectorMultiply(packed_input_weights_ptr, n_gate_rows, n_input,
+                            input->data.f, n_vectors, packed_gate_bias_ptr,
+                            input_gates_ptr, cpu_backend_context);
+  if (aux_input) {
+    tensor_utils::MatrixBatchVectorMultiplyAccumulate(
+        packed_aux_input_weights_ptr, n_gate_rows, aux_input_size,
+        aux_input->data.f, n_vectors, input_gates_ptr, /*result_stride=*/1);
+  }
+
+  const int output_batch_leading_dim =
+      output->dims->data[output->dims->size - 1];
+  if (time_major) {
+    // Loop through the sequence.
+    const int input_gates_step = n_batch * n_gate_rows;
+    const int output_step = n_batch * output_batch_leading_dim;
+    for (int t = 0; t < max_time; t++) {
+      // If this is the forward_sequence, step forward, otherwise step
+      // backwards.
+      const int t_rel = forward_sequence ? t : max_time - t - 1;
+      float* output_ptr_time =
+          output->data.f + t_rel * output_step + output_offset;
+
+      LstmStepWithPackedGateWeights(
+          input_gates_ptr + t_rel * input_gates_step,
+          packed_recurrent_weights_ptr, cell_to_input_weights_ptr,
+          cell_to_forget_weights_ptr, cell_to_output_weights_ptr,
+          input_layer_norm_coefficients_ptr, forget_layer_norm_coefficients_ptr,
+          cell_layer_norm_coefficients_ptr, output_layer_norm_coefficients_ptr,
+          input_gate_bias_ptr, forget_gate_bias->data.f, cell_bias->data.f,
+          output_gate_bias->data.f, projection_weights_ptr, projection_bias_ptr,
+          params, use_cifg, n_batch, n_cell, n_output, output_batch_leading_dim,
+          activation_state->data.f, cell_state->data.f,
+          scratch_buffer->data.f, output_ptr_time, cpu_backend_context);
+    }
+  } else {
+    for (int b = 0; b < n_batch; b++) {
+      for (int t = 0; t < max_time; t++) {
+        // If this is the forward_sequence, step forward, otherwise step
+        // backwards.
+        const int t_rel = forward_sequence ? t : max_time - t - 1;
+        const int time_offset = b * max_time + t_rel;
+        float* output_ptr = output->data.f +
+                            time_offset * output_batch_leading_dim +
+                            output_offset;
+
+        LstmStepWithPackedGateWeights(
+            input_gates_ptr + time_offset * n_gate_rows,
+            packed_recurrent_weights_ptr, cell_to_input_weights_ptr,
+            cell_to_forget_weights_ptr, cell_to_output_weights_ptr,
+            input_layer_norm_coefficients_ptr,
+            forget_layer_norm_coefficients_ptr,
+            cell_layer_norm_coefficients_ptr,
+            output_layer_norm_coefficients_ptr, input_gate_bias_ptr,
+            forget_gate_bias->data.f, cell_bias->data.f,
+            output_gate_bias->data.f, projection_weights_ptr,
+            projection_bias_ptr, params, use_cifg, /*n_batch=*/1, n_cell,
+            n_output, output_batch_leading_dim,
+            activation_state->data.f + b * n_output,
+            cell_state->data.f + b * n_cell, scratch_buffer->data.f,
+            output_ptr, cpu_backend_context);
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus EvalHybrid(
     const TfLiteTensor* input, const TfLiteTensor* input_to_input_weights,
     const TfLiteTensor* input_to_forget_weights,
@@ -1405,6 +1986,222 @@ TfLiteStatus EvalHybrid(
   return kTfLiteOk;
 }
 
+void PackIntegerGateBias(
+    const TfLiteTensor* input_to_input_weights,
+    const TfLiteTensor* input_to_forget_weights,
+    const TfLiteTensor* input_to_cell_weights,
+    const TfLiteTensor* input_to_output_weights,
+    const TfLiteTensor* recurrent_to_input_weights,
+    const TfLiteTensor* recurrent_to_forget_weights,
+    const TfLiteTensor* recurrent_to_cell_weights,
+    const TfLiteTensor* recurrent_to_output_weights,
+    const TfLiteTensor* input_gate_bias, const TfLiteTensor* forget_gate_bias,
+    const TfLiteTensor* cell_bias, const TfLiteTensor* output_gate_bias,
+    bool is_layer_norm_lstm, int32_t input_zero_point,
+    int32_t activation_state_zero_point, TfLiteTensor* packed_gate_bias) {
+  const bool use_cifg = (input_to_input_weights == nullptr);
+  const int n_cell = input_to_output_weights->dims->data[0];
+  const TfLiteTensor* input_weights[] = {
+      input_to_input_weights, input_to_forget_weights, input_to_cell_weights,
+      input_to_output_weights};
+  const TfLiteTensor* recurrent_weights[] = {
+      recurrent_to_input_weights, recurrent_to_forget_weights,
+      recurrent_to_cell_weights, recurrent_to_output_weights};
+  const TfLiteTensor* biases[] = {input_gate_bias, forget_gate_bias, cell_bias,
+                                  output_gate_bias};
+  int32_t* packed_bias_ptr = GetTensorData<int32_t>(packed_gate_bias);
+  for (int gate = use_cifg ? 1 : 0; gate < 4; ++gate) {
+    if (is_layer_norm_lstm) {
+      std::fill_n(packed_bias_ptr, n_cell, 0);
+    } else {
+      std::copy_n(GetTensorData<int32_t>(biases[gate]), n_cell,
+                  packed_bias_ptr);
+    }
+    AddZeroPointRowSums(input_weights[gate], input_zero_point,
+                        packed_bias_ptr);
+    packed_bias_ptr += n_cell;
+    std::fill_n(packed_bias_ptr, n_cell, 0);
+    AddZeroPointRowSums(recurrent_weights[gate], activation_state_zero_point,
+                        packed_bias_ptr);
+    packed_bias_ptr += n_cell;
+  }
+}
+
+TfLiteStatus EvalInteger(
+    const TfLiteTensor* input, const TfLiteTensor* input_to_input_weights,
+    const TfLiteTensor* input_to_forget_weights,
+    const TfLiteTensor* input_to_cell_weights,
+    const TfLiteTensor* input_to_output_weights,
+    const TfLiteTensor* recurrent_to_input_weights,
+    const TfLiteTensor* recurrent_to_forget_weights,
+    const TfLiteTensor* recurrent_to_cell_weights,
+    const TfLiteTensor* recurrent_to_output_weights,
+    const TfLiteTensor* cell_to_input_weights,
+    const TfLiteTensor* cell_to_forget_weights,
+    const TfLiteTensor* cell_to_output_weights,
+    const TfLiteTensor* input_layer_norm_coefficients,
+    const TfLiteTensor* forget_layer_norm_coefficients,
+    const TfLiteTensor* cell_layer_norm_coefficients,
+    const TfLiteTensor* output_layer_norm_coefficients,
+    const TfLiteTensor* input_gate_bias, const TfLiteTensor* forget_gate_bias,
+    const TfLiteTensor* cell_bias, const TfLiteTensor* output_gate_bias,
+    const TfLiteTensor* projection_weights, const TfLiteTensor* projection_bias,
+    const TfLiteLSTMParams* params, const IntegerLstmParams& integer_params,
+    const TfLiteTensor* packed_gate_bias, TfLiteTensor* gate_scratch,
+    TfLiteTensor* accumulator_scratch, TfLiteTensor* hidden_scratch,
+    TfLiteTensor* activation_state, TfLiteTensor* cell_state,
+    TfLiteTensor* output) {
+  TF_LITE_ASSERT(input->dims->size >= 2 && input->dims->size <= 3);
+  const int max_time = (input->dims->size == 2) ? 1 : input->dims->data[0];
+  const int n_batch = input->dims->data[input->dims->size - 2];
+  const int n_input = input->dims->data[input->dims->size - 1];
+  const int n_cell = input_to_output_weights->dims->data[0];
+  const int n_output = recurrent_to_output_weights->dims->data[1];
+
+  const bool use_cifg = (input_to_input_weights == nullptr);
+  const bool use_peephole = (cell_to_output_weights != nullptr);
+  const bool is_layer_norm_lstm =
+      (forget_layer_norm_coefficients != nullptr);
+  const IntegerLstmParams& p = integer_params;
+
+  const TfLiteTensor* input_weights[] = {
+      input_to_input_weights, input_to_forget_weights, input_to_cell_weights,
+      input_to_output_weights};
+  const TfLiteTensor* recurrent_weights[] = {
+      recurrent_to_input_weights, recurrent_to_forget_weights,
+      recurrent_to_cell_weights, recurrent_to_output_weights};
+  const TfLiteTensor* peephole_weights[] = {
+      cell_to_input_weights, cell_to_forget_weights, nullptr,
+      cell_to_output_weights};
+  const TfLiteTensor* layer_norm_coefficients[] = {
+      input_layer_norm_coefficients, forget_layer_norm_coefficients,
+      cell_layer_norm_coefficients, output_layer_norm_coefficients};
+  const TfLiteTensor* biases[] = {input_gate_bias, forget_gate_bias, cell_bias,
+                                  output_gate_bias};
+
+  // The gates are stored one after the other in gate_scratch, and the packed
+  // biases two rows per gate, skipping the input gate with CIFG.
+  int16_t* gates[4] = {nullptr, nullptr, nullptr, nullptr};
+  const int32_t* packed_biases[4] = {nullptr, nullptr, nullptr, nullptr};
+  int16_t* gate_ptr = GetTensorData<int16_t>(gate_scratch);
+  const int32_t* packed_bias_ptr = GetTensorData<int32_t>(packed_gate_bias);
+  for (int gate = use_cifg ? 1 : 0; gate < 4; ++gate) {
+    gates[gate] = gate_ptr;
+    gate_ptr += n_batch * n_cell;
+    packed_biases[gate] = packed_bias_ptr;
+    packed_bias_ptr += 2 * n_cell;
+  }
+  int32_t* accumulator = GetTensorData<int32_t>(accumulator_scratch);
+  int8_t* hidden = GetTensorData<int8_t>(hidden_scratch);
+  int8_t* activation_state_ptr = GetTensorData<int8_t>(activation_state);
+  int16_t* cell_state_ptr = GetTensorData<int16_t>(cell_state);
+
+  for (int t = 0; t < max_time; ++t) {
+    const int8_t* input_ptr =
+        GetTensorData<int8_t>(input) + t * n_batch * n_input;
+    int8_t* output_ptr = GetTensorData<int8_t>(output) + t * n_batch * n_output;
+
+    for (int gate = use_cifg ? 1 : 0; gate < 4; ++gate) {
+      const bool has_peephole = use_peephole && gate != kCellGate;
+      CalculateIntegerLstmGate(
+          input_ptr, GetTensorData<int8_t>(input_weights[gate]),
+          packed_biases[gate], p.input_multiplier[gate], p.input_shift[gate],
+          activation_state_ptr, GetTensorData<int8_t>(recurrent_weights[gate]),
+          packed_biases[gate] + n_cell, p.recurrent_multiplier[gate],
+          p.recurrent_shift[gate], cell_state_ptr,
+          has_peephole ? GetTensorData<int16_t>(peephole_weights[gate])
+                       : nullptr,
+          p.cell_multiplier[gate], p.cell_shift[gate],
+          is_layer_norm_lstm
+              ? GetTensorData<int16_t>(layer_norm_coefficients[gate])
+              : nullptr,
+          is_layer_norm_lstm ? GetTensorData<int32_t>(biases[gate]) : nullptr,
+          p.layer_norm_multiplier[gate], p.layer_norm_shift[gate], n_batch,
+          n_input, n_output, n_cell, /*use_tanh=*/gate == kCellGate,
+          accumulator, gates[gate]);
+      // The output gate peephole reads the updated cell state.
+      if (gate == kCellGate) {
+        const int16_t* forget_gate = gates[kForgetGate];
+        const int16_t* input_gate = gates[kInputGate];
+        const int16_t* cell_gate = gates[kCellGate];
+        const int input_times_cell_shift = 30 + p.cell_scale_log2;
+        for (int i = 0; i < n_batch * n_cell; ++i) {
+          const int32_t input_gate_value =
+              use_cifg ? 32767 - forget_gate[i] : input_gate[i];
+          int32_t value =
+              gemmlowp::RoundingDivideByPOT(
+                  static_cast<int32_t>(forget_gate[i]) * cell_state_ptr[i],
+                  15) +
+              gemmlowp::RoundingDivideByPOT(input_gate_value * cell_gate[i],
+                                            input_times_cell_shift);
+          if (p.quantized_cell_clip > 0) {
+            value = std::min<int32_t>(
+                std::max<int32_t>(value, -p.quantized_cell_clip),
+                p.quantized_cell_clip);
+          }
+          cell_state_ptr[i] = SaturateToInt16(value);
+        }
+      }
+    }
+
+    // tanh of the cell state, after bringing it to Q3.12, in the cell gate
+    // buffer, which is not needed anymore.
+    int16_t* cell_tanh = gates[kCellGate];
+    const int cell_to_gate_shift =
+        p.cell_scale_log2 - kIntegerLstmGateScaleLog2;
+    for (int i = 0; i < n_batch * n_cell; ++i) {
+      const int32_t c = cell_state_ptr[i];
+      cell_tanh[i] = SaturateToInt16(
+          cell_to_gate_shift >= 0
+              ? c * (1 << cell_to_gate_shift)
+              : gemmlowp::RoundingDivideByPOT(c, -cell_to_gate_shift));
+    }
+    const RuntimeShape shape({n_batch * n_cell});
+    TanhParams tanh_params;
+    tanh_params.input_left_shift = 0;
+    optimized_ops::Tanh(tanh_params, shape, cell_tanh, shape, cell_tanh);
+
+    const int16_t* output_gate = gates[kOutputGate];
+    const int32_t output_zero_point = p.output_zero_point;
+    if (projection_weights) {
+      for (int i = 0; i < n_batch * n_cell; ++i) {
+        const int32_t hidden_value = gemmlowp::RoundingDivideByPOT(
+            static_cast<int32_t>(output_gate[i]) * cell_tanh[i],
+            30 + kIntegerLstmHiddenScaleLog2);
+        hidden[i] = static_cast<int8_t>(
+            std::min<int32_t>(std::max<int32_t>(hidden_value, -128), 127));
+      }
+      std::fill_n(accumulator, n_batch * n_output, 0);
+      tensor_utils::MatrixBatchVectorMultiplyAccumulate(
+          GetTensorData<int8_t>(projection_weights), n_output, n_cell, hidden,
+          projection_bias ? GetTensorData<int32_t>(projection_bias) : nullptr,
+          n_batch, p.output_multiplier, p.output_shift, accumulator);
+      for (int i = 0; i < n_batch * n_output; ++i) {
+        int32_t value = accumulator[i];
+        if (p.quantized_proj_clip > 0) {
+          value = std::min<int32_t>(
+              std::max<int32_t>(value, -p.quantized_proj_clip),
+              p.quantized_proj_clip);
+        }
+        output_ptr[i] = static_cast<int8_t>(std::min<int32_t>(
+            std::max<int32_t>(value + output_zero_point, -128), 127));
+      }
+    } else {
+      for (int i = 0; i < n_batch * n_output; ++i) {
+        const int32_t value =
+            MultiplyByQuantizedMultiplier(
+                static_cast<int32_t>(output_gate[i]) * cell_tanh[i],
+                p.output_multiplier, p.output_shift) +
+            output_zero_point;
+        output_ptr[i] = static_cast<int8_t>(
+            std::min<int32_t>(std::max<int32_t>(value, -128), 127));
+      }
+    }
+    std::copy_n(output_ptr, n_batch * n_output, activation_state_ptr);
+  }
+  return kTfLiteOk;
+}
+
 }  // namespace lstm_eval
 }  // namespace builtin
 }  // namespace ops
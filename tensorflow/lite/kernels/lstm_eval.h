@@ -17,6 +17,7 @@ limitations under the License.
 
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/kernels/cpu_backend_context.h"
 
 namespace tflite {
 namespace ops {
@@ -52,6 +53,61 @@ TfLiteStatus EvalFloat(
     TfLiteTensor* activation_state, TfLiteTensor* cell_state,
     TfLiteTensor* output);
 
+// Packs the input, auxiliary input and recurrent weights of all the gates of a
+// float LSTM into packed_gate_weights, of shape
+// {n_gates * n_cell, n_input + n_aux_input + n_output}. It holds three
+// consecutive row-major matrices, for the input, the auxiliary input and the
+// recurrent weights, each with n_gates * n_cell rows for the input (unless
+// CIFG), forget, cell and output gates in that order. With them, one GEMM
+// computes the contribution of the inputs to all the gates over the whole
+// sequence, and another one the recurrent contribution at each time step. The
+// gate biases are packed the same way into packed_gate_bias, which must be
+// null for layer norm LSTMs since their biases are applied after the
+// normalization.
+void PackFloatGateWeights(
+    const TfLiteTensor* input_to_input_weights,
+    const TfLiteTensor* input_to_forget_weights,
+    const TfLiteTensor* input_to_cell_weights,
+    const TfLiteTensor* input_to_output_weights,
+    const TfLiteTensor* aux_input_to_input_weights,
+    const TfLiteTensor* aux_input_to_forget_weights,
+    const TfLiteTensor* aux_input_to_cell_weights,
+    const TfLiteTensor* aux_input_to_output_weights,
+    const TfLiteTensor* recurrent_to_input_weights,
+    const TfLiteTensor* recurrent_to_forget_weights,
+    const TfLiteTensor* recurrent_to_cell_weights,
+    const TfLiteTensor* recurrent_to_output_weights,
+    const TfLiteTensor* input_gate_bias, const TfLiteTensor* forget_gate_bias,
+    const TfLiteTensor* cell_bias, const TfLiteTensor* output_gate_bias,
+    TfLiteTensor* packed_gate_weights, TfLiteTensor* packed_gate_bias);
+
+// Same as EvalFloat, with the gate weights packed by PackFloatGateWeights.
+// The input projection of all the time steps, which does not depend on the
+// state, is first computed with a single multithreaded GEMM into
+// input_gates_buffer. Each time step then only runs a GEMM for the recurrent
+// weights, followed by a fused update of the cell. The gate biases are only
+// read for layer norm LSTMs. input_gates_buffer must hold
+// max_time * n_batch * n_gates * n_cell floats.
+TfLiteStatus EvalFloatWithPackedGateWeights(
+    const TfLiteTensor* input, const TfLiteTensor* packed_gate_weights,
+    const TfLiteTensor* packed_gate_bias,
+    const TfLiteTensor* cell_to_input_weights,
+    const TfLiteTensor* cell_to_forget_weights,
+    const TfLiteTensor* cell_to_output_weights,
+    const TfLiteTensor* input_layer_norm_coefficients,
+    const TfLiteTensor* forget_layer_norm_coefficients,
+    const TfLiteTensor* cell_layer_norm_coefficients,
+    const TfLiteTensor* output_layer_norm_coefficients,
+    const TfLiteTensor* aux_input, const TfLiteTensor* input_gate_bias,
+    const TfLiteTensor* forget_gate_bias, const TfLiteTensor* cell_bias,
+    const TfLiteTensor* output_gate_bias,
+    const TfLiteTensor* projection_weights, const TfLiteTensor* projection_bias,
+    const TfLiteLSTMParams* params, bool forward_sequence, bool time_major,
+    int output_offset, TfLiteTensor* input_gates_buffer,
+    TfLiteTensor* scratch_buffer, TfLiteTensor* activation_state,
+    TfLiteTensor* cell_state, TfLiteTensor* output,
+    CpuBackendContext* cpu_backend_context);
+
 TfLiteStatus EvalHybrid(
     const TfLiteTensor* input, const TfLiteTensor* input_to_input_weights,
     const TfLiteTensor* input_to_forget_weights,
@@ -84,6 +140,105 @@ TfLiteStatus EvalHybrid(
     TfLiteTensor* cell_state_quantized, TfLiteTensor* output_state,
     TfLiteTensor* cell_state, TfLiteTensor* output);
 
+// Fixed-point formats of the intermediate values of the fully integer LSTM,
+// given as the log2 of their scales. The gate pre-activations are int16 Q3.12,
+// the input of the sigmoid and tanh, and the layer normalized gates have 10
+// fractional bits. With a projection, its int8 input is Q0.7. Using fixed
+// formats means that, apart from the cell state, no intermediate needs
+// calibration.
+constexpr int kIntegerLstmGateScaleLog2 = -12;
+constexpr int kIntegerLstmLayerNormScaleLog2 = -10;
+constexpr int kIntegerLstmHiddenScaleLog2 = -7;
+
+// Rescaling parameters of the fully integer LSTM, derived in Prepare from the
+// quantization parameters of its tensors. Multipliers and shifts are those of
+// MultiplyByQuantizedMultiplier. Gates are indexed input, forget, cell and
+// output; the input gate entries are unused with CIFG.
+struct IntegerLstmParams {
+  // From the products of the input (resp. recurrent) weights with the input
+  // (resp. activation state) to the gate pre-activations.
+  int32_t input_multiplier[4];
+  int input_shift[4];
+  int32_t recurrent_multiplier[4];
+  int recurrent_shift[4];
+  // From the products of the peephole weights with the cell state to the gate
+  // pre-activations. The cell gate has no peephole.
+  int32_t cell_multiplier[4];
+  int cell_shift[4];
+  // From the products of the layer norm coefficients with the normalized gates
+  // to the gate pre-activations.
+  int32_t layer_norm_multiplier[4];
+  int layer_norm_shift[4];
+  // From the hidden state to the output: the Q0.30 product of the output gate
+  // with tanh(cell) without projection, the projection accumulators
+  // otherwise.
+  int32_t output_multiplier;
+  int output_shift;
+  int32_t input_zero_point;
+  int32_t output_zero_point;
+  // The cell state is int16 with a scale of 2^cell_scale_log2.
+  int cell_scale_log2;
+  // cell_clip and proj_clip in the units of the cell state and output, or 0.
+  int16_t quantized_cell_clip;
+  int8_t quantized_proj_clip;
+};
+
+// Folds the zero points of the input and activation state into the gate
+// biases of a fully integer LSTM. packed_gate_bias is int32 of shape
+// {2 * n_gates, n_cell}: for each gate in the input (unless CIFG), forget,
+// cell and output order, a row added to the input weights accumulators, with
+// the gate bias unless the LSTM has layer norm, followed by one for the
+// recurrent weights accumulators.
+void PackIntegerGateBias(
+    const TfLiteTensor* input_to_input_weights,
+    const TfLiteTensor* input_to_forget_weights,
+    const TfLiteTensor* input_to_cell_weights,
+    const TfLiteTensor* input_to_output_weights,
+    const TfLiteTensor* recurrent_to_input_weights,
+    const TfLiteTensor* recurrent_to_forget_weights,
+    const TfLiteTensor* recurrent_to_cell_weights,
+    const TfLiteTensor* recurrent_to_output_weights,
+    const TfLiteTensor* input_gate_bias, const TfLiteTensor* forget_gate_bias,
+    const TfLiteTensor* cell_bias, const TfLiteTensor* output_gate_bias,
+    bool is_layer_norm_lstm, int32_t input_zero_point,
+    int32_t activation_state_zero_point, TfLiteTensor* packed_gate_bias);
+
+// Fully integer LSTM, without any float arithmetic. The input, output and
+// activation state are int8 asymmetric, the latter two with the same
+// quantization parameters, the cell state is int16 with a power of two scale,
+// and the weights are symmetric: int8 for the input, recurrent and projection
+// weights, int16 for the peephole weights and layer norm coefficients. The
+// biases are int32, with the scale of the input times the input weights, the
+// layer norm coefficients times 2^kIntegerLstmLayerNormScaleLog2, or the
+// projection weights times 2^kIntegerLstmHiddenScaleLog2. Only the tanh
+// activation is supported. gate_scratch is int16 {n_batch, n_gates * n_cell},
+// accumulator_scratch int32 {n_batch, max(n_cell, n_output)} and
+// hidden_scratch int8 {n_batch, n_cell}.
+TfLiteStatus EvalInteger(
+    const TfLiteTensor* input, const TfLiteTensor* input_to_input_weights,
+    const TfLiteTensor* input_to_forget_weights,
+    const TfLiteTensor* input_to_cell_weights,
+    const TfLiteTensor* input_to_output_weights,
+    const TfLiteTensor* recurrent_to_input_weights,
+    const TfLiteTensor* recurrent_to_forget_weights,
+    const TfLiteTensor* recurrent_to_cell_weights,
+    const TfLiteTensor* recurrent_to_output_weights,
+    const TfLiteTensor* cell_to_input_weights,
+    const TfLiteTensor* cell_to_forget_weights,
+    const TfLiteTensor* cell_to_output_weights,
+    const TfLiteTensor* input_layer_norm_coefficients,
+    const TfLiteTensor* forget_layer_norm_coefficients,
+    const TfLiteTensor* cell_layer_norm_coefficients,
+    const TfLiteTensor* output_layer_norm_coefficients,
+    const TfLiteTensor* input_gate_bias, const TfLiteTensor* forget_gate_bias,
+    const TfLiteTensor* cell_bias, const TfLiteTensor* output_gate_bias,
+    const TfLiteTensor* projection_weights, const TfLiteTensor* projection_bias,
+    const TfLiteLSTMParams* params, const IntegerLstmParams& integer_params,
+    const TfLiteTensor* packed_gate_bias, TfLiteTensor* gate_scratch,
+    TfLiteTensor* accumulator_scratch, TfLiteTensor* hidden_scratch,
+    TfLiteTensor* activation_state, TfLiteTensor* cell_state,
+    TfLiteTensor* output);
+
 }  // namespace lstm_eval
 }  // namespace builtin
 }  // namespace ops
@@ -2555,6 +2555,258 @@ TEST_F(CifgPeepholeProjectionNoClippingLayerNormLstmTest,
                 &layer_norm_lstm);
 }
 
+// Fully integer LSTM. The tensors are quantized as the post-training quantizer
+// does: int8 symmetric weights, int16 symmetric peephole weights and layer norm
+// coefficients, int32 biases and a power of two scale for the cell state.
+class IntegerLSTMOpModel : public SingleOpModel {
+ public:
+  // `tensors` holds the float values of the 24 inputs of the LSTM, by input
+  // index, with empty vectors for the omitted ones, the input and the states.
+  IntegerLSTMOpModel(int n_batch, int n_input, int n_cell, int n_output,
+                     const std::vector<std::vector<float>>& tensors,
+                     float input_min, float input_max, float output_min,
+                     float output_max, int cell_scale_log2)
+      : n_input_(n_input), n_output_(n_output) {
+    const bool is_layer_norm = !tensors[21].empty();
+    input_ = AddInput(
+        TensorData{TensorType_INT8, {n_batch, n_input}, input_min, input_max});
+    std::vector<int> ids(24, input_);
+    for (int i = 1; i < 24; ++i) {
+      if (i == 18) {
+        ids[i] = AddInput(TensorData{TensorType_INT8,
+                                     {n_batch * n_output},
+                                     output_min,
+                                     output_max},
+                          /*is_variable=*/true);
+        continue;
+      }
+      if (i == 19) {
+        ids[i] = AddInput(TensorData{TensorType_INT16,
+                                     {n_batch * n_cell},
+                                     0,
+                                     0,
+                                     std::ldexp(1.0f, cell_scale_log2)},
+                          /*is_variable=*/true);
+        continue;
+      }
+      if (tensors[i].empty()) {
+        ids[i] = AddNullInput();
+        continue;
+      }
+      std::vector<int> shape;
+      TensorType type;
+      float scale;
+      if (i <= 8 || i == 16) {
+        shape = i <= 4 ? std::vector<int>{n_cell, n_input}
+                       : i <= 8 ? std::vector<int>{n_cell, n_output}
+                                : std::vector<int>{n_output, n_cell};
+        type = TensorType_INT8;
+        scale = MaxAbs(tensors[i]) / 127;
+      } else if (i == 17) {
+        shape = {n_output};
+        type = TensorType_INT32;
+        scale = MaxAbs(tensors[16]) / 127 / 128;
+      } else if (i >= 12 && i <= 15) {
+        shape = {n_cell};
+        type = TensorType_INT32;
+        scale = is_layer_norm
+                    ? MaxAbs(tensors[i + 8]) / 32767 / 1024
+                    : GetScale(input_) * MaxAbs(tensors[i - 11]) / 127;
+      } else {
+        shape = {n_cell};
+        type = TensorType_INT16;
+        scale = MaxAbs(tensors[i]) / 32767;
+      }
+      ids[i] = AddInput(TensorData{type, shape, 0, 0, scale});
+    }
+    output_ =
+        AddOutput(TensorData{TensorType_INT8, {}, output_min, output_max});
+
+    SetBuiltinOp(BuiltinOperator_LSTM, BuiltinOptions_LSTMOptions,
+                 CreateLSTMOptions(builder_, ActivationFunctionType_TANH,
+                                   /*cell_clip=*/0.0, /*proj_clip=*/0.0)
+                     .Union());
+    BuildInterpreter({});
+
+    for (int i = 1; i < 24; ++i) {
+      if (i == 18 || i == 19 || tensors[i].empty()) {
+        continue;
+      }
+      switch (interpreter_->tensor(ids[i])->type) {
+        case kTfLiteInt8:
+          QuantizeAndPopulate<int8_t>(ids[i], tensors[i]);
+          break;
+        case kTfLiteInt16:
+          QuantizeAndPopulate<int16_t>(ids[i], tensors[i]);
+          break;
+        default:
+          QuantizeAndPopulate<int32_t>(ids[i], tensors[i]);
+      }
+    }
+  }
+
+  void SetInput(int offset, const float* begin, const float* end) {
+    std::vector<int8_t> q = Quantize<int8_t>(
+        std::vector<float>(begin, end), GetScale(input_), GetZeroPoint(input_));
+    PopulateTensor(input_, offset, q.data(), q.data() + q.size());
+  }
+
+  std::vector<float> GetDequantizedOutput() {
+    return Dequantize<int8_t>(ExtractVector<int8_t>(output_), GetScale(output_),
+                              GetZeroPoint(output_));
+  }
+
+  int num_inputs() { return n_input_; }
+  int num_outputs() { return n_output_; }
+
+  // Compares the output, up to tolerance, to the float goldens.
+  void VerifyGoldens(const std::vector<std::vector<float>>& input,
+                     const std::vector<std::vector<float>>& output,
+                     float tolerance) {
+    const int num_batches = input.size();
+    const int input_sequence_size = input[0].size() / n_input_;
+    for (int i = 0; i < input_sequence_size; ++i) {
+      for (int b = 0; b < num_batches; ++b) {
+        const float* batch_start = input[b].data() + i * n_input_;
+        SetInput(b * n_input_, batch_start, batch_start + n_input_);
+      }
+
+      Invoke();
+
+      std::vector<float> expected;
+      for (int b = 0; b < num_batches; ++b) {
+        const float* golden_start_batch = output[b].data() + i * n_output_;
+        expected.insert(expected.end(), golden_start_batch,
+                        golden_start_batch + n_output_);
+      }
+      EXPECT_THAT(GetDequantizedOutput(),
+                  ElementsAreArray(ArrayFloatNear(expected, tolerance)));
+    }
+  }
+
+ private:
+  static float MaxAbs(const std::vector<float>& values) {
+    float max_abs = 0;
+    for (const float value : values) {
+      max_abs = std::max(max_abs, std::abs(value));
+    }
+    return max_abs;
+  }
+
+  int input_;
+  int output_;
+  int n_input_;
+  int n_output_;
+};
+
+TEST_F(NoCifgNoPeepholeNoProjectionNoClippingLstmTest,
+       IntegerLstmBlackBoxTest) {
+  const int n_batch = 1;
+  const int n_input = 2;
+  const int n_cell = 4;
+  const int n_output = 4;
+  std::vector<std::vector<float>> tensors(24);
+  tensors[1] = input_to_input_weights_;
+  tensors[2] = input_to_forget_weights_;
+  tensors[3] = input_to_cell_weights_;
+  tensors[4] = input_to_output_weights_;
+  tensors[5] = recurrent_to_input_weights_;
+  tensors[6] = recurrent_to_forget_weights_;
+  tensors[7] = recurrent_to_cell_weights_;
+  tensors[8] = recurrent_to_output_weights_;
+  tensors[12] = input_gate_bias_;
+  tensors[13] = forget_gate_bias_;
+  tensors[14] = cell_gate_bias_;
+  tensors[15] = output_gate_bias_;
+
+  IntegerLSTMOpModel lstm(n_batch, n_input, n_cell, n_output, tensors,
+                          /*input_min=*/-5.0, /*input_max=*/5.0,
+                          /*output_min=*/-0.5, /*output_max=*/1.0,
+                          /*cell_scale_log2=*/-11);
+  // Within two steps of the output quantization, 1.5 / 255.
+  lstm.VerifyGoldens(lstm_input_, lstm_golden_output_, /*tolerance=*/0.012);
+}
+
+TEST_F(CifgNoPeepholeNoProjectionNoClippingLstmTest, IntegerLstmBlackBoxTest) {
+  const int n_batch = 1;
+  const int n_input = 2;
+  const int n_cell = 4;
+  const int n_output = 4;
+  std::vector<std::vector<float>> tensors(24);
+  tensors[2] = input_to_forget_weights_;
+  tensors[3] = input_to_cell_weights_;
+  tensors[4] = input_to_output_weights_;
+  tensors[6] = recurrent_to_forget_weights_;
+  tensors[7] = recurrent_to_cell_weights_;
+  tensors[8] = recurrent_to_output_weights_;
+  tensors[10] = cell_to_forget_weights_;
+  tensors[11] = cell_to_output_weights_;
+  tensors[13] = forget_gate_bias_;
+  tensors[14] = cell_gate_bias_;
+  tensors[15] = output_gate_bias_;
+
+  IntegerLSTMOpModel lstm(n_batch, n_input, n_cell, n_output, tensors,
+                          /*input_min=*/-5.0, /*input_max=*/5.0,
+                          /*output_min=*/-0.5, /*output_max=*/0.5,
+                          /*cell_scale_log2=*/-11);
+  // Within two steps of the output quantization, 1 / 255.
+  lstm.VerifyGoldens(lstm_input_, lstm_golden_output_, /*tolerance=*/0.008);
+}
+
+TEST_F(NoCifgPeepholeProjectionNoClippingLayerNormLstmTest,
+       IntegerLayerNormLstmBlackBoxTest) {
+  const int n_batch = 2;
+  const int n_input = 5;
+  const int n_cell = 4;
+  const int n_output = 3;
+  std::vector<std::vector<float>> tensors(24);
+  tensors[1] = input_to_input_weights_;
+  tensors[2] = input_to_forget_weights_;
+  tensors[3] = input_to_cell_weights_;
+  tensors[4] = input_to_output_weights_;
+  tensors[5] = recurrent_to_input_weights_;
+  tensors[6] = recurrent_to_forget_weights_;
+  tensors[7] = recurrent_to_cell_weights_;
+  tensors[8] = recurrent_to_output_weights_;
+  tensors[9] = cell_to_input_weights_;
+  tensors[10] = cell_to_forget_weights_;
+  tensors[11] = cell_to_output_weights_;
+  tensors[12] = input_gate_bias_;
+  tensors[13] = forget_gate_bias_;
+  tensors[14] = cell_gate_bias_;
+  tensors[15] = output_gate_bias_;
+  tensors[16] = projection_weights_;
+  tensors[20] = input_layer_norm_coefficients_;
+  tensors[21] = forget_layer_norm_coefficients_;
+  tensors[22] = cell_layer_norm_coefficients_;
+  tensors[23] = output_layer_norm_coefficients_;
+
+  IntegerLSTMOpModel layer_norm_lstm(n_batch, n_input, n_cell, n_output,
+                                     tensors, /*input_min=*/-1.0,
+                                     /*input_max=*/1.0, /*output_min=*/-0.25,
+                                     /*output_max=*/0.25,
+                                     /*cell_scale_log2=*/-11);
+
+  // Same goldens as the float LayerNormLstmBlackBoxTest.
+  const std::vector<std::vector<float>> layer_norm_lstm_golden_output = {
+      {
+          // Batch0: 3 (input_sequence_size) * 3 (n_output)
+          0.0244077, 0.128027, -0.00170918,  // seq 0
+          0.0137642, 0.140751, 0.0395835,    // seq 1
+          -0.00459231, 0.155278, 0.0837377,  // seq 2
+      },
+      {
+          // Batch1: 3 (input_sequence_size) * 3 (n_output)
+          -0.00692428, 0.0848741, 0.063445,  // seq 0
+          -0.00403912, 0.139963, 0.072681,   // seq 1
+          0.00752706, 0.161903, 0.0561371,   // seq 2
+      }};
+  // Within two steps of the output quantization, 0.5 / 255.
+  layer_norm_lstm.VerifyGoldens(layer_norm_lstm_input_,
+                                layer_norm_lstm_golden_output,
+                                /*tolerance=*/0.004);
+}
+
 #ifdef GTEST_HAS_DEATH_TEST
 TEST(LSTMOpModel, InvalidTypeTest) {
   const int n_batch = 1;
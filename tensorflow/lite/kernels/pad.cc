@@ -233,10 +233,18 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
                           op_context.constant_values->params.scale);
         pad_value = *GetTensorData<int8_t>(op_context.constant_values);
       }
-      if (op_context.resizing_category == ResizingCategory::kImageStyle) {
-        TF_LITE_PAD(reference_ops, PadImageStyle, int8_t, pad_value);
-      } else {
-        TF_LITE_PAD(reference_ops, Pad, int8_t, pad_value);
+      if (kernel_type == kReference) {
+        if (op_context.resizing_category == ResizingCategory::kImageStyle) {
+          TF_LITE_PAD(reference_ops, PadImageStyle, int8_t, pad_value);
+        } else {
+          TF_LITE_PAD(reference_ops, Pad, int8_t, pad_value);
+        }
+      } else if (kernel_type == kGenericOptimized) {
+        if (op_context.resizing_category == ResizingCategory::kImageStyle) {
+          TF_LITE_PAD(optimized_ops, PadImageStyle, int8_t, pad_value);
+        } else {
+          TF_LITE_PAD(optimized_ops, Pad, int8_t, pad_value);
+        }
       }
     } break;
     case kTfLiteInt32: {
@@ -104,10 +104,13 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
     words.push_back({strref.str + prev_idx, strref.len - prev_idx});
   }
 
-  // Generate n-grams recursively.
-  tflite::DynamicBuffer buf;
+  // Generate n-grams recursively, writing them straight into the output.
+  // There are at least as many n-grams as words, each about ngram_size words
+  // long; the output grows if that is not enough.
+  tflite::StringTensorWriter writer(GetOutput(context, node, 0), words.size(),
+                                    strref.len * params->ngram_size);
   if (words.size() < params->ngram_size) {
-    buf.WriteToTensorAsVector(GetOutput(context, node, 0));
+    writer.FinishAsVector();
     return kTfLiteOk;
   }
 
@@ -117,6 +120,8 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   // Stack index that indicates which depth the recursion is operating at.
   int stack_idx = 1;
   int num_words = words.size();
+  std::vector<StringRef> gram;
+  gram.reserve(params->ngram_size);
 
   while (stack_idx >= 0) {
     if (ShouldStepInRecursion(params, stack, stack_idx, num_words)) {
@@ -132,11 +137,11 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       if (ShouldIncludeCurrentNgram(params, stack_idx)) {
         // Add n-gram to tensor buffer when the stack has filled with enough
         // words to generate the ngram.
-        std::vector<StringRef> gram(stack_idx);
+        gram.clear();
         for (int i = 0; i < stack_idx; i++) {
-          gram[i] = words[stack[i]];
+          gram.push_back(words[stack[i]]);
         }
-        buf.AddJoinedString(gram, ' ');
+        writer.AddJoinedString(gram, ' ');
       }
       // When current depth cannot fill with a valid new word,
       // and not in last depth to generate ngram,
@@ -145,7 +150,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
     }
   }
 
-  buf.WriteToTensorAsVector(GetOutput(context, node, 0));
+  writer.FinishAsVector();
   return kTfLiteOk;
 }
 }  // namespace
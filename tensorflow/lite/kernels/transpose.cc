@@ -16,6 +16,8 @@ limitations under the License.
 #include <vector>
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/kernels/cpu_backend_support.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
 #include "tensorflow/lite/kernels/internal/reference/reference_ops.h"
 #include "tensorflow/lite/kernels/internal/tensor.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
@@ -29,6 +31,7 @@ namespace transpose {
 // This file has two implementations of Transpose.
 enum KernelType {
   kReference,
+  kGenericOptimized,
 };
 
 struct TransposeContext {
@@ -65,6 +68,15 @@ TfLiteStatus ResizeOutputTensor(TfLiteContext* context,
   return context->ResizeTensor(context, op_context->output, output_size);
 }
 
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  cpu_backend_support::IncrementUsageCounter(context);
+  return nullptr;
+}
+
+void Free(TfLiteContext* context, void* buffer) {
+  cpu_backend_support::DecrementUsageCounter(context);
+}
+
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_EQ(context, NumInputs(node), 2);
   TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
@@ -72,8 +84,8 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TransposeContext op_context(context, node);
 
   // Ensure validity of input tensor.
-  TF_LITE_ENSURE_MSG(context, NumDimensions(op_context.input) <= 4,
-                     "Transpose op only supports 1D-4D input arrays.");
+  TF_LITE_ENSURE_MSG(context, NumDimensions(op_context.input) <= 6,
+                     "Transpose op only supports 1D-6D input arrays.");
   TF_LITE_ENSURE_EQ(context, op_context.input->type, op_context.output->type);
 
   if (!IsConstantTensor(op_context.perm)) {
@@ -94,6 +106,11 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   const int* perm_data = GetTensorData<int32_t>(op_context.perm);
   const int size = op_context.perm->dims->data[0];
+  if (kernel_type == kReference) {
+    TF_LITE_ENSURE_MSG(context, size <= 4,
+                       "Reference Transpose op only supports 1D-4D input "
+                       "arrays.");
+  }
   TransposeParams params;
   params.perm_count = size;
   for (int i = 0; i < size; ++i) {
@@ -105,32 +122,53 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
                   GetTensorData<scalar>(op_context.input),  \
                   GetTensorShape(op_context.output),        \
                   GetTensorData<scalar>(op_context.output))
+#define TF_LITE_OPTIMIZED_TRANSPOSE(scalar)                        \
+  optimized_ops::Transpose(params, GetTensorShape(op_context.input), \
+                           GetTensorData<scalar>(op_context.input),  \
+                           GetTensorShape(op_context.output),        \
+                           GetTensorData<scalar>(op_context.output), \
+                           cpu_backend_support::GetFromContext(context))
 
   switch (op_context.input->type) {
     case kTfLiteFloat32:
       if (kernel_type == kReference) {
         TF_LITE_TRANSPOSE(reference_ops, float);
       }
+      if (kernel_type == kGenericOptimized) {
+        TF_LITE_OPTIMIZED_TRANSPOSE(float);
+      }
       break;
     case kTfLiteUInt8:
       if (kernel_type == kReference) {
         TF_LITE_TRANSPOSE(reference_ops, uint8_t);
       }
+      if (kernel_type == kGenericOptimized) {
+        TF_LITE_OPTIMIZED_TRANSPOSE(uint8_t);
+      }
       break;
     case kTfLiteInt8:
       if (kernel_type == kReference) {
         TF_LITE_TRANSPOSE(reference_ops, int8_t);
       }
+      if (kernel_type == kGenericOptimized) {
+        TF_LITE_OPTIMIZED_TRANSPOSE(int8_t);
+      }
       break;
     case kTfLiteInt32:
       if (kernel_type == kReference) {
         TF_LITE_TRANSPOSE(reference_ops, int32_t);
       }
+      if (kernel_type == kGenericOptimized) {
+        TF_LITE_OPTIMIZED_TRANSPOSE(int32_t);
+      }
       break;
     case kTfLiteInt64:
       if (kernel_type == kReference) {
         TF_LITE_TRANSPOSE(reference_ops, int64_t);
       }
+      if (kernel_type == kGenericOptimized) {
+        TF_LITE_OPTIMIZED_TRANSPOSE(int64_t);
+      }
       break;
     default:
       context->ReportError(context,
@@ -138,6 +176,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
                            op_context.input->type);
       return kTfLiteError;
   }
+#undef TF_LITE_OPTIMIZED_TRANSPOSE
 #undef TF_LITE_TRANSPOSE
 
   return kTfLiteOk;
@@ -146,12 +185,22 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 }  // namespace transpose
 
 TfLiteRegistration* Register_TRANSPOSE_REF() {
-  static TfLiteRegistration r = {nullptr, nullptr, transpose::Prepare,
+  static TfLiteRegistration r = {transpose::Init, transpose::Free,
+                                 transpose::Prepare,
                                  transpose::Eval<transpose::kReference>};
   return &r;
 }
 
-TfLiteRegistration* Register_TRANSPOSE() { return Register_TRANSPOSE_REF(); }
+TfLiteRegistration* Register_TRANSPOSE_GENERIC_OPT() {
+  static TfLiteRegistration r = {transpose::Init, transpose::Free,
+                                 transpose::Prepare,
+                                 transpose::Eval<transpose::kGenericOptimized>};
+  return &r;
+}
+
+TfLiteRegistration* Register_TRANSPOSE() {
+  return Register_TRANSPOSE_GENERIC_OPT();
+}
 
 }  // namespace builtin
 }  // namespace ops
@@ -12,8 +12,13 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
+#include <algorithm>
+#include <random>
+
 #include <gtest/gtest.h>
 #include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/kernels/cpu_backend_context.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
 #include "tensorflow/lite/kernels/internal/reference/reference_ops.h"
 #include "tensorflow/lite/kernels/internal/tensor.h"
 #include "tensorflow/lite/kernels/register.h"
@@ -136,6 +141,109 @@ TEST(TransposeTest, TestRefOps4DInt8) {
   ASSERT_EQ(out, ref);
 }
 
+// Transposes random data with optimized_ops::Transpose and compares with a
+// straightforward loop over the output.
+template <typename T>
+void RunOptimizedTestPermutation(const std::vector<int>& shape,
+                                 const std::vector<int>& perms,
+                                 CpuBackendContext* cpu_backend_context) {
+  const RuntimeShape input_shape = GetTensorShape(shape);
+  const int dims_count = shape.size();
+  RuntimeShape output_shape(dims_count);
+  for (int i = 0; i < dims_count; i++) {
+    output_shape.SetDim(i, input_shape.Dims(perms[i]));
+  }
+  const int count = input_shape.FlatSize();
+
+  std::minstd_rand random_engine(count);
+  std::vector<T> input(count);
+  for (T& value : input) {
+    value = static_cast<T>(random_engine() % 251);
+  }
+
+  std::vector<T> expected(count);
+  std::vector<int> out_index(dims_count, 0);
+  for (int out_offset = 0; out_offset < count; ++out_offset) {
+    int in_offset = 0;
+    for (int d = 0; d < dims_count; ++d) {
+      int in_index = 0;
+      for (int i = 0; i < dims_count; ++i) {
+        if (perms[i] == d) in_index = out_index[i];
+      }
+      in_offset = in_offset * shape[d] + in_index;
+    }
+    expected[out_offset] = input[in_offset];
+    for (int i = dims_count - 1; i >= 0; --i) {
+      if (++out_index[i] < output_shape.Dims(i)) break;
+      out_index[i] = 0;
+    }
+  }
+
+  TransposeParams params;
+  params.perm_count = dims_count;
+  for (int i = 0; i < dims_count; ++i) {
+    params.perm[i] = perms[i];
+  }
+  std::vector<T> output(count);
+  optimized_ops::Transpose<T>(params, input_shape, input.data(), output_shape,
+                              output.data(), cpu_backend_context);
+  ASSERT_EQ(output, expected);
+}
+
+template <typename T>
+void RunOptimizedTestAllPermutations(const std::vector<int>& shape,
+                                     CpuBackendContext* cpu_backend_context) {
+  std::vector<int> perms(shape.size());
+  for (int i = 0; i < perms.size(); ++i) perms[i] = i;
+  do {
+    RunOptimizedTestPermutation<T>(shape, perms, cpu_backend_context);
+  } while (std::next_permutation(perms.begin(), perms.end()));
+}
+
+TEST(TransposeTest, TestOptimizedOps) {
+  // Sizes that exercise both the register tiles and their remainders, with
+  // size-1 dimensions that get dropped.
+  for (const auto& shape : std::vector<std::vector<int>>{
+           {37},
+           {19, 35},
+           {16, 8},
+           {3, 17, 9},
+           {2, 1, 13, 8},
+           {2, 3, 5, 19},
+           {2, 1, 3, 4, 17},
+           {2, 3, 1, 2, 5, 9}}) {
+    RunOptimizedTestAllPermutations<float>(shape, nullptr);
+    RunOptimizedTestAllPermutations<int8_t>(shape, nullptr);
+    RunOptimizedTestAllPermutations<uint8_t>(shape, nullptr);
+    RunOptimizedTestAllPermutations<int64_t>(shape, nullptr);
+  }
+}
+
+TEST(TransposeTest, TestOptimizedOpsEmpty) {
+  for (const auto& shape : std::vector<std::vector<int>>{
+           {0}, {2, 0, 3}, {0, 5}, {3, 1, 0, 7}}) {
+    RunOptimizedTestAllPermutations<float>(shape, nullptr);
+    RunOptimizedTestAllPermutations<int8_t>(shape, nullptr);
+  }
+}
+
+TEST(TransposeTest, TestOptimizedOpsMultithreaded) {
+  CpuBackendContext cpu_backend_context;
+  cpu_backend_context.set_max_num_threads(4);
+  // NHWC <-> NCHW, and an attention head split.
+  RunOptimizedTestPermutation<float>({1, 56, 56, 67}, {0, 3, 1, 2},
+                                     &cpu_backend_context);
+  RunOptimizedTestPermutation<int8_t>({1, 67, 56, 56}, {0, 2, 3, 1},
+                                      &cpu_backend_context);
+  RunOptimizedTestPermutation<float>({2, 128, 12, 64}, {0, 2, 1, 3},
+                                     &cpu_backend_context);
+  RunOptimizedTestPermutation<int32_t>({3, 2, 37, 5, 41}, {4, 1, 0, 3, 2},
+                                       &cpu_backend_context);
+  // A single large 2D transpose is split across row blocks.
+  RunOptimizedTestPermutation<float>({517, 300}, {1, 0},
+                                     &cpu_backend_context);
+}
+
 class TransposeOpModel : public SingleOpModel {
  public:
   void SetInput(std::initializer_list<float> data) {
@@ -266,12 +374,32 @@ TEST(TransposeTest, Test3DInputDynamicTensor) {
 }
 
 #ifdef GTEST_HAS_DEATH_TEST
-TEST(TransposeTest, Test5DInputTensor) {
-  EXPECT_DEATH(TransposeOpConstModel({1, 2, 3, 4, 5}, {5}, {0, 1, 2, 3, 4}),
-               "Transpose op only supports 1D-4D input arrays.");
+TEST(TransposeTest, Test7DInputTensor) {
+  EXPECT_DEATH(
+      TransposeOpConstModel({1, 2, 3, 1, 1, 4, 5}, {7}, {0, 1, 2, 3, 4, 5, 6}),
+      "Transpose op only supports 1D-6D input arrays.");
 }
 #endif
 
+TEST(TransposeTest, Test5DInputConstTensor) {
+  TransposeOpConstModel m({2, 1, 3, 1, 2}, {5}, {4, 1, 0, 3, 2});
+  m.SetInput({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+  m.Invoke();
+  EXPECT_THAT(m.GetOutputShape(), ElementsAreArray({2, 1, 2, 1, 3}));
+  EXPECT_THAT(m.GetOutput(),
+              ElementsAreArray({0, 2, 4, 6, 8, 10, 1, 3, 5, 7, 9, 11}));
+}
+
+TEST(TransposeTest, Test6DInputDynamicTensor) {
+  TransposeOpDynamicModel m({2, 1, 3, 1, 2, 1}, {6});
+  m.SetInput({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+  m.SetPerm({4, 1, 2, 5, 3, 0});
+  m.Invoke();
+  EXPECT_THAT(m.GetOutputShape(), ElementsAreArray({2, 1, 3, 1, 1, 2}));
+  EXPECT_THAT(m.GetOutput(),
+              ElementsAreArray({0, 6, 2, 8, 4, 10, 1, 7, 3, 9, 5, 11}));
+}
+
 TEST(TransposeTest, SimpleTestNoReorderConstTensor) {
   TransposeOpConstModel m({1, 2, 3, 1}, {4}, {0, 1, 2, 3});
   m.SetInput({1, 2, 3, 4, 5, 6});
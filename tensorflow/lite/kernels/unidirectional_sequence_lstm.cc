@@ -23,6 +23,7 @@ limitations under the License.
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/kernels/activation_functor.h"
+#include "tensorflow/lite/kernels/cpu_backend_support.h"
 #include "tensorflow/lite/kernels/internal/kernel_utils.h"
 #include "tensorflow/lite/kernels/internal/tensor_utils.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
@@ -39,6 +40,10 @@ struct OpData {
   bool is_layer_norm_lstm;
   // The scratch tensor index.
   int scratch_tensor_index;
+  // The float kernel packs the gate weights into one matrix, see
+  // lstm_eval::PackFloatGateWeights. Constant weights are only packed once.
+  bool gate_weights_are_constant;
+  bool have_gate_weights_been_packed;
 };
 
 // Input Tensors of size {max_time, n_batch, n_input}
@@ -100,17 +105,48 @@ enum TemporaryTensor {
   kNumTemporaryTensors = 7
 };
 
+// Temporary tensors of the float kernel, which follows the scratch buffer
+// with these instead of the hybrid kernel ones. Their tensors are added after
+// the hybrid kernel ones.
+enum FloatTemporaryTensor {
+  kPackedGateWeights = 1,
+  kPackedGateBias = 2,
+  kInputGatesBuffer = 3,
+  kNumFloatTemporaryTensors = 4
+};
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  cpu_backend_support::IncrementUsageCounter(context);
   auto* op_data = new OpData();
-  context->AddTensors(context, kNumTemporaryTensors,
+  context->AddTensors(context,
+                      kNumTemporaryTensors + kNumFloatTemporaryTensors - 1,
                       &op_data->scratch_tensor_index);
   return op_data;
 }
 
 void Free(TfLiteContext* context, void* buffer) {
+  cpu_backend_support::DecrementUsageCounter(context);
   delete reinterpret_cast<OpData*>(buffer);
 }
 
+// Returns true if the input and recurrent weights and the gate biases, i.e.
+// what lstm_eval::PackFloatGateWeights reads, are all constant.
+bool GateWeightsAreConstant(TfLiteContext* context, TfLiteNode* node) {
+  for (const int index :
+       {kInputToInputWeightsTensor, kInputToForgetWeightsTensor,
+        kInputToCellWeightsTensor, kInputToOutputWeightsTensor,
+        kRecurrentToInputWeightsTensor, kRecurrentToForgetWeightsTensor,
+        kRecurrentToCellWeightsTensor, kRecurrentToOutputWeightsTensor,
+        kInputGateBiasTensor, kForgetGateBiasTensor, kCellGateBiasTensor,
+        kOutputGateBiasTensor}) {
+    const TfLiteTensor* tensor = GetOptionalInputTensor(context, node, index);
+    if (tensor != nullptr && !IsConstantTensor(tensor)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // Check that input tensor dimensions matches with each other.
 TfLiteStatus CheckInputTensorDimensions(TfLiteContext* context,
                                         TfLiteNode* node, int n_input,
@@ -341,6 +377,7 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       reinterpret_cast<TfLiteUnidirectionalSequenceLSTMParams*>(
           node->builtin_data);
   const bool time_major = params->time_major;
+  const int max_time = time_major ? input->dims->data[0] : input->dims->data[1];
   const int n_batch = time_major ? input->dims->data[1] : input->dims->data[0];
   const int n_input = input->dims->data[2];
 
@@ -382,11 +419,12 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_OK(context,
                     context->ResizeTensor(context, output, output_size));
 
+  const bool is_hybrid_op = IsHybridOp(input, input_to_output_weights);
   TfLiteIntArrayFree(node->temporaries);
-  if (IsHybridOp(input, input_to_output_weights)) {
+  if (is_hybrid_op) {
     node->temporaries = TfLiteIntArrayCreate(kNumTemporaryTensors);
   } else {
-    node->temporaries = TfLiteIntArrayCreate(1);
+    node->temporaries = TfLiteIntArrayCreate(kNumFloatTemporaryTensors);
   }
   node->temporaries->data[0] = scratch_tensor_index;
 
@@ -410,7 +448,56 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_OK(context, context->ResizeTensor(context, scratch_buffer,
                                                    scratch_buffer_size));
 
-  if (IsHybridOp(input, input_to_output_weights)) {
+  if (!is_hybrid_op) {
+    // Allocate the packed gate weights and biases. Constant weights are kept
+    // packed across invocations, others are packed at every invocation.
+    const int n_gate_rows = (use_cifg ? 3 : 4) * n_cell;
+    op_data->gate_weights_are_constant = GateWeightsAreConstant(context, node);
+    op_data->have_gate_weights_been_packed = false;
+    const TfLiteAllocationType packed_allocation_type =
+        op_data->gate_weights_are_constant ? kTfLiteArenaRwPersistent
+                                           : kTfLiteArenaRw;
+    const int float_tensor_index = scratch_tensor_index + kNumTemporaryTensors;
+    node->temporaries->data[kPackedGateWeights] =
+        float_tensor_index + kPackedGateWeights - 1;
+    TfLiteTensor* packed_gate_weights =
+        GetTemporary(context, node, kPackedGateWeights);
+    packed_gate_weights->type = kTfLiteFloat32;
+    packed_gate_weights->allocation_type = packed_allocation_type;
+    TfLiteIntArray* packed_gate_weights_size = TfLiteIntArrayCreate(2);
+    packed_gate_weights_size->data[0] = n_gate_rows;
+    packed_gate_weights_size->data[1] = n_input + n_output;
+    TF_LITE_ENSURE_OK(context,
+                      context->ResizeTensor(context, packed_gate_weights,
+                                            packed_gate_weights_size));
+    node->temporaries->data[kPackedGateBias] =
+        float_tensor_index + kPackedGateBias - 1;
+    TfLiteTensor* packed_gate_bias =
+        GetTemporary(context, node, kPackedGateBias);
+    packed_gate_bias->type = kTfLiteFloat32;
+    packed_gate_bias->allocation_type = packed_allocation_type;
+    TfLiteIntArray* packed_gate_bias_size = TfLiteIntArrayCreate(1);
+    packed_gate_bias_size->data[0] = n_gate_rows;
+    TF_LITE_ENSURE_OK(context, context->ResizeTensor(context, packed_gate_bias,
+                                                     packed_gate_bias_size));
+
+    // Allocate a temporary tensor for the contribution of the input to the
+    // gates, which is computed for the whole sequence at once.
+    node->temporaries->data[kInputGatesBuffer] =
+        float_tensor_index + kInputGatesBuffer - 1;
+    TfLiteTensor* input_gates_buffer =
+        GetTemporary(context, node, kInputGatesBuffer);
+    input_gates_buffer->type = kTfLiteFloat32;
+    input_gates_buffer->allocation_type = kTfLiteArenaRw;
+    TfLiteIntArray* input_gates_buffer_size = TfLiteIntArrayCreate(2);
+    input_gates_buffer_size->data[0] = max_time * n_batch;
+    input_gates_buffer_size->data[1] = n_gate_rows;
+    TF_LITE_ENSURE_OK(context,
+                      context->ResizeTensor(context, input_gates_buffer,
+                                            input_gates_buffer_size));
+  }
+
+  if (is_hybrid_op) {
     // Allocate temporary tensors to store quantized values of input,
     // activation_state and cell_state tensors.
     node->temporaries->data[kInputQuantized] =
@@ -510,7 +597,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const auto* params =
       reinterpret_cast<TfLiteUnidirectionalSequenceLSTMParams*>(
           node->builtin_data);
-  const OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
+  OpData* op_data = reinterpret_cast<OpData*>(node->user_data);
   const bool is_layer_norm_lstm = op_data->is_layer_norm_lstm;
   const bool time_major = params->time_major;
   const TfLiteTensor* input = GetInput(context, node, kInputTensor);
@@ -588,23 +675,39 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   switch (input_to_output_weights->type) {
     case kTfLiteFloat32: {
-      return lstm_eval::EvalFloat(
-          input, input_to_input_weights, input_to_forget_weights,
-          input_to_cell_weights, input_to_output_weights,
-          recurrent_to_input_weights, recurrent_to_forget_weights,
-          recurrent_to_cell_weights, recurrent_to_output_weights,
-          cell_to_input_weights, cell_to_forget_weights, cell_to_output_weights,
+      TfLiteTensor* packed_gate_weights =
+          GetTemporary(context, node, kPackedGateWeights);
+      // Layer norm LSTMs add the gate biases after the normalization.
+      TfLiteTensor* packed_gate_bias =
+          is_layer_norm_lstm ? nullptr
+                             : GetTemporary(context, node, kPackedGateBias);
+      TfLiteTensor* input_gates_buffer =
+          GetTemporary(context, node, kInputGatesBuffer);
+      if (!op_data->gate_weights_are_constant ||
+          !op_data->have_gate_weights_been_packed) {
+        lstm_eval::PackFloatGateWeights(
+            input_to_input_weights, input_to_forget_weights,
+            input_to_cell_weights, input_to_output_weights,
+            /*aux_input_to_input_weights=*/nullptr,
+            /*aux_input_to_forget_weights=*/nullptr,
+            /*aux_input_to_cell_weights=*/nullptr,
+            /*aux_input_to_output_weights=*/nullptr,
+            recurrent_to_input_weights, recurrent_to_forget_weights,
+            recurrent_to_cell_weights, recurrent_to_output_weights,
+            input_gate_bias, forget_gate_bias, cell_bias, output_gate_bias,
+            packed_gate_weights, packed_gate_bias);
+        op_data->have_gate_weights_been_packed = true;
+      }
+      return lstm_eval::EvalFloatWithPackedGateWeights(
+          input, packed_gate_weights, packed_gate_bias, cell_to_input_weights,
+          cell_to_forget_weights, cell_to_output_weights,
           input_layer_norm_coefficients, forget_layer_norm_coefficients,
           cell_layer_norm_coefficients, output_layer_norm_coefficients,
-          /*aux_input=*/nullptr,
-          /*aux_input_to_input_weights=*/nullptr,
-          /*aux_input_to_forget_weights=*/nullptr,
-          /*aux_input_to_cell_weights=*/nullptr,
-          /*aux_input_to_output_weights=*/nullptr, input_gate_bias,
-          forget_gate_bias, cell_bias, output_gate_bias, projection_weights,
-          projection_bias, &lstm_params, /*forward_sequence=*/true, time_major,
-          /*output_offset=*/0, scratch_buffer, activation_state, cell_state,
-          output);
+          /*aux_input=*/nullptr, input_gate_bias, forget_gate_bias, cell_bias,
+          output_gate_bias, projection_weights, projection_bias, &lstm_params,
+          /*forward_sequence=*/true, time_major, /*output_offset=*/0,
+          input_gates_buffer, scratch_buffer, activation_state, cell_state,
+          output, cpu_backend_support::GetFromContext(context));
     }
     case kTfLiteUInt8:
     case kTfLiteInt8: {
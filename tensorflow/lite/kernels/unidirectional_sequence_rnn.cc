@@ -22,7 +22,11 @@ limitations under the License.
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/kernels/activation_functor.h"
+#include "tensorflow/lite/kernels/cpu_backend_context.h"
+#include "tensorflow/lite/kernels/cpu_backend_support.h"
 #include "tensorflow/lite/kernels/internal/kernel_utils.h"
+#include "tensorflow/lite/kernels/internal/optimized/optimized_ops.h"
+#include "tensorflow/lite/kernels/internal/tensor.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/op_macros.h"
 
@@ -42,12 +46,14 @@ constexpr int kHiddenStateTensor = 4;
 constexpr int kOutputTensor = 0;
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  cpu_backend_support::IncrementUsageCounter(context);
   auto* scratch_tensor_index = new int;
   context->AddTensors(context, /*tensors_to_add=*/3, scratch_tensor_index);
   return scratch_tensor_index;
 }
 
 void Free(TfLiteContext* context, void* buffer) {
+  cpu_backend_support::DecrementUsageCounter(context);
   delete reinterpret_cast<int*>(buffer);
 }
 
@@ -146,7 +152,8 @@ TfLiteStatus EvalFloat(const TfLiteTensor* input,
                        const TfLiteTensor* recurrent_weights,
                        const TfLiteTensor* bias,
                        const TfLiteSequenceRNNParams* params,
-                       TfLiteTensor* hidden_state, TfLiteTensor* output) {
+                       TfLiteTensor* hidden_state, TfLiteTensor* output,
+                       CpuBackendContext* cpu_backend_context) {
   // Initialize the pointer bias.
   const float* bias_ptr = bias->data.f;
 
@@ -162,20 +169,31 @@ TfLiteStatus EvalFloat(const TfLiteTensor* input,
   const float* input_weights_ptr = input_weights->data.f;
   const float* recurrent_weights_ptr = recurrent_weights->data.f;
 
+  // The contribution of the input does not depend on the hidden state, so it
+  // is computed for all the time steps at once with a single matrix
+  // multiplication, straight into the output.
+  FullyConnectedParams fc_params;
+  fc_params.float_activation_min = std::numeric_limits<float>::lowest();
+  fc_params.float_activation_max = std::numeric_limits<float>::max();
+  optimized_ops::FullyConnected(
+      fc_params, RuntimeShape({max_time * batch_size, input_size}),
+      input->data.f, GetTensorShape(input_weights), input_weights_ptr,
+      GetTensorShape(bias), bias_ptr,
+      RuntimeShape({max_time * batch_size, num_units}), output->data.f,
+      cpu_backend_context);
+
   if (time_major) {
     // Initialize the pointer to hidden state.
     float* hidden_state_ptr_batch = hidden_state->data.f;
     // Unroll the sequence and use batch operations for efficiency.
     for (int s = 0; s < max_time; s++) {
-      // Initialize the pointer to input and output.
-      const float* input_ptr_batch =
-          input->data.f + s * input_size * batch_size;
+      // Initialize the pointer to output.
       float* output_ptr_batch = output->data.f + s * num_units * batch_size;
 
-      kernel_utils::RnnBatchStep(
-          input_ptr_batch, input_weights_ptr, recurrent_weights_ptr, bias_ptr,
-          input_size, num_units, batch_size, num_units, params->activation,
-          hidden_state_ptr_batch, output_ptr_batch);
+      kernel_utils::RnnBatchStepWithInputProjection(
+          output_ptr_batch, recurrent_weights_ptr, num_units, batch_size,
+          num_units, params->activation, hidden_state_ptr_batch,
+          output_ptr_batch);
     }
   } else {
     // For each batch
@@ -183,16 +201,14 @@ TfLiteStatus EvalFloat(const TfLiteTensor* input,
       // Initialize the pointer to hidden state.
       float* hidden_state_ptr_batch = hidden_state->data.f + b * num_units;
       for (int s = 0; s < max_time; s++) {
-        // Initialize the pointer to input and output.
-        const float* input_ptr_batch =
-            input->data.f + b * input_size * max_time + s * input_size;
+        // Initialize the pointer to output.
         float* output_ptr_batch =
             output->data.f + b * num_units * max_time + s * num_units;
 
-        kernel_utils::RnnBatchStep(
-            input_ptr_batch, input_weights_ptr, recurrent_weights_ptr, bias_ptr,
-            input_size, num_units, /*batch_size=*/1, num_units,
-            params->activation, hidden_state_ptr_batch, output_ptr_batch);
+        kernel_utils::RnnBatchStepWithInputProjection(
+            output_ptr_batch, recurrent_weights_ptr, num_units,
+            /*batch_size=*/1, num_units, params->activation,
+            hidden_state_ptr_batch, output_ptr_batch);
       }
     }
   }
@@ -299,7 +315,8 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   switch (input_weights->type) {
     case kTfLiteFloat32:
       return EvalFloat(input, input_weights, recurrent_weights, bias, params,
-                       hidden_state, output);
+                       hidden_state, output,
+                       cpu_backend_support::GetFromContext(context));
     case kTfLiteUInt8:
     case kTfLiteInt8: {
       // TODO(mirkov): implement eval with quantized inputs as well.
@@ -119,6 +119,8 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
 
   Subgraph* cond_subgraph = (*subgraphs)[op_data->cond_subgraph_index].get();
   Subgraph* body_subgraph = (*subgraphs)[op_data->body_subgraph_index].get();
+  TF_LITE_ENSURE_OK(context, cond_subgraph->EnsureMaterialized());
+  TF_LITE_ENSURE_OK(context, body_subgraph->EnsureMaterialized());
 
   // Check input & output count of the condition subgraph.
   TF_LITE_ENSURE_EQ(context, cond_subgraph->inputs().size(), num_inputs);
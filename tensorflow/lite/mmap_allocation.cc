@@ -19,10 +19,31 @@ limitations under the License.
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <cstdint>
+
 #include "tensorflow/lite/allocation.h"
 #include "tensorflow/lite/core/api/error_reporter.h"
 
 namespace tflite {
+namespace {
+
+// Widens the `bytes` bytes at `ptr` to whole pages, as madvise and mlock
+// require. Returns false if they are not within [base, base + size).
+bool GetPageRange(const void* base, size_t size, const void* ptr, size_t bytes,
+                  void** page_start, size_t* page_bytes) {
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(base);
+  const uintptr_t start = reinterpret_cast<uintptr_t>(ptr);
+  if (start < begin || start - begin > size || bytes > size - (start - begin)) {
+    return false;
+  }
+  const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  const uintptr_t aligned_start = start - start % page_size;
+  *page_start = reinterpret_cast<void*>(aligned_start);
+  *page_bytes = start + bytes - aligned_start;
+  return true;
+}
+
+}  // namespace
 
 MMAPAllocation::MMAPAllocation(const char* filename,
                                ErrorReporter* error_reporter)
@@ -56,6 +77,43 @@ size_t MMAPAllocation::bytes() const { return buffer_size_bytes_; }
 
 bool MMAPAllocation::valid() const { return mmapped_buffer_ != MAP_FAILED; }
 
+bool MMAPAllocation::Advise(Advice advice, const void* ptr,
+                            size_t bytes) const {
+  void* page_start;
+  size_t page_bytes;
+  if (!valid() || !GetPageRange(mmapped_buffer_, buffer_size_bytes_, ptr,
+                                bytes, &page_start, &page_bytes)) {
+    return false;
+  }
+  int posix_advice = MADV_NORMAL;
+  switch (advice) {
+    case Advice::kNormal:
+      posix_advice = MADV_NORMAL;
+      break;
+    case Advice::kSequential:
+      posix_advice = MADV_SEQUENTIAL;
+      break;
+    case Advice::kRandom:
+      posix_advice = MADV_RANDOM;
+      break;
+    case Advice::kWillNeed:
+      posix_advice = MADV_WILLNEED;
+      break;
+  }
+  return madvise(page_start, page_bytes, posix_advice) == 0;
+}
+
+bool MMAPAllocation::Lock(const void* ptr, size_t bytes) const {
+  void* page_start;
+  size_t page_bytes;
+  if (!valid() || !GetPageRange(mmapped_buffer_, buffer_size_bytes_, ptr,
+                                bytes, &page_start, &page_bytes)) {
+    return false;
+  }
+  // The lock goes away with the mapping, in the destructor.
+  return mlock(page_start, page_bytes) == 0;
+}
+
 bool MMAPAllocation::IsSupported() { return true; }
 
 }  // namespace tflite
@@ -34,6 +34,15 @@ size_t MMAPAllocation::bytes() const { return 0; }
 
 bool MMAPAllocation::valid() const { return false; }
 
+bool MMAPAllocation::Advise(Advice advice, const void* ptr,
+                            size_t bytes) const {
+  return false;
+}
+
+bool MMAPAllocation::Lock(const void* ptr, size_t bytes) const {
+  return false;
+}
+
 bool MMAPAllocation::IsSupported() { return false; }
 
 }  // namespace tflite
@@ -19,12 +19,24 @@ limitations under the License.
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <thread>  // NOLINT(build/c++11)
+#include <utility>
+#include <vector>
+
 #include "tensorflow/lite/allocation.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_internal.h"
 #include "tensorflow/lite/core/api/error_reporter.h"
 #include "tensorflow/lite/core/api/flatbuffer_conversions.h"
 #include "tensorflow/lite/model.h"
+#include "tensorflow/lite/util.h"
 #include "tensorflow/lite/version.h"
 
 namespace tflite {
@@ -146,6 +158,53 @@ std::unique_ptr<FlatBufferModel> FlatBufferModel::VerifyAndBuildFromBuffer(
   return BuildFromBuffer(buffer, buffer_size, error_reporter);
 }
 
+std::unique_ptr<FlatBufferModel> FlatBufferModel::VerifyAndBuildFromReader(
+    StreamReader* reader, size_t stream_bytes, TfLiteVerifier* extra_verifier,
+    ErrorReporter* error_reporter) {
+  error_reporter = ValidateErrorReporter(error_reporter);
+
+  // Stop reading as soon as the header shows that the stream is not a model,
+  // rather than after the whole stream was read.
+  auto check_header = [error_reporter, stream_bytes](const char* data,
+                                                     size_t bytes) {
+    if (bytes < sizeof(flatbuffers::uoffset_t) +
+                    flatbuffers::FlatBufferBuilder::kFileIdentifierLength) {
+      return true;
+    }
+    if (!ModelBufferHasIdentifier(data) ||
+        (stream_bytes &&
+         flatbuffers::ReadScalar<flatbuffers::uoffset_t>(data) >=
+             stream_bytes)) {
+      error_reporter->Report("The stream is not a valid Flatbuffer model");
+      return false;
+    }
+    return true;
+  };
+  std::unique_ptr<Allocation> allocation(new StreamingAllocation(
+      reader, stream_bytes, check_header, error_reporter));
+  if (!allocation->valid()) {
+    return nullptr;
+  }
+
+  const char* buffer = static_cast<const char*>(allocation->base());
+  flatbuffers::Verifier base_verifier(reinterpret_cast<const uint8_t*>(buffer),
+                                      allocation->bytes());
+  if (!VerifyModelBuffer(base_verifier)) {
+    error_reporter->Report("The model is not a valid Flatbuffer stream");
+    return nullptr;
+  }
+
+  if (extra_verifier &&
+      !extra_verifier->Verify(buffer, allocation->bytes(), error_reporter)) {
+    return nullptr;
+  }
+
+  std::unique_ptr<FlatBufferModel> model(
+      new FlatBufferModel(std::move(allocation), error_reporter));
+  if (!model->initialized()) model.reset();
+  return model;
+}
+
 std::unique_ptr<FlatBufferModel> FlatBufferModel::BuildFromModel(
     const tflite::Model* caller_owned_model_spec,
     ErrorReporter* error_reporter) {
@@ -239,11 +298,155 @@ class MallocDataAllocator : public BuiltinDataAllocator {
   void Deallocate(void* data) override { free(data); }
 };
 
-}  // namespace
+// A palette compressed buffer to decompress: `num_elements` indices of
+// `index_bits` bits into `num_values` values of `value_bytes` bytes. Writes the
+// values to `output`, or only checks the indices if `output` is null.
+struct PaletteDecompression {
+  const uint8_t* indices;
+  int index_bits;
+  const uint8_t* values;
+  size_t value_bytes;
+  size_t num_values;
+  size_t num_elements;
+  char* output;
+};
+
+// The data and size in bytes of the decompressed buffers, keyed by buffer index
+// and whether the tensors using them keep them compressed.
+using DecompressedBuffers =
+    std::map<std::pair<uint32_t, bool>, std::pair<const char*, size_t>>;
+
+// Decompresses elements [begin, end) of `decompression`. Returns false if an
+// index is out of range.
+bool DecompressPalette(const PaletteDecompression& decompression, size_t begin,
+                       size_t end) {
+  const int index_bits = decompression.index_bits;
+  const int index_mask = (1 << index_bits) - 1;
+  const size_t value_bytes = decompression.value_bytes;
+  for (size_t i = begin; i < end; ++i) {
+    const size_t bit = i * index_bits;
+    const size_t index =
+        (decompression.indices[bit / 8] >> (bit % 8)) & index_mask;
+    if (index >= decompression.num_values) {
+      return false;
+    }
+    if (decompression.output) {
+      memcpy(decompression.output + i * value_bytes,
+             decompression.values + index * value_bytes, value_bytes);
+    }
+  }
+  return true;
+}
+
+// Builds the tensors and nodes of the subgraphs of a model. Unlike
+// InterpreterBuilder it does not need the op resolver, so it can be kept
+// alive by subgraphs that are built on first use.
+class SubgraphBuilder {
+ public:
+  SubgraphBuilder(const ::tflite::Model* model,
+                  std::vector<const TfLiteRegistration*> registrations,
+                  ErrorReporter* error_reporter, const Allocation* allocation,
+                  int num_threads, bool keep_palettized_weights,
+                  WeightRegistry* weight_registry)
+      : model_(model),
+        flatbuffer_op_index_to_registration_(std::move(registrations)),
+        error_reporter_(error_reporter),
+        allocation_(allocation),
+        num_threads_(num_threads),
+        keep_palettized_weights_(keep_palettized_weights),
+        weight_registry_(weight_registry) {}
+
+  // Builds subgraph `subgraph_index` of the model into `subgraph`.
+  TfLiteStatus Build(int subgraph_index, Subgraph* subgraph) const {
+    TF_LITE_ENSURE_STATUS(BuildTensors(subgraph_index, subgraph));
+    return BuildNodes(subgraph_index, subgraph);
+  }
+
+  // Sets up the tensors, inputs and outputs of the subgraph. This only
+  // touches `subgraph`, so different subgraphs can be set up concurrently.
+  TfLiteStatus BuildTensors(int subgraph_index, Subgraph* subgraph) const;
+
+  // Adds the nodes of the subgraph, once its tensors are set up. This runs
+  // the init function of the ops, which may share state across subgraphs.
+  TfLiteStatus BuildNodes(int subgraph_index, Subgraph* subgraph) const;
+
+ private:
+  TfLiteStatus ParseNodes(
+      const flatbuffers::Vector<flatbuffers::Offset<Operator>>* operators,
+      Subgraph* subgraph) const;
+  TfLiteStatus ParseTensors(
+      const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
+      const flatbuffers::Vector<flatbuffers::Offset<Tensor>>* tensors,
+      const std::vector<bool>& keep_palettized, Subgraph* subgraph) const;
+  // Returns whether each tensor of `src_subgraph` is palette compressed
+  // weights to keep compressed, i.e. float weights only used by
+  // FULLY_CONNECTED ops, when `keep_palettized_weights_` is set.
+  std::vector<bool> FindPalettizedWeightsToKeep(
+      const tflite::SubGraph* src_subgraph) const;
+  // Decompresses the palette compressed buffers used by `tensors` into memory
+  // owned by `subgraph`, and adds them to `decompressed_data`. The buffers
+  // kept compressed only have their indices unpacked to bytes.
+  TfLiteStatus DecompressBuffers(
+      const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
+      const flatbuffers::Vector<flatbuffers::Offset<Tensor>>* tensors,
+      const std::vector<bool>& keep_palettized, Subgraph* subgraph,
+      DecompressedBuffers* decompressed_data) const;
+  // Also sets `borrowed_scale` when the scales are not copied into
+  // `quantization`, but must be pointed at the model once the tensor is set.
+  TfLiteStatus ParseQuantization(const QuantizationParameters* src_quantization,
+                                 TfLiteQuantization* quantization,
+                                 const TfLiteFloatArray** borrowed_scale) const;
+
+  const ::tflite::Model* model_;
+  const std::vector<const TfLiteRegistration*>
+      flatbuffer_op_index_to_registration_;
+  ErrorReporter* error_reporter_;
+  const Allocation* allocation_;
+  const int num_threads_;
+  const bool keep_palettized_weights_;
+  WeightRegistry* const weight_registry_;
+};
+
+TfLiteStatus SubgraphBuilder::BuildTensors(int subgraph_index,
+                                           Subgraph* subgraph) const {
+  const tflite::SubGraph* src_subgraph = (*model_->subgraphs())[subgraph_index];
+  auto operators = src_subgraph->operators();
+  auto tensors = src_subgraph->tensors();
+  auto buffers = model_->buffers();
+  if (!operators || !tensors || !buffers) {
+    error_reporter_->Report(
+        "Did not get operators, tensors, or buffers in subgraph %d.\n",
+        subgraph_index);
+    return kTfLiteError;
+  }
+  TF_LITE_ENSURE_STATUS(subgraph->AddTensors(tensors->Length()));
+  // Parse inputs/outputs
+  subgraph->SetInputs(FlatBufferIntArrayToVector(src_subgraph->inputs()));
+  subgraph->SetOutputs(FlatBufferIntArrayToVector(src_subgraph->outputs()));
+
+  TF_LITE_ENSURE_STATUS(
+      ParseTensors(buffers, tensors,
+                   FindPalettizedWeightsToKeep(src_subgraph), subgraph));
+
+  std::vector<int> variables;
+  for (int i = 0; i < subgraph->tensors_size(); ++i) {
+    auto* tensor = subgraph->tensor(i);
+    if (tensor->is_variable) {
+      variables.push_back(i);
+    }
+  }
+  return subgraph->SetVariables(std::move(variables));
+}
+
+TfLiteStatus SubgraphBuilder::BuildNodes(int subgraph_index,
+                                         Subgraph* subgraph) const {
+  const tflite::SubGraph* src_subgraph = (*model_->subgraphs())[subgraph_index];
+  return ParseNodes(src_subgraph->operators(), subgraph);
+}
 
-TfLiteStatus InterpreterBuilder::ParseNodes(
+TfLiteStatus SubgraphBuilder::ParseNodes(
     const flatbuffers::Vector<flatbuffers::Offset<Operator>>* operators,
-    Subgraph* subgraph) {
+    Subgraph* subgraph) const {
   TfLiteStatus status = kTfLiteOk;
 
   // Reduce the number of redundant allocations
@@ -296,10 +499,221 @@ TfLiteStatus InterpreterBuilder::ParseNodes(
   return status;
 }
 
-TfLiteStatus InterpreterBuilder::ParseQuantization(
+std::vector<bool> SubgraphBuilder::FindPalettizedWeightsToKeep(
+    const tflite::SubGraph* src_subgraph) const {
+  auto tensors = src_subgraph->tensors();
+  auto buffers = model_->buffers();
+  std::vector<bool> keep(tensors->Length(), false);
+  if (!keep_palettized_weights_) {
+    return keep;
+  }
+  for (int i = 0; i < tensors->Length(); ++i) {
+    const auto* tensor = tensors->Get(i);
+    const auto* quantization = tensor->quantization();
+    if (tensor->type() != TensorType_FLOAT32 || tensor->buffer() == 0 ||
+        tensor->buffer() >= buffers->size() ||
+        (quantization && quantization->scale() &&
+         quantization->scale()->size() > 0)) {
+      continue;
+    }
+    const auto* buffer = buffers->Get(tensor->buffer());
+    keep[i] = buffer && buffer->palette() && buffer->palette()->values() &&
+              buffer->palette()->values()->size() / sizeof(float) <= 256;
+  }
+  // Only keep the weights whose every use is as the weights of a
+  // FULLY_CONNECTED op that runs on the default weights format.
+  auto mark_used = [&](const flatbuffers::Vector<int32_t>* indices) {
+    if (!indices) return;
+    for (int32_t index : *indices) {
+      if (index >= 0 && index < tensors->Length()) {
+        keep[index] = false;
+      }
+    }
+  };
+  mark_used(src_subgraph->outputs());
+  std::vector<bool> used(tensors->Length(), false);
+  auto operator_codes = model_->operator_codes();
+  for (const auto* op : *src_subgraph->operators()) {
+    const auto* inputs = op->inputs();
+    const bool is_fully_connected =
+        op->opcode_index() < operator_codes->size() &&
+        operator_codes->Get(op->opcode_index())->builtin_code() ==
+            BuiltinOperator_FULLY_CONNECTED &&
+        (!op->builtin_options_as_FullyConnectedOptions() ||
+         op->builtin_options_as_FullyConnectedOptions()->weights_format() ==
+             FullyConnectedOptionsWeightsFormat_DEFAULT);
+    if (!inputs) continue;
+    for (int j = 0; j < inputs->Length(); ++j) {
+      const int32_t index = inputs->Get(j);
+      if (index < 0 || index >= tensors->Length()) continue;
+      if (is_fully_connected && j == 1) {
+        used[index] = true;
+      } else {
+        keep[index] = false;
+      }
+    }
+    mark_used(op->outputs());
+  }
+  for (int i = 0; i < tensors->Length(); ++i) {
+    keep[i] = keep[i] && used[i];
+  }
+  return keep;
+}
+
+TfLiteStatus SubgraphBuilder::DecompressBuffers(
+    const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
+    const flatbuffers::Vector<flatbuffers::Offset<Tensor>>* tensors,
+    const std::vector<bool>& keep_palettized, Subgraph* subgraph,
+    DecompressedBuffers* decompressed_data) const {
+  // Unpacks the indices of the weights kept compressed.
+  static const struct IdentityPalette {
+    IdentityPalette() {
+      for (int i = 0; i < 256; ++i) values[i] = i;
+    }
+    uint8_t values[256];
+  } kIdentityPalette;
+  // Aligned like the buffers in the model.
+  constexpr size_t kAlignment = 16;
+  constexpr size_t kNoOffset = static_cast<size_t>(-1);
+
+  // Collect the buffers to decompress, then decompress them all into a
+  // single block owned by the subgraph.
+  std::vector<PaletteDecompression> decompressions;
+  std::vector<size_t> offsets;
+  std::vector<std::pair<uint32_t, bool>> keys;
+  size_t total_bytes = 0;
+  for (int i = 0; i < tensors->Length(); ++i) {
+    const auto* tensor = tensors->Get(i);
+    if (tensor->buffer() == 0 || tensor->buffer() >= buffers->size()) continue;
+    const auto* buffer = buffers->Get(tensor->buffer());
+    if (!buffer || !buffer->palette()) continue;
+    const std::pair<uint32_t, bool> key(tensor->buffer(), keep_palettized[i]);
+    if (std::find(keys.begin(), keys.end(), key) != keys.end()) continue;
+
+    const auto* palette = buffer->palette();
+    const int index_bits = palette->index_bits();
+    TfLiteType type;
+    size_t type_bytes;
+    if (ConvertTensorType(tensor->type(), &type, error_reporter_) !=
+            kTfLiteOk ||
+        GetSizeOfType(subgraph->context(), type, &type_bytes) != kTfLiteOk) {
+      return kTfLiteError;
+    }
+    // The shape comes from the file, so it must not make the sizes below
+    // overflow.
+    constexpr size_t kMaxBytes = std::numeric_limits<size_t>::max() / 2;
+    bool valid_shape = true;
+    size_t num_elements = 1;
+    if (tensor->shape()) {
+      for (int32_t dim : *tensor->shape()) {
+        if (dim <= 0 || num_elements > kMaxBytes / type_bytes / dim) {
+          valid_shape = false;
+          break;
+        }
+        num_elements *= dim;
+      }
+    }
+    if (!valid_shape ||
+        (index_bits != 1 && index_bits != 2 && index_bits != 4 &&
+         index_bits != 8) ||
+        !buffer->data() ||
+        buffer->data()->size() < num_elements / 8 * index_bits +
+                                     (num_elements % 8 * index_bits + 7) / 8 ||
+        total_bytes > kMaxBytes - num_elements * type_bytes) {
+      error_reporter_->Report(
+          "Buffer %d is not a valid palette compression of tensor %d.\n",
+          tensor->buffer(), i);
+      return kTfLiteError;
+    }
+
+    PaletteDecompression decompression = {
+        buffer->data()->data(),
+        index_bits,
+        palette->values() ? palette->values()->data() : nullptr,
+        type_bytes,
+        palette->values() ? palette->values()->size() / type_bytes : 0,
+        num_elements,
+        /*output=*/nullptr};
+    size_t bytes = num_elements * type_bytes;
+    if (keep_palettized[i]) {
+      decompression.values = kIdentityPalette.values;
+      decompression.value_bytes = 1;
+      bytes = index_bits == 8 ? 0 : num_elements;
+      // Indices that are already bytes are used in place, but still checked.
+      if (index_bits == 8) {
+        (*decompressed_data)[key] = {
+            reinterpret_cast<const char*>(decompression.indices),
+            num_elements};
+      }
+    }
+    decompressions.push_back(decompression);
+    offsets.push_back(bytes ? total_bytes : kNoOffset);
+    keys.push_back(key);
+    total_bytes += (bytes + kAlignment - 1) / kAlignment * kAlignment;
+  }
+  if (decompressions.empty()) {
+    return kTfLiteOk;
+  }
+
+  char* block =
+      total_bytes ? subgraph->AllocateConstantData(total_bytes) : nullptr;
+  for (size_t i = 0; i < decompressions.size(); ++i) {
+    if (offsets[i] != kNoOffset) {
+      decompressions[i].output = block + offsets[i];
+      (*decompressed_data)[keys[i]] = {
+          decompressions[i].output,
+          decompressions[i].num_elements * decompressions[i].value_bytes};
+    }
+  }
+
+  // Workers take chunks of the buffers in turn until all are decompressed.
+  constexpr size_t kChunkElements = 64 * 1024;
+  std::vector<std::pair<size_t, size_t>> chunks;
+  for (size_t i = 0; i < decompressions.size(); ++i) {
+    for (size_t begin = 0; begin < decompressions[i].num_elements;
+         begin += kChunkElements) {
+      chunks.emplace_back(i, begin);
+    }
+  }
+  std::atomic<size_t> next_chunk(0);
+  std::atomic<bool> valid(true);
+  auto decompress = [&]() {
+    for (size_t chunk = next_chunk++; chunk < chunks.size();
+         chunk = next_chunk++) {
+      const PaletteDecompression& decompression =
+          decompressions[chunks[chunk].first];
+      const size_t begin = chunks[chunk].second;
+      const size_t end =
+          std::min(begin + kChunkElements, decompression.num_elements);
+      if (!DecompressPalette(decompression, begin, end)) {
+        valid = false;
+      }
+    }
+  };
+  const int num_workers = static_cast<int>(
+      std::min(static_cast<size_t>(std::max(num_threads_, 1)), chunks.size()));
+  std::vector<std::thread> workers;
+  for (int i = 1; i < num_workers; ++i) {
+    workers.emplace_back(decompress);
+  }
+  decompress();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  if (!valid) {
+    error_reporter_->Report(
+        "Palette compressed buffer has out of range indices.\n");
+    return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus SubgraphBuilder::ParseQuantization(
     const QuantizationParameters* src_quantization,
-    TfLiteQuantization* quantization) {
+    TfLiteQuantization* quantization,
+    const TfLiteFloatArray** borrowed_scale) const {
   quantization->type = kTfLiteNoQuantization;
+  *borrowed_scale = nullptr;
   if (!src_quantization || !src_quantization->scale() ||
       src_quantization->scale()->size() == 0) {
     return kTfLiteOk;
@@ -334,10 +748,27 @@ TfLiteStatus InterpreterBuilder::ParseQuantization(
 
   auto* affine_quantization = reinterpret_cast<TfLiteAffineQuantization*>(
       malloc(sizeof(TfLiteAffineQuantization)));
-  affine_quantization->scale = TfLiteFloatArrayCreate(num_scales);
+  affine_quantization->scale = nullptr;
   affine_quantization->zero_point = TfLiteIntArrayCreate(num_scales);
+#if FLATBUFFERS_LITTLEENDIAN
+  // A flatbuffer vector of floats is laid out like a TfLiteFloatArray, so
+  // per-channel scales, which can be large, are used in place. Zero points
+  // are int64 in the model and still need a conversion.
+  static_assert(offsetof(TfLiteFloatArray, data) ==
+                    sizeof(flatbuffers::uoffset_t),
+                "TfLiteFloatArray must match the layout of flatbuffer vectors");
+  if (num_scales > 1) {
+    *borrowed_scale =
+        reinterpret_cast<const TfLiteFloatArray*>(src_quantization->scale());
+  }
+#endif
+  if (*borrowed_scale == nullptr) {
+    affine_quantization->scale = TfLiteFloatArrayCreate(num_scales);
+  }
   for (size_t i = 0; i < num_scales; ++i) {
-    affine_quantization->scale->data[i] = src_quantization->scale()->Get(i);
+    if (affine_quantization->scale) {
+      affine_quantization->scale->data[i] = src_quantization->scale()->Get(i);
+    }
     affine_quantization->zero_point->data[i] =
         src_quantization->zero_point()->Get(i);
   }
@@ -347,12 +778,16 @@ TfLiteStatus InterpreterBuilder::ParseQuantization(
   return kTfLiteOk;
 }
 
-TfLiteStatus InterpreterBuilder::ParseTensors(
+TfLiteStatus SubgraphBuilder::ParseTensors(
     const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
     const flatbuffers::Vector<flatbuffers::Offset<Tensor>>* tensors,
-    Subgraph* subgraph) {
+    const std::vector<bool>& keep_palettized, Subgraph* subgraph) const {
   TfLiteStatus status = kTfLiteOk;
 
+  DecompressedBuffers decompressed_data;
+  TF_LITE_ENSURE_STATUS(DecompressBuffers(buffers, tensors, keep_palettized,
+                                          subgraph, &decompressed_data));
+
   // A little helper to get the names of inputs and outputs. Note that they
   // must outlive the subgraph.
   auto get_name = [](const tflite::Tensor* t) -> const char* {
@@ -384,10 +819,25 @@ TfLiteStatus InterpreterBuilder::ParseTensors(
         return kTfLiteError;
       }
       if (auto* buffer = (*buffers)[tensor->buffer()]) {
+        if (buffer->palette()) {
+          const auto& data = decompressed_data.at(std::make_pair(
+              tensor->buffer(), static_cast<bool>(keep_palettized[i])));
+          *buffer_data = data.first;
+          *buffer_size = data.second;
+          return kTfLiteOk;
+        }
         if (auto* array = buffer->data()) {
           if (size_t size = array->size()) {
             *buffer_size = size;
             *buffer_data = reinterpret_cast<const char*>(array->data());
+            if (WeightRegistry* registry = weight_registry_) {
+              const char* interned = registry->Intern(*buffer_data, size);
+              if (registry->IsInterned(interned)) {
+                subgraph->AddConstantDataReleaser(
+                    [registry, interned]() { registry->Release(interned); });
+                *buffer_data = interned;
+              }
+            }
             return kTfLiteOk;
           }
         }
@@ -400,10 +850,25 @@ TfLiteStatus InterpreterBuilder::ParseTensors(
 
     const auto* src_quantization = tensor->quantization();
     TfLiteQuantization quantization;
-    if (ParseQuantization(src_quantization, &quantization) != kTfLiteOk) {
+    const TfLiteFloatArray* borrowed_scale;
+    if (ParseQuantization(src_quantization, &quantization, &borrowed_scale) !=
+        kTfLiteOk) {
       status = kTfLiteError;
       continue;
     }
+    if (keep_palettized[i]) {
+      // The weights are the indices into their palette.
+      const auto* values = (*buffers)[tensor->buffer()]->palette()->values();
+      const int num_values = values->size() / sizeof(float);
+      auto* palette_quantization = reinterpret_cast<TfLitePaletteQuantization*>(
+          malloc(sizeof(TfLitePaletteQuantization)));
+      palette_quantization->values = TfLiteFloatArrayCreate(num_values);
+      memcpy(palette_quantization->values->data, values->data(),
+             num_values * sizeof(float));
+      quantization.type = kTfLitePaletteQuantization;
+      quantization.params = palette_quantization;
+      type = kTfLiteUInt8;
+    }
 
     bool is_variable = tensor->is_variable();
     if (buffer_ptr) {
@@ -431,11 +896,24 @@ TfLiteStatus InterpreterBuilder::ParseTensors(
         status = kTfLiteError;
       }
     }
+    if (borrowed_scale && subgraph->BorrowQuantizationScale(
+                              i, borrowed_scale) != kTfLiteOk) {
+      status = kTfLiteError;
+    }
+    if (tensor->shape_signature() && tensor->shape_signature()->size() != 0 &&
+        subgraph->SetTensorDimsSignature(
+            i, FlatBufferIntArrayToVector(tensor->shape_signature())) !=
+            kTfLiteOk) {
+      error_reporter_->Report("Tensor %d has an invalid shape signature.\n", i);
+      status = kTfLiteError;
+    }
   }
 
   return status;
 }
 
+}  // namespace
+
 TfLiteStatus InterpreterBuilder::ApplyDelegates(Interpreter* interpreter) {
   // TODO(b/117561550): Move flex delegate application to the OpResolver.
   if (AcquireFlexDelegate == nullptr) {
@@ -506,7 +984,6 @@ TfLiteStatus InterpreterBuilder::operator()(
   // invocation in the model graph.
   // Construct interpreter with correct number of tensors and operators.
   auto* subgraphs = model_->subgraphs();
-  auto* buffers = model_->buffers();
 
   if (subgraphs->size() == 0) {
     error_reporter_->Report("No subgraph in the model.\n");
@@ -515,47 +992,66 @@ TfLiteStatus InterpreterBuilder::operator()(
 
   interpreter->reset(new Interpreter(error_reporter_));
   (*interpreter)->SetNumThreads(num_threads);
-  if (subgraphs->Length() > 1) {
-    (*interpreter)->AddSubgraphs(subgraphs->Length() - 1);
-  }
-
-  for (int subgraph_index = 0; subgraph_index < subgraphs->Length();
-       ++subgraph_index) {
-    const tflite::SubGraph* subgraph = (*subgraphs)[subgraph_index];
-    tflite::Subgraph* modified_subgraph =
-        (*interpreter)->subgraph(subgraph_index);
-    auto operators = subgraph->operators();
-    auto tensors = subgraph->tensors();
-    if (!operators || !tensors || !buffers) {
-      error_reporter_->Report(
-          "Did not get operators, tensors, or buffers in subgraph %d.\n",
-          subgraph_index);
+  const int num_subgraphs = subgraphs->Length();
+  if (num_subgraphs > 1) {
+    (*interpreter)->AddSubgraphs(num_subgraphs - 1);
+  }
+
+  auto builder = std::make_shared<SubgraphBuilder>(
+      model_, flatbuffer_op_index_to_registration_, error_reporter_,
+      allocation_, num_threads, keep_palettized_weights_, weight_registry_);
+  if (lazy_subgraphs_) {
+    if (builder->Build(0, (*interpreter)->subgraph(0)) != kTfLiteOk) {
       return cleanup_and_error();
     }
-    if (modified_subgraph->AddTensors(tensors->Length()) != kTfLiteOk) {
-      return cleanup_and_error();
+    for (int subgraph_index = 1; subgraph_index < num_subgraphs;
+         ++subgraph_index) {
+      (*interpreter)
+          ->subgraph(subgraph_index)
+          ->SetMaterializer([builder, subgraph_index](Subgraph* subgraph) {
+            return builder->Build(subgraph_index, subgraph);
+          });
     }
-    // Set num threads
-    // Parse inputs/outputs
-    modified_subgraph->SetInputs(
-        FlatBufferIntArrayToVector(subgraph->inputs()));
-    modified_subgraph->SetOutputs(
-        FlatBufferIntArrayToVector(subgraph->outputs()));
-
-    // Finally setup nodes and tensors
-    if (ParseNodes(operators, modified_subgraph) != kTfLiteOk)
-      return cleanup_and_error();
-    if (ParseTensors(buffers, tensors, modified_subgraph) != kTfLiteOk)
-      return cleanup_and_error();
-
-    std::vector<int> variables;
-    for (int i = 0; i < modified_subgraph->tensors_size(); ++i) {
-      auto* tensor = modified_subgraph->tensor(i);
-      if (tensor->is_variable) {
-        variables.push_back(i);
+  } else {
+    // Tensors of different subgraphs are independent and can be set up in
+    // parallel, while the nodes are added serially since the init function
+    // of the ops may share state across subgraphs.
+    std::vector<TfLiteStatus> statuses(num_subgraphs, kTfLiteOk);
+    const int num_workers = std::min(num_threads, num_subgraphs);
+    auto build_tensors = [&](int first_subgraph_index, int stride) {
+      for (int subgraph_index = first_subgraph_index;
+           subgraph_index < num_subgraphs; subgraph_index += stride) {
+        statuses[subgraph_index] = builder->BuildTensors(
+            subgraph_index, (*interpreter)->subgraph(subgraph_index));
       }
+    };
+    if (num_workers > 1) {
+      std::vector<std::thread> workers;
+      for (int i = 1; i < num_workers; ++i) {
+        workers.emplace_back(build_tensors, i, num_workers);
+      }
+      build_tensors(0, num_workers);
+      for (auto& worker : workers) {
+        worker.join();
+      }
+    } else {
+      build_tensors(0, 1);
     }
-    modified_subgraph->SetVariables(std::move(variables));
+    for (int subgraph_index = 0; subgraph_index < num_subgraphs;
+         ++subgraph_index) {
+      if (statuses[subgraph_index] != kTfLiteOk ||
+          builder->BuildNodes(subgraph_index,
+                              (*interpreter)->subgraph(subgraph_index)) !=
+              kTfLiteOk) {
+        return cleanup_and_error();
+      }
+    }
+  }
+
+  if (weight_registry_) {
+    (*interpreter)
+        ->SetExternalContext(kTfLiteWeightCacheContext,
+                             weight_registry_->weight_cache());
   }
 
   if (ApplyDelegates(interpreter->get()) != kTfLiteOk)
@@ -26,6 +26,7 @@ limitations under the License.
 #include "tensorflow/lite/interpreter.h"
 #include "tensorflow/lite/mutable_op_resolver.h"
 #include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/weight_registry.h"
 
 namespace tflite {
 
@@ -113,6 +114,21 @@ class FlatBufferModel {
       TfLiteVerifier* extra_verifier = nullptr,
       ErrorReporter* error_reporter = DefaultErrorReporter());
 
+  /// Verifies and builds a model streamed from `reader`, e.g. a pipe or a
+  /// download, without assembling it anywhere else first: it is read straight
+  /// into the single buffer the model then lives in. `stream_bytes` is the
+  /// size of the stream if known, which saves growing the buffer as it is
+  /// read, or 0. Reading stops as soon as the header shows that the stream
+  /// isn't a model. The model is then verified like in
+  /// VerifyAndBuildFromBuffer, including with the optional `extra_verifier`.
+  /// Caller retains ownership of `reader`, which is only used by this call,
+  /// and of `error_reporter`, which must outlive the FlatBufferModel instance.
+  /// Returns a nullptr in case of failure.
+  static std::unique_ptr<FlatBufferModel> VerifyAndBuildFromReader(
+      StreamReader* reader, size_t stream_bytes,
+      TfLiteVerifier* extra_verifier = nullptr,
+      ErrorReporter* error_reporter = DefaultErrorReporter());
+
   /// Builds a model directly from a flatbuffer pointer
   /// Caller retains ownership of the buffer and should keep it alive until the
   /// returned object is destroyed. Caller retains ownership of `error_reporter`
@@ -199,18 +215,39 @@ class InterpreterBuilder {
   TfLiteStatus operator()(std::unique_ptr<Interpreter>* interpreter,
                           int num_threads);
 
+  /// If true, only the primary subgraph is built by operator(). The other
+  /// subgraphs, e.g. the branches of control flow ops, are built the first
+  /// time they are prepared, so that a model with many subgraphs loads faster
+  /// and the ones that are never used cost nothing. Otherwise, all subgraphs
+  /// are built upfront, and their tensors are set up on up to `num_threads`
+  /// threads. Defaults to false.
+  void SetLazySubgraphs(bool lazy_subgraphs) {
+    lazy_subgraphs_ = lazy_subgraphs;
+  }
+
+  /// Buffers of the model that are palette compressed are decompressed once
+  /// when their subgraph is built, on up to `num_threads` threads. If true,
+  /// the float weights of FULLY_CONNECTED ops are instead kept compressed, as
+  /// uint8 indices with palette quantization that the op looks up as it runs.
+  /// This takes a quarter of the memory of float weights or less, for a bit
+  /// more CPU. Defaults to false.
+  void SetKeepPalettizedWeights(bool keep_palettized_weights) {
+    keep_palettized_weights_ = keep_palettized_weights;
+  }
+
+  /// If set, the constant tensors whose weights `weight_registry` found in
+  /// another model point at its copy of them, shared with the other models
+  /// built with it, and the interpreter uses the weight cache of
+  /// `weight_registry`. The interpreter releases its references to the
+  /// weights when destroyed. The registry must outlive the interpreter.
+  /// Defaults to nullptr.
+  void SetWeightRegistry(WeightRegistry* weight_registry) {
+    weight_registry_ = weight_registry;
+  }
+
  private:
   TfLiteStatus BuildLocalIndexToRegistrationMapping();
-  TfLiteStatus ParseNodes(
-      const flatbuffers::Vector<flatbuffers::Offset<Operator>>* operators,
-      Subgraph* subgraph);
-  TfLiteStatus ParseTensors(
-      const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
-      const flatbuffers::Vector<flatbuffers::Offset<Tensor>>* tensors,
-      Subgraph* subgraph);
   TfLiteStatus ApplyDelegates(Interpreter* interpreter);
-  TfLiteStatus ParseQuantization(const QuantizationParameters* src_quantization,
-                                 TfLiteQuantization* quantization);
 
   const ::tflite::Model* model_;
   const OpResolver& op_resolver_;
@@ -219,6 +256,9 @@ class InterpreterBuilder {
   std::vector<const TfLiteRegistration*> flatbuffer_op_index_to_registration_;
   std::vector<BuiltinOperator> flatbuffer_op_index_to_registration_types_;
   const Allocation* allocation_ = nullptr;
+  bool lazy_subgraphs_ = false;
+  bool keep_palettized_weights_ = false;
+  WeightRegistry* weight_registry_ = nullptr;
 };
 
 }  // namespace tflite
@@ -20,12 +20,18 @@ limitations under the License.
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+
 #include "tensorflow/lite/model.h"
 
 #include <gtest/gtest.h>
 #include "tensorflow/lite/core/api/error_reporter.h"
 #include "tensorflow/lite/kernels/register.h"
 #include "tensorflow/lite/testing/util.h"
+#include "tensorflow/lite/version.h"
 
 // Comparison for TfLiteRegistration. Since TfLiteRegistration is a C object,
 // we must declare this in global namespace, so argument-dependent operator
@@ -104,6 +110,315 @@ TEST(BasicFlatBufferModel, TestMultipleSubgraphs) {
   EXPECT_EQ(interpreter->subgraphs_size(), 2);
 }
 
+TEST(BasicFlatBufferModel, TestLazySubgraphs) {
+  auto m = FlatBufferModel::BuildFromFile(
+      "tensorflow/lite/testdata/2_subgraphs.bin");
+  ASSERT_TRUE(m);
+  std::unique_ptr<Interpreter> eager_interpreter;
+  ASSERT_EQ(InterpreterBuilder(*m, TrivialResolver())(&eager_interpreter),
+            kTfLiteOk);
+
+  InterpreterBuilder builder(*m, TrivialResolver());
+  builder.SetLazySubgraphs(true);
+  std::unique_ptr<Interpreter> interpreter;
+  ASSERT_EQ(builder(&interpreter), kTfLiteOk);
+  ASSERT_EQ(interpreter->subgraphs_size(), 2);
+  EXPECT_EQ(interpreter->tensors_size(), eager_interpreter->tensors_size());
+  // The second subgraph is only built when first used.
+  Subgraph* subgraph = interpreter->subgraph(1);
+  EXPECT_EQ(subgraph->tensors_size(), 0);
+  ASSERT_EQ(subgraph->EnsureMaterialized(), kTfLiteOk);
+  Subgraph* eager_subgraph = eager_interpreter->subgraph(1);
+  EXPECT_EQ(subgraph->tensors_size(), eager_subgraph->tensors_size());
+  EXPECT_EQ(subgraph->nodes_size(), eager_subgraph->nodes_size());
+  EXPECT_EQ(subgraph->inputs(), eager_subgraph->inputs());
+  EXPECT_EQ(subgraph->outputs(), eager_subgraph->outputs());
+  // Further calls do nothing.
+  ASSERT_EQ(subgraph->EnsureMaterialized(), kTfLiteOk);
+  EXPECT_EQ(subgraph->tensors_size(), eager_subgraph->tensors_size());
+}
+
+TEST(BasicFlatBufferModel, TestMultipleSubgraphsOnThreads) {
+  auto m = FlatBufferModel::BuildFromFile(
+      "tensorflow/lite/testdata/2_subgraphs.bin");
+  ASSERT_TRUE(m);
+  std::unique_ptr<Interpreter> serial_interpreter;
+  ASSERT_EQ(InterpreterBuilder(*m, TrivialResolver())(&serial_interpreter, 1),
+            kTfLiteOk);
+  std::unique_ptr<Interpreter> interpreter;
+  ASSERT_EQ(InterpreterBuilder(*m, TrivialResolver())(&interpreter, 4),
+            kTfLiteOk);
+  ASSERT_EQ(interpreter->subgraphs_size(),
+            serial_interpreter->subgraphs_size());
+  for (int i = 0; i < interpreter->subgraphs_size(); ++i) {
+    Subgraph* subgraph = interpreter->subgraph(i);
+    Subgraph* serial_subgraph = serial_interpreter->subgraph(i);
+    EXPECT_EQ(subgraph->tensors_size(), serial_subgraph->tensors_size());
+    EXPECT_EQ(subgraph->nodes_size(), serial_subgraph->nodes_size());
+    EXPECT_EQ(subgraph->inputs(), serial_subgraph->inputs());
+    EXPECT_EQ(subgraph->outputs(), serial_subgraph->outputs());
+  }
+}
+
+TEST(BasicFlatBufferModel, TestAdviseMappedModel) {
+  auto model = FlatBufferModel::BuildFromFile(
+      "tensorflow/lite/testdata/test_model.bin");
+  ASSERT_TRUE(model);
+  const Allocation* allocation = model->allocation();
+  ASSERT_NE(allocation, nullptr);
+  if (!MMAPAllocation::IsSupported()) return;
+  const char* base = static_cast<const char*>(allocation->base());
+  EXPECT_TRUE(allocation->Advise(Allocation::Advice::kWillNeed, base,
+                                 allocation->bytes()));
+  EXPECT_TRUE(allocation->Advise(Allocation::Advice::kRandom, base + 1, 1));
+  // Ranges outside of the model are rejected.
+  EXPECT_FALSE(allocation->Advise(Allocation::Advice::kSequential, base,
+                                  allocation->bytes() + 1));
+  EXPECT_FALSE(allocation->Lock(base - 1, 1));
+}
+
+// Reads a buffer a few bytes at a time, like a pipe.
+class ChunkedReader : public StreamReader {
+ public:
+  explicit ChunkedReader(std::string data) : data_(std::move(data)) {}
+  int64_t Read(void* dst, size_t bytes) override {
+    const size_t read = std::min({bytes, data_.size() - offset_, size_t{100}});
+    memcpy(dst, data_.data() + offset_, read);
+    offset_ += read;
+    return read;
+  }
+  size_t offset() const { return offset_; }
+
+ private:
+  const std::string data_;
+  size_t offset_ = 0;
+};
+
+std::string ReadFile(const char* filename) {
+  std::ifstream file(filename, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+}
+
+TEST(BasicFlatBufferModel, TestBuildFromReader) {
+  const std::string data =
+      ReadFile("tensorflow/lite/testdata/test_model.bin");
+  ASSERT_FALSE(data.empty());
+  for (size_t stream_bytes : {data.size(), size_t{0}}) {
+    ChunkedReader reader(data);
+    auto model = FlatBufferModel::VerifyAndBuildFromReader(&reader,
+                                                           stream_bytes);
+    ASSERT_TRUE(model);
+    EXPECT_EQ(model->allocation()->bytes(), data.size());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(model->allocation()->base()) % 16,
+              0);
+    std::unique_ptr<Interpreter> interpreter;
+    ASSERT_EQ(InterpreterBuilder(*model, TrivialResolver(&dummy_reg))(
+                  &interpreter),
+              kTfLiteOk);
+  }
+
+  // Streams of the wrong size are rejected.
+  for (size_t stream_bytes : {data.size() - 1, data.size() + 1}) {
+    ChunkedReader reader(data);
+    EXPECT_FALSE(
+        FlatBufferModel::VerifyAndBuildFromReader(&reader, stream_bytes));
+  }
+}
+
+TEST(BasicFlatBufferModel, TestBuildFromReaderStopsEarly) {
+  std::string data = ReadFile("tensorflow/lite/testdata/test_model.bin");
+  ASSERT_FALSE(data.empty());
+  data[4] = 'X';
+  ChunkedReader reader(data);
+  EXPECT_FALSE(FlatBufferModel::VerifyAndBuildFromReader(&reader, 0));
+  // Reading stopped after the header.
+  EXPECT_EQ(reader.offset(), 100);
+}
+
+// Builds a model with a FULLY_CONNECTED op, whose 2x4 weights are palette
+// compressed with 2 bit indices into `palette`.
+void BuildPalettizedModel(const std::vector<float>& palette,
+                          flatbuffers::FlatBufferBuilder* builder,
+                          const std::vector<int32_t>& weights_shape = {2, 4}) {
+  const std::vector<uint8_t> indices = {0xE4, 0x1B};  // 0 1 2 3, 3 2 1 0.
+  const std::vector<uint8_t> values(
+      reinterpret_cast<const uint8_t*>(palette.data()),
+      reinterpret_cast<const uint8_t*>(palette.data() + palette.size()));
+  const std::vector<flatbuffers::Offset<Buffer>> buffers = {
+      CreateBuffer(*builder),
+      CreateBufferDirect(*builder, &indices,
+                         CreatePaletteCompressionDirect(*builder, &values,
+                                                        /*index_bits=*/2))};
+  const std::vector<int32_t> input_shape = {1, 4};
+  const std::vector<int32_t> output_shape = {1, 2};
+  const std::vector<flatbuffers::Offset<Tensor>> tensors = {
+      CreateTensorDirect(*builder, &input_shape, TensorType_FLOAT32, 0,
+                         "input"),
+      CreateTensorDirect(*builder, &weights_shape, TensorType_FLOAT32, 1,
+                         "weights"),
+      CreateTensorDirect(*builder, &output_shape, TensorType_FLOAT32, 0,
+                         "output")};
+  const std::vector<int32_t> op_inputs = {0, 1, -1};
+  const std::vector<int32_t> op_outputs = {2};
+  const std::vector<flatbuffers::Offset<Operator>> operators = {
+      CreateOperatorDirect(
+          *builder, 0, &op_inputs, &op_outputs,
+          BuiltinOptions_FullyConnectedOptions,
+          CreateFullyConnectedOptions(*builder).Union())};
+  const std::vector<int32_t> subgraph_inputs = {0};
+  const std::vector<int32_t> subgraph_outputs = {2};
+  const std::vector<flatbuffers::Offset<SubGraph>> subgraphs = {
+      CreateSubGraphDirect(*builder, &tensors, &subgraph_inputs,
+                           &subgraph_outputs, &operators)};
+  const std::vector<flatbuffers::Offset<OperatorCode>> operator_codes = {
+      CreateOperatorCode(*builder, BuiltinOperator_FULLY_CONNECTED)};
+  FinishModelBuffer(*builder, CreateModelDirect(*builder, TFLITE_SCHEMA_VERSION,
+                                                &operator_codes, &subgraphs,
+                                                nullptr, &buffers));
+}
+
+std::vector<float> InvokePalettizedModel(Interpreter* interpreter) {
+  EXPECT_EQ(interpreter->AllocateTensors(), kTfLiteOk);
+  float* input = interpreter->typed_input_tensor<float>(0);
+  for (int i = 0; i < 4; ++i) {
+    input[i] = i + 1;
+  }
+  EXPECT_EQ(interpreter->Invoke(), kTfLiteOk);
+  const float* output = interpreter->typed_output_tensor<float>(0);
+  return std::vector<float>(output, output + 2);
+}
+
+TEST(BasicFlatBufferModel, TestPalettizedWeights) {
+  flatbuffers::FlatBufferBuilder builder;
+  BuildPalettizedModel({0.5f, -1.0f, 2.0f, 0.0f}, &builder);
+  auto model = FlatBufferModel::BuildFromBuffer(
+      reinterpret_cast<const char*>(builder.GetBufferPointer()),
+      builder.GetSize());
+  ASSERT_TRUE(model);
+  ops::builtin::BuiltinOpResolver resolver;
+  const std::vector<float> expected_output = {4.5f, 3.0f};
+
+  // Decompressed when loaded.
+  std::unique_ptr<Interpreter> interpreter;
+  ASSERT_EQ(InterpreterBuilder(*model, resolver)(&interpreter, 2), kTfLiteOk);
+  const TfLiteTensor* weights = interpreter->tensor(1);
+  EXPECT_EQ(weights->type, kTfLiteFloat32);
+  EXPECT_EQ(weights->allocation_type, kTfLiteMmapRo);
+  EXPECT_EQ(std::vector<float>(weights->data.f, weights->data.f + 8),
+            std::vector<float>({0.5f, -1.0f, 2.0f, 0.0f, 0.0f, 2.0f, -1.0f,
+                                0.5f}));
+  EXPECT_EQ(InvokePalettizedModel(interpreter.get()), expected_output);
+
+  // Kept compressed and looked up by the op.
+  InterpreterBuilder keeping_builder(*model, resolver);
+  keeping_builder.SetKeepPalettizedWeights(true);
+  ASSERT_EQ(keeping_builder(&interpreter), kTfLiteOk);
+  weights = interpreter->tensor(1);
+  EXPECT_EQ(weights->type, kTfLiteUInt8);
+  EXPECT_EQ(weights->quantization.type, kTfLitePaletteQuantization);
+  EXPECT_EQ(std::vector<uint8_t>(weights->data.uint8,
+                                 weights->data.uint8 + weights->bytes),
+            std::vector<uint8_t>({0, 1, 2, 3, 3, 2, 1, 0}));
+  EXPECT_EQ(InvokePalettizedModel(interpreter.get()), expected_output);
+}
+
+TEST(BasicFlatBufferModel, TestPalettizedWeightsOutOfRange) {
+  flatbuffers::FlatBufferBuilder builder;
+  // Index 3 has no value.
+  BuildPalettizedModel({0.5f, -1.0f, 2.0f}, &builder);
+  auto model = FlatBufferModel::BuildFromBuffer(
+      reinterpret_cast<const char*>(builder.GetBufferPointer()),
+      builder.GetSize());
+  ASSERT_TRUE(model);
+  std::unique_ptr<Interpreter> interpreter;
+  EXPECT_NE(InterpreterBuilder(*model, ops::builtin::BuiltinOpResolver())(
+                &interpreter),
+            kTfLiteOk);
+}
+
+TEST(BasicFlatBufferModel, TestPalettizedWeightsInvalidShape) {
+  // Negative dimensions, and dimensions whose product overflows.
+  for (const std::vector<int32_t>& shape :
+       {std::vector<int32_t>({-2, -4}),
+        std::vector<int32_t>({65536, 65536, 65536, 65536})}) {
+    flatbuffers::FlatBufferBuilder builder;
+    BuildPalettizedModel({0.5f, -1.0f, 2.0f, 0.0f}, &builder, shape);
+    auto model = FlatBufferModel::BuildFromBuffer(
+        reinterpret_cast<const char*>(builder.GetBufferPointer()),
+        builder.GetSize());
+    ASSERT_TRUE(model);
+    std::unique_ptr<Interpreter> interpreter;
+    EXPECT_NE(InterpreterBuilder(*model, ops::builtin::BuiltinOpResolver())(
+                  &interpreter),
+              kTfLiteOk);
+  }
+}
+
+// Builds a model that adds its input, with the given shape signature, to
+// itself.
+void BuildModelWithShapeSignature(const std::vector<int32_t>& shape_signature,
+                                  flatbuffers::FlatBufferBuilder* builder) {
+  const std::vector<flatbuffers::Offset<Buffer>> buffers = {
+      CreateBuffer(*builder)};
+  const std::vector<int32_t> shape = {1, 2};
+  const std::vector<flatbuffers::Offset<Tensor>> tensors = {
+      CreateTensorDirect(*builder, &shape, TensorType_FLOAT32, 0, "input",
+                         /*quantization=*/0, /*is_variable=*/false,
+                         &shape_signature),
+      CreateTensorDirect(*builder, &shape, TensorType_FLOAT32, 0, "output")};
+  const std::vector<int32_t> op_inputs = {0, 0};
+  const std::vector<int32_t> op_outputs = {1};
+  const std::vector<flatbuffers::Offset<Operator>> operators = {
+      CreateOperatorDirect(*builder, 0, &op_inputs, &op_outputs,
+                           BuiltinOptions_AddOptions,
+                           CreateAddOptions(*builder).Union())};
+  const std::vector<int32_t> subgraph_inputs = {0};
+  const std::vector<int32_t> subgraph_outputs = {1};
+  const std::vector<flatbuffers::Offset<SubGraph>> subgraphs = {
+      CreateSubGraphDirect(*builder, &tensors, &subgraph_inputs,
+                           &subgraph_outputs, &operators)};
+  const std::vector<flatbuffers::Offset<OperatorCode>> operator_codes = {
+      CreateOperatorCode(*builder, BuiltinOperator_ADD)};
+  FinishModelBuffer(*builder, CreateModelDirect(*builder, TFLITE_SCHEMA_VERSION,
+                                                &operator_codes, &subgraphs,
+                                                nullptr, &buffers));
+}
+
+TEST(BasicFlatBufferModel, TestShapeSignature) {
+  ops::builtin::BuiltinOpResolver resolver;
+  flatbuffers::FlatBufferBuilder builder;
+  BuildModelWithShapeSignature({-1, 2}, &builder);
+  auto model = FlatBufferModel::BuildFromBuffer(
+      reinterpret_cast<const char*>(builder.GetBufferPointer()),
+      builder.GetSize());
+  ASSERT_TRUE(model);
+  std::unique_ptr<Interpreter> interpreter;
+  ASSERT_EQ(InterpreterBuilder(*model, resolver)(&interpreter), kTfLiteOk);
+  for (int batch : {3, 1, 5, 2}) {
+    ASSERT_EQ(interpreter->ResizeInputTensor(0, {batch, 2}), kTfLiteOk);
+    ASSERT_EQ(interpreter->AllocateTensors(), kTfLiteOk);
+    float* input = interpreter->typed_input_tensor<float>(0);
+    for (int i = 0; i < 2 * batch; ++i) {
+      input[i] = i;
+    }
+    ASSERT_EQ(interpreter->Invoke(), kTfLiteOk);
+    const float* output = interpreter->typed_output_tensor<float>(0);
+    for (int i = 0; i < 2 * batch; ++i) {
+      EXPECT_EQ(output[i], 2 * i);
+    }
+  }
+
+  flatbuffers::FlatBufferBuilder invalid_builder;
+  BuildModelWithShapeSignature({-3, 2}, &invalid_builder);
+  auto invalid_model = FlatBufferModel::BuildFromBuffer(
+      reinterpret_cast<const char*>(invalid_builder.GetBufferPointer()),
+      invalid_builder.GetSize());
+  ASSERT_TRUE(invalid_model);
+  EXPECT_NE(InterpreterBuilder(*invalid_model, resolver)(&interpreter),
+            kTfLiteOk);
+}
+
 // Test what happens if we cannot bind any of the ops.
 TEST(BasicFlatBufferModel, TestModelWithoutNullRegistrations) {
   auto model = FlatBufferModel::BuildFromFile(
@@ -15,6 +15,7 @@ limitations under the License.
 #ifndef TENSORFLOW_LITE_SIMPLE_MEMORY_ARENA_H_
 #define TENSORFLOW_LITE_SIMPLE_MEMORY_ARENA_H_
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include "tensorflow/lite/c/c_api_internal.h"
@@ -64,6 +65,16 @@ class SimpleMemoryArena {
 
   TfLiteStatus Commit(TfLiteContext* context);
 
+  // Returns the end of the highest allocation made since the last Clear().
+  size_t high_water_mark() const { return high_water_mark_; }
+
+  // Makes the next Commit() reserve room for allocations up to
+  // `high_water_mark`, as if they had been made. This lets a saved plan be
+  // replayed without going through Allocate().
+  void Reserve(size_t high_water_mark) {
+    high_water_mark_ = std::max(high_water_mark_, high_water_mark);
+  }
+
   TfLiteStatus ResolveAlloc(TfLiteContext* context, const ArenaAlloc& alloc,
                             char** output_ptr);
 
@@ -17,6 +17,7 @@ limitations under the License.
 
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <vector>
 #include "tensorflow/lite/c/c_api_internal.h"
 
@@ -117,6 +118,118 @@ void DynamicBuffer::WriteToTensor(TfLiteTensor* tensor,
                     tensor->is_variable, tensor);
 }
 
+namespace {
+
+// Size of the header of a string tensor holding `num_strings` strings: their
+// number, their offsets and the length of the whole buffer.
+size_t HeaderBytes(int num_strings) {
+  return sizeof(int32_t) * (num_strings + 2);
+}
+
+}  // namespace
+
+StringTensorWriter::StringTensorWriter(TfLiteTensor* tensor,
+                                       int estimated_num_strings,
+                                       size_t estimated_bytes)
+    : tensor_(tensor), max_strings_(estimated_num_strings) {
+  if (tensor->allocation_type != kTfLiteDynamic) {
+    // Arena memory cannot be resized, so the tensor gets its own buffer, as
+    // DynamicBuffer::WriteToTensor does.
+    tensor->allocation_type = kTfLiteDynamic;
+    tensor->data.raw = nullptr;
+    tensor->bytes = 0;
+  }
+  capacity_ = tensor->data.raw == nullptr ? 0 : tensor->bytes;
+  ReserveData(estimated_bytes);
+}
+
+char* StringTensorWriter::ReserveData(size_t len) {
+  const size_t bytes = HeaderBytes(max_strings_) + data_bytes_ + len;
+  if (bytes > capacity_ || tensor_->data.raw == nullptr) {
+    capacity_ = std::max(bytes, 2 * capacity_);
+    TfLiteTensorRealloc(capacity_, tensor_);
+  }
+  return tensor_->data.raw + HeaderBytes(max_strings_) + data_bytes_;
+}
+
+void StringTensorWriter::GrowOffsets() {
+  const int max_strings = std::max(2 * max_strings_, 1);
+  const size_t growth = HeaderBytes(max_strings) - HeaderBytes(max_strings_);
+  ReserveData(growth);
+  // The offsets are relative to the contents until Finish(), so they stay
+  // valid when the contents move.
+  memmove(tensor_->data.raw + HeaderBytes(max_strings),
+          tensor_->data.raw + HeaderBytes(max_strings_), data_bytes_);
+  max_strings_ = max_strings;
+}
+
+void StringTensorWriter::AddString(const char* str, size_t len) {
+  if (num_strings_ == max_strings_) {
+    GrowOffsets();
+  }
+  char* dst = ReserveData(len);
+  memcpy(dst, str, len);
+  offsets()[num_strings_ + 1] = data_bytes_;
+  data_bytes_ += len;
+  ++num_strings_;
+}
+
+void StringTensorWriter::AddString(const StringRef& string) {
+  AddString(string.str, string.len);
+}
+
+void StringTensorWriter::AddJoinedString(const std::vector<StringRef>& strings,
+                                         char separator) {
+  if (num_strings_ == max_strings_) {
+    GrowOffsets();
+  }
+  size_t total_len = strings.size() - 1;
+  for (StringRef ref : strings) {
+    total_len += ref.len;
+  }
+  char* dst = ReserveData(total_len);
+  for (size_t i = 0; i < strings.size(); ++i) {
+    // Fill separator if not first string.
+    if (i != 0) {
+      *dst++ = separator;
+    }
+    memcpy(dst, strings[i].str, strings[i].len);
+    dst += strings[i].len;
+  }
+  offsets()[num_strings_ + 1] = data_bytes_;
+  data_bytes_ += total_len;
+  ++num_strings_;
+}
+
+void StringTensorWriter::Finish(TfLiteIntArray* new_shape) {
+  if (max_strings_ != num_strings_) {
+    memmove(tensor_->data.raw + HeaderBytes(num_strings_),
+            tensor_->data.raw + HeaderBytes(max_strings_), data_bytes_);
+    max_strings_ = num_strings_;
+  }
+  // Until now offsets()[i + 1] held the start of string i relative to the
+  // contents. Make them relative to the buffer as in the string tensor format.
+  const int32_t start = HeaderBytes(num_strings_);
+  int32_t* offsets = this->offsets();
+  offsets[0] = num_strings_;
+  for (int i = 1; i <= num_strings_; ++i) {
+    offsets[i] += start;
+  }
+  offsets[num_strings_ + 1] = start + data_bytes_;
+  tensor_->bytes = start + data_bytes_;
+
+  if (new_shape != nullptr) {
+    TfLiteIntArrayFree(tensor_->dims);
+    tensor_->dims = new_shape;
+  }
+}
+
+void StringTensorWriter::FinishAsVector() {
+  TfLiteIntArray* dims = TfLiteIntArrayCreate(1);
+  dims->data[0] = num_strings_;
+  Finish(dims);
+}
+
 int GetStringCount(const char* raw_buffer) {
   // The first integers in the raw buffer is the number of strings.
   return *GetIntPtr(raw_buffer);
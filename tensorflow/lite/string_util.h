@@ -36,10 +36,19 @@ limitations under the License.
 //   # Write content of DynamicBuffer to tensor in format of string tensor
 //   # described above.
 //   buf.WriteToTensor(tensor, nullptr)
+//
+// When the number of strings is known or can be estimated, StringTensorWriter
+// writes them straight into the tensor instead:
+//   StringTensorWriter writer(tensor, num_strings, estimated_bytes);
+//   writer.AddString("AB", 2);
+//   writer.FinishAsVector();
 
 #ifndef TENSORFLOW_LITE_STRING_UTIL_H_
 #define TENSORFLOW_LITE_STRING_UTIL_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <vector>
 
 #include "tensorflow/lite/c/c_api_internal.h"
@@ -90,6 +99,84 @@ class DynamicBuffer {
   std::vector<int32_t> offset_;
 };
 
+// StringTensorWriter fills a string tensor in one pass, writing the offsets
+// and contents of the strings directly into the tensor's buffer rather than
+// into a DynamicBuffer that is copied afterwards. The buffer of the previous
+// invocation is reused when it is large enough.
+// The buffer is sized from the estimated number of strings and total length
+// given to the constructor. With exact estimates no byte is copied twice;
+// otherwise the buffer grows, and the contents are moved once more if the
+// number of strings was not exact.
+class StringTensorWriter {
+ public:
+  StringTensorWriter(TfLiteTensor* tensor, int estimated_num_strings,
+                     size_t estimated_bytes = 0);
+
+  void AddString(const StringRef& string);
+  void AddString(const char* str, size_t len);
+
+  // Join a list of string with separator, and add as a single string.
+  void AddJoinedString(const std::vector<StringRef>& strings, char separator);
+
+  // Complete the string tensor, with the given new_shape. The new shape must
+  // match the number of strings added. Caller relinquishes ownership of
+  // new_shape. If 'new_shape' is nullptr, keep the tensor's existing shape.
+  // No string may be added afterwards.
+  void Finish(TfLiteIntArray* new_shape);
+
+  // Complete the string tensor. Set shape to {num_strings}.
+  void FinishAsVector();
+
+ private:
+  // Returns a pointer to `len` bytes after the contents of the strings added
+  // so far, growing the buffer if needed.
+  char* ReserveData(size_t len);
+  // Makes room for twice as many offsets in front of the contents.
+  void GrowOffsets();
+  int32_t* offsets() { return reinterpret_cast<int32_t*>(tensor_->data.raw); }
+
+  TfLiteTensor* tensor_;
+  // Number of strings the offsets in front of the contents have room for.
+  int max_strings_;
+  int num_strings_ = 0;
+  // Total length of the strings added so far.
+  size_t data_bytes_ = 0;
+  size_t capacity_;
+};
+
+// StringTensorView reads the strings of a tensor. It reads the header once,
+// so that accessing the strings only costs two loads each.
+// NOTE: This will not create a copy of string data.
+class StringTensorView {
+ public:
+  explicit StringTensorView(const char* raw_buffer)
+      : raw_buffer_(raw_buffer),
+        offsets_(reinterpret_cast<const int32_t*>(raw_buffer) + 1),
+        num_strings_(*reinterpret_cast<const int32_t*>(raw_buffer)) {}
+  explicit StringTensorView(const TfLiteTensor* tensor)
+      : StringTensorView(tensor->data.raw) {}
+
+  int size() const { return num_strings_; }
+  const char* data(int string_index) const {
+    return raw_buffer_ + offsets_[string_index];
+  }
+  int length(int string_index) const {
+    return offsets_[string_index + 1] - offsets_[string_index];
+  }
+  StringRef operator[](int string_index) const {
+    return {data(string_index), length(string_index)};
+  }
+  // Total length of the strings, not including headers.
+  size_t total_length() const {
+    return offsets_[num_strings_] - offsets_[0];
+  }
+
+ private:
+  const char* raw_buffer_;
+  const int32_t* offsets_;
+  int num_strings_;
+};
+
 // Return num of strings in a String tensor.
 int GetStringCount(const char* raw_buffer);
 int GetStringCount(const TfLiteTensor* tensor);
@@ -155,6 +155,104 @@ TEST(StringUtil, TestShapes) {
   EXPECT_EQ(t0->dims->data[1], 2);
 }
 
+TEST(StringUtil, TestStringTensorWriter) {
+  Interpreter interpreter;
+  interpreter.AddTensors(1);
+  TfLiteTensor* t0 = interpreter.tensor(0);
+  t0->type = kTfLiteString;
+  t0->allocation_type = kTfLiteDynamic;
+
+  // Exact estimates.
+  {
+    StringTensorWriter writer(t0, 3, 7);
+    writer.AddString("ABC", 3);
+    writer.AddString("", 0);
+    writer.AddJoinedString({{"D", 1}, {"EF", 2}}, ' ');
+    auto new_shape = TfLiteIntArrayCreate(2);
+    new_shape->data[0] = 3;
+    new_shape->data[1] = 1;
+    writer.Finish(new_shape);
+  }
+  ASSERT_EQ(t0->dims->size, 2);
+  EXPECT_EQ(t0->dims->data[0], 3);
+  EXPECT_EQ(t0->dims->data[1], 1);
+  ASSERT_EQ(t0->bytes, 27);
+  ASSERT_EQ(GetStringCount(t0), 3);
+  StringRef str_ref = GetString(t0, 0);
+  EXPECT_EQ(string(str_ref.str, str_ref.len), "ABC");
+  str_ref = GetString(t0, 1);
+  EXPECT_EQ(string(str_ref.str, str_ref.len), "");
+  str_ref = GetString(t0, 2);
+  EXPECT_EQ(string(str_ref.str, str_ref.len), "D EF");
+
+  // Underestimates grow the buffer, overestimates are trimmed.
+  for (int num_strings : {0, 1, 5, 100}) {
+    StringTensorWriter writer(t0, num_strings, 1);
+    for (int i = 0; i < 10; ++i) {
+      const string s(i, 'a' + i);
+      writer.AddString(s.data(), s.length());
+    }
+    writer.FinishAsVector();
+
+    ASSERT_EQ(t0->dims->size, 1);
+    EXPECT_EQ(t0->dims->data[0], 10);
+    ASSERT_EQ(t0->bytes, 4 * 12 + 45);
+    ASSERT_EQ(GetStringCount(t0), 10);
+    for (int i = 0; i < 10; ++i) {
+      str_ref = GetString(t0, i);
+      EXPECT_EQ(string(str_ref.str, str_ref.len), string(i, 'a' + i));
+    }
+  }
+
+  // A large enough buffer is reused.
+  const char* buffer = t0->data.raw;
+  {
+    StringTensorWriter writer(t0, 1, 2);
+    writer.AddString("XY", 2);
+    writer.FinishAsVector();
+  }
+  EXPECT_EQ(t0->data.raw, buffer);
+  ASSERT_EQ(t0->bytes, 14);
+  str_ref = GetString(t0, 0);
+  EXPECT_EQ(string(str_ref.str, str_ref.len), "XY");
+}
+
+TEST(StringUtil, TestStringTensorWriterOnArenaTensor) {
+  Interpreter interpreter;
+  interpreter.AddTensors(1);
+  TfLiteTensor* t0 = interpreter.tensor(0);
+  t0->type = kTfLiteString;
+  // Memory the writer must not resize nor free.
+  char arena[8];
+  t0->allocation_type = kTfLiteArenaRw;
+  t0->data.raw = arena;
+  t0->bytes = sizeof(arena);
+
+  StringTensorWriter writer(t0, 2);
+  writer.AddString("ABC", 3);
+  writer.AddString("DE", 2);
+  writer.FinishAsVector();
+
+  EXPECT_EQ(t0->allocation_type, kTfLiteDynamic);
+  ASSERT_EQ(GetStringCount(t0), 2);
+  StringRef str_ref = GetString(t0, 1);
+  EXPECT_EQ(string(str_ref.str, str_ref.len), "DE");
+}
+
+TEST(StringUtil, TestStringTensorView) {
+  char data[] = {3,   0,   0,   0,   20,  0,   0,   0,   23,  0,
+                 0,   0,   23,  0,   0,   0,   25,  0,   0,   0,
+                 'X', 'Y', 'Z', 'A', 'B'};
+  StringTensorView view(data);
+  ASSERT_EQ(view.size(), 3);
+  EXPECT_EQ(view.total_length(), 5);
+  EXPECT_EQ(view.length(0), 3);
+  EXPECT_EQ(string(view.data(0), view.length(0)), "XYZ");
+  EXPECT_EQ(view[1].len, 0);
+  StringRef str_ref = view[2];
+  EXPECT_EQ(string(str_ref.str, str_ref.len), "AB");
+}
+
 }  // namespace tflite
 
 int main(int argc, char** argv) {
@@ -0,0 +1,197 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/toco/graph_transformations/graph_transformations.h"
+#include "tensorflow/lite/toco/model.h"
+#include "tensorflow/lite/toco/tooling_util.h"
+#include "tensorflow/core/platform/logging.h"
+
+namespace toco {
+
+namespace {
+
+// Returns true if padding the input of a VALID convolution by `left` and
+// `right` along a dimension of size `input_size` gives the same result as
+// SAME padding of the unpadded input, i.e. if the explicit padding is the one
+// the runtime would apply implicitly.
+bool IsEquivalentToSamePadding(int input_size, int left, int right,
+                               int kernel_size, int stride, int dilation) {
+  const int effective_kernel_size = (kernel_size - 1) * dilation + 1;
+  const int padded_size = input_size + left + right;
+  if (padded_size < effective_kernel_size) {
+    return false;
+  }
+  const int valid_output_size =
+      (padded_size - effective_kernel_size) / stride + 1;
+  const int same_output_size = (input_size + stride - 1) / stride;
+  if (valid_output_size != same_output_size) {
+    return false;
+  }
+  const int same_total_padding = std::max(
+      (same_output_size - 1) * stride + effective_kernel_size - input_size, 0);
+  // Any extra padding on the right is never read by the VALID convolution.
+  return left == same_total_padding / 2;
+}
+
+bool HasZeroPaddingValue(const Model& model, const Operator& pad_op) {
+  if (pad_op.type == OperatorType::kPad) {
+    // Pad always pads with zero, or with the zero point when quantized.
+    return true;
+  }
+  CHECK_EQ(pad_op.inputs.size(), 3);
+  const Array& value_array = model.GetArray(pad_op.inputs[2]);
+  if (!value_array.buffer || value_array.data_type != ArrayDataType::kFloat) {
+    return false;
+  }
+  const auto& value = value_array.GetBuffer<ArrayDataType::kFloat>().data;
+  return value.size() == 1 && value[0] == 0.f;
+}
+
+bool HaveSameQuantization(const Array& a, const Array& b) {
+  if (!a.quantization_params || !b.quantization_params) {
+    return !a.quantization_params && !b.quantization_params;
+  }
+  return a.GetQuantizationParams().zero_point ==
+             b.GetQuantizationParams().zero_point &&
+         a.GetQuantizationParams().scale == b.GetQuantizationParams().scale;
+}
+
+// The attributes of Conv and DepthwiseConv that matter here.
+struct ConvAttributes {
+  Padding* padding;
+  int stride_width;
+  int stride_height;
+  int dilation_width_factor;
+  int dilation_height_factor;
+};
+
+template <typename ConvOperatorType>
+ConvAttributes GetConvAttributes(ConvOperatorType* conv_op) {
+  return {&conv_op->padding, conv_op->stride_width, conv_op->stride_height,
+          conv_op->dilation_width_factor, conv_op->dilation_height_factor};
+}
+
+}  // namespace
+
+// Replaces a Pad followed by a VALID Conv or DepthwiseConv with a SAME
+// convolution of the unpadded input, when the two are equivalent. This is the
+// pattern that e.g. Keras' ZeroPadding2D before strided convolutions produces,
+// and it saves writing and reading back the whole padded activations array.
+::tensorflow::Status FusePadIntoFollowingConv::Run(Model* model,
+                                                   std::size_t op_index,
+                                                   bool* modified) {
+  *modified = false;
+  const auto pad_it = model->operators.begin() + op_index;
+  auto* pad_op = pad_it->get();
+  const std::vector<int>* left_padding;
+  const std::vector<int>* right_padding;
+  if (pad_op->type == OperatorType::kPad) {
+    left_padding = &static_cast<PadOperator*>(pad_op)->left_padding;
+    right_padding = &static_cast<PadOperator*>(pad_op)->right_padding;
+  } else if (pad_op->type == OperatorType::kPadV2) {
+    left_padding = &static_cast<PadV2Operator*>(pad_op)->left_padding;
+    right_padding = &static_cast<PadV2Operator*>(pad_op)->right_padding;
+  } else {
+    return ::tensorflow::Status::OK();
+  }
+  // Yield until the padding attributes have been resolved.
+  if (left_padding->size() != 4 || right_padding->size() != 4) {
+    return ::tensorflow::Status::OK();
+  }
+  // Only spatial padding can be expressed by the convolution.
+  if ((*left_padding)[0] != 0 || (*right_padding)[0] != 0 ||
+      (*left_padding)[3] != 0 || (*right_padding)[3] != 0) {
+    return ::tensorflow::Status::OK();
+  }
+  if (!HasZeroPaddingValue(*model, *pad_op)) {
+    return ::tensorflow::Status::OK();
+  }
+
+  const string& padded_array_name = pad_op->outputs[0];
+  if (!IsDiscardableArray(*model, padded_array_name) ||
+      CountOpsWithInput(*model, padded_array_name) != 1) {
+    return ::tensorflow::Status::OK();
+  }
+  Operator* conv_op = GetOpWithInput(*model, padded_array_name);
+  if (!conv_op || conv_op->inputs[0] != padded_array_name) {
+    return ::tensorflow::Status::OK();
+  }
+  // A quantized Pad must not change the quantization of its input, since the
+  // convolution would read the unpadded input with the padded array's params.
+  if (!HaveSameQuantization(model->GetArray(pad_op->inputs[0]),
+                            model->GetArray(padded_array_name))) {
+    return ::tensorflow::Status::OK();
+  }
+
+  ConvAttributes conv;
+  if (conv_op->type == OperatorType::kConv) {
+    conv = GetConvAttributes(static_cast<ConvOperator*>(conv_op));
+  } else if (conv_op->type == OperatorType::kDepthwiseConv) {
+    conv = GetConvAttributes(static_cast<DepthwiseConvOperator*>(conv_op));
+  } else {
+    return ::tensorflow::Status::OK();
+  }
+  if (conv.padding->type != PaddingType::kValid) {
+    return ::tensorflow::Status::OK();
+  }
+
+  const Array& input_array = model->GetArray(pad_op->inputs[0]);
+  const Array& weights_array = model->GetArray(conv_op->inputs[1]);
+  // Yield until shapes have been resolved.
+  if (!input_array.has_shape() || !weights_array.has_shape()) {
+    return ::tensorflow::Status::OK();
+  }
+  const Shape& input_shape = input_array.shape();
+  const Shape& weights_shape = weights_array.shape();
+  if (input_shape.dimensions_count() != 4 ||
+      weights_shape.dimensions_count() != 4) {
+    return ::tensorflow::Status::OK();
+  }
+  // Conv weights are OHWI and DepthwiseConv weights are 1HWO, so the kernel
+  // height and width are dimensions 1 and 2 in both cases.
+  if (!IsEquivalentToSamePadding(input_shape.dims(1), (*left_padding)[1],
+                                 (*right_padding)[1], weights_shape.dims(1),
+                                 conv.stride_height,
+                                 conv.dilation_height_factor) ||
+      !IsEquivalentToSamePadding(input_shape.dims(2), (*left_padding)[2],
+                                 (*right_padding)[2], weights_shape.dims(2),
+                                 conv.stride_width,
+                                 conv.dilation_width_factor)) {
+    AddMessageF(
+        "Not fusing %s into %s because the padding is not equivalent to SAME "
+        "padding",
+        LogName(*pad_op), LogName(*conv_op));
+    return ::tensorflow::Status::OK();
+  }
+
+  AddMessageF("Fusing %s into following %s", LogName(*pad_op),
+              LogName(*conv_op));
+  conv_op->inputs[0] = pad_op->inputs[0];
+  conv.padding->type = PaddingType::kSame;
+  FixedPadding& fixed_padding = conv.padding->GetOrCreateFixedPadding();
+  fixed_padding.height = (*left_padding)[1];
+  fixed_padding.width = (*left_padding)[2];
+  const string padded_array = padded_array_name;
+  DeleteOpAndArraysIfUnused(model, pad_op);
+  model->EraseArray(padded_array);
+  *modified = true;
+  return ::tensorflow::Status::OK();
+}
+
+}  // namespace toco
@@ -0,0 +1,125 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/lite/toco/graph_transformations/graph_transformations.h"
+#include "tensorflow/lite/toco/model.h"
+#include "tensorflow/lite/toco/tooling_util.h"
+#include "tensorflow/core/platform/logging.h"
+
+namespace toco {
+
+namespace {
+
+bool IsFusableConv(const Model& model, const Operator* op,
+                   const string& array_name) {
+  if (!op || (op->type != OperatorType::kConv &&
+              op->type != OperatorType::kDepthwiseConv)) {
+    return false;
+  }
+  // The residual becomes inputs[3], which requires the bias in inputs[2]. The
+  // activation must apply to the sum, so the conv must not have one already.
+  if (op->inputs.size() != 3 || op->outputs[0] != array_name ||
+      op->fused_activation_function != FusedActivationFunctionType::kNone) {
+    return false;
+  }
+  return IsDiscardableArray(model, array_name) &&
+         CountOpsWithInput(model, array_name) == 1;
+}
+
+bool IsFloatArrayOfShape(const Model& model, const string& array_name,
+                         const Shape& shape) {
+  const Array& array = model.GetArray(array_name);
+  return array.data_type == ArrayDataType::kFloat && array.has_shape() &&
+         array.shape() == shape;
+}
+
+}  // namespace
+
+// Fuses an Add of the output of a Conv or DepthwiseConv and another array of
+// the same shape, i.e. a residual connection, into the convolution, which then
+// takes the other array as a fourth input. This saves writing the convolution
+// output and reading it back for the Add. Only float kernels support the
+// residual input, so this must not run on models being quantized.
+::tensorflow::Status FuseResidualAddIntoPrecedingConv::Run(
+    Model* model, std::size_t op_index, bool* modified) {
+  *modified = false;
+  const auto add_it = model->operators.begin() + op_index;
+  auto* add_op = add_it->get();
+  if (add_op->type != OperatorType::kAdd) {
+    return ::tensorflow::Status::OK();
+  }
+  CHECK_EQ(add_op->inputs.size(), 2);
+  if (add_op->inputs[0] == add_op->inputs[1]) {
+    return ::tensorflow::Status::OK();
+  }
+
+  int conv_input_index = -1;
+  Operator* conv_op = nullptr;
+  for (int i = 0; i < 2; ++i) {
+    Operator* op = GetOpWithOutput(*model, add_op->inputs[i]);
+    if (IsFusableConv(*model, op, add_op->inputs[i])) {
+      conv_input_index = i;
+      conv_op = op;
+      break;
+    }
+  }
+  if (!conv_op) {
+    return ::tensorflow::Status::OK();
+  }
+  const string conv_output_name = add_op->inputs[conv_input_index];
+  const string residual_name = add_op->inputs[1 - conv_input_index];
+
+  // Broadcasting adds are not residual connections.
+  const Array& output_array = model->GetArray(add_op->outputs[0]);
+  if (!output_array.has_shape()) {
+    return ::tensorflow::Status::OK();
+  }
+  const Shape& output_shape = output_array.shape();
+  if (output_array.data_type != ArrayDataType::kFloat ||
+      output_array.quantization_params ||
+      !IsFloatArrayOfShape(*model, conv_output_name, output_shape) ||
+      !IsFloatArrayOfShape(*model, residual_name, output_shape)) {
+    AddMessageF(
+        "Not fusing %s into preceding %s because the arrays are not float "
+        "arrays of the same shape",
+        LogName(*add_op), LogName(*conv_op));
+    return ::tensorflow::Status::OK();
+  }
+
+  AddMessageF("Fusing %s into preceding %s as residual", LogName(*add_op),
+              LogName(*conv_op));
+  conv_op->inputs.push_back(residual_name);
+  conv_op->outputs[0] = add_op->outputs[0];
+  conv_op->fused_activation_function = add_op->fused_activation_function;
+  model->EraseArray(conv_output_name);
+
+  // The residual may be computed after the conv, so the conv moves to where
+  // the Add was. Its other inputs are already available there.
+  auto conv_it = FindOp(*model, conv_op);
+  std::unique_ptr<Operator> fused_op = std::move(*conv_it);
+  model->operators.erase(conv_it);
+  auto fused_it = FindOp(*model, add_op);
+  CHECK(fused_it != model->operators.end());
+  *fused_it = std::move(fused_op);
+
+  *modified = true;
+  return ::tensorflow::Status::OK();
+}
+
+}  // namespace toco
@@ -135,6 +135,8 @@ DECLARE_GRAPH_TRANSFORMATION(FuseActivationFunctions)
 DECLARE_GRAPH_TRANSFORMATION(FuseBinaryIntoFollowingAffine)
 DECLARE_GRAPH_TRANSFORMATION(FuseBinaryIntoPrecedingAffine)
 DECLARE_GRAPH_TRANSFORMATION(FuseBroadcastIntoFollowingBinary)
+DECLARE_GRAPH_TRANSFORMATION(FusePadIntoFollowingConv)
+DECLARE_GRAPH_TRANSFORMATION(FuseResidualAddIntoPrecedingConv)
 DECLARE_GRAPH_TRANSFORMATION(GroupBidirectionalSequenceLstm)
 DECLARE_GRAPH_TRANSFORMATION(GroupBidirectionalSequenceRnn)
 DECLARE_GRAPH_TRANSFORMATION(GroupDynamicBidirectionalSequenceLstm)
@@ -185,7 +187,6 @@ DECLARE_GRAPH_TRANSFORMATION(ResolveConstantReshape)
 DECLARE_GRAPH_TRANSFORMATION(ResolveConstantTranspose)
 DECLARE_GRAPH_TRANSFORMATION(DropFakeQuant)
 DECLARE_GRAPH_TRANSFORMATION(UnfuseActivationFunctions)
-DECLARE_GRAPH_TRANSFORMATION(UnrollBatchMatMul)
 DECLARE_GRAPH_TRANSFORMATION(ResolveSpaceToBatchNDAttributes)
 DECLARE_GRAPH_TRANSFORMATION(ResolveBatchToSpaceNDAttributes)
 DECLARE_GRAPH_TRANSFORMATION(ResolvePadAttributes)
@@ -295,6 +296,22 @@ class IdentifyDilatedConv : public GraphTransformation {
   bool identify_depthwise_conv_ = true;
 };
 
+class UnrollBatchMatMul : public GraphTransformation {
+ public:
+  ::tensorflow::Status Run(Model* model, std::size_t op_index,
+                           bool* modified) override;
+  const char* Name() const override { return "UnrollBatchMatMul"; }
+
+  // When false, only the BatchMatMul operators without batch dimensions are
+  // replaced by MatMul, and the others are kept for runtimes that implement
+  // BatchMatMul natively.
+  bool unroll_batches() const { return unroll_batches_; }
+  void set_unroll_batches(bool val) { unroll_batches_ = val; }
+
+ private:
+  bool unroll_batches_ = true;
+};
+
 #undef DECLARE_GRAPH_TRANSFORMATION
 
 }  // end namespace toco
@@ -393,6 +393,49 @@ void ProcessFullyConnectedOperator(Model* model, FullyConnectedOperator* op) {
   output_array.copy_shape(Shape({matmul_repeats, weights_output_depth}));
 }
 
+void ProcessBatchMatMulOperator(Model* model, BatchMatMulOperator* op) {
+  CHECK_EQ(op->inputs.size(), 2);
+  CHECK_EQ(op->outputs.size(), 1);
+  auto& output_array = model->GetArray(op->outputs[0]);
+  if (output_array.has_shape()) {
+    return;
+  }
+  const auto& lhs_array = model->GetArray(op->inputs[0]);
+  const auto& rhs_array = model->GetArray(op->inputs[1]);
+  // Yield until input dims have been resolved.
+  if (!lhs_array.has_shape() || !rhs_array.has_shape()) {
+    return;
+  }
+  const auto& lhs_shape = lhs_array.shape();
+  const auto& rhs_shape = rhs_array.shape();
+  const int lhs_rank = lhs_shape.dimensions_count();
+  const int rhs_rank = rhs_shape.dimensions_count();
+  CHECK_GE(lhs_rank, 2) << "First input must have rank >= 2";
+  CHECK_GE(rhs_rank, 2) << "Second input must have rank >= 2";
+  CHECK_EQ(lhs_shape.dims(op->adj_x ? lhs_rank - 2 : lhs_rank - 1),
+           rhs_shape.dims(op->adj_y ? rhs_rank - 1 : rhs_rank - 2))
+      << "Input dimensions must be compatible for multiplication";
+
+  // The batch dimensions are broadcast against each other, aligned on the
+  // innermost ones.
+  const int output_rank = std::max(lhs_rank, rhs_rank);
+  std::vector<int> output_dims(output_rank);
+  for (int i = 0; i < output_rank - 2; ++i) {
+    const int lhs_index = i - (output_rank - lhs_rank);
+    const int rhs_index = i - (output_rank - rhs_rank);
+    const int lhs_dim = lhs_index >= 0 ? lhs_shape.dims(lhs_index) : 1;
+    const int rhs_dim = rhs_index >= 0 ? rhs_shape.dims(rhs_index) : 1;
+    CHECK(lhs_dim == rhs_dim || lhs_dim == 1 || rhs_dim == 1)
+        << "Input batch dimensions must be broadcastable";
+    output_dims[i] = lhs_dim == 1 ? rhs_dim : lhs_dim;
+  }
+  output_dims[output_rank - 2] =
+      lhs_shape.dims(op->adj_x ? lhs_rank - 1 : lhs_rank - 2);
+  output_dims[output_rank - 1] =
+      rhs_shape.dims(op->adj_y ? rhs_rank - 2 : rhs_rank - 1);
+  *output_array.mutable_shape()->mutable_dims() = output_dims;
+}
+
 void ProcessTensorFlowReshapeOperator(Model* model,
                                       TensorFlowReshapeOperator* op) {
   auto& output_array = model->GetArray(op->outputs[0]);
@@ -2330,6 +2373,8 @@ void ProcessMatrixSetDiagOperator(Model* model, MatrixSetDiagOperator* op) {
       ProcessLstmCellOperator(model, static_cast<LstmCellOperator*>(op));
       break;
     case OperatorType::kBatchMatMul:
+      ProcessBatchMatMulOperator(model, static_cast<BatchMatMulOperator*>(op));
+      break;
     case OperatorType::kMatMul:
       // MatMul operators are converted to FullyConnected, after which their
       // shapes are propagated.
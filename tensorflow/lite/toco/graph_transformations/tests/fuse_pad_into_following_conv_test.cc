@@ -0,0 +1,103 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "absl/memory/memory.h"
+#include "tensorflow/lite/toco/graph_transformations/graph_transformations.h"
+#include "tensorflow/lite/toco/model.h"
+#include "tensorflow/lite/toco/tooling_util.h"
+
+namespace toco {
+
+class FusePadIntoFollowingConvTest : public ::testing::Test {
+ protected:
+  void SetUp() override { model_.reset(new Model); }
+
+  void CreateArray(const string& name, const std::vector<int>& shape) {
+    Array& array = model_->GetOrCreateArray(name);
+    array.data_type = ArrayDataType::kFloat;
+    *array.mutable_shape()->mutable_dims() = shape;
+  }
+
+  // Builds Pad -> 3x3 Conv with stride 2 and VALID padding on a 1x8x8x3
+  // input. SAME padding of this conv is 0 rows on top and 1 at the bottom.
+  void CreateModel(const std::vector<int>& left_padding,
+                   const std::vector<int>& right_padding) {
+    CreateArray("Input", {1, 8, 8, 3});
+    CreateArray("Paddings", {4, 2});
+    CreateArray("Padded", {1, 8 + left_padding[1] + right_padding[1],
+                           8 + left_padding[2] + right_padding[2], 3});
+    CreateArray("Weights", {4, 3, 3, 3});
+    CreateArray("Bias", {4});
+    CreateArray("Output", {1, 4, 4, 4});
+
+    auto pad_op = absl::make_unique<PadOperator>();
+    pad_op->inputs = {"Input", "Paddings"};
+    pad_op->outputs = {"Padded"};
+    pad_op->left_padding = left_padding;
+    pad_op->right_padding = right_padding;
+    model_->operators.push_back(std::move(pad_op));
+
+    auto conv_op = absl::make_unique<ConvOperator>();
+    conv_op->inputs = {"Padded", "Weights", "Bias"};
+    conv_op->outputs = {"Output"};
+    conv_op->padding.type = PaddingType::kValid;
+    conv_op->stride_width = 2;
+    conv_op->stride_height = 2;
+    model_->operators.push_back(std::move(conv_op));
+  }
+
+  std::unique_ptr<Model> model_;
+};
+
+TEST_F(FusePadIntoFollowingConvTest, FusesSamePadding) {
+  CreateModel({0, 0, 0, 0}, {0, 1, 1, 0});
+
+  bool modified;
+  ASSERT_TRUE(FusePadIntoFollowingConv().Run(model_.get(), 0, &modified).ok());
+  EXPECT_TRUE(modified);
+
+  ASSERT_EQ(model_->operators.size(), 1);
+  const auto& conv_op =
+      static_cast<const ConvOperator&>(*model_->operators[0]);
+  EXPECT_EQ(conv_op.inputs[0], "Input");
+  EXPECT_EQ(conv_op.padding.type, PaddingType::kSame);
+  EXPECT_FALSE(model_->HasArray("Padded"));
+  EXPECT_FALSE(model_->HasArray("Paddings"));
+}
+
+TEST_F(FusePadIntoFollowingConvTest, DoesNotFuseOtherPadding) {
+  // Same output size, but the convolution windows are shifted by one.
+  CreateModel({0, 1, 1, 0}, {0, 0, 0, 0});
+
+  bool modified;
+  ASSERT_TRUE(FusePadIntoFollowingConv().Run(model_.get(), 0, &modified).ok());
+  EXPECT_FALSE(modified);
+  EXPECT_EQ(model_->operators.size(), 2);
+}
+
+TEST_F(FusePadIntoFollowingConvTest, DoesNotFuseChannelPadding) {
+  CreateModel({0, 0, 0, 1}, {0, 1, 1, 0});
+
+  bool modified;
+  ASSERT_TRUE(FusePadIntoFollowingConv().Run(model_.get(), 0, &modified).ok());
+  EXPECT_FALSE(modified);
+  EXPECT_EQ(model_->operators.size(), 2);
+}
+
+}  // namespace toco
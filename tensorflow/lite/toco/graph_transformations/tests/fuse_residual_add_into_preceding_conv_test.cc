@@ -0,0 +1,104 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "absl/memory/memory.h"
+#include "tensorflow/lite/toco/graph_transformations/graph_transformations.h"
+#include "tensorflow/lite/toco/model.h"
+#include "tensorflow/lite/toco/tooling_util.h"
+
+namespace toco {
+
+class FuseResidualAddIntoPrecedingConvTest : public ::testing::Test {
+ protected:
+  void SetUp() override { model_.reset(new Model); }
+
+  void CreateArray(const string& name, const std::vector<int>& shape) {
+    Array& array = model_->GetOrCreateArray(name);
+    array.data_type = ArrayDataType::kFloat;
+    *array.mutable_shape()->mutable_dims() = shape;
+  }
+
+  // Builds Conv -> Add(conv output, Relu(Shortcut)), where the Relu computing
+  // the residual comes after the Conv in the operator order.
+  void CreateModel(const std::vector<int>& residual_shape) {
+    CreateArray("Input", {1, 4, 4, 8});
+    CreateArray("Weights", {8, 1, 1, 8});
+    CreateArray("Bias", {8});
+    CreateArray("ConvOutput", {1, 4, 4, 8});
+    CreateArray("Shortcut", residual_shape);
+    CreateArray("Residual", residual_shape);
+    CreateArray("Output", {1, 4, 4, 8});
+
+    auto conv_op = absl::make_unique<ConvOperator>();
+    conv_op->inputs = {"Input", "Weights", "Bias"};
+    conv_op->outputs = {"ConvOutput"};
+    conv_op->padding.type = PaddingType::kSame;
+    conv_op->stride_width = 1;
+    conv_op->stride_height = 1;
+    model_->operators.push_back(std::move(conv_op));
+
+    auto relu_op = absl::make_unique<ReluOperator>();
+    relu_op->inputs = {"Shortcut"};
+    relu_op->outputs = {"Residual"};
+    model_->operators.push_back(std::move(relu_op));
+
+    auto add_op = absl::make_unique<AddOperator>();
+    add_op->inputs = {"ConvOutput", "Residual"};
+    add_op->outputs = {"Output"};
+    add_op->fused_activation_function = FusedActivationFunctionType::kRelu;
+    model_->operators.push_back(std::move(add_op));
+  }
+
+  std::unique_ptr<Model> model_;
+};
+
+TEST_F(FuseResidualAddIntoPrecedingConvTest, FusesResidualAdd) {
+  CreateModel({1, 4, 4, 8});
+
+  bool modified;
+  ASSERT_TRUE(FuseResidualAddIntoPrecedingConv()
+                  .Run(model_.get(), 2, &modified)
+                  .ok());
+  EXPECT_TRUE(modified);
+
+  // The conv now runs after the Relu that computes its residual input.
+  ASSERT_EQ(model_->operators.size(), 2);
+  EXPECT_EQ(model_->operators[0]->type, OperatorType::kRelu);
+  const Operator& conv_op = *model_->operators[1];
+  EXPECT_EQ(conv_op.type, OperatorType::kConv);
+  EXPECT_EQ(conv_op.inputs,
+            std::vector<string>({"Input", "Weights", "Bias", "Residual"}));
+  EXPECT_EQ(conv_op.outputs[0], "Output");
+  EXPECT_EQ(conv_op.fused_activation_function,
+            FusedActivationFunctionType::kRelu);
+  EXPECT_FALSE(model_->HasArray("ConvOutput"));
+}
+
+TEST_F(FuseResidualAddIntoPrecedingConvTest, DoesNotFuseBroadcastAdd) {
+  CreateModel({1, 1, 1, 8});
+
+  bool modified;
+  ASSERT_TRUE(FuseResidualAddIntoPrecedingConv()
+                  .Run(model_.get(), 2, &modified)
+                  .ok());
+  EXPECT_FALSE(modified);
+  EXPECT_EQ(model_->operators.size(), 3);
+}
+
+}  // namespace toco
@@ -147,6 +147,10 @@ TransposeOperator* TransposeInput(const string& input, Model* model) {
   const auto& input_rhs_array = model->GetArray(input_rhs);
   if (!input_lhs_array.has_shape() || !input_rhs_array.has_shape())
     return ::tensorflow::Status::OK();
+  if (!unroll_batches_ && (input_lhs_array.shape().dimensions_count() > 2 ||
+                          input_rhs_array.shape().dimensions_count() > 2)) {
+    return ::tensorflow::Status::OK();
+  }
 
   // Transpose LHS input if necessary.
   if (batch_op->adj_x) {
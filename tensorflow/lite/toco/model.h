@@ -450,6 +450,9 @@ struct Padding {
 //   inputs[1]: required: the Conv weights
 //   inputs[2]: optional: the bias vector, specifying the biases for each output
 //   channel.
+//   inputs[3]: optional: a residual array of the output shape, added to the
+//   output before the fused activation function. Only set by
+//   FuseResidualAddIntoPrecedingConv, and requires inputs[2].
 //
 // Outputs:
 //   outputs[0]: required: the output activations array
@@ -499,6 +502,7 @@ struct CTCBeamSearchDecoderOperator : Operator {
 //   inputs[1]: required: the DepthwiseConv weights
 //   inputs[2]: optional: the bias vector, specifying the biases for each output
 //   channel.
+//   inputs[3]: optional: a residual array, as for ConvOperator.
 //
 // TensorFlow equivalent: DepthwiseConv2dNative
 struct DepthwiseConvOperator : Operator {
@@ -169,6 +169,7 @@ string GetMinimumRuntimeVersionForModel(const Model& model) {
           {{OperatorType::kSelect, 2}, "1.14.0"},
           {{OperatorType::kFloorDiv, 1}, "1.14.0"},
           {{OperatorType::kFloorDiv, 2}, "1.14.0"},
+          {{OperatorType::kBatchMatMul, 1}, kPendingReleaseOpVersion},
       });
 
   const auto& op_types_map =
@@ -111,6 +111,10 @@ class Convolution
     const Array& input_array = op_signature.model->GetArray(input_name);
     const Array& filter_array = op_signature.model->GetArray(filter_name);
     const Array& output_array = op_signature.model->GetArray(output_name);
+    // If the op has a fused residual input, its version 4.
+    if (op_signature.op->inputs.size() == 4) {
+      return 4;
+    }
     // If the op has signed int8 inputs and outputs, its version 3.
     if (input_array.data_type == ArrayDataType::kInt8 &&
         filter_array.data_type == ArrayDataType::kInt8 &&
@@ -168,6 +172,10 @@ class DepthwiseConvolution
     const Array& input_array = op_signature.model->GetArray(input_name);
     const Array& filter_array = op_signature.model->GetArray(filter_name);
     const Array& output_array = op_signature.model->GetArray(output_name);
+    // If the op has a fused residual input, its version 4.
+    if (op_signature.op->inputs.size() == 4) {
+      return 4;
+    }
     // If the op has signed int8 inputs and outputs, its version 3.
     if (input_array.data_type == ArrayDataType::kInt8 &&
         filter_array.data_type == ArrayDataType::kInt8 &&
@@ -1020,6 +1028,11 @@ class Lstm : public BuiltinOperator<LstmCellOperator, ::tflite::LSTMOptions,
             output_array.data_type == ArrayDataType::kFloat) {
           return 3;
         }
+        // If the input tensor is int8, this is a version 4 fully integer
+        // operation.
+        if (input_array.data_type == ArrayDataType::kInt8) {
+          return 4;
+        }
         return 1;
       }
       case LstmCellOperator::KERNEL_BASIC:
@@ -2256,6 +2269,29 @@ class ReverseSequence
   }
 };
 
+class BatchMatMul
+    : public BuiltinOperator<BatchMatMulOperator, ::tflite::BatchMatMulOptions,
+                             ::tflite::BuiltinOptions_BatchMatMulOptions> {
+ public:
+  using BuiltinOperator::BuiltinOperator;
+
+  flatbuffers::Offset<TfLiteOptions> WriteOptions(
+      const TocoOperator& op,
+      flatbuffers::FlatBufferBuilder* builder) const override {
+    return ::tflite::CreateBatchMatMulOptions(*builder, op.adj_x, op.adj_y);
+  }
+
+  void ReadOptions(const TfLiteOptions& options,
+                   TocoOperator* op) const override {
+    op->adj_x = options.adj_x();
+    op->adj_y = options.adj_y();
+  }
+
+  int GetVersion(const OperatorSignature& op_signature) const override {
+    return 1;
+  }
+};
+
 class Equal : public SimpleOperator<TensorFlowEqualOperator> {
  public:
   explicit Equal() : SimpleOperator("EQUAL", OperatorType::kEqual) {}
@@ -2522,6 +2558,8 @@ std::vector<std::unique_ptr<BaseOperator>> BuildOperatorList(
       "MATRIX_DIAG", OperatorType::kMatrixDiag));
   ops.push_back(MakeUnique<SimpleOperator<MatrixSetDiagOperator>>(
       "MATRIX_SET_DIAG", OperatorType::kMatrixSetDiag));
+  ops.push_back(MakeUnique<BatchMatMul>(::tflite::BuiltinOperator_BATCH_MATMUL,
+                                        OperatorType::kBatchMatMul));
   // Custom Operators.
   ops.push_back(
       MakeUnique<DepthToSpace>("DEPTH_TO_SPACE", OperatorType::kDepthToSpace));
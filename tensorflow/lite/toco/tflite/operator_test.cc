@@ -724,6 +724,17 @@ TEST_F(OperatorTest, BuiltinReverseSequence) {
   EXPECT_EQ(op.batch_dim, output_toco_op->batch_dim);
 }
 
+TEST_F(OperatorTest, BuiltinBatchMatMul) {
+  BatchMatMulOperator op;
+  op.adj_x = true;
+  op.adj_y = false;
+  std::unique_ptr<toco::BatchMatMulOperator> output_toco_op =
+      SerializeAndDeserialize(
+          GetOperator("BATCH_MATMUL", OperatorType::kBatchMatMul), op);
+  EXPECT_EQ(op.adj_x, output_toco_op->adj_x);
+  EXPECT_EQ(op.adj_y, output_toco_op->adj_y);
+}
+
 TEST_F(OperatorTest, BuiltinMatrixDiag) {
   MatrixDiagOperator op;
   std::unique_ptr<toco::MatrixDiagOperator> output_toco_op =
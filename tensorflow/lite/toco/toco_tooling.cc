@@ -74,7 +74,6 @@ void MakeGeneralGraphTransformationsSet(
   transformations->Add(new RemoveUnusedOp);
   transformations->Add(new EnsureBiasVectors);
   transformations->Add(new ResolveReorderAxes);
-  transformations->Add(new UnrollBatchMatMul);
   transformations->Add(new ResolveTensorFlowMatMul);
   transformations->Add(new FuseBinaryIntoPrecedingAffine);
   transformations->Add(new FuseBinaryIntoFollowingAffine);
@@ -309,6 +308,12 @@ tensorflow::Status TransformWithStatus(const TocoFlags& toco_flags,
     identify_dilated_conv->set_identify_depthwise_conv(false);
   }
   transformations.Add(identify_dilated_conv);
+  // The TFLite runtime has a native BatchMatMul kernel, but only for float.
+  auto* unroll_batch_matmul = new UnrollBatchMatMul;
+  if (output_format == TFLITE && !quantize_output) {
+    unroll_batch_matmul->set_unroll_batches(false);
+  }
+  transformations.Add(unroll_batch_matmul);
   TF_RETURN_IF_ERROR(RunGraphTransformationsWithStatus(
       model, "general graph transformations", transformations));
 
@@ -406,6 +411,18 @@ tensorflow::Status TransformWithStatus(const TocoFlags& toco_flags,
         dequantization_transformations));
   }
 
+  if (output_format == TFLITE) {
+    // These produce ops that only the TF Lite kernels understand, and run last
+    // so that no other transformation needs to know about them.
+    GraphTransformationsSet fusion_transformations;
+    fusion_transformations.Add(new FusePadIntoFollowingConv);
+    if (!quantize_output) {
+      fusion_transformations.Add(new FuseResidualAddIntoPrecedingConv);
+    }
+    TF_RETURN_IF_ERROR(RunGraphTransformationsWithStatus(
+        model, "kernel fusion graph transformations", fusion_transformations));
+  }
+
   if (output_format == TENSORFLOW_GRAPHDEF) {
     EncodeConstantArraysMinMaxByWrappingThemInFakeQuantNodes(model);
   }
@@ -236,6 +236,8 @@ BenchmarkParams BenchmarkTfLiteModel::DefaultParams() {
   default_params.AddParam(
       "enable_op_profiling",
       BenchmarkParam::Create<bool>(kOpProfilingEnabledDefault));
+  default_params.AddParam("warmup_interpreter",
+                          BenchmarkParam::Create<bool>(false));
   return default_params;
 }
 
@@ -270,7 +272,10 @@ std::vector<Flag> BenchmarkTfLiteModel::GetFlags() {
       CreateFlag<bool>("use_legacy_nnapi", &params_, "use legacy nnapi api"),
       CreateFlag<bool>("use_gpu", &params_, "use gpu"),
       CreateFlag<bool>("allow_fp16", &params_, "allow fp16"),
-      CreateFlag<bool>("enable_op_profiling", &params_, "enable op profiling")};
+      CreateFlag<bool>("enable_op_profiling", &params_, "enable op profiling"),
+      CreateFlag<bool>("warmup_interpreter", &params_,
+                       "warm up the interpreter during initialization and "
+                       "report the time of each phase of the warmup")};
 
   flags.insert(flags.end(), specific_flags.begin(), specific_flags.end());
   return flags;
@@ -291,6 +296,8 @@ void BenchmarkTfLiteModel::LogParams() {
                    << "]";
   TFLITE_LOG(INFO) << "Enable op profiling: ["
                    << params_.Get<bool>("enable_op_profiling") << "]";
+  TFLITE_LOG(INFO) << "Warmup interpreter: ["
+                   << params_.Get<bool>("warmup_interpreter") << "]";
 }
 
 bool BenchmarkTfLiteModel::ValidateParams() {
@@ -473,11 +480,25 @@ void BenchmarkTfLiteModel::Init() {
     }
   }
 
-  // Don't allocate tensors if we have delegates.
-  if (delegates_.empty() && interpreter->AllocateTensors() != kTfLiteOk) {
+  // Don't allocate tensors if we have delegates. Warmup allocates them
+  // itself, as part of the prepare phase it times.
+  const bool warmup_interpreter = params_.Get<bool>("warmup_interpreter");
+  if (delegates_.empty() && !warmup_interpreter &&
+      interpreter->AllocateTensors() != kTfLiteOk) {
     TFLITE_LOG(FATAL) << "Failed to allocate tensors!";
   }
 
+  if (warmup_interpreter) {
+    Interpreter::WarmupTimings timings;
+    if (interpreter->Warmup(&timings) != kTfLiteOk) {
+      TFLITE_LOG(FATAL) << "Failed to warm up the interpreter!";
+    }
+    TFLITE_LOG(INFO) << "Interpreter warmup timings in us: "
+                     << "Prepare: " << timings.prepare_us << ", "
+                     << "Fault in: " << timings.fault_in_us << ", "
+                     << "Dry run: " << timings.dry_run_us;
+  }
+
   // Install profilers if necessary.
   if (params_.Get<bool>("enable_op_profiling")) {
     profiling_listener_.reset(new ProfilingListener(interpreter.get()));
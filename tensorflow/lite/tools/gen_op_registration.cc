@@ -12,6 +12,9 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
+#include <map>
+#include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -44,4 +47,140 @@ void ReadOpsFromModel(const ::tflite::Model* model,
   }
 }
 
+void ReadOpVersionsFromModel(const ::tflite::Model* model,
+                             std::map<string, std::set<int>>* builtin_ops,
+                             std::map<string, std::set<int>>* custom_ops) {
+  if (!model) return;
+  auto opcodes = model->operator_codes();
+  if (!opcodes) return;
+  for (const auto* opcode : *opcodes) {
+    if (opcode->builtin_code() != ::tflite::BuiltinOperator_CUSTOM) {
+      (*builtin_ops)[tflite::EnumNameBuiltinOperator(opcode->builtin_code())]
+          .insert(opcode->version());
+    } else {
+      (*custom_ops)[opcode->custom_code()->c_str()].insert(opcode->version());
+    }
+  }
+}
+
+std::vector<string> FindUnsupportedOpVersions(
+    const std::map<string, std::set<int>>& builtin_ops,
+    const OpResolver& op_resolver) {
+  std::vector<string> unsupported;
+  for (const auto& op : builtin_ops) {
+    const BuiltinOperator* op_code = nullptr;
+    for (const BuiltinOperator& value : EnumValuesBuiltinOperator()) {
+      if (op.first == EnumNameBuiltinOperator(value)) {
+        op_code = &value;
+        break;
+      }
+    }
+    for (int version : op.second) {
+      if (!op_code || !op_resolver.FindOp(*op_code, version)) {
+        unsupported.push_back(op.first + " version " +
+                              std::to_string(version));
+      }
+    }
+  }
+  return unsupported;
+}
+
+namespace {
+
+// Writes the cases of a switch on `version` that return the registration of
+// `register_function` for each of `versions`.
+void WriteVersionCases(const string& register_function, const string& op,
+                       const string& custom_name, const std::set<int>& versions,
+                       std::ostream* out) {
+  *out << "      switch (version) {\n";
+  for (int version : versions) {
+    *out << "        case " << version << ": {\n"
+         << "          static const TfLiteRegistration registration =\n"
+         << "              WithVersion(" << register_function << "(),\n"
+         << "                          " << op << ", " << custom_name << ", "
+         << version << ");\n"
+         << "          return &registration;\n"
+         << "        }\n";
+  }
+  *out << "      }\n"
+       << "      return nullptr;\n";
+}
+
+}  // namespace
+
+string GenerateOpResolverHeader(
+    const string& tflite_path, const string& class_name,
+    const std::map<string, std::set<int>>& builtin_ops,
+    const std::map<string, std::set<int>>& custom_ops) {
+  const string guard =
+      "TFLITE_GENERATED_" + NormalizeCustomOpName(class_name) + "_H_";
+  std::ostringstream out;
+  out << "// Generated by generate_op_registrations. Do not edit.\n"
+      << "#ifndef " << guard << "\n"
+      << "#define " << guard << "\n\n"
+      << "#include <cstring>\n\n"
+      << "#include \"" << tflite_path << "/c/c_api_internal.h\"\n"
+      << "#include \"" << tflite_path << "/core/api/op_resolver.h\"\n"
+      << "#include \"" << tflite_path << "/schema/schema_generated.h\"\n\n"
+      << "namespace tflite {\n"
+      << "namespace ops {\n";
+  if (!builtin_ops.empty()) {
+    out << "namespace builtin {\n";
+    for (const auto& op : builtin_ops) {
+      out << "TfLiteRegistration* Register_" << op.first << "();\n";
+    }
+    out << "}  // namespace builtin\n";
+  }
+  if (!custom_ops.empty()) {
+    out << "namespace custom {\n";
+    for (const auto& op : custom_ops) {
+      out << "TfLiteRegistration* Register_" << NormalizeCustomOpName(op.first)
+          << "();\n";
+    }
+    out << "}  // namespace custom\n";
+  }
+  out << "}  // namespace ops\n\n"
+      << "class " << class_name << " : public OpResolver {\n"
+      << " public:\n"
+      << "  const TfLiteRegistration* FindOp(BuiltinOperator op,\n"
+      << "                                   int version) const override {\n"
+      << "    switch (op) {\n";
+  for (const auto& op : builtin_ops) {
+    out << "    case BuiltinOperator_" << op.first << ":\n";
+    WriteVersionCases("ops::builtin::Register_" + op.first, "op", "nullptr",
+                      op.second, &out);
+  }
+  out << "    default:\n"
+      << "      return nullptr;\n"
+      << "    }\n"
+      << "  }\n\n"
+      << "  const TfLiteRegistration* FindOp(const char* op,\n"
+      << "                                   int version) const override {\n";
+  for (const auto& op : custom_ops) {
+    out << "    if (strcmp(op, \"" << op.first << "\") == 0) {\n";
+    WriteVersionCases(
+        "ops::custom::Register_" + NormalizeCustomOpName(op.first),
+        "BuiltinOperator_CUSTOM", "\"" + op.first + "\"", op.second, &out);
+    out << "    }\n";
+  }
+  out << "    return nullptr;\n"
+      << "  }\n\n"
+      << " private:\n"
+      << "  // Copies `registration` with the op and version it is found for,\n"
+      << "  // like MutableOpResolver does.\n"
+      << "  static TfLiteRegistration WithVersion(\n"
+      << "      const TfLiteRegistration* registration, BuiltinOperator op,\n"
+      << "      const char* custom_name, int version) {\n"
+      << "    TfLiteRegistration versioned = *registration;\n"
+      << "    versioned.builtin_code = op;\n"
+      << "    versioned.custom_name = custom_name;\n"
+      << "    versioned.version = version;\n"
+      << "    return versioned;\n"
+      << "  }\n"
+      << "};\n\n"
+      << "}  // namespace tflite\n\n"
+      << "#endif  // " << guard << "\n";
+  return out.str();
+}
+
 }  // namespace tflite
@@ -15,6 +15,10 @@ limitations under the License.
 #ifndef TENSORFLOW_LITE_TOOLS_GEN_OP_REGISTRATION_H_
 #define TENSORFLOW_LITE_TOOLS_GEN_OP_REGISTRATION_H_
 
+#include <map>
+#include <set>
+#include <vector>
+
 #include "tensorflow/lite/model.h"
 #include "tensorflow/lite/string.h"
 
@@ -34,6 +38,33 @@ void ReadOpsFromModel(const ::tflite::Model* model,
                       std::vector<string>* builtin_ops,
                       std::vector<string>* custom_ops);
 
+// Read the versions of the ops used by the TFLite model, keyed by the names
+// that ReadOpsFromModel stores.
+void ReadOpVersionsFromModel(const ::tflite::Model* model,
+                             std::map<string, std::set<int>>* builtin_ops,
+                             std::map<string, std::set<int>>* custom_ops);
+
+// Returns the builtin op versions, as read by ReadOpVersionsFromModel, that
+// `op_resolver` does not support, e.g. "CONV_2D version 7". A resolver
+// generated for these would build, but not find them when the model is
+// loaded.
+std::vector<string> FindUnsupportedOpVersions(
+    const std::map<string, std::set<int>>& builtin_ops,
+    const OpResolver& op_resolver);
+
+// Generates the source of a header that defines `class_name`, an OpResolver
+// of exactly the given op versions. It finds them with a switch rather than
+// a map lookup, and only references the kernels of these ops, so that the
+// linker leaves the other kernels out of the binary.
+// The builtin ops are enum names as in ReadOpsFromModel, registered by the
+// Register_<op> functions of tflite::ops::builtin, and the custom ops are
+// registered by the Register_<NormalizeCustomOpName(op)> functions of
+// tflite::ops::custom.
+string GenerateOpResolverHeader(
+    const string& tflite_path, const string& class_name,
+    const std::map<string, std::set<int>>& builtin_ops,
+    const std::map<string, std::set<int>>& custom_ops);
+
 }  // namespace tflite
 
 #endif  // TENSORFLOW_LITE_TOOLS_GEN_OP_REGISTRATION_H_
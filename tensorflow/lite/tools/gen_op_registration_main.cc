@@ -15,12 +15,15 @@ limitations under the License.
 
 #include <cassert>
 #include <fstream>
+#include <iostream>
 #include <map>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "absl/strings/strip.h"
+#include "tensorflow/lite/kernels/register.h"
 #include "tensorflow/lite/tools/gen_op_registration.h"
 #include "tensorflow/core/platform/init_main.h"
 #include "tensorflow/core/util/command_line_flags.h"
@@ -28,18 +31,26 @@ limitations under the License.
 const char kInputModelFlag[] = "input_model";
 const char kOutputRegistrationFlag[] = "output_registration";
 const char kTfLitePathFlag[] = "tflite_path";
+const char kOutputResolverFlag[] = "output_resolver";
+const char kResolverClassFlag[] = "resolver_class";
 
 using tensorflow::Flag;
 using tensorflow::Flags;
 using tensorflow::string;
 
 void ParseFlagAndInit(int argc, char** argv, string* input_model,
-                      string* output_registration, string* tflite_path) {
+                      string* output_registration, string* tflite_path,
+                      string* output_resolver, string* resolver_class) {
   std::vector<tensorflow::Flag> flag_list = {
       Flag(kInputModelFlag, input_model, "path to the tflite model"),
       Flag(kOutputRegistrationFlag, output_registration,
            "filename for generated registration code"),
       Flag(kTfLitePathFlag, tflite_path, "Path to tensorflow lite dir"),
+      Flag(kOutputResolverFlag, output_resolver,
+           "filename for a generated header defining a resolver of only the "
+           "op versions used by the model"),
+      Flag(kResolverClassFlag, resolver_class,
+           "name of the class of the generated resolver"),
   };
 
   Flags::Parse(&argc, argv, flag_list);
@@ -99,8 +110,10 @@ int main(int argc, char** argv) {
   string input_model;
   string output_registration;
   string tflite_path;
+  string output_resolver;
+  string resolver_class = "SelectedOpResolver";
   ParseFlagAndInit(argc, argv, &input_model, &output_registration,
-                   &tflite_path);
+                   &tflite_path, &output_resolver, &resolver_class);
 
   std::vector<string> builtin_ops;
   std::vector<string> custom_ops;
@@ -111,7 +124,31 @@ int main(int argc, char** argv) {
   string content_str = content.str();
   const ::tflite::Model* model = ::tflite::GetModel(content_str.data());
   ::tflite::ReadOpsFromModel(model, &builtin_ops, &custom_ops);
-  GenerateFileContent(tflite_path, output_registration, builtin_ops,
-                      custom_ops);
+  if (!output_registration.empty()) {
+    GenerateFileContent(tflite_path, output_registration, builtin_ops,
+                        custom_ops);
+  }
+  if (!output_resolver.empty()) {
+    std::map<string, std::set<int>> builtin_op_versions;
+    std::map<string, std::set<int>> custom_op_versions;
+    ::tflite::ReadOpVersionsFromModel(model, &builtin_op_versions,
+                                      &custom_op_versions);
+    // The builtin kernels only support some versions of each op. Custom ops
+    // are registered by the libraries of the model and can't be checked here.
+    const std::vector<string> unsupported_op_versions =
+        ::tflite::FindUnsupportedOpVersions(
+            builtin_op_versions, ::tflite::ops::builtin::BuiltinOpResolver());
+    if (!unsupported_op_versions.empty()) {
+      for (const string& op_version : unsupported_op_versions) {
+        std::cerr << "The model uses " << op_version
+                  << ", which no builtin kernel supports.\n";
+      }
+      return 1;
+    }
+    std::ofstream fout(output_resolver);
+    fout << ::tflite::GenerateOpResolverHeader(tflite_path, resolver_class,
+                                               builtin_op_versions,
+                                               custom_op_versions);
+  }
   return 0;
 }
@@ -16,6 +16,7 @@ limitations under the License.
 #include "tensorflow/lite/tools/gen_op_registration.h"
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "tensorflow/lite/mutable_op_resolver.h"
 
 using ::testing::ElementsAreArray;
 
@@ -66,6 +67,31 @@ TEST_F(GenOpRegistrationTest, TestBrokenMmap) {
   EXPECT_EQ(custom_ops_.size(), 0);
 }
 
+TEST_F(GenOpRegistrationTest, TestOpVersions) {
+  auto model = FlatBufferModel::BuildFromFile(
+      "tensorflow/lite/testdata/test_model.bin");
+  ASSERT_TRUE(model);
+  std::map<string, std::set<int>> builtin_ops;
+  std::map<string, std::set<int>> custom_ops;
+  ReadOpVersionsFromModel(model->GetModel(), &builtin_ops, &custom_ops);
+  EXPECT_EQ(builtin_ops, (std::map<string, std::set<int>>{{"CONV_2D", {1}}}));
+  EXPECT_EQ(custom_ops,
+            (std::map<string, std::set<int>>{{"testing_op", {1}}}));
+}
+
+TEST_F(GenOpRegistrationTest, TestUnsupportedOpVersions) {
+  TfLiteRegistration registration = {};
+  MutableOpResolver resolver;
+  resolver.AddBuiltin(BuiltinOperator_ADD, &registration, /*min_version=*/1,
+                      /*max_version=*/2);
+  EXPECT_TRUE(FindUnsupportedOpVersions({{"ADD", {1, 2}}}, resolver).empty());
+  EXPECT_THAT(FindUnsupportedOpVersions(
+                  {{"ADD", {2, 3}}, {"CONV_2D", {1}}, {"NOT_AN_OP", {1}}},
+                  resolver),
+              ElementsAreArray({"ADD version 3", "CONV_2D version 1",
+                                "NOT_AN_OP version 1"}));
+}
+
 TEST_F(GenOpRegistrationTest, TestNormalizeCustomOpName) {
   std::vector<std::pair<string, string>> testcase = {
       {"CustomOp", "CUSTOM_OP"},
@@ -114,6 +114,15 @@ OperatorProperty GetOperatorProperty(const BuiltinOperator& op) {
       property.restricted_value_on_output = {1 / 128.0, 0};
       property.version = 2;
       break;
+    case BuiltinOperator_LSTM:
+      // The input and the int8 input, recurrent and projection weights. The
+      // remaining tensors of the fully integer kernel (int16 peephole weights,
+      // layer norm coefficients and cell state, int32 biases) are quantized
+      // by a dedicated pass, see QuantizeLstmTensors.
+      property.input_indexes = {0, 1, 2, 3, 4, 5, 6, 7, 8, 16};
+      property.output_indexes = {0};
+      property.version = 4;
+      break;
     case BuiltinOperator_MAX_POOL_2D:
       property.input_indexes = {0};
       property.output_indexes = {0};
@@ -196,6 +196,42 @@ TfLiteStatus SymmetricQuantizeTensor(ModelT* model, TensorT* tensor) {
   return kTfLiteOk;
 }
 
+TfLiteStatus SymmetricQuantizeTensorInt16(ModelT* model, TensorT* tensor) {
+  if (model == nullptr || tensor == nullptr) {
+    return kTfLiteError;
+  }
+
+  BufferT* buffer = model->buffers[tensor->buffer].get();
+  if (buffer == nullptr) {
+    return kTfLiteError;
+  }
+  const float* float_data = reinterpret_cast<float*>(buffer->data.data());
+  uint64_t num_elements;
+  TF_LITE_ENSURE_STATUS(NumElements(*tensor, &num_elements));
+
+  float max_abs = 0;
+  for (uint64_t i = 0; i < num_elements; i++) {
+    max_abs = std::max(max_abs, std::abs(float_data[i]));
+  }
+  const int32_t kScale = std::numeric_limits<int16_t>::max();
+  const float scaling_factor = max_abs / kScale;
+  const float scaling_factor_inv = (max_abs == 0) ? 0 : kScale / max_abs;
+
+  std::vector<int16_t> quantized_buffer(num_elements);
+  for (uint64_t i = 0; i < num_elements; i++) {
+    const int32_t quantized_value =
+        static_cast<int32_t>(TfLiteRound(float_data[i] * scaling_factor_inv));
+    quantized_buffer[i] = std::min(kScale, std::max(-kScale, quantized_value));
+  }
+
+  uint8_t* uint8_buffer = reinterpret_cast<uint8_t*>(quantized_buffer.data());
+  std::vector<float> scales(1, scaling_factor);
+  std::vector<int64_t> zero_points(1, 0);
+  return AddQuantizationParams(scales, zero_points, 0, uint8_buffer,
+                               num_elements * sizeof(int16_t),
+                               TensorType_INT16, model, tensor);
+}
+
 TfLiteStatus QuantizeTensorFloat16(ModelT* model, TensorT* tensor) {
   if (model == nullptr || tensor == nullptr) {
     return kTfLiteError;
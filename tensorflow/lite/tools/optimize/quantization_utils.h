@@ -64,6 +64,10 @@ void SymmetricPerChannelQuantizeValues(const float* const input,
 // of the tensor.
 TfLiteStatus SymmetricQuantizeTensor(ModelT* model, TensorT* tensor);
 
+// Quantizes tensor to int16 using symmetric quantization with the min and max
+// elements of the tensor.
+TfLiteStatus SymmetricQuantizeTensorInt16(ModelT* model, TensorT* tensor);
+
 // Quantizes tensor to float16.
 TfLiteStatus QuantizeTensorFloat16(ModelT* model, TensorT* tensor);
 
@@ -361,6 +361,38 @@ TEST(QuantizationUtilsTest, SymmetricPerLayerBiasQuantize) {
   EXPECT_EQ(model->subgraphs[0]->tensors[0]->type, TensorType_INT32);
 }
 
+TEST(QuantizationUtilsTest, SymmetricQuantizeTensorInt16) {
+  // Create data.
+  auto model = absl::make_unique<ModelT>();
+  auto subgraph = absl::make_unique<tflite::SubGraphT>();
+  auto tensor = absl::make_unique<TensorT>();
+  auto buffer = absl::make_unique<tflite::BufferT>();
+  std::vector<float> data = {-2.0, 1.0, 0.5, 0.0};
+  auto reinterpreted_data = reinterpret_cast<const unsigned char*>(data.data());
+  buffer->data.assign(reinterpreted_data,
+                      reinterpreted_data + data.size() * 4);
+  tensor->buffer = 0;
+  tensor->shape = {4};
+
+  // Wire the model.
+  model->subgraphs.push_back(std::move(subgraph));
+  model->subgraphs[0]->tensors.push_back(std::move(tensor));
+  model->buffers.push_back(std::move(buffer));
+
+  // Call and verify.
+  EXPECT_EQ(SymmetricQuantizeTensorInt16(model.get(),
+                                         model->subgraphs[0]->tensors[0].get()),
+            kTfLiteOk);
+
+  EXPECT_FLOAT_EQ(model->subgraphs[0]->tensors[0]->quantization->scale[0],
+                  2.0 / 32767);
+  EXPECT_THAT(model->subgraphs[0]->tensors[0]->quantization->zero_point[0], 0);
+  // -32767, 16384, 8192 and 0 in little endian.
+  EXPECT_THAT(model->buffers[model->subgraphs[0]->tensors[0]->buffer]->data,
+              ElementsAreArray({1, 128, 0, 64, 0, 32, 0, 0}));
+  EXPECT_EQ(model->subgraphs[0]->tensors[0]->type, TensorType_INT16);
+}
+
 TEST(QuantizationUtilsTest, SymmetricPerChannelBiasQuantize) {
   // Create data.
   auto model = absl::make_unique<ModelT>();
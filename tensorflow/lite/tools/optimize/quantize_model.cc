@@ -15,6 +15,7 @@ limitations under the License.
 #include "tensorflow/lite/tools/optimize/quantize_model.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -379,6 +380,10 @@ TfLiteStatus QuantizeOpInput(ModelT* model, int32_t subgraph_idx,
     return kTfLiteError;
   }
   const int32_t tensor_idx = op->inputs[input_idx];
+  if (tensor_idx == -1) {
+    // Skip optional inputs that are absent.
+    return kTfLiteOk;
+  }
   TensorT* tensor = subgraph->tensors[tensor_idx].get();
   const bool is_input_quantized = utils::IsQuantized(subgraph, tensor_idx);
   if (property.quantizable && !is_input_quantized) {
@@ -624,6 +629,113 @@ TfLiteStatus QuantizeBiases(ModelT* model, ErrorReporter* error_reporter) {
   return kTfLiteOk;
 }
 
+// Quantizes the tensors of the LSTM ops that the generic passes leave as float,
+// as expected by the fully integer kernel: int16 peephole weights and layer
+// norm coefficients, int32 biases and int8 and int16 activation and cell
+// states.
+TfLiteStatus QuantizeLstmTensors(ModelT* model,
+                                 ErrorReporter* error_reporter) {
+  // Fixed-point formats of the integer kernel, see lstm_eval.h.
+  const float kLayerNormScale = 1.0f / 1024;
+  const float kHiddenScale = 1.0f / 128;
+  for (size_t subgraph_idx = 0; subgraph_idx < model->subgraphs.size();
+       subgraph_idx++) {
+    SubGraphT* subgraph = model->subgraphs.at(subgraph_idx).get();
+    for (size_t op_idx = 0; op_idx < subgraph->operators.size(); op_idx++) {
+      OperatorT* op = subgraph->operators[op_idx].get();
+      if (model->operator_codes[op->opcode_index]->builtin_code !=
+          BuiltinOperator_LSTM) {
+        continue;
+      }
+      if (op->inputs.size() != 20 && op->inputs.size() != 24) {
+        error_reporter->Report(
+            "Expected 20 or 24 inputs for LSTM at index %d in subgraph %d, "
+            "got %d",
+            op_idx, subgraph_idx, op->inputs.size());
+        return kTfLiteError;
+      }
+      // Returns the tensor of an input, or null if the input is absent.
+      auto get_input = [&](int input_idx) -> TensorT* {
+        if (input_idx >= op->inputs.size() || op->inputs[input_idx] == -1) {
+          return nullptr;
+        }
+        return subgraph->tensors[op->inputs[input_idx]].get();
+      };
+      auto needs_quantization = [&](int input_idx) {
+        return get_input(input_idx) != nullptr &&
+               !utils::IsQuantized(subgraph, op->inputs[input_idx]) &&
+               utils::HasBuffer(model, subgraph, op->inputs[input_idx]);
+      };
+
+      // Peephole weights and layer norm coefficients.
+      for (const int input_idx : {9, 10, 11, 20, 21, 22, 23}) {
+        if (needs_quantization(input_idx)) {
+          TF_LITE_ENSURE_STATUS(
+              utils::SymmetricQuantizeTensorInt16(model, get_input(input_idx)));
+        }
+      }
+
+      // Gate biases, which a layer norm LSTM adds to the normalized gates.
+      const TensorT* input = get_input(0);
+      const bool is_layer_norm = get_input(21) != nullptr;
+      for (int gate = 0; gate < 4; ++gate) {
+        const int bias_idx = 12 + gate;
+        if (!needs_quantization(bias_idx)) {
+          continue;
+        }
+        const TensorT* scale_tensor =
+            is_layer_norm ? get_input(20 + gate) : get_input(1 + gate);
+        TF_LITE_ENSURE(error_reporter, scale_tensor != nullptr &&
+                                           scale_tensor->quantization);
+        TF_LITE_ENSURE_STATUS(utils::SymmetricPerLayerBiasQuantize(
+            model, get_input(bias_idx),
+            is_layer_norm ? kLayerNormScale : input->quantization->scale[0],
+            scale_tensor->quantization->scale[0]));
+      }
+      if (needs_quantization(17)) {
+        const TensorT* projection_weights = get_input(16);
+        TF_LITE_ENSURE(error_reporter, projection_weights != nullptr &&
+                                           projection_weights->quantization);
+        TF_LITE_ENSURE_STATUS(utils::SymmetricPerLayerBiasQuantize(
+            model, get_input(17), kHiddenScale,
+            projection_weights->quantization->scale[0]));
+      }
+
+      // The output is fed back as the activation state, so both share their
+      // quantization.
+      const TensorT* output = subgraph->tensors[op->outputs[0]].get();
+      TensorT* activation_state = get_input(18);
+      TensorT* cell_state = get_input(19);
+      TF_LITE_ENSURE(error_reporter, output->quantization &&
+                                         activation_state != nullptr &&
+                                         cell_state != nullptr);
+      activation_state->quantization =
+          absl::make_unique<QuantizationParametersT>(*output->quantization);
+      activation_state->type = TensorType_INT8;
+
+      // The cell state needs a power of two scale. Without a calibrated range
+      // it is assumed to be within [-16, 16].
+      int cell_scale_log2 = -11;
+      if (utils::HasMinMax(cell_state)) {
+        const float range =
+            std::max(std::abs(cell_state->quantization->min[0]),
+                     std::abs(cell_state->quantization->max[0]));
+        if (range > 0) {
+          cell_scale_log2 = std::min(
+              0, std::max(-15, static_cast<int>(std::ceil(
+                                   std::log2(range / 32767)))));
+        }
+      }
+      cell_state->quantization = absl::make_unique<QuantizationParametersT>();
+      cell_state->quantization->scale.push_back(
+          std::ldexp(1.0f, cell_scale_log2));
+      cell_state->quantization->zero_point.push_back(0);
+      cell_state->type = TensorType_INT16;
+    }
+  }
+  return kTfLiteOk;
+}
+
 }  // namespace
 
 // Assumes that the operators in the model have been topologically sorted.
@@ -635,6 +747,7 @@ TfLiteStatus QuantizeModel(flatbuffers::FlatBufferBuilder* builder,
       QuantizeWeightsInputOutput(model, allow_float, error_reporter));
   TF_LITE_ENSURE_STATUS(ApplyConstraints(model, error_reporter));
   TF_LITE_ENSURE_STATUS(QuantizeBiases(model, error_reporter));
+  TF_LITE_ENSURE_STATUS(QuantizeLstmTensors(model, error_reporter));
   utils::SetOperatorCodeVersion(model);
   TF_LITE_ENSURE_STATUS(
       SetInputAndOutputTypes(model, input_type, output_type, error_reporter));
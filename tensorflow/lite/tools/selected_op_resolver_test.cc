@@ -0,0 +1,67 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include <memory>
+
+#include <gtest/gtest.h>
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/model.h"
+#include "tensorflow/lite/tools/add_op_resolver.h"
+
+namespace tflite {
+namespace {
+
+TEST(SelectedOpResolverTest, FindsOnlyTheOpVersionsOfTheModel) {
+  AddOpResolver resolver;
+  const TfLiteRegistration* add = resolver.FindOp(BuiltinOperator_ADD, 1);
+  ASSERT_NE(add, nullptr);
+  EXPECT_EQ(add->builtin_code, BuiltinOperator_ADD);
+  EXPECT_EQ(add->version, 1);
+  EXPECT_EQ(add->custom_name, nullptr);
+  // The same registration is found every time.
+  EXPECT_EQ(resolver.FindOp(BuiltinOperator_ADD, 1), add);
+
+  EXPECT_EQ(resolver.FindOp(BuiltinOperator_ADD, 2), nullptr);
+  EXPECT_EQ(resolver.FindOp(BuiltinOperator_CONV_2D, 1), nullptr);
+  EXPECT_EQ(resolver.FindOp("ADD", 1), nullptr);
+}
+
+TEST(SelectedOpResolverTest, RunsTheModel) {
+  auto model =
+      FlatBufferModel::BuildFromFile("tensorflow/lite/testdata/add.bin");
+  ASSERT_TRUE(model);
+  std::unique_ptr<Interpreter> interpreter;
+  ASSERT_EQ(InterpreterBuilder(*model, AddOpResolver())(&interpreter),
+            kTfLiteOk);
+  ASSERT_EQ(interpreter->AllocateTensors(), kTfLiteOk);
+  float* input = interpreter->typed_input_tensor<float>(0);
+  const int num_elements = 1 * 8 * 8 * 3;
+  for (int i = 0; i < num_elements; ++i) {
+    input[i] = i;
+  }
+  ASSERT_EQ(interpreter->Invoke(), kTfLiteOk);
+  // The model computes (input + input) + input.
+  const float* output = interpreter->typed_output_tensor<float>(0);
+  for (int i = 0; i < num_elements; ++i) {
+    EXPECT_EQ(output[i], 3 * i);
+  }
+}
+
+}  // namespace
+}  // namespace tflite
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -14,10 +14,19 @@ limitations under the License.
 ==============================================================================*/
 
 #include "tensorflow/lite/tools/verifier.h"
+#include <algorithm>
+#include <atomic>
 #include <climits>
+#include <functional>
+#include <memory>
+#include <mutex>   // NOLINT(build/c++11)
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
 #include "absl/container/flat_hash_set.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/string_util.h"
+#include "tensorflow/lite/util.h"
 #include "tensorflow/lite/version.h"
 
 namespace tflite {
@@ -34,6 +43,97 @@ void ReportError(ErrorReporter* error_reporter, const char* format, ...) {
   }
 }
 
+// Serializes the reports of the threads verifying a model.
+class LockedErrorReporter : public ErrorReporter {
+ public:
+  explicit LockedErrorReporter(ErrorReporter* error_reporter)
+      : error_reporter_(error_reporter) {}
+  int Report(const char* format, va_list args) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return error_reporter_->Report(format, args);
+  }
+
+ private:
+  ErrorReporter* error_reporter_;
+  std::mutex mutex_;
+};
+
+// Layout of the files written to mark a model as verified.
+constexpr uint32_t kVerifiedMarkerMagic = 0x564c4654;  // "TFLV"
+constexpr uint32_t kVerifiedMarkerVersion = 1;
+
+struct VerifiedMarker {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t model_hash;
+  uint64_t model_bytes;
+  uint64_t max_string_buffer_bytes_checked;
+};
+
+// Returns true if the marker file of `options` says that the model of `len`
+// bytes and `model_hash` was verified at least as thoroughly as `options` ask.
+bool IsMarkedAsVerified(size_t len, uint64_t model_hash,
+                        const VerifierOptions& options) {
+  FILE* file = fopen(options.verified_marker_filename, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  VerifiedMarker marker;
+  const bool read = fread(&marker, sizeof(marker), 1, file) == 1;
+  fclose(file);
+  return read && marker.magic == kVerifiedMarkerMagic &&
+         marker.version == kVerifiedMarkerVersion &&
+         marker.model_hash == model_hash && marker.model_bytes == len &&
+         marker.max_string_buffer_bytes_checked >=
+             options.max_string_buffer_bytes_to_check;
+}
+
+// Writes the marker file of `options`, replacing it atomically so that a
+// partial file is never read. A marker that can't be written only means that
+// the model is walked again next time.
+void MarkAsVerified(size_t len, uint64_t model_hash,
+                    const VerifierOptions& options) {
+  const std::string temp_filename =
+      std::string(options.verified_marker_filename) + ".tmp";
+  FILE* file = fopen(temp_filename.c_str(), "wb");
+  if (file == nullptr) {
+    return;
+  }
+  const VerifiedMarker marker = {kVerifiedMarkerMagic, kVerifiedMarkerVersion,
+                                 model_hash, len,
+                                 options.max_string_buffer_bytes_to_check};
+  const bool written = fwrite(&marker, sizeof(marker), 1, file) == 1;
+  if (fclose(file) != 0 || !written ||
+      rename(temp_filename.c_str(), options.verified_marker_filename) != 0) {
+    remove(temp_filename.c_str());
+  }
+}
+
+// Runs `checks` on up to `num_threads` threads, until one of them fails.
+// Returns true if all of them passed.
+bool RunChecks(const std::vector<std::function<bool()>>& checks,
+               int num_threads) {
+  std::atomic<size_t> next_check(0);
+  std::atomic<bool> failed(false);
+  auto run = [&]() {
+    for (size_t i = next_check++; i < checks.size() && !failed;
+         i = next_check++) {
+      if (!checks[i]()) failed = true;
+    }
+  };
+  std::vector<std::thread> workers;
+  const size_t num_workers =
+      std::min(static_cast<size_t>(std::max(num_threads, 1)), checks.size());
+  for (size_t i = 1; i < num_workers; ++i) {
+    workers.emplace_back(run);
+  }
+  run();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  return !failed;
+}
+
 // Returns the int32_t value pointed by ptr.
 const uint32_t* GetIntPtr(const char* ptr) {
   return reinterpret_cast<const uint32_t*>(ptr);
@@ -53,8 +153,10 @@ const Model* VerifyFlatbufferAndGetModel(const void* buf, size_t len) {
 const uint32_t kMaxNumString = UINT_MAX / sizeof(int32_t) - 2;
 
 // Verifies string tensor has legit buffer contents that follow the schema
-// defined in lite/string_util.h
+// defined in lite/string_util.h. Only the header of buffers larger than
+// `max_bytes_to_check` is checked.
 bool VerifyStringTensorBuffer(const Tensor& tensor, const Buffer& buffer,
+                              size_t max_bytes_to_check,
                               ErrorReporter* error_reporter) {
   uint32_t buffer_size = buffer.data()->size();
   if (buffer_size < sizeof(uint32_t)) {
@@ -92,13 +194,18 @@ bool VerifyStringTensorBuffer(const Tensor& tensor, const Buffer& buffer,
     return false;
   }
   offset += sizeof(int32_t);
-  for (int i = 1; i <= num_strings; i++, offset += sizeof(int32_t)) {
-    int string_offset = *GetIntPtr(buffer_ptr + offset);
-    if (string_offset < prev_ptr || string_offset > buffer_size) {
-      ReportError(error_reporter,
-                  "String tensor %s buffer is invalid: index %d",
-                  tensor.name()->c_str(), i);
-      return false;
+  if (buffer_size > max_bytes_to_check) {
+    // Skip to the last offset, which must still end the buffer.
+    offset += num_strings * sizeof(int32_t);
+  } else {
+    for (int i = 1; i <= num_strings; i++, offset += sizeof(int32_t)) {
+      int string_offset = *GetIntPtr(buffer_ptr + offset);
+      if (string_offset < prev_ptr || string_offset > buffer_size) {
+        ReportError(error_reporter,
+                    "String tensor %s buffer is invalid: index %d",
+                    tensor.name()->c_str(), i);
+        return false;
+      }
     }
   }
   if (*GetIntPtr(buffer_ptr + offset - sizeof(int32_t)) != buffer_size) {
@@ -282,74 +389,104 @@ bool VerifySubGraphConsistency(const Model& model, const SubGraph& subgraph,
   return true;
 }
 
-bool VerifySubGraphs(const Model& model, ErrorReporter* error_reporter) {
-  if (!model.subgraphs()) {
-    ReportError(error_reporter, "Missing 'subgraphs' section.");
+// Verifies the operators of a sub-graph and how they connect its tensors.
+bool VerifySubGraph(const Model& model, const SubGraph& subgraph,
+                    ErrorReporter* error_reporter) {
+  if (!subgraph.operators()) {
+    ReportError(error_reporter, "Missing 'operators' section in subgraph.");
     return false;
   }
-  for (const auto& subgraph : *model.subgraphs()) {
-    if (!subgraph->operators()) {
-      ReportError(error_reporter, "Missing 'operators' section in subgraph.");
-      return false;
-    }
 
-    if (!VerifyOperators(*subgraph->operators(), error_reporter)) {
-      return false;
-    }
-
-    if (!VerifySubGraphConsistency(model, *subgraph, error_reporter)) {
-      return false;
-    }
+  if (!VerifyOperators(*subgraph.operators(), error_reporter)) {
+    return false;
   }
-  return true;
+
+  return VerifySubGraphConsistency(model, subgraph, error_reporter);
 }
 
-// Verifies tensors have valid properties and legit buffer if set.
-bool VerifyTensors(const Model& model, ErrorReporter* error_reporter) {
-  if (!model.subgraphs()) {
+// Verifies a tensor has valid properties and legit buffer if set.
+bool VerifyTensor(const Model& model, const Tensor& tensor,
+                  const VerifierOptions& options,
+                  ErrorReporter* error_reporter) {
+  if (!tensor.buffer()) {
     return true;
   }
-  if (!model.buffers()) {
-    ReportError(error_reporter, "Missing 'buffers' section.");
+  if (tensor.buffer() >= model.buffers()->size()) {
+    ReportError(error_reporter, "Tensor %s invalid buffer index: %d",
+                tensor.name(), tensor.buffer());
+    return false;
+  }
+  auto* buffer = model.buffers()->Get(tensor.buffer());
+  if (!buffer) {
+    ReportError(error_reporter, "Tensor %s buffer %d not set", tensor.name(),
+                tensor.buffer());
     return false;
   }
 
-  for (const auto& subgraph : *model.subgraphs()) {
-    if (!subgraph->tensors()) {
-      continue;
-    }
-    for (const auto& tensor : *subgraph->tensors()) {
-      if (!tensor->buffer()) {
-        continue;
-      }
-      if (tensor->buffer() >= model.buffers()->size()) {
-        ReportError(error_reporter, "Tensor %s invalid buffer index: %d",
-                    tensor->name(), tensor->buffer());
-        return false;
-      }
-      auto* buffer = model.buffers()->Get(tensor->buffer());
-      if (!buffer) {
-        ReportError(error_reporter, "Tensor %s buffer %d not set",
-                    tensor->name(), tensor->buffer());
-        return false;
-      }
+  // Many transient tensors don't have data in the flatbuffer. Their
+  // buffers will be allocated by the interpreter at run-time. Palette
+  // compressed buffers hold indices, which are checked when decompressed.
+  if (!buffer->data() || buffer->palette()) {
+    return true;
+  }
+  if (tensor.type() == TensorType_STRING) {
+    return VerifyStringTensorBuffer(tensor, *buffer,
+                                    options.max_string_buffer_bytes_to_check,
+                                    error_reporter);
+  }
+  return VerifyNumericTensorBuffer(tensor, *buffer, error_reporter);
+}
 
-      // Many transient tensors don't have data in the flatbuffer. Their
-      // buffers will be allocated by the interpreter at run-time.
-      if (buffer->data()) {
-        if (tensor->type() == TensorType_STRING) {
-          if (!VerifyStringTensorBuffer(*tensor, *buffer, error_reporter)) {
-            return false;
-          }
-        } else {
-          if (!VerifyNumericTensorBuffer(*tensor, *buffer, error_reporter)) {
-            return false;
+// The number of tensors verified by each check, so that the tensors of a
+// large subgraph are spread over the threads.
+constexpr int kTensorsPerCheck = 256;
+
+// Verifies the sub-graphs, then the tensors, on `options.num_threads`
+// threads.
+bool VerifySubGraphsAndTensors(const Model& model,
+                               const VerifierOptions& options,
+                               ErrorReporter* error_reporter) {
+  if (!model.subgraphs()) {
+    ReportError(error_reporter, "Missing 'subgraphs' section.");
+    return false;
+  }
+  std::unique_ptr<LockedErrorReporter> locked_error_reporter;
+  if (error_reporter && options.num_threads > 1) {
+    locked_error_reporter.reset(new LockedErrorReporter(error_reporter));
+    error_reporter = locked_error_reporter.get();
+  }
+
+  std::vector<std::function<bool()>> checks;
+  for (const auto* subgraph : *model.subgraphs()) {
+    checks.push_back([&model, subgraph, error_reporter]() {
+      return VerifySubGraph(model, *subgraph, error_reporter);
+    });
+  }
+  if (!model.buffers()) {
+    checks.push_back([error_reporter]() {
+      ReportError(error_reporter, "Missing 'buffers' section.");
+      return false;
+    });
+  } else {
+    for (const auto* subgraph : *model.subgraphs()) {
+      const auto* tensors = subgraph->tensors();
+      const int num_tensors = tensors ? tensors->size() : 0;
+      for (int first = 0; first < num_tensors; first += kTensorsPerCheck) {
+        const int last = std::min(first + kTensorsPerCheck, num_tensors);
+        checks.push_back([&model, &options, tensors, first, last,
+                          error_reporter]() {
+          for (int i = first; i < last; ++i) {
+            if (!VerifyTensor(model, *tensors->Get(i), options,
+                              error_reporter)) {
+              return false;
+            }
           }
-        }
+          return true;
+        });
       }
     }
   }
-  return true;
+  return RunChecks(checks, options.num_threads);
 }
 
 bool VerifyOps(const Model& model, const OpResolver& resolver,
@@ -387,7 +524,22 @@ bool VerifyOps(const Model& model, const OpResolver& resolver,
 
 bool Verify(const void* buf, size_t len, const OpResolver& resolver,
             ErrorReporter* error_reporter) {
-  const Model* model = VerifyFlatbufferAndGetModel(buf, len);
+  return Verify(buf, len, resolver, error_reporter, VerifierOptions());
+}
+
+bool Verify(const void* buf, size_t len, const OpResolver& resolver,
+            ErrorReporter* error_reporter, const VerifierOptions& options) {
+  // Without a hash from the caller, the model is hashed: it is read once, but
+  // still much faster than walked.
+  const uint64_t model_hash =
+      !options.verified_marker_filename || options.model_hash != 0
+          ? options.model_hash
+          : HashBytes(buf, len);
+  const bool marked_as_verified = options.verified_marker_filename &&
+                                  IsMarkedAsVerified(len, model_hash, options);
+  const Model* model = marked_as_verified
+                           ? ::tflite::GetModel(buf)
+                           : VerifyFlatbufferAndGetModel(buf, len);
   if (model == nullptr) {
     ReportError(error_reporter, "Invalid flatbuffer format");
     return false;
@@ -396,15 +548,16 @@ bool Verify(const void* buf, size_t len, const OpResolver& resolver,
     ReportError(error_reporter, "Invalid model version %d", model->version());
     return false;
   }
-  if (!VerifySubGraphs(*model, error_reporter)) {
-    return false;
-  }
-  if (!VerifyTensors(*model, error_reporter)) {
+  if (!marked_as_verified &&
+      !VerifySubGraphsAndTensors(*model, options, error_reporter)) {
     return false;
   }
   if (!VerifyOps(*model, resolver, error_reporter)) {
     return false;
   }
+  if (options.verified_marker_filename && !marked_as_verified) {
+    MarkAsVerified(len, model_hash, options);
+  }
   return true;
 }
 }  // namespace tflite
@@ -18,6 +18,9 @@ limitations under the License.
 
 #include <stdio.h>
 
+#include <cstdint>
+#include <limits>
+
 #include "tensorflow/lite/error_reporter.h"
 #include "tensorflow/lite/model.h"
 
@@ -47,6 +50,31 @@ class AlwaysTrueResolver : public OpResolver {
 bool Verify(const void* buf, size_t len, const OpResolver& resolver,
             ErrorReporter* error_reporter);
 
+// Options to trade the thoroughness of `Verify` for speed on large models.
+struct VerifierOptions {
+  // The string tensor buffers larger than this only have their header
+  // checked, not the offset of each of their strings. The structure of the
+  // flatbuffer, and the size of all buffers, are always checked.
+  size_t max_string_buffer_bytes_to_check =
+      std::numeric_limits<size_t>::max();
+
+  // The number of threads verifying the subgraphs and tensors concurrently.
+  int num_threads = 1;
+
+  // If set, the model is marked as verified in this file once it passes, and
+  // is not walked again while the file marks it as verified with options at
+  // least as thorough. Only the version and the ops of the model are then
+  // checked. `model_hash` identifies the model in the file, and must change
+  // with any of its bytes, e.g. a digest stored with the model. If it is 0,
+  // `HashBytes(buf, len)` is used.
+  const char* verified_marker_filename = nullptr;
+  uint64_t model_hash = 0;
+};
+
+// Same as above, with options.
+bool Verify(const void* buf, size_t len, const OpResolver& resolver,
+            ErrorReporter* error_reporter, const VerifierOptions& options);
+
 }  // namespace tflite
 
 #endif  // TENSORFLOW_LITE_TOOLS_VERIFIER_H_
@@ -12,6 +12,8 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
+#include <cstdio>
+#include <cstdlib>
 #include <string>
 #include <vector>
 
@@ -90,6 +92,22 @@ class TfLiteFlatbufferModelBuilder {
                                           is_variable));
   }
 
+  // Adds a float tensor whose buffer holds 2 bit indices into `palette`.
+  void AddPalettizedTensor(const std::vector<int>& shape,
+                           const std::vector<uint8_t>& indices,
+                           const std::vector<float>& palette,
+                           const char* name) {
+    const std::vector<uint8_t> values(
+        reinterpret_cast<const uint8_t*>(palette.data()),
+        reinterpret_cast<const uint8_t*>(palette.data() + palette.size()));
+    buffers_.push_back(CreateBufferDirect(
+        builder_, &indices,
+        CreatePaletteCompressionDirect(builder_, &values, /*index_bits=*/2)));
+    tensors_.push_back(CreateTensorDirect(builder_, &shape,
+                                          TensorType_FLOAT32,
+                                          buffers_.size() - 1, name));
+  }
+
   void AddOperator(const std::vector<int32_t>& inputs,
                    const std::vector<int32_t>& outputs,
                    tflite::BuiltinOperator builtin_op, const char* custom_op) {
@@ -126,6 +144,11 @@ class TfLiteFlatbufferModelBuilder {
                           resolver_, &mock_reporter_);
   }
 
+  bool Verify(const VerifierOptions& options) {
+    return tflite::Verify(builder_.GetBufferPointer(), builder_.GetSize(),
+                          resolver_, &mock_reporter_, options);
+  }
+
   string GetErrorString() { return mock_reporter_.GetAsString(); }
 
  private:
@@ -381,6 +404,122 @@ TEST(VerifyModel, StringTensorIsLargerThanRequired) {
                   "String tensor input buffer last offset must be 19"));
 }
 
+TEST(VerifyModel, StringTensorContentsAreSkippedAboveLimit) {
+  TfLiteFlatbufferModelBuilder builder;
+  builder.AddTensor(
+      {2}, TensorType_STRING,
+      {2, 0, 0, 0, 16, 0, 0, 0, 20, 0, 0, 0, 18, 0, 0, 0, 'A', 'B'}, "input");
+  builder.FinishModel({}, {});
+  VerifierOptions options;
+  options.max_string_buffer_bytes_to_check = 18;
+  ASSERT_FALSE(builder.Verify(options));
+  EXPECT_THAT(builder.GetErrorString(),
+              ::testing::ContainsRegex(
+                  "String tensor input buffer is invalid: index 1"));
+  options.max_string_buffer_bytes_to_check = 17;
+  ASSERT_TRUE(builder.Verify(options));
+}
+
+TEST(VerifyModel, StringTensorLastOffsetIsCheckedAboveLimit) {
+  TfLiteFlatbufferModelBuilder builder;
+  builder.AddTensor(
+      {2}, TensorType_STRING,
+      {2, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 18, 0, 0, 0, 'A', 'B', 'C'},
+      "input");
+  builder.FinishModel({}, {});
+  VerifierOptions options;
+  options.max_string_buffer_bytes_to_check = 0;
+  ASSERT_FALSE(builder.Verify(options));
+  EXPECT_THAT(builder.GetErrorString(),
+              ::testing::ContainsRegex(
+                  "String tensor input buffer last offset must be 19"));
+}
+
+TEST(VerifyModel, VerifyOnSeveralThreads) {
+  VerifierOptions options;
+  options.num_threads = 4;
+  TfLiteFlatbufferModelBuilder builder;
+  for (int i = 0; i < 1000; ++i) {
+    builder.AddTensor({2, 2}, TensorType_UINT8, {1, 2, 3, 4}, "input");
+  }
+  builder.FinishModel({}, {});
+  ASSERT_TRUE(builder.Verify(options));
+  EXPECT_EQ("", builder.GetErrorString());
+
+  TfLiteFlatbufferModelBuilder invalid_builder;
+  for (int i = 0; i < 1000; ++i) {
+    invalid_builder.AddTensor({2, 2}, TensorType_UINT8, {1, 2, 3, 4},
+                              "input");
+  }
+  invalid_builder.AddTensor({2, 3}, TensorType_UINT8, {1, 2, 3, 4}, "last");
+  invalid_builder.FinishModel({}, {});
+  ASSERT_FALSE(invalid_builder.Verify(options));
+  EXPECT_THAT(invalid_builder.GetErrorString(),
+              ::testing::ContainsRegex("Tensor last requires 6 bytes"));
+}
+
+std::string VerifiedMarkerFilename() {
+  const char* tmpdir = getenv("TEST_TMPDIR");
+  return std::string(tmpdir ? tmpdir : "/tmp") + "/verifier_test_marker";
+}
+
+TEST(VerifyModel, VerifiedMarkerSkipsTheWalk) {
+  const std::string filename = VerifiedMarkerFilename();
+  remove(filename.c_str());
+  VerifierOptions options;
+  options.verified_marker_filename = filename.c_str();
+  options.model_hash = 1234;
+  options.max_string_buffer_bytes_to_check = 1024;
+
+  TfLiteFlatbufferModelBuilder builder;
+  builder.AddTensor(
+      {2}, TensorType_STRING,
+      {2, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 18, 0, 0, 0, 'A', 'B'}, "input");
+  builder.FinishModel({}, {});
+  ASSERT_TRUE(builder.Verify(options));
+
+  // A model of the same size with an invalid string offset. The marker is
+  // trusted for the hash it was written for.
+  TfLiteFlatbufferModelBuilder invalid_builder;
+  invalid_builder.AddTensor(
+      {2}, TensorType_STRING,
+      {2, 0, 0, 0, 16, 0, 0, 0, 20, 0, 0, 0, 18, 0, 0, 0, 'A', 'B'}, "input");
+  invalid_builder.FinishModel({}, {});
+  EXPECT_TRUE(invalid_builder.Verify(options));
+
+  // The model is walked for other hashes, or more thorough options.
+  options.model_hash = 5678;
+  EXPECT_FALSE(invalid_builder.Verify(options));
+  options.model_hash = 1234;
+  options.max_string_buffer_bytes_to_check = 2048;
+  EXPECT_FALSE(invalid_builder.Verify(options));
+  remove(filename.c_str());
+}
+
+TEST(VerifyModel, VerifiedMarkerHashesTheModelWithoutHash) {
+  const std::string filename = VerifiedMarkerFilename();
+  remove(filename.c_str());
+  VerifierOptions options;
+  options.verified_marker_filename = filename.c_str();
+
+  TfLiteFlatbufferModelBuilder builder;
+  builder.AddTensor(
+      {2}, TensorType_STRING,
+      {2, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 18, 0, 0, 0, 'A', 'B'}, "input");
+  builder.FinishModel({}, {});
+  ASSERT_TRUE(builder.Verify(options));
+  EXPECT_TRUE(builder.Verify(options));
+
+  // A model of the same size with other bytes isn't trusted.
+  TfLiteFlatbufferModelBuilder invalid_builder;
+  invalid_builder.AddTensor(
+      {2}, TensorType_STRING,
+      {2, 0, 0, 0, 16, 0, 0, 0, 20, 0, 0, 0, 18, 0, 0, 0, 'A', 'B'}, "input");
+  invalid_builder.FinishModel({}, {});
+  EXPECT_FALSE(invalid_builder.Verify(options));
+  remove(filename.c_str());
+}
+
 TEST(VerifyModel, AllOpsAreSupported) {
   TfLiteFlatbufferModelBuilder builder({BuiltinOperator_ADD}, {"CustomOp"});
   builder.AddTensor({2, 2}, TensorType_UINT8, {1, 2, 3, 4}, "input1");
@@ -516,6 +655,19 @@ TEST(VerifyModel, OpWithOptionalTensor) {
   EXPECT_EQ("", builder.GetErrorString());
 }
 
+TEST(VerifyModel, PalettizedTensor) {
+  TfLiteFlatbufferModelBuilder builder({}, {"test"});
+  builder.AddOperator({0, 1}, {2}, BuiltinOperator_CUSTOM, "test");
+  builder.AddTensor({2, 3}, TensorType_FLOAT32, {}, "input");
+  // 8 floats in 2 bytes of indices.
+  builder.AddPalettizedTensor({2, 4}, {0xE4, 0x1B}, {0.5f, -1.0f, 2.0f, 0.0f},
+                              "weights");
+  builder.AddTensor({2, 3}, TensorType_FLOAT32, {}, "output");
+  builder.FinishModel({0}, {2});
+  ASSERT_TRUE(builder.Verify());
+  EXPECT_EQ("", builder.GetErrorString());
+}
+
 // TODO(yichengfan): make up malicious files to test with.
 
 }  // namespace tflite
@@ -57,6 +57,25 @@ size_t CombineHashes(std::initializer_list<size_t> hashes) {
   return result;
 }
 
+uint64_t HashBytes(const void* data, size_t size) {
+  // Multiply-and-shift mixing of 8 bytes at a time, as in CityHash's
+  // Hash128to64.
+  const uint64_t kMul = 0x9ddfea08eb382d69ULL;
+  const char* bytes = static_cast<const char*>(data);
+  uint64_t hash = size * kMul;
+  for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, bytes, sizeof(word));
+    bytes += sizeof(word);
+    hash = (hash ^ word) * kMul;
+    hash ^= hash >> 47;
+  }
+  uint64_t tail = 0;
+  memcpy(&tail, bytes, size);
+  hash = (hash ^ tail) * kMul;
+  return hash ^ (hash >> 47);
+}
+
 TfLiteStatus GetSizeOfType(TfLiteContext* context, const TfLiteType type,
                            size_t* bytes) {
   // TODO(levp): remove the default case so that new types produce compilation
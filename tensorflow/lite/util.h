@@ -21,6 +21,7 @@ limitations under the License.
 #ifndef TENSORFLOW_LITE_UTIL_H_
 #define TENSORFLOW_LITE_UTIL_H_
 
+#include <cstdint>
 #include <vector>
 
 #include "tensorflow/lite/c/c_api_internal.h"
@@ -53,6 +54,11 @@ bool EqualArrayAndTfLiteIntArray(const TfLiteIntArray* a, const int b_size,
 
 size_t CombineHashes(std::initializer_list<size_t> hashes);
 
+// Returns a 64-bit hash of the `size` bytes at `data`. It is fast rather than
+// cryptographic, and meant to tell whether data derived from a buffer, e.g.
+// from a model file, is stale.
+uint64_t HashBytes(const void* data, size_t size);
+
 struct TfLiteIntArrayDeleter {
   void operator()(TfLiteIntArray* a) {
     if (a) TfLiteIntArrayFree(a);
@@ -13,6 +13,7 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <string>
 #include <vector>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -51,6 +52,20 @@ TEST(UtilTest, IsFlexOp) {
   EXPECT_FALSE(IsFlexOp(""));
 }
 
+TEST(UtilTest, HashBytes) {
+  const char data[] = "0123456789abcdefghij";
+  EXPECT_EQ(HashBytes(data, 20), HashBytes(data, 20));
+  // Every byte, in the 8-byte words and in the tail, changes the hash.
+  std::string modified(data, 20);
+  for (int i = 0; i < 20; ++i) {
+    modified[i] ^= 1;
+    EXPECT_NE(HashBytes(data, 20), HashBytes(modified.data(), 20));
+    modified[i] ^= 1;
+  }
+  EXPECT_NE(HashBytes(data, 19), HashBytes(data, 20));
+  EXPECT_NE(HashBytes(data, 0), HashBytes(data, 1));
+}
+
 }  // namespace
 }  // namespace tflite
 
@@ -0,0 +1,338 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/weight_cache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/weight_registry.h"
+
+namespace tflite {
+namespace {
+
+// Layout of the files written by WeightCache::Save: a header, the
+// WeightCacheFileEntry of each entry, their keys, then their data. Offsets
+// are from the start of the file. Those of the data are aligned so that the
+// mapped data can be used as is.
+constexpr uint32_t kWeightCacheFileMagic = 0x574c4654;  // "TFLW"
+constexpr uint32_t kWeightCacheFileVersion = 2;
+constexpr size_t kWeightCacheFileAlignment = 64;
+
+struct WeightCacheFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t model_hash;
+  uint64_t num_entries;
+};
+
+struct WeightCacheFileEntry {
+  uint64_t key_offset;
+  uint64_t key_bytes;
+  uint64_t offset;
+  uint64_t bytes;
+};
+
+size_t AlignTo(size_t alignment, size_t offset) {
+  return offset % alignment == 0 ? offset
+                                 : offset + (alignment - offset % alignment);
+}
+
+// Writes `bytes` bytes at `data` to `file`. Returns false on failure.
+bool WriteToFile(FILE* file, const void* data, size_t bytes) {
+  return fwrite(data, 1, bytes, file) == bytes;
+}
+
+// Returns true if the `bytes` bytes at `offset` are within a file of
+// `file_bytes` bytes.
+bool IsInFile(uint64_t offset, uint64_t bytes, size_t file_bytes) {
+  return offset <= file_bytes && bytes <= file_bytes - offset;
+}
+
+template <typename T>
+void AppendToKey(const T& value, std::string* key) {
+  key->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+void AppendArrayToKey(const T* array, std::string* key) {
+  const int size = array ? array->size : 0;
+  AppendToKey(size, key);
+  if (size > 0) {
+    key->append(reinterpret_cast<const char*>(array->data),
+                size * sizeof(array->data[0]));
+  }
+}
+
+}  // namespace
+
+WeightCache::WeightCache(const Allocation* model_allocation,
+                         uint64_t model_hash, ErrorReporter* error_reporter)
+    : model_allocation_(model_allocation),
+      registry_(nullptr),
+      model_hash_(model_hash),
+      error_reporter_(error_reporter ? error_reporter
+                                     : DefaultErrorReporter()) {
+  this->type = kTfLiteWeightCacheContext;
+  this->Refresh = nullptr;
+}
+
+WeightCache::WeightCache(const WeightRegistry* registry,
+                         ErrorReporter* error_reporter)
+    : model_allocation_(nullptr),
+      registry_(registry),
+      model_hash_(0),
+      error_reporter_(error_reporter ? error_reporter
+                                     : DefaultErrorReporter()) {
+  this->type = kTfLiteWeightCacheContext;
+  this->Refresh = nullptr;
+}
+
+WeightCache::~WeightCache() {}
+
+WeightCache* WeightCache::FromContext(TfLiteContext* context) {
+  return static_cast<WeightCache*>(
+      context->GetExternalContext(context, kTfLiteWeightCacheContext));
+}
+
+TfLiteStatus WeightCache::Load(const char* filename) {
+  if (registry_) {
+    error_reporter_->Report("The weight cache of a registry can't be loaded.");
+    return kTfLiteError;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!entries_.empty()) {
+    error_reporter_->Report("The weight cache must be loaded before use.");
+    return kTfLiteError;
+  }
+  std::unique_ptr<Allocation> file;
+  if (MMAPAllocation::IsSupported()) {
+    file.reset(new MMAPAllocation(filename, error_reporter_));
+  } else {
+    file.reset(new FileCopyAllocation(filename, error_reporter_));
+  }
+  if (!file->valid()) {
+    return kTfLiteError;
+  }
+
+  const char* base = static_cast<const char*>(file->base());
+  WeightCacheFileHeader header;
+  if (file->bytes() < sizeof(header)) {
+    error_reporter_->Report("'%s' is not a weight cache file.", filename);
+    return kTfLiteError;
+  }
+  memcpy(&header, base, sizeof(header));
+  if (header.magic != kWeightCacheFileMagic ||
+      header.version != kWeightCacheFileVersion) {
+    error_reporter_->Report("'%s' is not a weight cache file.", filename);
+    return kTfLiteError;
+  }
+  if (header.model_hash != model_hash_) {
+    error_reporter_->Report("The weight cache in '%s' is for another model.",
+                            filename);
+    return kTfLiteError;
+  }
+  if ((file->bytes() - sizeof(header)) / sizeof(WeightCacheFileEntry) <
+      header.num_entries) {
+    error_reporter_->Report("The weight cache in '%s' is truncated.",
+                            filename);
+    return kTfLiteError;
+  }
+
+  // Only keep the entries once the whole file was checked.
+  std::map<std::string, Entry> entries;
+  for (uint64_t i = 0; i < header.num_entries; ++i) {
+    WeightCacheFileEntry file_entry;
+    memcpy(&file_entry, base + sizeof(header) + i * sizeof(file_entry),
+           sizeof(file_entry));
+    if (!IsInFile(file_entry.key_offset, file_entry.key_bytes,
+                  file->bytes()) ||
+        !IsInFile(file_entry.offset, file_entry.bytes, file->bytes())) {
+      error_reporter_->Report("The weight cache in '%s' is truncated.",
+                              filename);
+      return kTfLiteError;
+    }
+    Entry& entry = entries[std::string(base + file_entry.key_offset,
+                                       file_entry.key_bytes)];
+    entry.data = base + file_entry.offset;
+    entry.bytes = file_entry.bytes;
+  }
+  entries_.swap(entries);
+  file_ = std::move(file);
+  return kTfLiteOk;
+}
+
+TfLiteStatus WeightCache::Save(const char* filename) const {
+  if (registry_) {
+    // Its keys are addresses, only valid in this process.
+    error_reporter_->Report("The weight cache of a registry can't be saved.");
+    return kTfLiteError;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const std::string temp_filename = std::string(filename) + ".tmp";
+  FILE* file = fopen(temp_filename.c_str(), "wb");
+  if (file == nullptr) {
+    error_reporter_->Report("Could not open '%s' to write the weight cache.",
+                            temp_filename.c_str());
+    return kTfLiteError;
+  }
+
+  const WeightCacheFileHeader header = {
+      kWeightCacheFileMagic, kWeightCacheFileVersion, model_hash_,
+      entries_.size()};
+  bool written = WriteToFile(file, &header, sizeof(header));
+  size_t key_offset =
+      sizeof(header) + entries_.size() * sizeof(WeightCacheFileEntry);
+  size_t offset = key_offset;
+  for (const auto& key_and_entry : entries_) {
+    offset += key_and_entry.first.size();
+  }
+  for (const auto& key_and_entry : entries_) {
+    offset = AlignTo(kWeightCacheFileAlignment, offset);
+    const WeightCacheFileEntry file_entry = {
+        key_offset, key_and_entry.first.size(), offset,
+        key_and_entry.second.bytes};
+    written = written && WriteToFile(file, &file_entry, sizeof(file_entry));
+    key_offset += key_and_entry.first.size();
+    offset += key_and_entry.second.bytes;
+  }
+  for (const auto& key_and_entry : entries_) {
+    written = written && WriteToFile(file, key_and_entry.first.data(),
+                                     key_and_entry.first.size());
+  }
+  static const char kPadding[kWeightCacheFileAlignment] = {};
+  offset = key_offset;
+  for (const auto& key_and_entry : entries_) {
+    const size_t padding = AlignTo(kWeightCacheFileAlignment, offset) - offset;
+    written = written && WriteToFile(file, kPadding, padding) &&
+              WriteToFile(file, key_and_entry.second.data,
+                          key_and_entry.second.bytes);
+    offset += padding + key_and_entry.second.bytes;
+  }
+
+  if (fclose(file) != 0 || !written ||
+      rename(temp_filename.c_str(), filename) != 0) {
+    error_reporter_->Report("Could not write the weight cache to '%s'.",
+                            filename);
+    remove(temp_filename.c_str());
+    return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+bool WeightCache::UseCached(const TfLiteTensor* source, const char* transform,
+                            TfLiteTensor* derived) const {
+  std::string key;
+  if (!GetKey(source, transform, &key)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end() || it->second.bytes != derived->bytes) {
+    return false;
+  }
+  derived->allocation_type = kTfLiteMmapRo;
+  derived->data.raw = const_cast<char*>(it->second.data);
+  return true;
+}
+
+void WeightCache::Add(const TfLiteTensor* source, const char* transform,
+                      const TfLiteTensor* derived) {
+  std::string key;
+  if (!GetKey(source, transform, &key)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (entries_.count(key) != 0) {
+    return;
+  }
+  Entry& entry = entries_[key];
+  entry.added_data.reset(new char[derived->bytes]);
+  memcpy(entry.added_data.get(), derived->data.raw, derived->bytes);
+  entry.data = entry.added_data.get();
+  entry.bytes = derived->bytes;
+  if (registry_) {
+    entry.source = source->data.raw_const;
+  }
+}
+
+void WeightCache::Evict(const char* source) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.source == source) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+bool WeightCache::GetKey(const TfLiteTensor* source, const char* transform,
+                         std::string* key) const {
+  if (source->allocation_type != kTfLiteMmapRo) {
+    return false;
+  }
+  const char* data = source->data.raw_const;
+  uint64_t location;
+  if (registry_) {
+    // The contents at an address known to the registry don't change for as
+    // long as the address is used.
+    if (!registry_->IsInterned(data)) {
+      return false;
+    }
+    location = reinterpret_cast<uintptr_t>(data);
+  } else {
+    // Constant tensors are identified by where they are in the model, which
+    // is the same in every process.
+    if (model_allocation_ == nullptr) {
+      return false;
+    }
+    const char* base = static_cast<const char*>(model_allocation_->base());
+    if (data < base ||
+        data + source->bytes > base + model_allocation_->bytes()) {
+      return false;
+    }
+    location = data - base;
+  }
+
+  key->clear();
+  key->append(transform, strlen(transform) + 1);
+  AppendToKey(location, key);
+  AppendToKey(static_cast<uint64_t>(source->bytes), key);
+  AppendToKey(static_cast<int32_t>(source->type), key);
+  AppendArrayToKey(source->dims, key);
+  AppendToKey(source->params.scale, key);
+  AppendToKey(source->params.zero_point, key);
+  const TfLiteQuantization& quantization = source->quantization;
+  AppendToKey(static_cast<int32_t>(quantization.type), key);
+  if (quantization.params == nullptr) {
+    return true;
+  }
+  if (quantization.type == kTfLiteAffineQuantization) {
+    const auto* params =
+        static_cast<const TfLiteAffineQuantization*>(quantization.params);
+    AppendToKey(params->quantized_dimension, key);
+    AppendArrayToKey(params->scale, key);
+    AppendArrayToKey(params->zero_point, key);
+  } else if (quantization.type == kTfLitePaletteQuantization) {
+    const auto* params =
+        static_cast<const TfLitePaletteQuantization*>(quantization.params);
+    AppendArrayToKey(params->values, key);
+  }
+  return true;
+}
+
+}  // namespace tflite
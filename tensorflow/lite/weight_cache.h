@@ -0,0 +1,133 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_WEIGHT_CACHE_H_
+#define TENSORFLOW_LITE_WEIGHT_CACHE_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <string>
+
+#include "tensorflow/lite/allocation.h"
+#include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/stderr_reporter.h"
+
+namespace tflite {
+
+class WeightRegistry;
+
+// A file of the weights that ops derive from the constant tensors of a model,
+// e.g. the transposed filters of Conv or the dequantized weights of
+// Dequantize. Ops normally compute these once per interpreter into private
+// memory. With a cache, they map the derived weights from the file instead,
+// so all the processes running the same model share the same pages.
+//
+// The cache is a 'kTfLiteWeightCacheContext'-typed external context:
+//
+//  WeightCache cache(model->allocation(), model_hash);
+//  if (cache.Load(cache_filename) != kTfLiteOk) {
+//    // First run: the ops add what they derive to the cache.
+//  }
+//  interpreter->SetExternalContext(kTfLiteWeightCacheContext, &cache);
+//  interpreter->AllocateTensors();
+//  interpreter->Invoke();
+//  cache.Save(cache_filename);
+//
+// The cache must outlive the interpreters using it. It is thread-safe, so it
+// can be shared by interpreters prepared concurrently.
+class WeightCache : public TfLiteExternalContext {
+ public:
+  // `model_allocation` holds the model whose weights are derived. Its
+  // `model_hash` identifies it in the cache files, so a file saved for
+  // another model is never used. To share what is derived from identical
+  // weights across models, use the cache of a WeightRegistry instead.
+  WeightCache(const Allocation* model_allocation, uint64_t model_hash,
+              ErrorReporter* error_reporter = DefaultErrorReporter());
+  ~WeightCache();
+
+  // Returns the cache set on `context`, or nullptr.
+  static WeightCache* FromContext(TfLiteContext* context);
+
+  // Maps the weights saved in `filename`. Must be called before anything is
+  // added, and fails if the file does not exist or is for another model.
+  // Not supported by the cache of a WeightRegistry.
+  TfLiteStatus Load(const char* filename);
+
+  // Writes all the weights in the cache to `filename`, replacing it
+  // atomically so that other processes never load a partial file. Not
+  // supported by the cache of a WeightRegistry.
+  TfLiteStatus Save(const char* filename) const;
+
+  // If the cache holds what `transform` derives from `source`, points
+  // `derived`, already resized by the op, at it and returns true. `derived`
+  // then becomes a read-only tensor and must not be written.
+  bool UseCached(const TfLiteTensor* source, const char* transform,
+                 TfLiteTensor* derived) const;
+
+  // Copies `derived`, computed by `transform` from `source`, into the cache.
+  // Does nothing if `source` is not a constant tensor of the model, or if
+  // the cache already holds it.
+  void Add(const TfLiteTensor* source, const char* transform,
+           const TfLiteTensor* derived);
+
+  // The file mapped by `Load`, e.g. to lock hot weights in memory, or nullptr.
+  const Allocation* allocation() const { return file_.get(); }
+
+ private:
+  friend class WeightRegistry;
+
+  struct Entry {
+    const char* data;
+    size_t bytes;
+    // Set for the entries added since `Load`, which hold their data.
+    std::unique_ptr<char[]> added_data;
+    // The data of the source, for the cache of a WeightRegistry.
+    const char* source = nullptr;
+  };
+
+  // The cache of `registry`. Constant tensors are identified by the address
+  // of their data, which must be known to `registry`.
+  WeightCache(const WeightRegistry* registry, ErrorReporter* error_reporter);
+
+  // Removes what was derived from `source`, before `registry_` forgets it.
+  void Evict(const char* source);
+
+  // Returns false if what is derived from `source` can't be cached, i.e.
+  // when `source` is not a constant tensor stored in the model, or known to
+  // `registry_`. Otherwise `key` identifies `source`, its type, shape and
+  // quantization, and `transform`, in full rather than by a hash, so that
+  // entries never collide.
+  bool GetKey(const TfLiteTensor* source, const char* transform,
+              std::string* key) const;
+
+  const Allocation* model_allocation_;
+  const WeightRegistry* registry_;
+  const uint64_t model_hash_;
+  ErrorReporter* error_reporter_;
+  // Guards the members below.
+  mutable std::mutex mutex_;
+  std::unique_ptr<Allocation> file_;
+  // Ordered so that saved files don't depend on the order of the ops.
+  std::map<std::string, Entry> entries_;
+
+  WeightCache(const WeightCache&) = delete;
+  WeightCache& operator=(const WeightCache&) = delete;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_WEIGHT_CACHE_H_
@@ -0,0 +1,218 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/weight_cache.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/kernels/register.h"
+#include "tensorflow/lite/testing/util.h"
+
+namespace tflite {
+namespace {
+
+std::string WeightCacheFilename() {
+  const char* tmpdir = getenv("TEST_TMPDIR");
+  return std::string(tmpdir ? tmpdir : "/tmp") + "/weight_cache_test";
+}
+
+TfLiteTensor ConstantTensor(const char* data, size_t bytes) {
+  TfLiteTensor tensor;
+  memset(&tensor, 0, sizeof(tensor));
+  tensor.allocation_type = kTfLiteMmapRo;
+  tensor.data.raw = const_cast<char*>(data);
+  tensor.bytes = bytes;
+  return tensor;
+}
+
+TfLiteTensor PersistentTensor(char* data, size_t bytes) {
+  TfLiteTensor tensor;
+  memset(&tensor, 0, sizeof(tensor));
+  tensor.allocation_type = kTfLiteArenaRwPersistent;
+  tensor.data.raw = data;
+  tensor.bytes = bytes;
+  return tensor;
+}
+
+TEST(WeightCache, SaveAndLoad) {
+  const std::string filename = WeightCacheFilename();
+  const uint64_t model_hash = 1234;
+  const std::vector<char> model(64, 1);
+  MemoryAllocation model_allocation(model.data(), model.size(),
+                                    DefaultErrorReporter());
+  const TfLiteTensor source = ConstantTensor(model.data() + 8, 16);
+  const TfLiteTensor other_source = ConstantTensor(model.data() + 24, 16);
+  std::vector<char> derived_data = {1, 2, 3, 4, 5, 6, 7};
+  std::vector<char> other_derived_data = {8, 9, 10};
+  {
+    WeightCache cache(&model_allocation, model_hash);
+    const TfLiteTensor derived =
+        PersistentTensor(derived_data.data(), derived_data.size());
+    const TfLiteTensor other_derived =
+        PersistentTensor(other_derived_data.data(), other_derived_data.size());
+    cache.Add(&source, "transform", &derived);
+    cache.Add(&other_source, "transform", &other_derived);
+    // Derived from a tensor that is not in the model, so not cached.
+    char non_constant_data[16];
+    TfLiteTensor non_constant =
+        PersistentTensor(non_constant_data, sizeof(non_constant_data));
+    cache.Add(&non_constant, "transform", &derived);
+    ASSERT_EQ(cache.Save(filename.c_str()), kTfLiteOk);
+  }
+
+  WeightCache cache(&model_allocation, model_hash);
+  ASSERT_EQ(cache.Load(filename.c_str()), kTfLiteOk);
+  ASSERT_NE(cache.allocation(), nullptr);
+
+  std::vector<char> buffer(derived_data.size());
+  TfLiteTensor derived = PersistentTensor(buffer.data(), buffer.size());
+  ASSERT_TRUE(cache.UseCached(&source, "transform", &derived));
+  EXPECT_EQ(derived.allocation_type, kTfLiteMmapRo);
+  EXPECT_NE(derived.data.raw, buffer.data());
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(derived.data.raw) % 64, 0);
+  EXPECT_EQ(std::vector<char>(derived.data.raw,
+                              derived.data.raw + derived.bytes),
+            derived_data);
+
+  std::vector<char> other_buffer(other_derived_data.size());
+  TfLiteTensor other_derived =
+      PersistentTensor(other_buffer.data(), other_buffer.size());
+  ASSERT_TRUE(cache.UseCached(&other_source, "transform", &other_derived));
+  EXPECT_EQ(std::vector<char>(other_derived.data.raw,
+                              other_derived.data.raw + other_derived.bytes),
+            other_derived_data);
+
+  // Other transforms of the same tensor, or derived tensors of another size,
+  // are not found.
+  TfLiteTensor unknown = PersistentTensor(buffer.data(), buffer.size());
+  EXPECT_FALSE(cache.UseCached(&source, "other transform", &unknown));
+  TfLiteTensor resized = PersistentTensor(buffer.data(), buffer.size() - 1);
+  EXPECT_FALSE(cache.UseCached(&source, "transform", &resized));
+  EXPECT_EQ(resized.allocation_type, kTfLiteArenaRwPersistent);
+
+  // Files saved for another model are not loaded.
+  WeightCache other_model_cache(&model_allocation, model_hash + 1);
+  EXPECT_NE(other_model_cache.Load(filename.c_str()), kTfLiteOk);
+  remove(filename.c_str());
+}
+
+TEST(WeightCache, KeysByTypeShapeAndQuantization) {
+  const std::vector<char> model(64, 1);
+  MemoryAllocation model_allocation(model.data(), model.size(),
+                                    DefaultErrorReporter());
+  std::vector<char> derived_data = {1, 2, 3};
+  const TfLiteTensor derived =
+      PersistentTensor(derived_data.data(), derived_data.size());
+  WeightCache cache(&model_allocation, /*model_hash=*/1);
+  TfLiteTensor source = ConstantTensor(model.data(), 16);
+  source.type = kTfLiteUInt8;
+  TfLiteIntArray* dims = TfLiteIntArrayCreate(2);
+  dims->data[0] = 4;
+  dims->data[1] = 4;
+  source.dims = dims;
+  source.params = {0.5f, 1};
+  cache.Add(&source, "transform", &derived);
+
+  std::vector<char> buffer(derived_data.size());
+  TfLiteTensor same_derived = PersistentTensor(buffer.data(), buffer.size());
+  EXPECT_TRUE(cache.UseCached(&source, "transform", &same_derived));
+
+  // The same bytes of the model, seen as other tensors, are not found.
+  TfLiteTensor other_derived = PersistentTensor(buffer.data(), buffer.size());
+  TfLiteTensor other_type = source;
+  other_type.type = kTfLiteInt8;
+  EXPECT_FALSE(cache.UseCached(&other_type, "transform", &other_derived));
+  TfLiteTensor other_shape = source;
+  TfLiteIntArray* other_dims = TfLiteIntArrayCreate(2);
+  other_dims->data[0] = 2;
+  other_dims->data[1] = 8;
+  other_shape.dims = other_dims;
+  EXPECT_FALSE(cache.UseCached(&other_shape, "transform", &other_derived));
+  TfLiteTensor other_quantization = source;
+  other_quantization.params.scale = 0.25f;
+  EXPECT_FALSE(
+      cache.UseCached(&other_quantization, "transform", &other_derived));
+  TfLiteIntArrayFree(other_dims);
+  TfLiteIntArrayFree(dims);
+}
+
+// Builds a graph that dequantizes a constant tensor stored in `model`.
+void BuildDequantizeGraph(const std::vector<uint8_t>& model,
+                          Interpreter* interpreter) {
+  ASSERT_EQ(interpreter->AddTensors(2), kTfLiteOk);
+  ASSERT_EQ(interpreter->SetInputs({}), kTfLiteOk);
+  ASSERT_EQ(interpreter->SetOutputs({1}), kTfLiteOk);
+  TfLiteQuantizationParams quantization = {0.5f, 1};
+  ASSERT_EQ(interpreter->SetTensorParametersReadOnly(
+                0, kTfLiteUInt8, "weights", {static_cast<int>(model.size())},
+                quantization, reinterpret_cast<const char*>(model.data()),
+                model.size()),
+            kTfLiteOk);
+  ASSERT_EQ(interpreter->SetTensorParametersReadWrite(
+                1, kTfLiteFloat32, "dequantized", {},
+                TfLiteQuantizationParams()),
+            kTfLiteOk);
+  ops::builtin::BuiltinOpResolver resolver;
+  ASSERT_EQ(interpreter->AddNodeWithParameters(
+                {0}, {1}, nullptr, 0, nullptr,
+                resolver.FindOp(BuiltinOperator_DEQUANTIZE, 1)),
+            kTfLiteOk);
+}
+
+TEST(WeightCache, SharesDequantizedWeights) {
+  const std::string filename = WeightCacheFilename();
+  const std::vector<uint8_t> model = {1, 3, 5, 7};
+  MemoryAllocation model_allocation(model.data(), model.size(),
+                                    DefaultErrorReporter());
+  const std::vector<float> expected = {0.0f, 1.0f, 2.0f, 3.0f};
+  {
+    WeightCache cache(&model_allocation, /*model_hash=*/1);
+    Interpreter interpreter;
+    BuildDequantizeGraph(model, &interpreter);
+    interpreter.SetExternalContext(kTfLiteWeightCacheContext, &cache);
+    ASSERT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+    EXPECT_EQ(interpreter.tensor(1)->allocation_type,
+              kTfLiteArenaRwPersistent);
+    ASSERT_EQ(interpreter.Invoke(), kTfLiteOk);
+    ASSERT_EQ(cache.Save(filename.c_str()), kTfLiteOk);
+  }
+
+  WeightCache cache(&model_allocation, /*model_hash=*/1);
+  ASSERT_EQ(cache.Load(filename.c_str()), kTfLiteOk);
+  Interpreter interpreter;
+  BuildDequantizeGraph(model, &interpreter);
+  interpreter.SetExternalContext(kTfLiteWeightCacheContext, &cache);
+  ASSERT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+  // The output is mapped from the cache rather than computed.
+  const TfLiteTensor* output = interpreter.tensor(1);
+  EXPECT_EQ(output->allocation_type, kTfLiteMmapRo);
+  ASSERT_EQ(interpreter.Invoke(), kTfLiteOk);
+  EXPECT_EQ(std::vector<float>(output->data.f, output->data.f + 4), expected);
+  remove(filename.c_str());
+}
+
+}  // namespace
+}  // namespace tflite
+
+int main(int argc, char** argv) {
+  ::tflite::LogToStderr();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
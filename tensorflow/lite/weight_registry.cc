@@ -0,0 +1,116 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/weight_registry.h"
+
+#include <cstring>
+
+#include "tensorflow/lite/util.h"
+
+namespace tflite {
+
+WeightRegistry::WeightRegistry(size_t min_bytes,
+                               ErrorReporter* error_reporter)
+    : min_bytes_(min_bytes), weight_cache_(this, error_reporter) {}
+
+WeightRegistry::~WeightRegistry() {}
+
+const char* WeightRegistry::Intern(const char* data, size_t bytes) {
+  if (bytes < min_bytes_) {
+    return data;
+  }
+  // Hashed without the lock, so that models are loaded concurrently.
+  const uint64_t hash = HashBytes(data, bytes);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto range = entries_.equal_range(hash);
+  bool known = false;
+  for (auto it = range.first; it != range.second; ++it) {
+    Entry& entry = it->second;
+    if (entry.bytes != bytes || memcmp(entry.data, data, bytes) != 0) {
+      continue;
+    }
+    known = true;
+    // The weights of another model may be gone before `data`, so only the
+    // same weights, e.g. of a model built twice, or a copy can be shared.
+    if (entry.data == data || entry.copy) {
+      ++entry.num_references;
+      shared_bytes_ += bytes;
+      return entry.data;
+    }
+  }
+  Entry entry;
+  entry.bytes = bytes;
+  entry.num_references = 1;
+  if (known || hashes_.count(data) != 0) {
+    // The second weights with these contents: copy them once for all the
+    // models that have them from now on. Weights at the address of other
+    // weights, e.g. a prefix of them, are copied too, to tell them apart.
+    entry.copy.reset(new char[bytes]);
+    memcpy(entry.copy.get(), data, bytes);
+    entry.data = entry.copy.get();
+    stored_bytes_ += bytes;
+  } else {
+    entry.data = data;
+  }
+  const char* interned = entry.data;
+  entries_.emplace(hash, std::move(entry));
+  hashes_[interned] = hash;
+  return interned;
+}
+
+void WeightRegistry::Release(const char* interned) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto hash = hashes_.find(interned);
+  if (hash == hashes_.end()) {
+    return;
+  }
+  auto range = entries_.equal_range(hash->second);
+  for (auto it = range.first; it != range.second; ++it) {
+    Entry& entry = it->second;
+    if (entry.data != interned) {
+      continue;
+    }
+    if (--entry.num_references > 0) {
+      shared_bytes_ -= entry.bytes;
+      return;
+    }
+    // Nothing uses the weights anymore, so nothing can look up what was
+    // derived from them before their address is reused.
+    weight_cache_.Evict(interned);
+    if (entry.copy) {
+      stored_bytes_ -= entry.bytes;
+    }
+    hashes_.erase(hash);
+    entries_.erase(it);
+    return;
+  }
+}
+
+bool WeightRegistry::IsInterned(const char* data) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hashes_.count(data) != 0;
+}
+
+size_t WeightRegistry::stored_bytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stored_bytes_;
+}
+
+size_t WeightRegistry::shared_bytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return shared_bytes_;
+}
+
+}  // namespace tflite
@@ -0,0 +1,117 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_WEIGHT_REGISTRY_H_
+#define TENSORFLOW_LITE_WEIGHT_REGISTRY_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <unordered_map>
+
+#include "tensorflow/lite/weight_cache.h"
+
+namespace tflite {
+
+// A store of the constant weights of several models, keyed by their
+// contents, so that the weights the models have in common are kept once.
+// This is meant for models fine-tuned from the same backbone and loaded in
+// the same process:
+//
+//  WeightRegistry registry;
+//  for (int i = 0; i < models.size(); ++i) {
+//    InterpreterBuilder builder(*models[i], resolver);
+//    builder.SetWeightRegistry(&registry);
+//    builder(&interpreters[i]);
+//  }
+//
+// Weights are not copied until they are found in another model: the first
+// model with some weights keeps using them in place, e.g. in its mapped file,
+// and the registry only records where they are. The models loaded after it
+// with the same weights share a single copy of them, held by the registry,
+// and the pages of their own weights can be reclaimed by the system. So
+// weights found in a single model take no more memory than without the
+// registry. The registry also has a weight cache, set on the interpreters,
+// keyed by the address of the weights it knows, so that what ops derive from
+// identical weights, e.g. transposed filters, is kept once per address too.
+//
+// The weights are reference counted: the interpreters release theirs when
+// they are destroyed, and the registry forgets them, freeing its copy along
+// with what was derived from them, once no interpreter uses them. The
+// registry must outlive the interpreters using it. It is thread-safe.
+class WeightRegistry {
+ public:
+  // Buffers smaller than `min_bytes` are left in their model, as sharing
+  // them would save less than the bookkeeping costs.
+  explicit WeightRegistry(
+      size_t min_bytes = 1024,
+      ErrorReporter* error_reporter = DefaultErrorReporter());
+  ~WeightRegistry();
+
+  // Returns the weights to use for the `bytes` bytes at `data`, which must
+  // stay valid until released, and takes a reference to them that must be
+  // given back with `Release`. These are `data` itself if the registry knows
+  // no other weights with the same contents, and a copy held by the registry
+  // otherwise. Returns `data` without taking a reference if `bytes` is less
+  // than `min_bytes`.
+  const char* Intern(const char* data, size_t bytes);
+
+  // Gives back a reference taken by `Intern`, which returned `interned`.
+  // Forgets the weights, and frees them if they are a copy, once they have
+  // no references left. Does nothing if `interned` was not returned by
+  // `Intern` with a reference.
+  void Release(const char* interned);
+
+  // Whether `data` was returned by `Intern` with a reference that is not
+  // released yet.
+  bool IsInterned(const char* data) const;
+
+  // The cache of the weights derived from the weights of the models.
+  WeightCache* weight_cache() { return &weight_cache_; }
+
+  // The number of bytes of weights copied into the registry.
+  size_t stored_bytes() const;
+
+  // The number of bytes of weights found in the registry, i.e. that would
+  // otherwise be kept once more.
+  size_t shared_bytes() const;
+
+ private:
+  struct Entry {
+    const char* data;
+    size_t bytes;
+    int num_references;
+    // Set if `data` is a copy held by the registry, rather than the weights
+    // of the model that had them first.
+    std::unique_ptr<char[]> copy;
+  };
+
+  const size_t min_bytes_;
+  WeightCache weight_cache_;
+  // Guards the members below.
+  mutable std::mutex mutex_;
+  // Keyed by the hash of the weights.
+  std::unordered_multimap<uint64_t, Entry> entries_;
+  // The hash of the weights at each address, to find their entry.
+  std::unordered_map<const char*, uint64_t> hashes_;
+  size_t stored_bytes_ = 0;
+  size_t shared_bytes_ = 0;
+
+  WeightRegistry(const WeightRegistry&) = delete;
+  WeightRegistry& operator=(const WeightRegistry&) = delete;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_WEIGHT_REGISTRY_H_
@@ -0,0 +1,234 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/weight_registry.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "tensorflow/lite/c/c_api_internal.h"
+#include "tensorflow/lite/kernels/register.h"
+#include "tensorflow/lite/model.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/testing/util.h"
+#include "tensorflow/lite/version.h"
+
+namespace tflite {
+namespace {
+
+TEST(WeightRegistry, InternsByContents) {
+  WeightRegistry registry(/*min_bytes=*/4);
+  const std::vector<char> weights = {1, 2, 3, 4, 5};
+  const std::vector<char> same_weights = weights;
+  const std::vector<char> more_same_weights = weights;
+  const std::vector<char> other_weights = {1, 2, 3, 4, 6};
+
+  // The first weights with some contents are used in place.
+  EXPECT_EQ(registry.Intern(weights.data(), weights.size()), weights.data());
+  EXPECT_EQ(registry.Intern(weights.data(), weights.size()), weights.data());
+  EXPECT_EQ(registry.Intern(other_weights.data(), other_weights.size()),
+            other_weights.data());
+  EXPECT_EQ(registry.stored_bytes(), 0);
+  EXPECT_EQ(registry.shared_bytes(), 5);
+
+  // The next ones share a copy.
+  const char* copy = registry.Intern(same_weights.data(), same_weights.size());
+  EXPECT_NE(copy, weights.data());
+  EXPECT_NE(copy, same_weights.data());
+  EXPECT_EQ(std::vector<char>(copy, copy + weights.size()), weights);
+  EXPECT_EQ(
+      registry.Intern(more_same_weights.data(), more_same_weights.size()),
+      copy);
+  // A prefix of known weights is other weights, at the same address.
+  EXPECT_NE(registry.Intern(weights.data(), 4), weights.data());
+  EXPECT_EQ(registry.stored_bytes(), 9);
+  EXPECT_EQ(registry.shared_bytes(), 10);
+
+  // Small buffers are left as they are.
+  EXPECT_EQ(registry.Intern(weights.data() + 1, 3), weights.data() + 1);
+  EXPECT_FALSE(registry.IsInterned(weights.data() + 1));
+  EXPECT_TRUE(registry.IsInterned(weights.data()));
+  EXPECT_TRUE(registry.IsInterned(copy));
+
+  // Weights are forgotten, and copies freed, once all their references are
+  // released.
+  registry.Release(weights.data());
+  EXPECT_TRUE(registry.IsInterned(weights.data()));
+  registry.Release(weights.data());
+  EXPECT_FALSE(registry.IsInterned(weights.data()));
+  EXPECT_EQ(registry.shared_bytes(), 5);
+  registry.Release(copy);
+  registry.Release(copy);
+  EXPECT_FALSE(registry.IsInterned(copy));
+  EXPECT_EQ(registry.stored_bytes(), 4);
+  EXPECT_EQ(registry.shared_bytes(), 0);
+  // The next weights with the contents of forgotten ones are used in place.
+  EXPECT_EQ(registry.Intern(same_weights.data(), same_weights.size()),
+            same_weights.data());
+}
+
+TfLiteTensor ConstantTensor(const char* data, size_t bytes) {
+  TfLiteTensor tensor;
+  memset(&tensor, 0, sizeof(tensor));
+  tensor.allocation_type = kTfLiteMmapRo;
+  tensor.data.raw = const_cast<char*>(data);
+  tensor.bytes = bytes;
+  return tensor;
+}
+
+TEST(WeightRegistry, CachesByInternedWeights) {
+  WeightRegistry registry(/*min_bytes=*/4);
+  WeightCache* cache = registry.weight_cache();
+  const std::vector<char> weights(16, 1);
+  const std::vector<char> same_weights = weights;
+  const char* interned = registry.Intern(weights.data(), weights.size());
+  ASSERT_EQ(registry.Intern(weights.data(), weights.size()), interned);
+  std::vector<char> derived_data = {1, 2, 3};
+  TfLiteTensor derived;
+  memset(&derived, 0, sizeof(derived));
+  derived.allocation_type = kTfLiteArenaRwPersistent;
+  derived.data.raw = derived_data.data();
+  derived.bytes = derived_data.size();
+  const TfLiteTensor source = ConstantTensor(interned, weights.size());
+  cache->Add(&source, "transform", &derived);
+
+  std::vector<char> buffer(derived_data.size());
+  TfLiteTensor cached = derived;
+  cached.data.raw = buffer.data();
+  ASSERT_TRUE(cache->UseCached(&source, "transform", &cached));
+  EXPECT_EQ(std::vector<char>(cached.data.raw, cached.data.raw + cached.bytes),
+            derived_data);
+
+  // Weights that are not in the registry are not cached, whatever their
+  // contents.
+  const TfLiteTensor other_source =
+      ConstantTensor(same_weights.data(), same_weights.size());
+  cache->Add(&other_source, "transform", &derived);
+  cached.data.raw = buffer.data();
+  EXPECT_FALSE(cache->UseCached(&other_source, "transform", &cached));
+
+  // Nor are the weights of the registry once released.
+  registry.Release(interned);
+  EXPECT_TRUE(cache->UseCached(&source, "transform", &cached));
+  registry.Release(interned);
+  const char* reinterned = registry.Intern(weights.data(), weights.size());
+  cached.data.raw = buffer.data();
+  const TfLiteTensor new_source = ConstantTensor(reinterned, weights.size());
+  EXPECT_FALSE(cache->UseCached(&new_source, "transform", &cached));
+  registry.Release(reinterned);
+
+  // The cache is only valid in this process.
+  EXPECT_NE(cache->Save("unused"), kTfLiteOk);
+}
+
+constexpr int kNumWeights = 512;
+
+// Builds a model that adds `weights` to its input.
+void BuildAddModel(const std::vector<float>& weights,
+                   flatbuffers::FlatBufferBuilder* builder) {
+  const std::vector<uint8_t> data(
+      reinterpret_cast<const uint8_t*>(weights.data()),
+      reinterpret_cast<const uint8_t*>(weights.data() + weights.size()));
+  const std::vector<flatbuffers::Offset<Buffer>> buffers = {
+      CreateBuffer(*builder), CreateBufferDirect(*builder, &data)};
+  const std::vector<int32_t> shape = {1, kNumWeights};
+  const std::vector<flatbuffers::Offset<Tensor>> tensors = {
+      CreateTensorDirect(*builder, &shape, TensorType_FLOAT32, 0, "input"),
+      CreateTensorDirect(*builder, &shape, TensorType_FLOAT32, 1, "weights"),
+      CreateTensorDirect(*builder, &shape, TensorType_FLOAT32, 0, "output")};
+  const std::vector<int32_t> op_inputs = {0, 1};
+  const std::vector<int32_t> op_outputs = {2};
+  const std::vector<flatbuffers::Offset<Operator>> operators = {
+      CreateOperatorDirect(*builder, 0, &op_inputs, &op_outputs,
+                           BuiltinOptions_AddOptions,
+                           CreateAddOptions(*builder).Union())};
+  const std::vector<int32_t> subgraph_inputs = {0};
+  const std::vector<int32_t> subgraph_outputs = {2};
+  const std::vector<flatbuffers::Offset<SubGraph>> subgraphs = {
+      CreateSubGraphDirect(*builder, &tensors, &subgraph_inputs,
+                           &subgraph_outputs, &operators)};
+  const std::vector<flatbuffers::Offset<OperatorCode>> operator_codes = {
+      CreateOperatorCode(*builder, BuiltinOperator_ADD)};
+  FinishModelBuffer(*builder, CreateModelDirect(*builder, TFLITE_SCHEMA_VERSION,
+                                                &operator_codes, &subgraphs,
+                                                nullptr, &buffers));
+}
+
+TEST(WeightRegistry, SharesWeightsAcrossModels) {
+  const std::vector<float> weights(kNumWeights, 1.0f);
+  const std::vector<float> other_weights(kNumWeights, 2.0f);
+  constexpr int kNumModels = 4;
+  flatbuffers::FlatBufferBuilder builders[kNumModels];
+  BuildAddModel(weights, &builders[0]);
+  BuildAddModel(weights, &builders[1]);
+  BuildAddModel(weights, &builders[2]);
+  BuildAddModel(other_weights, &builders[3]);
+
+  WeightRegistry registry;
+  ops::builtin::BuiltinOpResolver resolver;
+  std::unique_ptr<FlatBufferModel> models[kNumModels];
+  std::unique_ptr<Interpreter> interpreters[kNumModels];
+  const char* model_weights[kNumModels];
+  for (int i = 0; i < kNumModels; ++i) {
+    models[i] = FlatBufferModel::BuildFromBuffer(
+        reinterpret_cast<const char*>(builders[i].GetBufferPointer()),
+        builders[i].GetSize());
+    ASSERT_TRUE(models[i]);
+    model_weights[i] = reinterpret_cast<const char*>(
+        models[i]->GetModel()->buffers()->Get(1)->data()->data());
+    InterpreterBuilder builder(*models[i], resolver);
+    builder.SetWeightRegistry(&registry);
+    ASSERT_EQ(builder(&interpreters[i]), kTfLiteOk);
+  }
+
+  // The weights found in a single model so far are used in place, and the
+  // others share a copy.
+  EXPECT_EQ(interpreters[0]->tensor(1)->data.raw_const, model_weights[0]);
+  EXPECT_NE(interpreters[1]->tensor(1)->data.raw_const, model_weights[1]);
+  EXPECT_EQ(interpreters[1]->tensor(1)->data.raw,
+            interpreters[2]->tensor(1)->data.raw);
+  EXPECT_EQ(interpreters[3]->tensor(1)->data.raw_const, model_weights[3]);
+  EXPECT_EQ(registry.stored_bytes(), kNumWeights * sizeof(float));
+  EXPECT_EQ(registry.shared_bytes(), kNumWeights * sizeof(float));
+
+  for (int i = 0; i < kNumModels; ++i) {
+    Interpreter* interpreter = interpreters[i].get();
+    ASSERT_EQ(interpreter->AllocateTensors(), kTfLiteOk);
+    float* input = interpreter->typed_input_tensor<float>(0);
+    std::fill(input, input + kNumWeights, 1.0f);
+    ASSERT_EQ(interpreter->Invoke(), kTfLiteOk);
+    EXPECT_EQ(interpreter->typed_output_tensor<float>(0)[kNumWeights - 1],
+              i == 3 ? 3.0f : 2.0f);
+  }
+
+  // The copy is kept until no interpreter uses it.
+  interpreters[0].reset();
+  interpreters[1].reset();
+  EXPECT_EQ(registry.stored_bytes(), kNumWeights * sizeof(float));
+  EXPECT_EQ(registry.shared_bytes(), 0);
+  interpreters[2].reset();
+  EXPECT_EQ(registry.stored_bytes(), 0);
+  interpreters[3].reset();
+}
+
+}  // namespace
+}  // namespace tflite
+
+int main(int argc, char** argv) {
+  ::tflite::LogToStderr();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}